@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <random>
+
+#include "bench.h"
+#include "simd/simd.h"
+#include "storage/chunk_helper.h"
+#include "storage/column_predicate.h"
+
+namespace starrocks {
+
+// ColumnPredicate evaluation over one chunk of kTestChunkSize rows, parameterized by
+// selectivity (percent of rows the predicate keeps), column nullability and the evaluate
+// flavor (plain / and / or), which take different SIMD paths.
+//
+// Args: {selectivity_pct, nullable, flavor}
+//
+// Run with --benchmark_format=json --benchmark_out=<file> to record a baseline that can be
+// diffed against a later build with benchmark's compare.py.
+
+enum EvaluateFlavor : int64_t { kEvaluate = 0, kEvaluateAnd = 1, kEvaluateOr = 2 };
+
+static void do_benchmark_evaluate(benchmark::State& state, int64_t selectivity_pct, bool nullable,
+                                  EvaluateFlavor flavor) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> value_dist(0, 99);
+
+    auto column = ChunkHelper::column_from_field_type(TYPE_INT, nullable);
+    column->reserve(kTestChunkSize);
+    for (int i = 0; i < kTestChunkSize; i++) {
+        column->append_datum(Datum(value_dist(rng)));
+    }
+
+    // values are uniform in [0, 100), so "< selectivity_pct" keeps selectivity_pct percent
+    std::unique_ptr<ColumnPredicate> pred(
+            new_column_lt_predicate(get_type_info(TYPE_INT), 0, std::to_string(selectivity_pct)));
+
+    std::vector<uint8_t> selection(kTestChunkSize);
+    for (auto _ : state) {
+        switch (flavor) {
+        case kEvaluate:
+            CHECK(pred->evaluate(column.get(), selection.data(), 0, kTestChunkSize).ok());
+            break;
+        case kEvaluateAnd:
+            selection.assign(kTestChunkSize, 1);
+            CHECK(pred->evaluate_and(column.get(), selection.data(), 0, kTestChunkSize).ok());
+            break;
+        case kEvaluateOr:
+            selection.assign(kTestChunkSize, 0);
+            CHECK(pred->evaluate_or(column.get(), selection.data(), 0, kTestChunkSize).ok());
+            break;
+        }
+        benchmark::DoNotOptimize(selection.data());
+    }
+    state.SetItemsProcessed(state.iterations() * kTestChunkSize);
+    state.counters["selected_rows"] = SIMD::count_nonzero(selection.data(), kTestChunkSize);
+}
+
+static void Benchmark_ColumnPredicate_Evaluate(benchmark::State& state) {
+    do_benchmark_evaluate(state, state.range(0), state.range(1) != 0, static_cast<EvaluateFlavor>(state.range(2)));
+}
+
+static void ColumnPredicateArgs(benchmark::internal::Benchmark* b) {
+    std::vector<int64_t> bm_selectivities = {1, 10, 50, 90, 100};
+    std::vector<int64_t> bm_nullables = {0, 1};
+    std::vector<int64_t> bm_flavors = {kEvaluate, kEvaluateAnd, kEvaluateOr};
+    for (auto& selectivity : bm_selectivities) {
+        for (auto& bm_nullable : bm_nullables) {
+            for (auto& flavor : bm_flavors) {
+                b->Args({selectivity, bm_nullable, flavor});
+            }
+        }
+    }
+}
+
+BENCHMARK(Benchmark_ColumnPredicate_Evaluate)->Apply(ColumnPredicateArgs);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
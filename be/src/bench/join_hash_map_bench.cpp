@@ -0,0 +1,191 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+#include <random>
+
+#include "bench.h"
+#include "column/column_helper.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "exec/join_hash_map.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/runtime_state.h"
+
+namespace starrocks {
+
+// Probe-side benchmark of JoinHashTable, parameterized by build table size (build keys are
+// unique, so this is also the NDV), probe hit rate and key type. Build runs once outside the
+// timed loop; each iteration probes one chunk of kTestChunkSize rows.
+//
+// Args: {build_rows, hit_rate_pct, key_is_varchar}
+//
+// Run with --benchmark_format=json --benchmark_out=<file> to record a baseline that can be
+// diffed against a later build with benchmark's compare.py.
+
+static TSlotDescriptor create_slot_descriptor(const std::string& column_name, LogicalType column_type,
+                                              int32_t column_pos) {
+    TSlotDescriptorBuilder slot_desc_builder;
+    if (column_type == LogicalType::TYPE_VARCHAR) {
+        return slot_desc_builder.string_type(255)
+                .column_name(column_name)
+                .column_pos(column_pos)
+                .nullable(false)
+                .build();
+    }
+    return slot_desc_builder.type(column_type).column_name(column_name).column_pos(column_pos).nullable(false).build();
+}
+
+static void add_tuple_descriptor(TDescriptorTableBuilder* table_desc_builder, LogicalType key_type) {
+    TTupleDescriptorBuilder tuple_desc_builder;
+    tuple_desc_builder.add_slot(create_slot_descriptor("c0", key_type, 0));
+    tuple_desc_builder.add_slot(create_slot_descriptor("c1", LogicalType::TYPE_INT, 1));
+    tuple_desc_builder.build(table_desc_builder);
+}
+
+static std::shared_ptr<RuntimeState> create_runtime_state() {
+    TUniqueId fragment_id;
+    TQueryOptions query_options;
+    query_options.batch_size = config::vector_chunk_size;
+    TQueryGlobals query_globals;
+    auto runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+    runtime_state->init_instance_mem_tracker();
+    return runtime_state;
+}
+
+// build keys are 0..num_rows-1, probe keys are drawn so that hit_rate_pct percent of them
+// fall inside the build key range.
+static ColumnPtr create_key_column(LogicalType key_type, int64_t num_rows, int64_t key_range, int64_t hit_rate_pct) {
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int64_t> key_dist(0, key_range - 1);
+    std::uniform_int_distribution<int64_t> hit_dist(0, 99);
+
+    auto column = ColumnHelper::create_column(TypeDescriptor::from_logical_type(key_type), false);
+    column->reserve(num_rows);
+    for (int64_t i = 0; i < num_rows; i++) {
+        int64_t key = key_dist(rng);
+        if (hit_dist(rng) >= hit_rate_pct) {
+            key += key_range; // miss: shift out of the build key range
+        }
+        if (key_type == LogicalType::TYPE_VARCHAR) {
+            auto s = std::to_string(key);
+            column->append_datum(Datum(Slice(s)));
+        } else {
+            column->append_datum(Datum(static_cast<int32_t>(key)));
+        }
+    }
+    return column;
+}
+
+static ColumnPtr create_build_key_column(LogicalType key_type, int64_t num_rows) {
+    auto column = ColumnHelper::create_column(TypeDescriptor::from_logical_type(key_type), false);
+    column->reserve(num_rows);
+    for (int64_t i = 0; i < num_rows; i++) {
+        if (key_type == LogicalType::TYPE_VARCHAR) {
+            auto s = std::to_string(i);
+            column->append_datum(Datum(Slice(s)));
+        } else {
+            column->append_datum(Datum(static_cast<int32_t>(i)));
+        }
+    }
+    return column;
+}
+
+static void do_benchmark_probe(benchmark::State& state, LogicalType key_type, int64_t build_rows,
+                               int64_t hit_rate_pct) {
+    auto object_pool = std::make_shared<ObjectPool>();
+    auto runtime_state = create_runtime_state();
+    auto runtime_profile = std::make_shared<RuntimeProfile>("JoinHashMapBench");
+    auto key_type_desc = TypeDescriptor::from_logical_type(key_type);
+
+    TDescriptorTableBuilder table_desc_builder;
+    add_tuple_descriptor(&table_desc_builder, key_type); // tuple 0: probe, slots {0, 1}
+    add_tuple_descriptor(&table_desc_builder, key_type); // tuple 1: build, slots {2, 3}
+    DescriptorTbl* tbl = nullptr;
+    CHECK(DescriptorTbl::create(runtime_state.get(), object_pool.get(), table_desc_builder.desc_tbl(), &tbl,
+                                config::vector_chunk_size)
+                  .ok());
+    RowDescriptor probe_row_desc(*tbl, std::vector<TTupleId>{0});
+    RowDescriptor build_row_desc(*tbl, std::vector<TTupleId>{1});
+
+    HashTableParam param;
+    param.with_other_conjunct = false;
+    param.join_type = TJoinOp::INNER_JOIN;
+    param.search_ht_timer = ADD_TIMER(runtime_profile, "SearchHashTableTime");
+    param.output_build_column_timer = ADD_TIMER(runtime_profile, "OutputBuildColumnTime");
+    param.output_probe_column_timer = ADD_TIMER(runtime_profile, "OutputProbeColumnTime");
+    param.probe_output_slots = {0, 1};
+    param.build_output_slots = {2, 3};
+    param.join_keys.emplace_back(JoinKeyDesc{&key_type_desc, false, nullptr});
+    param.probe_row_desc = &probe_row_desc;
+    param.build_row_desc = &build_row_desc;
+
+    JoinHashTable hash_table;
+    hash_table.create(param);
+
+    auto build_chunk = std::make_shared<Chunk>();
+    build_chunk->append_column(create_build_key_column(key_type, build_rows), 2);
+    build_chunk->append_column(
+            Bench::create_series_column(TypeDescriptor::from_logical_type(TYPE_INT), build_rows, false), 3);
+    Columns build_key_columns{build_chunk->columns()[0]};
+    hash_table.append_chunk(build_chunk, build_key_columns);
+    CHECK(hash_table.build(runtime_state.get()).ok());
+
+    const int64_t probe_rows = kTestChunkSize;
+    auto probe_chunk = std::make_shared<Chunk>();
+    probe_chunk->append_column(create_key_column(key_type, probe_rows, build_rows, hit_rate_pct), 0);
+    probe_chunk->append_column(
+            Bench::create_series_column(TypeDescriptor::from_logical_type(TYPE_INT), probe_rows, false), 1);
+
+    for (auto _ : state) {
+        Columns probe_key_columns{probe_chunk->columns()[0]};
+        ChunkPtr result_chunk = std::make_shared<Chunk>();
+        bool eos = false;
+        CHECK(hash_table.probe(runtime_state.get(), probe_key_columns, &probe_chunk, &result_chunk, &eos).ok());
+        benchmark::DoNotOptimize(result_chunk);
+    }
+    state.SetItemsProcessed(state.iterations() * probe_rows);
+    state.counters["build_rows"] = build_rows;
+
+    hash_table.close();
+}
+
+static void Benchmark_JoinHashMap_Probe(benchmark::State& state) {
+    auto build_rows = state.range(0);
+    auto hit_rate_pct = state.range(1);
+    auto key_type = state.range(2) == 0 ? LogicalType::TYPE_INT : LogicalType::TYPE_VARCHAR;
+    do_benchmark_probe(state, key_type, build_rows, hit_rate_pct);
+}
+
+static void JoinHashMapProbeArgs(benchmark::internal::Benchmark* b) {
+    std::vector<int64_t> bm_build_rows = {4096, 1 << 20, 1 << 24};
+    std::vector<int64_t> bm_hit_rates = {0, 50, 100};
+    std::vector<int64_t> bm_key_types = {0, 1}; // 0: int, 1: varchar
+    for (auto& build_rows : bm_build_rows) {
+        for (auto& hit_rate : bm_hit_rates) {
+            for (auto& key_type : bm_key_types) {
+                b->Args({build_rows, hit_rate, key_type});
+            }
+        }
+    }
+}
+
+BENCHMARK(Benchmark_JoinHashMap_Probe)->Apply(JoinHashMapProbeArgs);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
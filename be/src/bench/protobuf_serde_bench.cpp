@@ -0,0 +1,121 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <glog/logging.h>
+
+#include <memory>
+
+#include "bench.h"
+#include "common/config.h"
+#include "common/object_pool.h"
+#include "runtime/descriptor_helper.h"
+#include "runtime/descriptors.h"
+#include "runtime/runtime_state.h"
+#include "serde/protobuf_serde.h"
+
+namespace starrocks {
+
+// Serialize/deserialize roundtrip of one chunk through ProtobufChunkSerde, the path every
+// exchange takes. Parameterized by the column mix of the chunk so wide-int, wide-varchar and
+// mixed schemas are all covered.
+//
+// Args: {num_int_columns, num_varchar_columns, nullable}
+//
+// Run with --benchmark_format=json --benchmark_out=<file> to record a baseline that can be
+// diffed against a later build with benchmark's compare.py.
+
+static std::shared_ptr<RuntimeState> create_runtime_state() {
+    TUniqueId fragment_id;
+    TQueryOptions query_options;
+    query_options.batch_size = config::vector_chunk_size;
+    TQueryGlobals query_globals;
+    auto runtime_state = std::make_shared<RuntimeState>(fragment_id, query_options, query_globals, nullptr);
+    runtime_state->init_instance_mem_tracker();
+    return runtime_state;
+}
+
+static void do_benchmark_roundtrip(benchmark::State& state, int64_t num_int_columns, int64_t num_varchar_columns,
+                                   bool nullable) {
+    auto object_pool = std::make_shared<ObjectPool>();
+    auto runtime_state = create_runtime_state();
+
+    TDescriptorTableBuilder table_desc_builder;
+    TTupleDescriptorBuilder tuple_desc_builder;
+    auto chunk = std::make_shared<Chunk>();
+    SlotId slot_id = 0;
+    for (int64_t i = 0; i < num_int_columns; i++, slot_id++) {
+        tuple_desc_builder.add_slot(TSlotDescriptorBuilder()
+                                            .type(TYPE_INT)
+                                            .column_name("c" + std::to_string(slot_id))
+                                            .column_pos(slot_id)
+                                            .nullable(nullable)
+                                            .build());
+        chunk->append_column(
+                Bench::create_random_column(TypeDescriptor(TYPE_INT), kTestChunkSize, false, nullable),
+                slot_id);
+    }
+    for (int64_t i = 0; i < num_varchar_columns; i++, slot_id++) {
+        tuple_desc_builder.add_slot(TSlotDescriptorBuilder()
+                                            .string_type(255)
+                                            .column_name("c" + std::to_string(slot_id))
+                                            .column_pos(slot_id)
+                                            .nullable(nullable)
+                                            .build());
+        chunk->append_column(
+                Bench::create_random_column(TypeDescriptor::create_varchar_type(255), kTestChunkSize, false,
+                                            nullable),
+                slot_id);
+    }
+    tuple_desc_builder.build(&table_desc_builder);
+    DescriptorTbl* tbl = nullptr;
+    CHECK(DescriptorTbl::create(runtime_state.get(), object_pool.get(), table_desc_builder.desc_tbl(), &tbl,
+                                config::vector_chunk_size)
+                  .ok());
+    RowDescriptor row_desc(*tbl, std::vector<TTupleId>{0});
+
+    int64_t serialized_bytes = 0;
+    for (auto _ : state) {
+        auto chunk_pb = serde::ProtobufChunkSerde::serialize(*chunk);
+        CHECK(chunk_pb.ok());
+        serialized_bytes = chunk_pb->data().size();
+        auto deserialized = serde::ProtobufChunkSerde::deserialize(row_desc, *chunk_pb);
+        CHECK(deserialized.ok());
+        benchmark::DoNotOptimize(deserialized.value());
+    }
+    state.SetItemsProcessed(state.iterations() * kTestChunkSize);
+    state.SetBytesProcessed(state.iterations() * serialized_bytes);
+    state.counters["serialized_bytes"] = serialized_bytes;
+}
+
+static void Benchmark_ProtobufSerde_Roundtrip(benchmark::State& state) {
+    do_benchmark_roundtrip(state, state.range(0), state.range(1), state.range(2) != 0);
+}
+
+static void ProtobufSerdeArgs(benchmark::internal::Benchmark* b) {
+    // column mixes: all-int, all-varchar and a mixed schema, not-null and nullable
+    std::vector<std::pair<int64_t, int64_t>> bm_column_mixes = {{16, 0}, {0, 16}, {8, 8}, {64, 0}, {32, 32}};
+    std::vector<int64_t> bm_nullables = {0, 1};
+    for (auto& [num_int, num_varchar] : bm_column_mixes) {
+        for (auto& bm_nullable : bm_nullables) {
+            b->Args({num_int, num_varchar, bm_nullable});
+        }
+    }
+}
+
+BENCHMARK(Benchmark_ProtobufSerde_Roundtrip)->Apply(ProtobufSerdeArgs);
+
+} // namespace starrocks
+
+BENCHMARK_MAIN();
@@ -24,6 +24,7 @@
 #ifdef WITH_STARCACHE
 #include "block_cache/starcache_wrapper.h"
 #endif
+#include "block_cache/cache_admission_policy.h"
 #include "common/config.h"
 #include "common/logging.h"
 #include "common/statusor.h"
@@ -70,6 +71,11 @@ Status BlockCache::init(const CacheOptions& options) {
         return Status::NotSupported("unsupported block cache engine");
     }
     RETURN_IF_ERROR(_kv_cache->init(cache_options));
+    if (config::datacache_frequency_admission_enable) {
+        _admission_policy = std::make_unique<CacheAdmissionPolicy>(config::datacache_admission_sketch_bytes);
+        LOG(INFO) << "init datacache frequency based admission, sketch bytes: "
+                  << config::datacache_admission_sketch_bytes;
+    }
     _initialized.store(true, std::memory_order_relaxed);
     if (_disk_space_monitor) {
         _disk_space_monitor->start();
@@ -89,6 +95,11 @@ Status BlockCache::write_buffer(const CacheKey& cache_key, off_t offset, const I
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if (_admission_policy != nullptr && !_admission_policy->should_admit(block_key)) {
+        // the block has not proven itself hot enough yet, skip caching it so one-off
+        // scans cannot evict the resident working set
+        return Status::OK();
+    }
     return _kv_cache->write_buffer(block_key, buffer, options);
 }
 
@@ -121,6 +132,9 @@ Status BlockCache::read_buffer(const CacheKey& cache_key, off_t offset, size_t s
 
     size_t index = offset / _block_size;
     std::string block_key = fmt::format("{}/{}", cache_key, index);
+    if (_admission_policy != nullptr) {
+        _admission_policy->record_access(block_key);
+    }
     return _kv_cache->read_buffer(block_key, offset - index * _block_size, size, buffer, options);
 }
 
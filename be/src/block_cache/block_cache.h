@@ -22,6 +22,8 @@
 
 namespace starrocks {
 
+class CacheAdmissionPolicy;
+
 class BlockCache {
 public:
     using CacheKey = std::string;
@@ -96,6 +98,7 @@ private:
     size_t _block_size = 0;
     std::unique_ptr<KvCache> _kv_cache;
     std::unique_ptr<DiskSpaceMonitor> _disk_space_monitor;
+    std::unique_ptr<CacheAdmissionPolicy> _admission_policy;
     std::atomic<bool> _initialized = false;
 };
 
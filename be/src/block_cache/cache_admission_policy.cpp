@@ -0,0 +1,80 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_admission_policy.h"
+
+#include <algorithm>
+
+#include "util/hash_util.hpp"
+
+namespace starrocks {
+
+CacheAdmissionPolicy::CacheAdmissionPolicy(size_t sketch_bytes) {
+    _width = std::max<size_t>(1024, sketch_bytes / kDepth);
+    // value-initialized, so all counters start at zero
+    _counters = std::vector<std::atomic<uint8_t>>(_width * kDepth);
+    // age once the window has seen about one access per counter: frequencies
+    // follow the recent past instead of accumulating forever, and the collision
+    // noise floor stays below the admission threshold
+    _sample_period = _width;
+}
+
+size_t CacheAdmissionPolicy::_slot(size_t row, uint64_t hash) const {
+    // derive one index per row from two independent halves of the hash
+    uint64_t h = static_cast<uint32_t>(hash) + row * (hash >> 32);
+    return row * _width + h % _width;
+}
+
+uint8_t CacheAdmissionPolicy::_estimate(uint64_t hash) const {
+    uint8_t freq = kMaxCount;
+    for (size_t row = 0; row < kDepth; row++) {
+        freq = std::min(freq, _counters[_slot(row, hash)].load(std::memory_order_relaxed));
+    }
+    return freq;
+}
+
+void CacheAdmissionPolicy::record_access(std::string_view key) {
+    uint64_t hash = HashUtil::hash64(key.data(), key.size(), 0);
+    for (size_t row = 0; row < kDepth; row++) {
+        auto& counter = _counters[_slot(row, hash)];
+        uint8_t count = counter.load(std::memory_order_relaxed);
+        // saturating increment, racing updates may lose an increment which is
+        // acceptable for an approximate sketch
+        if (count < kMaxCount) {
+            counter.store(count + 1, std::memory_order_relaxed);
+        }
+    }
+    if (_accesses.fetch_add(1, std::memory_order_relaxed) + 1 >= _sample_period) {
+        _age();
+    }
+}
+
+bool CacheAdmissionPolicy::should_admit(std::string_view key) const {
+    uint64_t hash = HashUtil::hash64(key.data(), key.size(), 0);
+    return _estimate(hash) >= 2;
+}
+
+void CacheAdmissionPolicy::_age() {
+    std::lock_guard l(_age_mutex);
+    if (_accesses.load(std::memory_order_relaxed) < _sample_period) {
+        // another thread already aged the sketch
+        return;
+    }
+    for (auto& counter : _counters) {
+        counter.store(counter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+    _accesses.store(0, std::memory_order_relaxed);
+}
+
+} // namespace starrocks
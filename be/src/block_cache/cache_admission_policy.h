@@ -0,0 +1,60 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace starrocks {
+
+// Scan-resistant admission for the block cache, modeled after TinyLFU.
+// Every block access bumps a count-min sketch of 4-bit saturating counters;
+// a block is admitted into the cache only when it has been accessed more than
+// once within the current aging window. Blocks of a large one-off scan are
+// touched a single time, so they are kept out of the cache and cannot evict
+// the resident working set. The sketch is halved periodically so estimated
+// frequencies follow the recent past, which also makes the window act as a
+// ghost record of recently seen keys: a key aged out of the sketch has to
+// prove itself again before being admitted.
+class CacheAdmissionPolicy {
+public:
+    explicit CacheAdmissionPolicy(size_t sketch_bytes);
+
+    // Record one access to |key|, bumping its estimated frequency.
+    void record_access(std::string_view key);
+
+    // Return true iff |key| has been accessed at least twice within the current
+    // aging window and is therefore worth caching.
+    bool should_admit(std::string_view key) const;
+
+private:
+    static constexpr uint8_t kMaxCount = 15;
+    static constexpr size_t kDepth = 4;
+
+    size_t _slot(size_t row, uint64_t hash) const;
+    uint8_t _estimate(uint64_t hash) const;
+    void _age();
+
+    size_t _width = 0;
+    std::vector<std::atomic<uint8_t>> _counters;
+    std::atomic<uint64_t> _accesses{0};
+    uint64_t _sample_period = 0;
+    std::mutex _age_mutex;
+};
+
+} // namespace starrocks
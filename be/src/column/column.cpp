@@ -16,10 +16,21 @@
 
 #include <fmt/format.h>
 
+#include "common/config.h"
 #include "common/statusor.h"
 
 namespace starrocks {
 
+ColumnCloneStats::ScopedClone::ScopedClone(const Column& column) {
+    if (_tls_clone_depth++ == 0) {
+        auto bytes = static_cast<int64_t>(column.memory_usage());
+        _tls_clone_bytes += bytes;
+        DCHECK(config::max_column_clone_bytes <= 0 || bytes <= config::max_column_clone_bytes)
+                << "deep copy of " << bytes << " bytes through Column::clone exceeds max_column_clone_bytes="
+                << config::max_column_clone_bytes;
+    }
+}
+
 void Column::serialize_batch_with_null_masks(uint8_t* dst, Buffer<uint32_t>& slice_sizes, size_t chunk_size,
                                              uint32_t max_one_row_size, uint8_t* null_masks, bool has_null) {
     uint32_t* sizes = slice_sizes.data();
@@ -418,6 +418,30 @@ protected:
     DelCondSatisfied _delete_state = DEL_NOT_SATISFIED;
 };
 
+// Accounting of deep copies made through Column::clone()/clone_shared(). Columns are
+// shared by std::shared_ptr and treated as copy-on-write, so cloning a column that is
+// still referenced elsewhere is often an accidental deep copy. The counter is thread
+// local: the pipeline driver snapshots it around an operator's work and attributes the
+// copied bytes to that operator in the query profile (as "CopyOnWriteBytes").
+class ColumnCloneStats {
+public:
+    static int64_t current_thread_bytes() { return _tls_clone_bytes; }
+
+    // RAII marker around one clone. Only the outermost clone of a nested column tree is
+    // accounted, because the parent's memory usage already covers the recursive clones
+    // of its children. In debug builds the outermost clone fails when it copies more
+    // than config::max_column_clone_bytes, see the config for details.
+    class ScopedClone {
+    public:
+        explicit ScopedClone(const Column& column);
+        ~ScopedClone() { _tls_clone_depth--; }
+    };
+
+private:
+    static inline thread_local int64_t _tls_clone_bytes = 0;
+    static inline thread_local int32_t _tls_clone_depth = 0;
+};
+
 // AncestorBase is root class of inheritance hierarchy
 // if Derived class is the direct subclass of the root, then AncestorBase is just the Base class
 // if Derived class is the indirect subclass of the root, Base class is parent class, and
@@ -459,10 +483,12 @@ public:
     }
 
     typename AncestorBaseType::MutablePtr clone() const override {
+        ColumnCloneStats::ScopedClone scoped_clone(*derived());
         return typename AncestorBase::MutablePtr(new Derived(*derived()));
     }
 
     typename AncestorBaseType::Ptr clone_shared() const override {
+        ColumnCloneStats::ScopedClone scoped_clone(*derived());
         return typename AncestorBase::Ptr(new Derived(*derived()));
     }
 
@@ -67,6 +67,14 @@ CONF_mInt64(memory_urgent_level, "85");
 // Memory high water level, if the memory usage exceeds this level, reduce the size of
 // the Pagecache slowly, it should be between [1, memory_urgent_level).
 CONF_mInt64(memory_high_level, "75");
+// Number of bytes a thread accumulates locally before committing them to the MemTracker chain.
+// Larger values cut the atomic traffic of allocation-heavy operators, smaller values tighten the
+// per-thread bound on unaccounted memory. Takes effect for threads created after the change.
+CONF_mInt64(mem_tracker_consume_batch_bytes, "2097152"); // 2MB
+// Whether the memory maintenance thread forces jemalloc to purge the dirty pages of all arenas
+// when the process memory usage exceeds memory_urgent_level, instead of waiting for the decay
+// curve to return them to the kernel.
+CONF_mBool(enable_jemalloc_purge_on_memory_pressure, "true");
 // Pagecache size adjust period, default 20, it should be between [1, 180].
 CONF_mInt64(pagecache_adjust_period, "20");
 // Sleep time in seconds between pagecache adjust iterations.
@@ -143,6 +151,9 @@ CONF_mInt32(max_download_speed_kbps, "50000");
 CONF_mInt32(download_low_speed_limit_kbps, "50");
 // The download low speed time(seconds).
 CONF_mInt32(download_low_speed_time, "300");
+// The number of concurrent HTTP streams used to fetch snapshot files during clone.
+// 1 falls back to downloading the files one by one over a single connection.
+CONF_mInt32(clone_download_parallelism, "4");
 // The sleep time for one second.
 CONF_Int32(sleep_one_second, "1");
 // The sleep time for five seconds.
@@ -238,6 +249,9 @@ CONF_mInt32(update_cache_expire_sec, "360");
 CONF_mInt32(file_descriptor_cache_clean_interval, "3600");
 CONF_mInt32(disk_stat_monitor_interval, "5");
 CONF_mInt32(profile_report_interval, "30");
+// Interval profile reports only carry the counters and info strings that changed since the last
+// report. FE merges reports item by item, so omitted items keep their last reported value.
+CONF_mBool(enable_profile_incremental_report, "true");
 CONF_mInt32(unused_rowset_monitor_interval, "30");
 CONF_String(storage_root_path, "${STARROCKS_HOME}/storage");
 // BE process will exit if the percentage of error disk reach this value.
@@ -261,6 +275,15 @@ CONF_Int32(file_descriptor_cache_capacity, "16384");
 // minimum file descriptor number
 // modify them upon necessity
 CONF_Int32(min_file_descriptor_number, "60000");
+// If set to true, local segment files are read through a read-only mmap of the whole file instead
+// of buffered pread() calls, so page-cache-resident bytes are accessed without a system call per
+// read. Best suited for hot tables that fit in memory; mapped regions are not budgeted, the
+// kernel reclaims the pages under memory pressure.
+CONF_Bool(enable_mmap_segment_read, "false");
+// memory budget (in bytes) of the process-wide cache of opened segments (parsed footer and
+// decoded indexes) used by code paths that open segments ad-hoc, e.g. partial update reads.
+// <= 0 disables the cache.
+CONF_Int64(segment_metadata_cache_capacity, /*128MB=*/"134217728");
 CONF_Int64(index_stream_cache_capacity, "10737418240");
 // CONF_Int64(max_packed_row_block_size, "20971520");
 
@@ -271,14 +294,25 @@ CONF_Int32(data_page_size, "65536");
 CONF_mString(storage_page_cache_limit, "20%");
 // whether to disable page cache feature in storage
 CONF_mBool(disable_storage_page_cache, "false");
+// Fraction of query page reads that verify the page crc32c checksum, in [0, 1]. Pages are
+// always verified when written, so read-mostly deployments can sample the verification to
+// save scan CPU. Compaction and schema change reads always verify regardless of this value.
+CONF_mDouble(page_checksum_verify_sample_ratio, "1");
 // whether to enable the bitmap index memory cache
 CONF_mBool(enable_bitmap_index_memory_page_cache, "false");
 // whether to enable the zonemap index memory cache
 CONF_mBool(enable_zonemap_index_memory_page_cache, "false");
 // whether to enable the ordinal index memory cache
 CONF_mBool(enable_ordinal_index_memory_page_cache, "false");
+// whether to cache dictionary pages at durable priority in the page cache. A dictionary page is
+// shared by all the data pages of its column, so a bulk scan that churns through data pages
+// should not push the dictionaries of hot columns out of the cache.
+CONF_mBool(enable_dict_memory_page_cache, "true");
 // whether to disable column pool
 CONF_Bool(disable_column_pool, "true");
+// In debug builds, a single Column::clone()/clone_shared() copying more bytes than this
+// fails a DCHECK, to pinpoint accidental deep copies of shared columns. <= 0 disables it.
+CONF_mInt64(max_column_clone_bytes, "0");
 
 CONF_mInt32(base_compaction_check_interval_seconds, "60");
 CONF_mInt64(min_base_compaction_num_singleton_deltas, "5");
@@ -303,6 +337,19 @@ CONF_Int32(cumulative_compaction_num_threads_per_disk, "1");
 // when candidate num reach this value, the condidate with lowest score will be dropped.
 CONF_mInt64(max_compaction_candidate_num, "40960");
 
+// Scale compaction priority by what queries actually pay for: tablets that are
+// scanned get their score boosted in proportion to the average number of
+// segments a query touches, tablets that have not been read for
+// compaction_cold_tablet_threshold_seconds are damped by
+// compaction_cold_tablet_score_factor. Tablets whose score already reaches
+// compaction_read_feedback_bypass_score are never damped, so version buildup
+// on write-only tablets stays bounded.
+CONF_mBool(enable_compaction_read_feedback, "false");
+CONF_mInt64(compaction_cold_tablet_threshold_seconds, "86400");
+CONF_mDouble(compaction_read_feedback_max_boost, "2");
+CONF_mDouble(compaction_cold_tablet_score_factor, "0.5");
+CONF_mDouble(compaction_read_feedback_bypass_score, "100");
+
 // If true, SR will try no to merge delta column back to main segment
 CONF_mBool(enable_lazy_delta_column_compaction, "true");
 
@@ -349,6 +396,19 @@ CONF_mBool(enable_rowset_verify, "false");
 // the columns will be divided into groups for vertical compaction.
 CONF_Int64(vertical_compaction_max_columns_per_group, "5");
 
+// Whether vertical compaction carries the dictionaries of low-cardinality
+// string columns forward from the input segments: when every input segment of a
+// column holds the same dictionary, the output dict builders are pre-seeded
+// with it instead of re-dictionarizing the column for each output segment.
+CONF_mBool(enable_vertical_compaction_dict_reuse, "true");
+
+// When enabled, compaction writes its output segments with O_DIRECT so that rewriting
+// cold rowsets does not evict the hot query working set from the OS page cache.
+// Column pages are staged in an aligned buffer of compaction_segment_direct_write_buffer_size
+// bytes per open segment and issued to disk in large batched writes.
+CONF_mBool(enable_compaction_segment_direct_write, "false");
+CONF_mInt32(compaction_segment_direct_write_buffer_size, "1048576"); // 1MB
+
 CONF_Bool(enable_event_based_compaction_framework, "true");
 
 CONF_Bool(enable_size_tiered_compaction_strategy, "true");
@@ -360,6 +420,11 @@ CONF_mInt64(size_tiered_level_num, "7");
 
 CONF_Bool(enable_check_string_lengths, "true");
 
+// Merge sorted inputs (compaction, sorted reads) with a tournament (loser) tree
+// instead of a binary heap, which needs half the key comparisons per row when
+// merging many overlapping inputs.
+CONF_mBool(enable_loser_tree_merge, "true");
+
 // Max row source mask memory bytes, default is 200M.
 // Should be smaller than compaction_mem_limit.
 // When the row source mask buffer exceeds this, it will be persisted to a temporary file on the disk.
@@ -378,7 +443,16 @@ CONF_Int64(load_data_reserve_hours, "4");
 // log error log will be removed after this time
 CONF_mInt64(load_error_log_reserve_hours, "48");
 CONF_mInt32(number_tablet_writer_threads, "16");
+// number of threads used to encode the column writers of one segment
+// concurrently when flushing, so that flushing a wide table scales with cores
+// instead of serializing all column encoding on one flush thread.
+// 0 (the default) keeps encoding on the flush thread.
+CONF_Int32(segment_flush_column_concurrency, "0");
 CONF_mInt64(max_queueing_memtable_per_tablet, "2");
+// Number of auto-increment ids leased from the FE in one RPC. A leased range is handed
+// out locally with an atomic fetch-add and refreshed in the background once it drains
+// below a quarter of this size, keeping the FE round trip off the ingest hot path.
+CONF_mInt64(auto_increment_lease_rows, "100000");
 // when memory limit exceed and memtable last update time exceed this time, memtable will be flushed
 CONF_mInt64(stale_memtable_flush_time_sec, "30");
 
@@ -404,6 +478,40 @@ CONF_Double(dictionary_encoding_ratio_for_non_string_column, "0");
 // The minimum chunk size for dictionary encoding speculation
 CONF_Int32(dictionary_speculate_min_chunk_size, "10000");
 
+// When enabled, char/varchar columns whose compression is zstd train a compression
+// dictionary from the column's page bodies at segment flush and compress every page with
+// it, which helps a lot on columns made of many short, similar strings (log messages,
+// urls, ...). The dictionary is stored in the column meta, so segments written this way
+// cannot be read by BE versions without this feature: only enable it after the whole
+// cluster has been upgraded.
+CONF_mBool(enable_zstd_dictionary_compression, "false");
+
+// When a numeric column does not qualify for dictionary encoding, speculate frame-of-reference
+// encoding instead of bitshuffle if at least this ratio of the adjacent value pairs in the
+// sample column is non-decreasing. FOR pages store a per-page minimum and bit-pack the offsets
+// from it, so (near-)monotonic columns such as event timestamps and auto-increment ids compress
+// much better with it. 0 disables frame-of-reference speculation.
+CONF_Double(for_encoding_min_ordered_ratio, "0");
+
+// When positive, write a BRIN-style secondary range index for columns that carry a zone
+// map: one min/max entry per this many rows, finer than the per-page zone maps. Useful
+// for semi-sorted time-series data where a range predicate only covers a slice of a big
+// page. 0 disables writing the index; readers always honor it when present.
+CONF_Int32(brin_index_block_size, "0");
+
+// Build bloom filter index columns of primary-key tables with a cuckoo filter instead of
+// the block split bloom filter. The cuckoo filter stores one-byte fingerprints in two-way
+// associative buckets, which gives a lower false positive rate (~3% vs 5%) at about one
+// byte per key, so point lookups skip more pages. Readers pick the right filter from the
+// algorithm recorded in the segment meta, so this only affects newly written segments.
+CONF_Bool(enable_cuckoo_filter_index, "false");
+
+// Write a segment-level pre-aggregated HLL sketch per scalar column: one HyperLogLog over
+// all non-null values, stored inline in the column meta. A full-table approx_count_distinct
+// can merge the per-segment sketches instead of re-hashing every row. Only affects newly
+// written segments.
+CONF_Bool(enable_pre_agg_hll_index, "false");
+
 // Whether to use special thread pool for streaming load to avoid deadlock for
 // concurrent streaming loads. The maximum number of threads and queue size are
 // set INT32_MAX which indicate there is no limit for the thread pool. Note you
@@ -414,6 +522,11 @@ CONF_Int32(streaming_load_thread_pool_idle_time_ms, "2000");
 
 // The maximum amount of data that can be processed by a stream load
 CONF_mInt64(streaming_load_max_mb, "102400");
+// The receive buffer size used when reading a streaming load request body off the HTTP event loop.
+// Each filled buffer is handed to the load pipe as one chunk, so a larger buffer means fewer
+// allocations and pipe appends per loaded byte, at the cost of more memory per in-flight request.
+// Values below 64KB are rounded up to 64KB.
+CONF_mInt64(streaming_load_buffer_size, "262144");
 // Some data formats, such as JSON, cannot be streamed.
 // Therefore, it is necessary to limit the maximum number of
 // such data when using stream load to prevent excessive memory consumption.
@@ -434,6 +547,9 @@ CONF_Int32(make_snapshot_rpc_timeout_ms, "20000");
 // CONF_Int32(tablet_writer_rpc_timeout_sec, "600");
 // OlapTableSink sender's send interval, should be less than the real response time of a tablet writer rpc.
 CONF_mInt32(olap_table_sink_send_interval_ms, "10");
+// The per-node chunk an OlapTableSink accumulates is sent once it grows past this many bytes,
+// even if it holds fewer rows than one full chunk, bounding the rpc payload for wide tables.
+CONF_mInt64(olap_table_sink_flush_chunk_bytes, "33554432");
 
 CONF_Bool(enable_load_segment_parallel, "false");
 CONF_Int32(load_segment_thread_pool_num_max, "128");
@@ -507,6 +623,16 @@ CONF_Int32(memory_max_alignment, "16");
 
 // write buffer size before flush
 CONF_mInt64(write_buffer_size, "104857600");
+// sort memtables with a single fixed-size integer sort key by a stable radix
+// sort instead of the generic comparison based kernels when flushing
+CONF_mBool(enable_memtable_radix_sort, "true");
+// encode the leading fixed-width integer ORDER BY columns into order-preserving 64-bit
+// keys and radix sort them, comparing rows only inside key ties
+CONF_mBool(enable_sort_key_prefix_radix_sort, "true");
+// pre-aggregate rows sharing the same key inside the tablet sink before transmission for
+// aggregate-key tables, trading a sender-side sort for less network traffic and remote
+// memtable aggregation when loads carry heavily duplicated keys
+CONF_mBool(enable_olap_table_sink_pre_aggregation, "false");
 
 // Following 2 configs limit the memory consumption of load process on a Backend.
 // eg: memory limit to 80% of mem limit config but up to 100GB(default)
@@ -515,6 +641,11 @@ CONF_mInt64(write_buffer_size, "104857600");
 // user should set these configs properly if necessary.
 CONF_Int32(query_max_memory_limit_percent, "90");
 CONF_Double(query_pool_spill_mem_limit_threshold, "1.0");
+// Whether to reject a query at fragment prepare time when the query pool cannot hold the query's
+// declared memory limit. Rejected queries fail fast with TOO_MANY_TASKS so the FE can queue or
+// retry them, instead of failing with MEM_LIMIT_EXCEEDED after doing a lot of work. Only queries
+// with a per-query memory limit take part in the check.
+CONF_mBool(enable_query_pool_mem_admission_control, "false");
 CONF_Int64(load_process_max_memory_limit_bytes, "107374182400"); // 100GB
 CONF_Int32(load_process_max_memory_limit_percent, "30");         // 30%
 CONF_mBool(enable_new_load_on_memory_limit_exceeded, "true");
@@ -536,6 +667,10 @@ CONF_mInt32(priority_queue_remaining_tasks_increased_frequency, "512");
 
 // Sync tablet_meta when modifing meta.
 CONF_mBool(sync_tablet_meta, "false");
+// If enabled, the meta write committing a compaction result does not wait for the RocksDB WAL
+// fsync even when sync_tablet_meta is on. A compaction commit lost in a crash is redone by the
+// next compaction, so ingest publishes no longer queue behind compaction meta fsyncs.
+CONF_mBool(enable_async_compaction_meta_write, "false");
 
 // Default thrift rpc timeout ms.
 CONF_mInt32(thrift_rpc_timeout_ms, "5000");
@@ -580,6 +715,10 @@ CONF_String(es_scroll_keepalive, "5m");
 // HTTP connection timeout for es.
 CONF_Int32(es_http_timeout_ms, "5000");
 
+// If enabled, the next es scroll page is fetched in the background while the
+// current page is converted to columns.
+CONF_mBool(es_enable_scroll_prefetch, "true");
+
 // es index max result window, and this value affects batch size.
 // if request batch size exceeds this value, ES will return bad request(400)
 // https://www.elastic.co/guide/en/elasticsearch/reference/current/index-modules.html
@@ -667,6 +806,17 @@ CONF_Int32(late_materialization_ratio, "10");
 // `1000` will enable late materialization always select metric type.
 CONF_Int32(metric_late_materialization_ratio, "1000");
 
+// If enabled, the conjuncts of a scan predicate tree are reordered at runtime: selectivity and
+// cost (ns/row) of every conjunct are measured over the first chunks it evaluates, then the
+// conjuncts run cheapest-most-selective first (e.g. a range check before a LIKE).
+CONF_mBool(enable_adaptive_predicate_reorder, "true");
+
+// If enabled, the WHEN/THEN/ELSE branches of a CASE WHEN expression only see the rows the preceding
+// clauses left unmatched: the rows surviving a branch's condition are compacted into a temporary
+// chunk, the branch is evaluated over it and the result is scattered back, instead of evaluating
+// every branch over the whole chunk and blending afterwards.
+CONF_mBool(enable_case_when_lazy_evaluation, "true");
+
 // Max batched bytes for each transmit request. (256KB)
 CONF_Int64(max_transmit_batched_bytes, "262144");
 
@@ -723,6 +873,9 @@ CONF_mInt32(tablet_max_pending_versions, "1000");
 // NOTE: it will be deleted.
 CONF_mBool(enable_bitmap_union_disk_format_with_set, "false");
 
+// If enabled, an idle scan driver steals morsels from the queues of its sibling drivers once
+// its own queue is drained, which evens out skewed morsel-to-driver assignments.
+CONF_mBool(enable_morsel_queue_stealing, "true");
 // The number of scan threads pipeline engine.
 CONF_Int64(pipeline_scan_thread_pool_thread_num, "0");
 CONF_mDouble(pipeline_connector_scan_thread_num_per_cpu, "8");
@@ -743,30 +896,83 @@ CONF_Int64(pipeline_sink_io_thread_pool_queue_size, "102400");
 CONF_Int64(pipeline_sink_buffer_size, "64");
 // The degree of parallelism of brpc.
 CONF_Int64(pipeline_sink_brpc_dop, "64");
+// When batches for one destination back up in SinkBuffer, concatenate consecutive batches with
+// identical routing metadata into a single transmit_chunk rpc up to this many attachment bytes,
+// which avoids paying one rpc round trip per small batch under high fan-out. 0 disables it.
+CONF_mInt64(pipeline_sink_coalesce_rpc_max_bytes, "1048576");
 // Used to reject coming fragment instances, when the number of running drivers
 // exceeds it*pipeline_exec_thread_pool_thread_num.
 CONF_Int64(pipeline_max_num_drivers_per_exec_thread, "10240");
+// When the blocked-driver poller finds nothing to wake for hundreds of consecutive scans, it
+// backs off by sleeping up to this long between scans instead of re-scanning in a hot loop,
+// so a large population of long-blocked drivers no longer burns a full core. Newly blocked
+// drivers wake the poller immediately; the sleep only delays noticing state changes of the
+// already-blocked ones, bounding the extra wake-up latency by this value. <= 0 keeps the old
+// sched_yield busy loop.
+CONF_mInt64(pipeline_poller_max_idle_sleep_us, "1024");
 CONF_mBool(pipeline_print_profile, "false");
+// Whether the workgroup driver scheduler charges the worker thread's CPU time (instead of the
+// elapsed wall time) of each driver run against the workgroup's vruntime. CPU time excludes the
+// intervals the thread spent descheduled or blocked, which tightens CPU quota enforcement for
+// expression-heavy queries.
+CONF_mBool(enable_resource_group_cpu_time_accounting, "false");
+// Collect hardware PMU counters (cycles, instructions, LLC misses, branch misses) around
+// operator push/pull and surface them in the operator's runtime profile. Needs access to
+// perf_event_open; silently stays off on hosts without it.
+CONF_Bool(pipeline_enable_pmu_profile_counters, "false");
+// The byte budget one CollectStats operator may buffer while observing the input cardinality for
+// adaptive DOP. The row threshold comes from the plan; this cap stops collecting early for very
+// wide rows, falling back to the upstream DOP. 0 means no byte cap.
+CONF_mInt64(pipeline_adaptive_dop_max_block_bytes, "134217728");
+// Bind pipeline execution threads to NUMA nodes in a round-robin manner, so that a driver tends to
+// be rescheduled on the socket where its operator state was allocated. Only takes effect on
+// machines with more than one NUMA node.
+CONF_Bool(pipeline_exec_thread_pool_numa_bind, "false");
 
 // The arguments of multilevel feedback pipeline_driver_queue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_driver_queue_level_time_slice_base_ns, "200000000");
 CONF_Double(pipeline_driver_queue_ratio_of_adjacent_queue, "1.2");
-// 0 represents PriorityScanTaskQueue (by default), while 1 represents MultiLevelFeedScanTaskQueue.
+// 0 represents PriorityScanTaskQueue (by default), 1 represents MultiLevelFeedScanTaskQueue,
+// and 2 represents WorkStealingScanTaskQueue.
 // - PriorityScanTaskQueue prioritizes scan tasks with lower committed times.
 // - MultiLevelFeedScanTaskQueue prioritizes scan tasks with shorter execution time.
 //   It is advisable to use MultiLevelFeedScanTaskQueue when scan tasks from large queries may impact those from small queries.
+// - WorkStealingScanTaskQueue distributes tasks over per-worker lock-free queues with work
+//   stealing, which reduces lock contention on many-core machines with many short queries.
 CONF_Int64(pipeline_scan_queue_mode, "0");
 // The arguments of MultiLevelFeedScanTaskQueue. It prioritizes small queries over larger ones,
 // when the value of level_time_slice_base_ns is smaller and queue_ratio_of_adjacent_queue is larger.
 CONF_Int64(pipeline_scan_queue_level_time_slice_base_ns, "100000000");
 CONF_Double(pipeline_scan_queue_ratio_of_adjacent_queue, "1.5");
 
+// The soft byte budget of one chunk re-batched by ChunkPipelineAccumulator. Chunks of wide
+// tables reach the budget before vector_chunk_size rows and are emitted early, so re-batching
+// doesn't accumulate chunks which blow the CPU caches. 0 disables the budget.
+CONF_mInt64(pipeline_chunk_accumulate_max_bytes, "4194304");
 CONF_Int32(pipeline_analytic_max_buffer_size, "128");
 CONF_Int32(pipeline_analytic_removable_chunk_num, "128");
 CONF_Bool(pipeline_analytic_enable_streaming_process, "true");
 CONF_Bool(pipeline_analytic_enable_removable_cumulative_process, "true");
+// Sliding ROWS frames at least this long whose functions cannot be updated removable-cumulatively
+// are evaluated by merging pre-aggregated block states instead of re-aggregating the whole frame
+// for every row.
+CONF_Bool(pipeline_analytic_enable_frame_block_process, "true");
+CONF_Int64(pipeline_analytic_frame_block_process_threshold, "1024");
+// A single partition routed by the ordered partition local exchange spills over to another channel
+// once it fed this many rows to the current one, provided the consumer can restore global row
+// numbering (currently pure ROW_NUMBER analytic queries). 0 keeps every partition on one channel.
+CONF_mInt64(pipeline_analytic_partition_split_rows, "4194304");
 CONF_Int32(pipline_limit_max_delivery, "4096");
+// Use the parallel merge source (Merge Path) for merging exchanges even when the plan doesn't
+// request it, as long as there are at least force_exchange_parallel_merge_senders senders.
+// A single-threaded k-way merge caps the throughput of ORDER BY over many fragment instances
+// at one core. 0 disables the override and keeps the plan's choice.
+CONF_mInt32(force_exchange_parallel_merge_senders, "0");
+// Build a block-split bloom filter alongside the join hash table and test it before bucket
+// traversal during probing. It pays off for highly selective joins with low probe hit rate;
+// probing stops consulting the filter adaptively when the observed pass rate is high.
+CONF_mBool(enable_join_probe_bloom_filter, "false");
 /// For parallel scan on the single tablet.
 // These three configs are used to calculate the minimum number of rows picked up from a segment at one time.
 // It is `splitted_scan_bytes/scan_row_bytes` and restricted in the range [min_splitted_scan_rows, max_splitted_scan_rows].
@@ -823,12 +1029,33 @@ CONF_Int64(object_storage_connect_timeout_ms, "-1");
 // value is greater than 0 and less than 1000.
 // When it's 0, low speed limit check will be disabled.
 CONF_Int64(object_storage_request_timeout_ms, "-1");
+// Hedged reads for object storage. If a ranged GetObject issued by a scan has not completed
+// within the threshold, a duplicate request is sent and the first response wins, which tames
+// the long tail of slow S3 responses. The threshold should be set close to the observed p95
+// GetObject latency; a low value wastes requests, a high value gives no benefit.
+CONF_mBool(enable_object_storage_hedged_read, "false");
+CONF_mInt64(object_storage_hedged_read_threshold_ms, "500");
+// Maximum number of threads issuing hedged object storage requests. When all threads are busy,
+// reads fall back to plain synchronous requests instead of queuing behind each other.
+CONF_Int32(object_storage_hedged_read_max_threads, "16");
+// Decode-ahead for compressed load streams (.gz/.zst/... files read through
+// CompressedInputStream). A background task decompresses ahead of the reader into a bounded
+// window, so source reads and decompression overlap with parsing instead of sharing one core.
+CONF_mBool(enable_compressed_stream_decode_ahead, "true");
+// Maximum number of concurrent decode-ahead tasks; each running compressed stream occupies one
+// thread. When all threads are busy, new streams decompress inline as before.
+CONF_Int32(compressed_stream_decode_ahead_max_threads, "16");
 
 CONF_Strings(fallback_to_hadoop_fs_list, "");
 CONF_Strings(s3_compatible_fs_list, "s3n://, s3a://, s3://, oss://, cos://, cosn://, obs://, ks3://, tos://");
 
 // Lake
 CONF_mBool(io_coalesce_lake_read_enable, "false");
+// Whether to coalesce segment page reads for local tablets as well. After zone-map and
+// short-key pruning selects the row ranges, the needed pages of all projected columns are
+// read in a few batched IOs ahead of decode instead of one read per page, which helps
+// cold-cache scans on local disks the same way it helps lake reads.
+CONF_mBool(io_coalesce_local_read_enable, "false");
 
 // orc reader
 CONF_Bool(enable_orc_late_materialization, "true");
@@ -847,6 +1074,10 @@ CONF_Int32(orc_loading_buffer_size, "8388608");
 CONF_mBool(parquet_coalesce_read_enable, "true");
 CONF_Bool(parquet_late_materialization_enable, "true");
 CONF_Bool(parquet_page_index_enable, "true");
+// How many bytes of the next row group's io ranges may be registered together with
+// the current row group, so reads coalesce across the row-group boundary and the
+// tail read of one group already pulls in the head of the next. 0 disables it.
+CONF_mInt64(parquet_row_group_lookahead_bytes, "16777216"); // 16MB
 
 CONF_Int32(io_coalesce_read_max_buffer_size, "8388608");
 CONF_Int32(io_coalesce_read_max_distance_size, "1048576");
@@ -858,6 +1089,9 @@ CONF_Int32(connector_io_tasks_adjust_interval_ms, "50");
 CONF_Int32(connector_io_tasks_adjust_step, "1");
 CONF_Int32(connector_io_tasks_adjust_smooth, "4");
 CONF_Int32(connector_io_tasks_slow_io_latency_ms, "50");
+// Upper bound of expected in-flight connector io tasks for one query,
+// shared by all connector scan operators of that query.
+CONF_Int64(connector_io_tasks_per_query, "1024");
 CONF_mDouble(scan_use_query_mem_ratio, "0.25");
 CONF_Double(connector_scan_use_query_mem_ratio, "0.3");
 
@@ -898,7 +1132,8 @@ CONF_Int64(meta_threshold_to_manual_compact, "10737418240"); // 10G
 CONF_Bool(manual_compact_before_data_dir_load, "false");
 
 // size of grf generated by broadcast join below this limit, multiple rf copy will be delivered in passthrough
-// style, otherwise, rf will be relayed by other be.
+// style, otherwise, rf will be relayed by other be. a broadcast wider than
+// deliver_broadcast_rf_passthrough_inflight_num destinations is always relayed, regardless of size.
 CONF_Int64(deliver_broadcast_rf_passthrough_bytes_limit, "131072");
 // in passthrough style, the number of inflight RPCs of parallel deliveries are issued is not exceeds this limit.
 CONF_Int64(deliver_broadcast_rf_passthrough_inflight_num, "10");
@@ -965,6 +1200,12 @@ CONF_mInt32(starlet_delete_files_max_key_in_batch, "1000");
 CONF_mInt64(lake_metadata_cache_limit, /*2GB=*/"2147483648");
 CONF_mBool(lake_print_delete_log, "false");
 CONF_mInt64(lake_compaction_stream_buffer_size_bytes, "1048576"); // 1MB
+// Read input rowsets on a separate thread during lake compaction, so remote
+// reads overlap with merge and segment upload instead of serializing with them.
+CONF_mBool(enable_lake_compaction_pipelined_read, "true");
+// Max number of merged chunks buffered between the read thread and the write
+// stage of a pipelined lake compaction.
+CONF_mInt32(lake_compaction_pipeline_queue_depth, "4");
 // The interval to check whether lake compaction is valid. Set to <= 0 to disable the check.
 CONF_mInt32(lake_compaction_check_valid_interval_minutes, "30"); // 30 minutes
 // Used to ensure service availability in extreme situations by sacrificing a certain degree of correctness
@@ -1028,6 +1269,22 @@ CONF_Int32(spill_max_partition_size, "1024");
 // The maximum size of a single log block container file, this is not a hard limit.
 // If the file size exceeds this limit, a new file will be created to store the block.
 CONF_Int64(spill_max_log_block_container_bytes, "10737418240"); // 10GB
+// Process-wide budget of the in-memory spill block tier. While the budget lasts, spilled
+// blocks are kept in memory (already serialized and compressed by the spill serde) and
+// only new blocks beyond the budget are demoted to disk or remote storage.
+// 0 disables the tier.
+CONF_mInt64(spill_max_in_memory_block_bytes, "0");
+// Whether operators with revocable memory also convert to low-memory (spill) mode when the
+// process memory usage exceeds spill_process_mem_high_level percent of the process limit, even
+// if their own query is still below its per-query limit. This makes the largest memory holders
+// start spilling under global pressure before smaller queries fail with MEM_LIMIT_EXCEEDED.
+CONF_mBool(enable_spill_on_process_mem_pressure, "false");
+// The process memory water level (percentage of the process limit) above which spillable
+// operators convert to low-memory mode, see enable_spill_on_process_mem_pressure.
+CONF_mInt64(spill_process_mem_high_level, "85");
+// Whether to advise the kernel to read a spill block ahead (POSIX_FADV_WILLNEED) when a
+// restore starts reading it, so the disk fetch overlaps with deserialization.
+CONF_mBool(spill_enable_restore_read_ahead, "true");
 // The maximum size of a single spill directory, for some case the spill directory may
 // be the same with storage path. Spill will return with error when used size has exceeded
 // the limit.
@@ -1077,6 +1334,20 @@ CONF_Int64(datacache_max_flying_memory_mb, "2");
 CONF_Double(datacache_skip_read_factor, "1.0");
 // Whether to use block buffer to hold the datacache block data.
 CONF_Bool(datacache_block_buffer_enable, "true");
+// Reads smaller than this threshold skip the block buffer and only fetch the
+// requested range from the cache, instead of materializing and copying a whole
+// block to serve a few kilobytes (parquet footers, index pages).
+CONF_mInt64(datacache_block_buffer_min_read_size, "65536"); // 64KB
+// Whether to populate the datacache asynchronously on read miss by default, so
+// cold scans are not slowed down by inline cache writes. Writes that exceed the
+// flying memory limit are dropped instead of blocking the read path.
+// The session variable `enable_datacache_async_populate_mode` overrides it.
+CONF_mBool(datacache_async_populate_enable, "true");
+// Only admit a block into the datacache after it has been read more than once
+// recently, so large one-off scans cannot evict the hot working set.
+CONF_Bool(datacache_frequency_admission_enable, "false");
+// Memory used by the admission frequency sketch.
+CONF_Int64(datacache_admission_sketch_bytes, "1048576"); // 1MB
 // To control how many threads will be created for datacache synchronous tasks.
 // For the default value, it means for every 8 cpu, one thread will be created.
 CONF_Double(datacache_scheduler_threads_per_cpu, "0.125");
@@ -1138,6 +1409,10 @@ CONF_mInt64(l0_max_mem_usage, "104857600"); // 100MB
 // if l0_mem_size exceeds this value, l0 need snapshot
 CONF_mInt64(l0_snapshot_size, "16777216"); // 16MB
 CONF_mInt64(max_tmp_l1_num, "10");
+// Run the tmp l1 merge of the persistent index on the pk index compaction thread pool
+// instead of the apply thread, so heavy upserts only pay for memtable inserts and the
+// swap of the merged result. The merge stays bounded to max_tmp_l1_num input files.
+CONF_Bool(enable_pindex_async_merge_advance, "false");
 CONF_mBool(enable_parallel_get_and_bf, "true");
 // Control if using the minor compaction strategy
 CONF_Bool(enable_pindex_minor_compaction, "true");
@@ -1178,6 +1453,11 @@ CONF_Int64(query_cache_capacity, "536870912");
 // ranges in [1,16], default value is 4.
 CONF_mInt32(query_cache_num_lanes_per_driver, "4");
 
+// When enabled, query cache entries are written through to the datacache (block cache), so entries
+// evicted from the in-memory query cache can be rehydrated from the datacache instead of being
+// recomputed. It requires the datacache to be initialized.
+CONF_mBool(enable_query_cache_persistent_tier, "false");
+
 // Used to limit buffer size of tablet send channel.
 CONF_mInt64(send_channel_buffer_limit, "67108864");
 
@@ -1201,6 +1481,12 @@ CONF_String(rocksdb_db_options_string, "create_if_missing=true;create_missing_co
 
 // limit local exchange buffer's memory size per driver
 CONF_Int64(local_exchange_buffer_mem_limit_per_driver, "134217728"); // 128MB
+// When a multi cast local exchanger (used by multi-cast data stream sinks, e.g. shared CTEs)
+// buffers more than this many bytes because its consumers progress at different speeds, the
+// oldest still-needed chunks are flushed to spill blocks and read back on demand, so slow
+// consumers no longer pin the whole backlog in memory. Requires spill to be enabled for the
+// query; <= 0 disables the overflow. Default: 128MB.
+CONF_mInt64(multi_cast_local_exchange_spill_mem_limit, "134217728");
 // only used for test. default: 128M
 CONF_mInt64(streaming_agg_limited_memory_size, "134217728");
 // pipeline streaming aggregate chunk buffer size
@@ -1232,6 +1518,13 @@ CONF_mInt32(primary_key_limit_size, "128");
 // used for control the max memory cost when batch get pk index in each tablet
 CONF_mInt64(primary_key_batch_get_index_memory_limit, "104857600"); // 100MB
 
+// when a column mode partial update touches at most this many rows of a segment,
+// write a sparse `.cols` file which only contains the updated rows plus a rowid
+// mapping merged lazily at read, instead of rewriting the columns full length.
+// the rowid mapping is persisted in the tablet meta, so this threshold also
+// bounds the meta growth per segment. 0 disables the sparse fast path
+CONF_mInt32(partial_update_sparse_dcg_max_rows, "0");
+
 // If your sort key cardinality is very high,
 // You could enable this config to speed up the point lookup query,
 // otherwise, StarRocks will use zone map for one column filter
@@ -1247,6 +1540,12 @@ CONF_mInt32(finish_publish_version_internal, "100");
 
 CONF_mBool(enable_stream_load_verbose_log, "false");
 
+// If enabled, a transaction stream load that hits its idle timeout with data already
+// received is committed as one rowset instead of being rolled back. This lets clients
+// group many small loads into one transaction and rely on the idle timeout to seal the
+// batch, instead of creating one rowset per tiny load.
+CONF_mBool(enable_transaction_stream_load_idle_commit, "false");
+
 CONF_mInt32(get_txn_status_internal_sec, "30");
 
 CONF_mBool(dump_metrics_with_bvar, "true");
@@ -1306,6 +1605,12 @@ CONF_mBool(enable_light_pk_compaction_publish, "true");
 // else it = min(mem_limit*0.01, 1GB)
 CONF_mInt64(jit_lru_cache_size, "0");
 
+// Directory of the persistent JIT object cache. When non-empty, compiled expression
+// object code is written to this directory and reloaded on later misses of the in-memory
+// LRU cache, so recurring expressions skip IR generation and optimization across BE
+// restarts. An empty string disables the persistent cache.
+CONF_String(jit_object_cache_dir, "");
+
 CONF_mInt64(arrow_io_coalesce_read_max_buffer_size, "8388608");
 CONF_mInt64(arrow_io_coalesce_read_max_distance_size, "1048576");
 CONF_mInt64(arrow_read_batch_size, "4096");
@@ -47,6 +47,8 @@
 #endif
 #include "gutil/cpu.h"
 #include "jemalloc/jemalloc.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
 #include "runtime/memory/mem_chunk_allocator.h"
 #include "runtime/time_types.h"
 #include "runtime/user_function_cache.h"
@@ -111,6 +113,20 @@ void gc_memory(void* arg_this) {
         ReleaseColumnPool releaser(kFreeRatio);
         ForEach<ColumnPoolList>(releaser);
         LOG_IF(INFO, releaser.freed_bytes() > 0) << "Released " << releaser.freed_bytes() << " bytes from column pool";
+
+#if !defined(ADDRESS_SANITIZER) && !defined(LEAK_SANITIZER) && !defined(THREAD_SANITIZER)
+        // Under urgent memory pressure, ask jemalloc to return the dirty pages of all arenas to
+        // the kernel right away instead of waiting out the decay curve. Memory freed by finished
+        // big queries otherwise lingers as dirty pages and still counts against the process limit.
+        if (config::enable_jemalloc_purge_on_memory_pressure) {
+            MemTracker* tracker = GlobalEnv::GetInstance()->process_mem_tracker();
+            if (tracker != nullptr && tracker->limit_exceeded_by_ratio(config::memory_urgent_level)) {
+                std::string purge_cmd = fmt::format("arena.{}.purge", MALLCTL_ARENAS_ALL);
+                int ret = je_mallctl(purge_cmd.c_str(), nullptr, nullptr, nullptr, 0);
+                LOG_IF(WARNING, ret != 0) << "Failed to purge jemalloc dirty pages, ret=" << ret;
+            }
+        }
+#endif
     }
 }
 
@@ -58,6 +58,11 @@ public:
     virtual int64_t cpu_time_spent() const = 0;
     // IO time of this data source
     virtual int64_t io_time_spent() const { return 0; }
+    // bytes served by the local cache tier and bytes fetched from remote storage. The adaptive
+    // io tasks strategy uses them to tell cache-hot scans from cold ones; data sources without
+    // a cache tier report zero for both, which keeps the heuristic disabled.
+    virtual int64_t io_bytes_read_local() const { return 0; }
+    virtual int64_t io_bytes_read_remote() const { return 0; }
     virtual bool can_estimate_mem_usage() const { return false; }
     virtual int64_t estimated_mem_usage() const { return 0; }
 
@@ -48,6 +48,18 @@ DataSourcePtr HiveDataSourceProvider::create_data_source(const TScanRange& scan_
     return std::make_unique<HiveDataSource>(this, scan_range);
 }
 
+std::optional<bool> HiveDataSourceProvider::lookup_partition_skip_verdict(int64_t partition_id) const {
+    std::lock_guard<std::mutex> lock(_partition_skip_mutex);
+    auto it = _partition_skip_verdicts.find(partition_id);
+    if (it == _partition_skip_verdicts.end()) return std::nullopt;
+    return it->second;
+}
+
+void HiveDataSourceProvider::record_partition_skip_verdict(int64_t partition_id, bool skipped) const {
+    std::lock_guard<std::mutex> lock(_partition_skip_mutex);
+    _partition_skip_verdicts.emplace(partition_id, skipped);
+}
+
 const TupleDescriptor* HiveDataSourceProvider::tuple_descriptor(RuntimeState* state) const {
     return state->desc_tbl().get_tuple_descriptor(_hdfs_scan_node.tuple_id);
 }
@@ -102,6 +114,7 @@ Status HiveDataSource::open(RuntimeState* state) {
     if (state->query_options().__isset.enable_populate_datacache) {
         _enable_populate_datacache = state->query_options().enable_populate_datacache;
     }
+    _enable_datacache_aync_populate_mode = config::datacache_async_populate_enable;
     if (state->query_options().__isset.enable_datacache_async_populate_mode) {
         _enable_datacache_aync_populate_mode = state->query_options().enable_datacache_async_populate_mode;
     }
@@ -123,6 +136,15 @@ Status HiveDataSource::open(RuntimeState* state) {
         _enable_split_tasks = state->query_options().enable_connector_split_io_tasks;
     }
 
+    // Splits of the same partition share the partition-conjunct verdict, so a partition pruned
+    // by the first of its splits short-circuits the remaining ones before any per-split
+    // expression cloning happens. This keeps pruning cost proportional to the number of
+    // partitions rather than the number of files.
+    if (auto skipped = _provider->lookup_partition_skip_verdict(_scan_range.partition_id); skipped.value_or(false)) {
+        _no_data = true;
+        return Status::OK();
+    }
+
     RETURN_IF_ERROR(_init_conjunct_ctxs(state));
     _init_tuples_and_slots(state);
     _init_counter(state);
@@ -207,7 +229,14 @@ Status HiveDataSource::_init_partition_values() {
         RETURN_IF_ERROR(ExecNode::eval_conjuncts(_partition_conjunct_ctxs, partition_chunk.get()));
     }
 
-    if (!partition_chunk->has_rows()) {
+    bool pruned = !partition_chunk->has_rows();
+    if (_has_scan_range_indicate_const_column || _has_partition_conjuncts) {
+        // Within one plan the verdict of the static partition conjuncts only depends on the
+        // partition id, so publish it for the other splits of this partition. Runtime-filter
+        // based pruning below stays per split: filters keep arriving while the scan runs.
+        _provider->record_partition_skip_verdict(_scan_range.partition_id, pruned);
+    }
+    if (pruned) {
         _filter_by_eval_partition_conjuncts = true;
         return Status::OK();
     }
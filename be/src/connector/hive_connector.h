@@ -14,6 +14,10 @@
 
 #pragma once
 
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
 #include "column/vectorized_fwd.h"
 #include "connector/connector.h"
 #include "exec/connector_scan_node.h"
@@ -48,6 +52,12 @@ public:
     void peek_scan_ranges(const std::vector<TScanRangeParams>& scan_ranges) override;
     void default_data_source_mem_bytes(int64_t* min_value, int64_t* max_value) override;
 
+    // Partition-conjunct pruning verdicts keyed by partition id, shared by all file splits of
+    // this scan node. Within one plan a partition id always evaluates to the same verdict, so
+    // the conjuncts run once per partition instead of once per split.
+    std::optional<bool> lookup_partition_skip_verdict(int64_t partition_id) const;
+    void record_partition_skip_verdict(int64_t partition_id, bool skipped) const;
+
     friend class HiveDataSource;
 
 protected:
@@ -55,6 +65,8 @@ protected:
     const THdfsScanNode _hdfs_scan_node;
     int64_t _max_file_length = 0;
     std::atomic<int32_t> _lazy_column_coalesce_counter = 0;
+    mutable std::mutex _partition_skip_mutex;
+    mutable std::unordered_map<int64_t, bool> _partition_skip_verdicts;
 };
 
 class HiveDataSource final : public DataSource {
@@ -50,6 +50,12 @@ public:
     int64_t num_rows_read() const override { return _num_rows_read; }
     int64_t num_bytes_read() const override { return _bytes_read; }
     int64_t cpu_time_spent() const override { return _cpu_time_spent_ns; }
+    int64_t io_bytes_read_local() const override {
+        return _reader == nullptr ? 0 : _reader->stats().compressed_bytes_read_local_disk;
+    }
+    int64_t io_bytes_read_remote() const override {
+        return _reader == nullptr ? 0 : _reader->stats().compressed_bytes_read_remote;
+    }
 
     void get_split_tasks(std::vector<pipeline::ScanSplitContextPtr>* split_tasks) override {
         _reader->get_split_tasks(split_tasks);
@@ -37,7 +37,8 @@
 
 namespace starrocks {
 
-const constexpr int32_t prefetch_threhold = 8192;
+// prefetch_threhold and AGG_HASH_MAP_DEFAULT_PREFETCH_DIST are defined in agg_hash_set.h,
+// which is shared by the hash maps and the hash sets.
 
 using AggDataPtr = uint8_t*;
 
@@ -72,31 +73,37 @@ using FixedSize16SliceAggHashMap =
 
 // =====================
 // two level agg hash map
+// The two-level maps have 2 ^ PHMAPN sub maps, selected by the high bits of the hash.
+// See agg_hash_set.h for the definition of PHMAPN and the rationale of the fanout.
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashMap = phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashMap =
+        phmap::parallel_flat_hash_map<int32_t, AggDataPtr, StdHashWithSeed<int32_t, seed>,
+                                      phmap::priv::hash_default_eq<int32_t>,
+                                      phmap::priv::Allocator<phmap::priv::Pair<const int32_t, AggDataPtr>>, PHMAPN>;
 
-// The SliceAggTwoLevelHashMap will have 2 ^ 4 = 16 sub map,
-// The 16 is same as PartitionedAggregationNode::PARTITION_FANOUT
-static constexpr uint8_t PHMAPN = 4;
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashMap =
         phmap::parallel_flat_hash_map<Slice, AggDataPtr, SliceHashWithSeed<seed>, SliceEqual,
                                       phmap::priv::Allocator<phmap::priv::Pair<const Slice, AggDataPtr>>, PHMAPN>;
 
-// This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
-static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
-
 static_assert(sizeof(AggDataPtr) == sizeof(size_t));
-#define AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, prefetch_dist)              \
-    size_t const column_size = column->size();                                  \
-    size_t* hash_values = reinterpret_cast<size_t*>(agg_states->data());        \
-    {                                                                           \
-        const auto& container_data = column->get_data();                        \
-        for (size_t i = 0; i < column_size; i++) {                              \
-            size_t hashval = this->hash_map.hash_function()(container_data[i]); \
-            hash_values[i] = hashval;                                           \
-        }                                                                       \
-    }                                                                           \
+// Hash the whole chunk's keys in a standalone pass before probing, so that the hash loop can be
+// unrolled and vectorized by the compiler without being interleaved with the probe code, and the
+// probes can reuse the precomputed hashes. The buckets of the first prefetch_dist rows are warmed
+// up right after hashing, so that even the first probes don't miss the cache.
+#define AGG_HASH_MAP_PRECOMPUTE_HASH_VALUES(column, prefetch_dist)                     \
+    size_t const column_size = column->size();                                         \
+    size_t* hash_values = reinterpret_cast<size_t*>(agg_states->data());               \
+    {                                                                                  \
+        const auto& container_data = column->get_data();                               \
+        for (size_t i = 0; i < column_size; i++) {                                     \
+            size_t hashval = this->hash_map.hash_function()(container_data[i]);        \
+            hash_values[i] = hashval;                                                  \
+        }                                                                              \
+        for (size_t i = 0; i < std::min<size_t>(column_size, prefetch_dist); i++) {    \
+            this->hash_map.prefetch_hash(hash_values[i]);                              \
+        }                                                                              \
+    }                                                                                  \
     size_t __prefetch_index = prefetch_dist;
 
 #define AGG_HASH_MAP_PREFETCH_HASH_VALUE()                             \
@@ -256,7 +263,7 @@ struct AggHashMapWithOneNumberKeyWithNullable
                 (*agg_states)[i] = iter->second;
             } else if constexpr (compute_not_founds) {
                 DCHECK(not_founds);
-                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                if (auto iter = this->hash_map.find(key, hash_values[i]); iter != this->hash_map.end()) {
                     (*agg_states)[i] = iter->second;
                 } else {
                     (*not_founds)[i] = 1;
@@ -473,7 +480,7 @@ struct AggHashMapWithOneStringKeyWithNullable
                 (*agg_states)[i] = iter->second;
             } else if constexpr (compute_not_founds) {
                 DCHECK(not_founds);
-                if (auto iter = this->hash_map.find(key); iter != this->hash_map.end()) {
+                if (auto iter = this->hash_map.find(key, hash_values[i]); iter != this->hash_map.end()) {
                     (*agg_states)[i] = iter->second;
                 } else {
                     (*not_founds)[i] = 1;
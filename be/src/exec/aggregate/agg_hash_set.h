@@ -27,6 +27,13 @@
 
 namespace starrocks {
 
+// Hash tables with at least this many buckets no longer fit in cache, so their probe loops
+// prefetch the bucket of a row a few iterations ahead. Smaller tables skip the prefetch pass.
+const constexpr int32_t prefetch_threhold = 8192;
+
+// This is just an empirical value based on benchmark, and you can tweak it if more proper value is found.
+static constexpr size_t AGG_HASH_MAP_DEFAULT_PREFETCH_DIST = 16;
+
 // =====================
 // one level agg hash set
 template <PhmapSeed seed>
@@ -58,13 +65,20 @@ using FixedSize16SliceAggHashSet = phmap::flat_hash_set<SliceKey16, FixedSizeSli
 
 // =====================
 // two level agg hash set
+// The two-level maps/sets will have 2 ^ 8 = 256 sub tables, selected by the high bits of the hash.
+// A larger fanout bounds the pause of a single resize on huge-cardinality GROUP BY / DISTINCT,
+// because each sub table resizes independently and holds 1/256 of the groups.
+static constexpr uint8_t PHMAPN = 8;
+
 template <PhmapSeed seed>
-using Int32AggTwoLevelHashSet = phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>>;
+using Int32AggTwoLevelHashSet =
+        phmap::parallel_flat_hash_set<int32_t, StdHashWithSeed<int32_t, seed>, phmap::priv::hash_default_eq<int32_t>,
+                                      phmap::priv::Allocator<int32_t>, PHMAPN>;
 
 template <PhmapSeed seed>
 using SliceAggTwoLevelHashSet =
         phmap::parallel_flat_hash_set<TSliceWithHash<seed>, THashOnSliceWithHash<seed>, TEqualOnSliceWithHash<seed>,
-                                      phmap::priv::Allocator<Slice>, 4>;
+                                      phmap::priv::Allocator<Slice>, PHMAPN>;
 
 // ==============================================================
 
@@ -363,6 +377,15 @@ struct AggHashSetOfSerializedKey : public AggHashSet<HashSet, AggHashSetOfSerial
             key_column->serialize_batch(_buffer, slice_sizes, chunk_size, max_one_row_size);
         }
 
+        if (this->hash_set.bucket_count() < prefetch_threhold) {
+            this->template build_set_noprefetch<compute_and_allocate>(chunk_size, pool, not_founds);
+        } else {
+            this->template build_set_prefetch<compute_and_allocate>(chunk_size, pool, not_founds);
+        }
+    }
+
+    template <bool compute_and_allocate>
+    ALWAYS_NOINLINE void build_set_noprefetch(size_t chunk_size, MemPool* pool, std::vector<uint8_t>* not_founds) {
         for (size_t i = 0; i < chunk_size; ++i) {
             Slice tmp = {_buffer + i * max_one_row_size, slice_sizes[i]};
             if constexpr (compute_and_allocate) {
@@ -379,6 +402,33 @@ struct AggHashSetOfSerializedKey : public AggHashSet<HashSet, AggHashSetOfSerial
         }
     }
 
+    // prefetch branch better performance in case with larger hash tables
+    template <bool compute_and_allocate>
+    ALWAYS_NOINLINE void build_set_prefetch(size_t chunk_size, MemPool* pool, std::vector<uint8_t>* not_founds) {
+        hashes.resize(chunk_size);
+        for (size_t i = 0; i < chunk_size; ++i) {
+            hashes[i] = KeyType(Slice(_buffer + i * max_one_row_size, slice_sizes[i])).hash;
+        }
+
+        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (__prefetch_index < chunk_size) {
+                this->hash_set.prefetch_hash(hashes[__prefetch_index++]);
+            }
+            KeyType key(_buffer + i * max_one_row_size, slice_sizes[i], hashes[i]);
+            if constexpr (compute_and_allocate) {
+                this->hash_set.lazy_emplace_with_hash(key, hashes[i], [&](const auto& ctor) {
+                    // we must persist the slice before insert
+                    uint8_t* pos = pool->allocate(key.size);
+                    memcpy(pos, key.data, key.size);
+                    ctor(pos, key.size, key.hash);
+                });
+            } else {
+                (*not_founds)[i] = this->hash_set.find(key, hashes[i]) == this->hash_set.end();
+            }
+        }
+    }
+
     size_t get_max_serialize_size(const Columns& key_columns) {
         size_t max_size = 0;
         for (const auto& key_column : key_columns) {
@@ -416,6 +466,7 @@ struct AggHashSetOfSerializedKey : public AggHashSet<HashSet, AggHashSetOfSerial
     std::unique_ptr<MemPool> _mem_pool;
     uint8_t* _buffer;
     ResultVector results;
+    Buffer<size_t> hashes;
 
     int32_t _chunk_size;
 };
@@ -429,12 +480,17 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
 
     bool has_null_column = false;
     int fixed_byte_size = -1; // unset state
-    static constexpr size_t max_fixed_size = sizeof(FixedSizeSliceKey);
+    struct CacheEntry {
+        FixedSizeSliceKey key;
+        size_t hashval;
+    };
+    static constexpr size_t max_fixed_size = sizeof(CacheEntry);
 
-    AggHashSetOfSerializedKeyFixedSize(int32_t chunk_size)
-            : _mem_pool(std::make_unique<MemPool>()),
-              buffer(_mem_pool->allocate(max_fixed_size * chunk_size)),
-              _chunk_size(chunk_size) {
+    std::vector<CacheEntry> caches;
+
+    AggHashSetOfSerializedKeyFixedSize(int32_t chunk_size) : _chunk_size(chunk_size) {
+        caches.reserve(chunk_size);
+        auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
         memset(buffer, 0x0, max_fixed_size * _chunk_size);
     }
 
@@ -451,12 +507,25 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
             not_founds->assign(chunk_size, 0);
         }
 
+        auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
         if (has_null_column) {
             memset(buffer, 0x0, max_fixed_size * chunk_size);
         }
 
+        if (this->hash_set.bucket_count() < prefetch_threhold) {
+            this->template build_set_noprefetch<compute_and_allocate>(chunk_size, key_columns, not_founds);
+        } else {
+            this->template build_set_prefetch<compute_and_allocate>(chunk_size, key_columns, not_founds);
+        }
+    }
+
+    template <bool compute_and_allocate>
+    ALWAYS_NOINLINE void build_set_noprefetch(size_t chunk_size, const Columns& key_columns,
+                                              std::vector<uint8_t>* not_founds) {
+        constexpr int key_size = sizeof(FixedSizeSliceKey);
+        auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
         for (const auto& key_column : key_columns) {
-            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
+            key_column->serialize_batch(buffer, slice_sizes, chunk_size, key_size);
         }
 
         auto* key = reinterpret_cast<FixedSizeSliceKey*>(buffer);
@@ -476,6 +545,39 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
         }
     }
 
+    // prefetch branch better performance in case with larger hash tables
+    template <bool compute_and_allocate>
+    ALWAYS_NOINLINE void build_set_prefetch(size_t chunk_size, const Columns& key_columns,
+                                            std::vector<uint8_t>* not_founds) {
+        auto* buffer = reinterpret_cast<uint8_t*>(caches.data());
+        for (const auto& key_column : key_columns) {
+            key_column->serialize_batch(buffer, slice_sizes, chunk_size, max_fixed_size);
+        }
+
+        if (has_null_column) {
+            for (size_t i = 0; i < chunk_size; ++i) {
+                caches[i].key.u.size = slice_sizes[i];
+            }
+        }
+        for (size_t i = 0; i < chunk_size; ++i) {
+            caches[i].hashval = this->hash_set.hash_function()(caches[i].key);
+        }
+
+        size_t __prefetch_index = AGG_HASH_MAP_DEFAULT_PREFETCH_DIST;
+
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (__prefetch_index < chunk_size) {
+                this->hash_set.prefetch_hash(caches[__prefetch_index++].hashval);
+            }
+            FixedSizeSliceKey& key = caches[i].key;
+            if constexpr (compute_and_allocate) {
+                this->hash_set.lazy_emplace_with_hash(key, caches[i].hashval, [&](const auto& ctor) { ctor(key); });
+            } else {
+                (*not_founds)[i] = this->hash_set.find(key, caches[i].hashval) == this->hash_set.end();
+            }
+        }
+    }
+
     void insert_keys_to_columns(ResultVector& keys, const Columns& key_columns, int32_t chunk_size) {
         DCHECK(fixed_byte_size != -1);
         tmp_slices.reserve(chunk_size);
@@ -503,8 +605,6 @@ struct AggHashSetOfSerializedKeyFixedSize : public AggHashSet<HashSet, AggHashSe
     static constexpr bool has_single_null_key = false;
 
     Buffer<uint32_t> slice_sizes;
-    std::unique_ptr<MemPool> _mem_pool;
-    uint8_t* buffer;
     ResultVector results;
     std::vector<Slice> tmp_slices;
 
@@ -57,10 +57,6 @@ Status AggregateStreamingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bo
         (*chunk)->reset();
     }
 
-#ifdef DEBUG
-    static int loop = 0;
-#endif
-
     // TODO: merge small chunks to large chunk for optimization
     while (!_child_eos) {
         ChunkPtr input_chunk;
@@ -76,90 +72,18 @@ Status AggregateStreamingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bo
 
             if (_aggregator->streaming_preaggregation_mode() == TStreamingPreaggregationMode::FORCE_STREAMING) {
                 // force execute streaming
-                SCOPED_TIMER(_aggregator->streaming_timer());
-                RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming(input_chunk.get(), chunk));
+                RETURN_IF_ERROR(_push_chunk_by_force_streaming(input_chunk.get(), chunk));
                 break;
             } else if (_aggregator->streaming_preaggregation_mode() ==
                        TStreamingPreaggregationMode::FORCE_PREAGGREGATION) {
-                RETURN_IF_ERROR(state->check_mem_limit("AggrNode"));
-                SCOPED_TIMER(_aggregator->agg_compute_timer());
-                TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(input_chunk_size));
-                if (_aggregator->is_none_group_by_exprs()) {
-                    RETURN_IF_ERROR(_aggregator->compute_single_agg_state(input_chunk.get(), input_chunk_size));
-                } else {
-                    RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(input_chunk.get(), input_chunk_size));
-                }
-
-                TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
-
-                COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
-
+                RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(state, input_chunk.get(), input_chunk_size));
                 continue;
             } else {
-                // TODO: calc the real capacity of hashtable, will add one interface in the class of habletable
-                size_t real_capacity =
-                        _aggregator->hash_map_variant().capacity() - _aggregator->hash_map_variant().capacity() / 8;
-                size_t remain_size = real_capacity - _aggregator->hash_map_variant().size();
-                [[maybe_unused]] bool ht_needs_expansion = remain_size < input_chunk_size;
-
-#ifdef DEBUG
-                // chaos test for streaming or agg, The results have to be consistent
-                // when group by type of double, it maybe cause dissonant result because of precision loss for double
-                // thus, so check case will fail, so it only work under DEBUG mode
-                loop++;
-                if (loop % 2 == 0) {
-#else
-                if (!ht_needs_expansion ||
-                    _aggregator->should_expand_preagg_hash_tables(_children[0]->rows_returned(), input_chunk_size,
-                                                                  _aggregator->mem_pool()->total_allocated_bytes(),
-                                                                  _aggregator->hash_map_variant().size())) {
-#endif
-                    RETURN_IF_ERROR(state->check_mem_limit("AggrNode"));
-                    // hash table is not full or allow expand the hash table according reduction rate
-                    SCOPED_TIMER(_aggregator->agg_compute_timer());
-                    TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(input_chunk_size));
-                    if (_aggregator->is_none_group_by_exprs()) {
-                        RETURN_IF_ERROR(_aggregator->compute_single_agg_state(input_chunk.get(), input_chunk_size));
-                    } else {
-                        RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(input_chunk.get(), input_chunk_size));
-                    }
-
-                    TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
-                    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
-                    continue;
+                RETURN_IF_ERROR(_push_chunk_by_auto(state, input_chunk.get(), input_chunk_size, chunk));
+                if (*chunk != nullptr && (*chunk)->num_rows() > 0) {
+                    break;
                 } else {
-                    // TODO: direct call the function may affect the performance of some aggregated cases
-                    {
-                        SCOPED_TIMER(_aggregator->agg_compute_timer());
-                        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(input_chunk_size));
-                    }
-
-                    size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
-                    if (zero_count == 0) {
-                        SCOPED_TIMER(_aggregator->streaming_timer());
-                        RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming(input_chunk.get(), chunk));
-                    } else if (zero_count == _aggregator->streaming_selection().size()) {
-                        SCOPED_TIMER(_aggregator->agg_compute_timer());
-                        RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(input_chunk.get(), input_chunk_size));
-                    } else {
-                        {
-                            SCOPED_TIMER(_aggregator->agg_compute_timer());
-                            RETURN_IF_ERROR(_aggregator->compute_batch_agg_states_with_selection(input_chunk.get(),
-                                                                                                 input_chunk_size));
-                        }
-                        {
-                            SCOPED_TIMER(_aggregator->streaming_timer());
-                            RETURN_IF_ERROR(
-                                    _aggregator->output_chunk_by_streaming_with_selection(input_chunk.get(), chunk));
-                        }
-                    }
-
-                    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
-                    if (*chunk != nullptr && (*chunk)->num_rows() > 0) {
-                        break;
-                    } else {
-                        continue;
-                    }
+                    continue;
                 }
             }
         }
@@ -196,6 +120,186 @@ Status AggregateStreamingNode::get_next(RuntimeState* state, ChunkPtr* chunk, bo
     return Status::OK();
 }
 
+Status AggregateStreamingNode::_push_chunk_by_force_streaming(Chunk* input_chunk, ChunkPtr* chunk) {
+    SCOPED_TIMER(_aggregator->streaming_timer());
+    RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming(input_chunk, chunk));
+    return Status::OK();
+}
+
+Status AggregateStreamingNode::_push_chunk_by_force_preaggregation(RuntimeState* state, Chunk* input_chunk,
+                                                                   size_t chunk_size) {
+    RETURN_IF_ERROR(state->check_mem_limit("AggrNode"));
+    SCOPED_TIMER(_aggregator->agg_compute_timer());
+    TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map(chunk_size));
+    if (_aggregator->is_none_group_by_exprs()) {
+        RETURN_IF_ERROR(_aggregator->compute_single_agg_state(input_chunk, chunk_size));
+    } else {
+        RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(input_chunk, chunk_size));
+    }
+
+    TRY_CATCH_BAD_ALLOC(_aggregator->try_convert_to_two_level_map());
+
+    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    return Status::OK();
+}
+
+Status AggregateStreamingNode::_push_chunk_by_selective_preaggregation(Chunk* input_chunk, size_t chunk_size,
+                                                                       ChunkPtr* chunk, bool need_build) {
+    if (need_build) {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(chunk_size));
+    }
+
+    size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection());
+    // very poor aggregation
+    if (zero_count == 0) {
+        RETURN_IF_ERROR(_push_chunk_by_force_streaming(input_chunk, chunk));
+    }
+    // very high aggregation
+    else if (zero_count == _aggregator->streaming_selection().size()) {
+        SCOPED_TIMER(_aggregator->agg_compute_timer());
+        RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(input_chunk, chunk_size));
+    } else {
+        // middle cases, aggregate the rows hitting the hash table and stream the rest
+        {
+            SCOPED_TIMER(_aggregator->agg_compute_timer());
+            RETURN_IF_ERROR(_aggregator->compute_batch_agg_states_with_selection(input_chunk, chunk_size));
+        }
+        {
+            SCOPED_TIMER(_aggregator->streaming_timer());
+            RETURN_IF_ERROR(_aggregator->output_chunk_by_streaming_with_selection(input_chunk, chunk));
+        }
+    }
+    COUNTER_SET(_aggregator->hash_table_size(), (int64_t)_aggregator->hash_map_variant().size());
+    return Status::OK();
+}
+
+// The same state machine as AggregateStreamingSinkOperator::_push_chunk_by_auto, adapted to the pull model:
+// streaming outputs are written into *chunk and returned to the caller, preaggregation keeps consuming input.
+// See the comment over there for the state transitions.
+Status AggregateStreamingNode::_push_chunk_by_auto(RuntimeState* state, Chunk* input_chunk, size_t chunk_size,
+                                                   ChunkPtr* chunk) {
+    size_t allocated_bytes = _aggregator->hash_map_variant().allocated_memory_usage(_aggregator->mem_pool());
+    const size_t continuous_limit = _auto_context.get_continuous_limit();
+    switch (_auto_state) {
+    case AggrAutoState::INIT_PREAGG: {
+        bool ht_needs_expansion = _aggregator->hash_map_variant().need_expand(chunk_size);
+        _auto_context.init_preagg_count++;
+        if (!ht_needs_expansion ||
+            _aggregator->should_expand_preagg_hash_tables(_aggregator->num_input_rows(), chunk_size, allocated_bytes,
+                                                          _aggregator->hash_map_variant().size())) {
+            // hash table is not full or allow to expand the hash table according reduction rate
+            RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(state, input_chunk, chunk_size));
+            break;
+        } else {
+            _auto_state = AggrAutoState::ADJUST;
+            _auto_context.adjust_count = 0;
+            VLOG_ROW << "auto agg: " << _auto_context.get_auto_state_string(AggrAutoState::INIT_PREAGG) << " "
+                     << _auto_context.init_preagg_count << " -> " << _auto_context.get_auto_state_string(_auto_state);
+        }
+    }
+    case AggrAutoState::ADJUST: {
+        _auto_context.adjust_count++;
+        {
+            SCOPED_TIMER(_aggregator->agg_compute_timer());
+            TRY_CATCH_BAD_ALLOC(_aggregator->build_hash_map_with_selection(chunk_size));
+        }
+
+        size_t hit_count = SIMD::count_zero(_aggregator->streaming_selection());
+        if (_auto_context.adjust_count < continuous_limit && _auto_context.is_low_reduction(hit_count, chunk_size)) {
+            RETURN_IF_ERROR(_push_chunk_by_force_streaming(input_chunk, chunk));
+            _auto_context.pass_through_count++;
+            _auto_context.preagg_count = 0;
+            _auto_context.selective_preagg_count = 0;
+            if (_auto_context.pass_through_count == AggrAutoContext::StableLimit) {
+                _auto_state = AggrAutoState::PASS_THROUGH;
+                VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " low reduction "
+                         << hit_count * 1.0 / chunk_size << " "
+                         << _auto_context.get_auto_state_string(AggrAutoState::ADJUST) << " -> "
+                         << _auto_context.get_auto_state_string(_auto_state);
+            }
+
+        } else if (_auto_context.adjust_count < continuous_limit &&
+                   _auto_context.is_high_reduction(hit_count, chunk_size) &&
+                   allocated_bytes < AggrAutoContext::MaxHtSize) {
+            RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(state, input_chunk, chunk_size));
+
+            _auto_context.preagg_count++;
+            _auto_context.pass_through_count = 0;
+            _auto_context.selective_preagg_count = 0;
+            if (_auto_context.preagg_count == AggrAutoContext::StableLimit) {
+                _auto_state = AggrAutoState::PREAGG;
+                _auto_context.preagg_count = 0;
+                VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " high reduction "
+                         << hit_count * 1.0 / chunk_size << " "
+                         << _auto_context.get_auto_state_string(AggrAutoState::ADJUST) << " -> "
+                         << _auto_context.get_auto_state_string(_auto_state);
+            }
+        } else {
+            RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(input_chunk, chunk_size, chunk, false));
+            _auto_context.selective_preagg_count++;
+            _auto_context.pass_through_count = 0;
+            _auto_context.preagg_count = 0;
+            if (_auto_context.selective_preagg_count == AggrAutoContext::StableLimit) {
+                _auto_state = AggrAutoState::SELECTIVE_PREAGG;
+                VLOG_ROW << "auto agg: continuous " << AggrAutoContext::StableLimit << " "
+                         << _auto_context.get_auto_state_string(AggrAutoState::ADJUST)
+                         << _auto_context.get_auto_state_string(_auto_state);
+            }
+        }
+        break;
+    }
+    case AggrAutoState::PASS_THROUGH: {
+        RETURN_IF_ERROR(_push_chunk_by_force_streaming(input_chunk, chunk));
+        _auto_context.pass_through_count++;
+        if (_auto_context.pass_through_count > continuous_limit) {
+            _auto_state =
+                    allocated_bytes < AggrAutoContext::MaxHtSize ? AggrAutoState::FORCE_PREAGG : AggrAutoState::ADJUST;
+            _auto_context.pass_through_count = 0;
+            _auto_context.preagg_count = 0;
+            _auto_context.adjust_count = 0;
+
+            VLOG_ROW << "auto agg: continuous " << continuous_limit << " "
+                     << _auto_context.get_auto_state_string(AggrAutoState::PASS_THROUGH) << " -> "
+                     << _auto_context.get_auto_state_string(_auto_state);
+            _auto_context.update_continuous_limit();
+        }
+        break;
+    }
+    case AggrAutoState::FORCE_PREAGG:
+    case AggrAutoState::PREAGG: {
+        RETURN_IF_ERROR(_push_chunk_by_force_preaggregation(state, input_chunk, chunk_size));
+        _auto_context.preagg_count++;
+        auto limit = _auto_state == AggrAutoState::FORCE_PREAGG ? AggrAutoContext::ForcePreaggLimit
+                                                                : AggrAutoContext::PreaggLimit;
+        if (_auto_context.preagg_count > limit) {
+            auto current_state = _auto_context.get_auto_state_string(_auto_state);
+            _auto_state = AggrAutoState::ADJUST;
+            _auto_context.preagg_count = 0;
+            _auto_context.adjust_count = 0;
+            VLOG_ROW << "auto agg: continuous " << AggrAutoContext::PreaggLimit << " " << current_state << " -> "
+                     << _auto_context.get_auto_state_string(_auto_state);
+        }
+        break;
+    }
+    case AggrAutoState::SELECTIVE_PREAGG: {
+        RETURN_IF_ERROR(_push_chunk_by_selective_preaggregation(input_chunk, chunk_size, chunk, true));
+        _auto_context.selective_preagg_count++;
+        if (_auto_context.selective_preagg_count > continuous_limit) {
+            _auto_state = AggrAutoState::ADJUST;
+            _auto_context.selective_preagg_count = 0;
+            _auto_context.adjust_count = 0;
+            VLOG_ROW << "auto agg: continuous " << continuous_limit << " "
+                     << _auto_context.get_auto_state_string(AggrAutoState::SELECTIVE_PREAGG) << " -> "
+                     << _auto_context.get_auto_state_string(_auto_state);
+            _auto_context.update_continuous_limit();
+        }
+        break;
+    }
+    }
+    return Status::OK();
+}
+
 Status AggregateStreamingNode::_output_chunk_from_hash_map(ChunkPtr* chunk) {
     if (!_aggregator->it_hash().has_value()) {
         _aggregator->it_hash() = _aggregator->_state_allocator.begin();
@@ -33,5 +33,15 @@ public:
 
 private:
     Status _output_chunk_from_hash_map(ChunkPtr* chunk);
+
+    Status _push_chunk_by_force_streaming(Chunk* input_chunk, ChunkPtr* chunk);
+    Status _push_chunk_by_force_preaggregation(RuntimeState* state, Chunk* input_chunk, size_t chunk_size);
+    Status _push_chunk_by_selective_preaggregation(Chunk* input_chunk, size_t chunk_size, ChunkPtr* chunk,
+                                                   bool need_build);
+    Status _push_chunk_by_auto(RuntimeState* state, Chunk* input_chunk, size_t chunk_size, ChunkPtr* chunk);
+
+    // State shared by the sampling-driven preaggregation controller, see _push_chunk_by_auto.
+    AggrAutoState _auto_state = AggrAutoState::INIT_PREAGG;
+    AggrAutoContext _auto_context;
 };
 } // namespace starrocks
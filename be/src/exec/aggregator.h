@@ -62,13 +62,27 @@ struct RawHashTableIterator {
 };
 
 struct HashTableKeyAllocator {
-    // number of states allocated consecutively in a single alloc
+    // number of states allocated consecutively in the first alloc
     static auto constexpr alloc_batch_size = 1024;
+    // Batches grow geometrically up to this many states, so high-cardinality aggregations
+    // keep their states in a few large contiguous extents instead of many small ones. Large
+    // extents get dedicated MemPool chunks, which can be backed by transparent huge pages
+    // (config::madvise_huge_pages).
+    static auto constexpr max_alloc_batch_size = 64 * 1024;
     // memory aligned when allocate
     static size_t constexpr aligned = 16;
 
+    struct StateBatch {
+        void* data = nullptr;
+        // number of states handed out from this batch
+        int used = 0;
+        // number of states this batch can hold
+        int capacity = 0;
+    };
+
     int aggregate_key_size = 0;
-    std::vector<std::pair<void*, int>> vecs;
+    int next_batch_size = alloc_batch_size;
+    std::vector<StateBatch> vecs;
     MemPool* pool = nullptr;
 
     RawHashTableIterator begin() { return {this, 0, 0}; }
@@ -76,25 +90,33 @@ struct HashTableKeyAllocator {
     RawHashTableIterator end() { return {this, vecs.size(), 0}; }
 
     AggDataPtr allocate() {
-        if (vecs.empty() || vecs.back().second == alloc_batch_size) {
-            uint8_t* mem = pool->allocate_aligned(alloc_batch_size * aggregate_key_size, aligned);
+        if (vecs.empty() || vecs.back().used == vecs.back().capacity) {
+            int batch_size = next_batch_size;
+            uint8_t* mem = pool->allocate_aligned(static_cast<int64_t>(batch_size) * aggregate_key_size, aligned);
             if (mem == nullptr) {
                 throw std::bad_alloc();
             }
-            vecs.emplace_back(mem, 0);
+            vecs.emplace_back(StateBatch{mem, 0, batch_size});
+            if (next_batch_size < max_alloc_batch_size) {
+                next_batch_size *= 2;
+            }
         }
-        return static_cast<AggDataPtr>(vecs.back().first) + aggregate_key_size * vecs.back().second++;
+        return static_cast<AggDataPtr>(vecs.back().data) + aggregate_key_size * vecs.back().used++;
     }
 
     AggDataPtr allocate_null_key_data() { return pool->allocate_aligned(aggregate_key_size, aligned); }
 
-    void reset() { vecs.clear(); }
+    void reset() {
+        vecs.clear();
+        next_batch_size = alloc_batch_size;
+    }
 
     void rollback() {
         DCHECK(!vecs.empty());
-        DCHECK_GT(vecs.back().second, 0);
-        vecs.back().second--;
-        if (vecs.back().second == 0) {
+        DCHECK_GT(vecs.back().used, 0);
+        vecs.back().used--;
+        if (vecs.back().used == 0) {
+            next_batch_size = vecs.back().capacity;
             vecs.pop_back();
         }
     }
@@ -102,14 +124,14 @@ struct HashTableKeyAllocator {
 
 inline void RawHashTableIterator::next() {
     y++;
-    if (y == alloc->vecs[x].second) {
+    if (y == alloc->vecs[x].used) {
         y = 0;
         x++;
     }
 }
 
 inline uint8_t* RawHashTableIterator::value() {
-    return static_cast<uint8_t*>(alloc->vecs[x].first) + alloc->aggregate_key_size * y;
+    return static_cast<uint8_t*>(alloc->vecs[x].data) + alloc->aggregate_key_size * y;
 }
 
 class Aggregator;
@@ -121,9 +121,17 @@ pipeline::OpFactories AnalyticNode::decompose_to_pipeline(pipeline::PipelineBuil
         context->inherit_upstream_source_properties(hash_partition_source_op.get(), upstream_source_op);
         ops_with_sink.push_back(std::move(hash_partition_source_op));
     } else if (is_skewed) {
+        // A single huge partition would serialize the query on one driver. The ordered partition
+        // exchange may split it across drivers, which is only correct when every result can be
+        // patched with a per-range offset, i.e. pure ROW_NUMBER queries.
+        bool enable_intra_partition_split =
+                std::all_of(_tnode.analytic_node.analytic_functions.begin(),
+                            _tnode.analytic_node.analytic_functions.end(), [](const TExpr& desc) {
+                                return desc.nodes[0].fn.name.function_name == "row_number";
+                            });
         // The former sort will use passthrough exchange, so we need to add ordered partition local exchange here.
-        ops_with_sink = context->maybe_interpolate_local_ordered_partition_exchange(runtime_state(), id(),
-                                                                                    ops_with_sink, _partition_exprs);
+        ops_with_sink = context->maybe_interpolate_local_ordered_partition_exchange(
+                runtime_state(), id(), ops_with_sink, _partition_exprs, enable_intra_partition_split);
     }
 
     upstream_source_op = context->source_operator(ops_with_sink);
@@ -20,6 +20,7 @@
 
 #include "column/chunk.h"
 #include "column/column_helper.h"
+#include "exec/pipeline/exchange/local_exchange.h"
 #include "common/config.h"
 #include "common/status.h"
 #include "exprs/agg/count.h"
@@ -334,6 +335,11 @@ Status Analytor::open(RuntimeState* state) {
         }
         AggDataPtr agg_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
         _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, agg_states, this));
+        if (_use_frame_block_process) {
+            // A second row of states accumulates the block being folded.
+            AggDataPtr block_states = _mem_pool->allocate_aligned(_agg_states_total_size, _max_agg_state_align_size);
+            _managed_fn_states.emplace_back(std::make_unique<ManagedFunctionStates>(&_agg_fn_ctxs, block_states, this));
+        }
         return Status::OK();
     };
 
@@ -419,10 +425,38 @@ std::string Analytor::debug_string() const {
 Status Analytor::_prepare_processing_mode(RuntimeState* state, RuntimeProfile* runtime_profile) {
     TAnalyticWindow window = _tnode.analytic_node.window;
     _process_impl = &Analytor::_materializing_process;
+
+    // A wide sliding frame whose functions cannot be updated removable-cumulatively is re-aggregated
+    // from scratch for every row, which is quadratic in the frame length. Merging pre-aggregated
+    // block states caps the per-row cost at O(frame / FRAME_BLOCK_SIZE) merges plus two partial
+    // blocks of updates. Lead/lag functions need an unnormalized frame and the functions without a
+    // FunctionContext (rank and friends) have no intermediate type, so both keep the default path.
+    if (config::pipeline_analytic_enable_frame_block_process && _tnode.analytic_node.__isset.window &&
+        !_use_removable_cumulative_process && window.type == TAnalyticWindowType::ROWS &&
+        window.__isset.window_start && window.__isset.window_end) {
+        const int64_t frame_span = _rows_end_offset - _rows_start_offset + 1;
+        _use_frame_block_process =
+                frame_span >= config::pipeline_analytic_frame_block_process_threshold &&
+                std::all_of(_agg_fn_ctxs.begin(), _agg_fn_ctxs.end(),
+                            [](FunctionContext* ctx) { return ctx != nullptr; }) &&
+                std::all_of(_fns.begin(), _fns.end(), [](const TFunction& fn) { return fn.__isset.aggregate_fn; }) &&
+                std::none_of(_is_lead_lag_functions.begin(), _is_lead_lag_functions.end(),
+                             [](bool is_lead_lag) { return is_lead_lag; });
+    }
+    if (_use_frame_block_process) {
+        for (auto& fn : _fns) {
+            // The window function is always the nullable variant, so is its serialized state.
+            _frame_block_states.emplace_back(
+                    ColumnHelper::create_column(TypeDescriptor::from_thrift(fn.aggregate_fn.intermediate_type), true));
+        }
+    }
+
     std::stringstream process_mode;
     process_mode << (_need_partition_materializing ? "Materializing/" : "Streaming/");
-    process_mode << (_use_removable_cumulative_process ? "RemovableCumulative"
-                                                       : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition"));
+    process_mode << (_use_removable_cumulative_process
+                             ? "RemovableCumulative"
+                             : (_use_frame_block_process ? "FrameBlockMerge"
+                                                         : (_is_unbounded_preceding ? "Cumulative" : "ByDefinition")));
     runtime_profile->add_info_string("ProcessMode", process_mode.str());
     if (!_tnode.analytic_node.__isset.window) {
         _materializing_process_impl = &Analytor::_materializing_process_for_unbounded_frame;
@@ -612,6 +646,11 @@ Status Analytor::_add_chunk(const ChunkPtr& chunk) {
         }
     }
 
+    if (auto* extra = dynamic_cast<pipeline::PartitionSplitOffsetExtraData*>(chunk->get_extra_data().get());
+        extra != nullptr) {
+        _partition_split_offsets[_input_rows] = extra->offset();
+    }
+
     _input_chunk_first_row_positions.emplace_back(_input_rows);
     _input_rows += chunk_size;
     _input_chunks.emplace_back(chunk);
@@ -799,6 +838,9 @@ Status Analytor::_streaming_process_for_sliding_frame(RuntimeState* state) {
         auto remain_size = _current_chunk_size() - _window_result_position();
         _init_window_result_columns();
         _find_partition_end();
+        if (_use_frame_block_process) {
+            _fold_frame_blocks();
+        }
 
         while (_current_row_position < _partition.end && remain_size > 0) {
             const FrameRange frame = _get_frame_range();
@@ -812,6 +854,8 @@ Status Analytor::_streaming_process_for_sliding_frame(RuntimeState* state) {
 
             if (_use_removable_cumulative_process) {
                 _update_window_batch_removable_cumulatively();
+            } else if (_use_frame_block_process) {
+                _update_window_batch_by_frame_blocks();
             } else {
                 // Update agg state in batch manner for each row.
                 _reset_window_state();
@@ -909,6 +953,14 @@ void Analytor::_materializing_process_for_sliding_frame(RuntimeState* state) {
         while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
             _update_window_batch_removable_cumulatively();
 
+            _get_window_function_result(_window_result_position(), _window_result_position() + 1);
+            _update_current_row_position(1);
+        }
+    } else if (_use_frame_block_process) {
+        _fold_frame_blocks();
+        while (_current_row_position < _partition.end && !_is_current_chunk_finished_eval()) {
+            _update_window_batch_by_frame_blocks();
+
             _get_window_function_result(_window_result_position(), _window_result_position() + 1);
             _update_current_row_position(1);
         }
@@ -961,6 +1013,93 @@ void Analytor::_update_window_batch_removable_cumulatively() {
     }
 }
 
+void Analytor::_fold_frame_blocks() {
+    // Rows in front of the reserved range may already be removed from the buffer. Block states
+    // covering them can never be probed again, so restart the blocks from the first buffered row.
+    if (_frame_block_next_position < _removed_from_buffer_rows) {
+        for (auto& column : _frame_block_states) {
+            column->resize(0);
+        }
+        _frame_block_base_position = _removed_from_buffer_rows;
+        _frame_block_next_position = _removed_from_buffer_rows;
+    }
+
+    // Whether or not _partition.end is real, every buffered row in front of it belongs to the
+    // current partition, so it is always a safe folding boundary.
+    const int64_t folding_end = _get_global_position(_partition.end);
+    while (_frame_block_next_position + FRAME_BLOCK_SIZE <= folding_end) {
+        const int64_t local_start = _frame_block_next_position - _removed_from_buffer_rows;
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            size_t column_size = _agg_intput_columns[i].size();
+            const Column* data_columns[column_size];
+            for (size_t j = 0; j < column_size; j++) {
+                data_columns[j] = _agg_intput_columns[i][j].get();
+            }
+
+            auto* block_state = _managed_fn_states[1]->mutable_data() + _agg_states_offsets[i];
+            _agg_functions[i]->reset(_agg_fn_ctxs[i], _agg_intput_columns[i], block_state);
+            _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], block_state, data_columns,
+                                                                    _partition.start, _partition.end, local_start,
+                                                                    local_start + FRAME_BLOCK_SIZE);
+            _agg_functions[i]->serialize_to_column(_agg_fn_ctxs[i], block_state, _frame_block_states[i].get());
+        }
+        _frame_block_next_position += FRAME_BLOCK_SIZE;
+    }
+}
+
+void Analytor::_update_window_batch_by_frame_blocks() {
+    const FrameRange range = _get_frame_range();
+    const int64_t frame_start = std::max<int64_t>(range.start, _partition.start);
+    const int64_t frame_end = std::min<int64_t>(range.end, _partition.end);
+
+    const int64_t global_start = _get_global_position(frame_start);
+    const int64_t global_end = _get_global_position(frame_end);
+    int64_t first_block = 0;
+    if (global_start > _frame_block_base_position) {
+        first_block = (global_start - _frame_block_base_position + FRAME_BLOCK_SIZE - 1) / FRAME_BLOCK_SIZE;
+    }
+    int64_t end_block = 0;
+    if (global_end > _frame_block_base_position) {
+        end_block = (global_end - _frame_block_base_position) / FRAME_BLOCK_SIZE;
+    }
+    const int64_t folded_blocks = (_frame_block_next_position - _frame_block_base_position) / FRAME_BLOCK_SIZE;
+    end_block = std::min<int64_t>(end_block, folded_blocks);
+
+    if (first_block >= end_block) {
+        // The frame is clipped by the partition boundary to less than one complete block.
+        _reset_window_state();
+        _update_window_batch(_partition.start, _partition.end, range.start, range.end);
+        return;
+    }
+
+    const int64_t merged_start =
+            _frame_block_base_position + first_block * FRAME_BLOCK_SIZE - _removed_from_buffer_rows;
+    const int64_t merged_end = _frame_block_base_position + end_block * FRAME_BLOCK_SIZE - _removed_from_buffer_rows;
+
+    _reset_window_state();
+    for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+        size_t column_size = _agg_intput_columns[i].size();
+        const Column* data_columns[column_size];
+        for (size_t j = 0; j < column_size; j++) {
+            data_columns[j] = _agg_intput_columns[i][j].get();
+        }
+
+        auto* state = _managed_fn_states[0]->mutable_data() + _agg_states_offsets[i];
+        if (frame_start < merged_start) {
+            _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], state, data_columns,
+                                                                    _partition.start, _partition.end, frame_start,
+                                                                    merged_start);
+        }
+        _agg_functions[i]->merge_batch_single_state(_agg_fn_ctxs[i], state, _frame_block_states[i].get(), first_block,
+                                                    end_block - first_block);
+        if (merged_end < frame_end) {
+            _agg_functions[i]->update_batch_single_state_with_frame(_agg_fn_ctxs[i], state, data_columns,
+                                                                    _partition.start, _partition.end, merged_end,
+                                                                    frame_end);
+        }
+    }
+}
+
 Status Analytor::_output_result_chunk(ChunkPtr* chunk) {
     ChunkPtr output_chunk = std::move(_input_chunks[_output_chunk_index]);
     for (size_t i = 0; i < _result_window_columns.size(); i++) {
@@ -989,6 +1128,14 @@ void Analytor::_reset_state_for_next_partition() {
     _partition.start = _partition.end;
     _current_row_position = _partition.start;
     _reset_window_state();
+    if (_use_frame_block_process) {
+        // Blocks never cross partition boundaries, restart them from the new partition start.
+        for (auto& column : _frame_block_states) {
+            column->resize(0);
+        }
+        _frame_block_base_position = _get_global_position(_partition.start);
+        _frame_block_next_position = _frame_block_base_position;
+    }
     DCHECK_GE(_current_row_position, 0);
 }
 
@@ -1195,6 +1342,34 @@ void Analytor::_get_window_function_result(size_t frame_start, size_t frame_end)
         _agg_functions[i]->get_values(_agg_fn_ctxs[i], _managed_fn_states[0]->data() + _agg_states_offsets[i],
                                       agg_column, frame_start, frame_end);
     }
+
+    if (!_partition_split_offsets.empty()) {
+        const int64_t offset = _partition_split_offset();
+        if (offset != 0) {
+            // This driver only received a range of the partition, patch the locally computed row
+            // numbers with the rows that were routed in front of it. The exchange splits a
+            // partition only when every window function is ROW_NUMBER.
+            for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+                if (_fns[i].name.function_name != "row_number") {
+                    continue;
+                }
+                auto& data = ColumnHelper::cast_to_raw<TYPE_BIGINT>(_result_window_columns[i].get())->get_data();
+                for (size_t j = frame_start; j < frame_end; j++) {
+                    data[j] += offset;
+                }
+            }
+        }
+    }
+}
+
+int64_t Analytor::_partition_split_offset() {
+    // Entries in front of the current partition can never match again.
+    const int64_t partition_first_position = _get_global_position(_partition.start);
+    while (!_partition_split_offsets.empty() && _partition_split_offsets.begin()->first < partition_first_position) {
+        _partition_split_offsets.erase(_partition_split_offsets.begin());
+    }
+    auto it = _partition_split_offsets.find(partition_first_position);
+    return it == _partition_split_offsets.end() ? 0 : it->second;
 }
 
 void Analytor::_set_partition_size_for_function() {
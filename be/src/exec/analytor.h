@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <map>
 #include <queue>
 #include <string>
 
@@ -193,6 +194,12 @@ private:
 
     void _update_window_batch(int64_t partition_start, int64_t partition_end, int64_t frame_start, int64_t frame_end);
     void _update_window_batch_removable_cumulatively();
+    // Pre-aggregate every complete block of buffered partition rows into a serialized intermediate
+    // state appended to _frame_block_states.
+    void _fold_frame_blocks();
+    // Evaluate one row of a wide sliding frame by merging the serialized states of the blocks fully
+    // covered by the frame, updating only the partial blocks at both edges row by row.
+    void _update_window_batch_by_frame_blocks();
 
     Status _output_result_chunk(ChunkPtr* chunk);
 
@@ -229,6 +236,10 @@ private:
     void _update_current_row_position(int64_t increment) { _current_row_position += increment; }
 
     void _get_window_function_result(size_t frame_start, size_t frame_end);
+    // Rows of the current partition routed to other drivers in front of this one, non-zero only
+    // when the ordered partition exchange split a skewed partition, see
+    // PartitionSplitOffsetExtraData.
+    int64_t _partition_split_offset();
 
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
@@ -290,6 +301,7 @@ private:
     // Any of these conditions is satisfied, the materializing processing is required.
     bool _need_partition_materializing = false;
     bool _use_removable_cumulative_process = false;
+    bool _use_frame_block_process = false;
     // When calculating window functions such as CUME_DIST and PERCENT_RANK,
     // it's necessary to specify the size of the partition.
     bool _should_set_partition_size = false;
@@ -335,6 +347,20 @@ private:
     Segment _peer_group;
     SegmentStatistics _peer_group_statistics;
     std::queue<int64_t> _candidate_peer_group_ends;
+
+    // Sliding frames longer than pipeline_analytic_frame_block_process_threshold are evaluated by
+    // pre-aggregating fixed-size blocks of partition rows, see _update_window_batch_by_frame_blocks.
+    static constexpr int64_t FRAME_BLOCK_SIZE = 128;
+    // Serialized intermediate state of each complete block, one column per window function.
+    Columns _frame_block_states;
+    // Global position of the first row covered by block 0.
+    int64_t _frame_block_base_position = 0;
+    // Global position of the first row not yet folded into a block.
+    int64_t _frame_block_next_position = 0;
+
+    // Global position of a chunk continuing a split partition -> rows of that partition routed to
+    // other drivers in front of it. Fed by _add_chunk from PartitionSplitOffsetExtraData.
+    std::map<int64_t, int64_t> _partition_split_offsets;
 };
 
 // Helper class that properly invokes destructor when state goes out of scope.
@@ -206,11 +206,15 @@ void AvroScanner::_report_error(const std::string& line, const std::string& err_
 Status AvroScanner::_construct_row(const avro_value_t& avro_value, Chunk* chunk) {
     size_t slot_size = _src_slot_descriptors.size();
     size_t jsonpath_size = _json_paths.size();
+    // The src chunk columns were appended in slot order, so track the column index
+    // directly instead of looking it up by slot id for every row.
+    int column_index = -1;
     for (size_t i = 0; i < slot_size; i++) {
         if (_src_slot_descriptors[i] == nullptr) {
             continue;
         }
-        auto column = down_cast<NullableColumn*>(chunk->get_column_by_slot_id(_src_slot_descriptors[i]->id()).get());
+        ++column_index;
+        auto column = down_cast<NullableColumn*>(chunk->get_column_by_index(column_index).get());
         if (UNLIKELY(i >= jsonpath_size)) {
             column->append_nulls(1);
             continue;
@@ -342,8 +346,7 @@ Status AvroScanner::_construct_row_without_jsonpath(const avro_value_t& avro_val
         }
         SlotInfo& slot_info = _data_idx_to_slot[i];
         if (slot_info.id > -1) {
-            int column_index = chunk->get_index_by_slot_id(slot_info.id);
-            _found_columns[column_index] = true;
+            _found_columns[slot_info.column_index] = true;
         } else if (slot_info.id == -1) {
             continue;
         } else if (UNLIKELY(slot_info.id < -1)) {
@@ -358,11 +361,11 @@ Status AvroScanner::_construct_row_without_jsonpath(const avro_value_t& avro_val
             slot_info.id = slot_desc->id();
             slot_info.type = slot_desc->type();
             slot_info.key = key;
-            int column_index = chunk->get_index_by_slot_id(slot_info.id);
-            _found_columns[column_index] = true;
+            slot_info.column_index = chunk->get_index_by_slot_id(slot_info.id);
+            _found_columns[slot_info.column_index] = true;
         }
 
-        auto& column = chunk->get_column_by_slot_id(slot_info.id);
+        auto& column = chunk->get_column_by_index(slot_info.column_index);
         // We should expand the union type.
         avro_value_t* cur_value = &element_value;
         if (UNLIKELY(avro_value_get_type(cur_value) == AVRO_UNION)) {
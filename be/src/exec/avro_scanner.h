@@ -64,6 +64,9 @@ public:
         SlotId id;
         TypeDescriptor type;
         std::string key;
+        // The chunk column index of the slot, resolved once: the src chunk is rebuilt
+        // with the same layout for every batch, so the index stays valid.
+        int column_index = -1;
     };
 
 private:
@@ -235,11 +235,23 @@ starrocks::ChunkPtr ChunksSorterFullSort::_late_materialize_tmpl(const starrocks
     auto ordinal_column = sorted_eager_chunk->get_column_by_slot_id(Chunk::SORT_ORDINAL_COLUMN_SLOT_ID);
     auto& ordinal_data = down_cast<OrdinalColumn<T>*>(ordinal_column.get())->get_data();
     T _offset_in_chunk_mask = static_cast<T>((1L << _offset_in_chunk_bits) - 1);
-    for (auto i = 0; i < num_rows; ++i) {
+    // Decode the ordinals into a permutation and gather the lazy columns column-wise, instead of
+    // appending row by row, which pays the virtual dispatch per row per column.
+    Permutation perm;
+    perm.resize(num_rows);
+    for (size_t i = 0; i < num_rows; ++i) {
         T ordinal = ordinal_data[i];
-        T chunk_idx = ordinal >> _offset_in_chunk_bits;
-        T off_in_chunk = ordinal & _offset_in_chunk_mask;
-        sorted_lazy_chunk->append(*_late_materialized_chunks[chunk_idx], off_in_chunk, 1);
+        perm[i] = {static_cast<uint32_t>(ordinal >> _offset_in_chunk_bits),
+                   static_cast<uint32_t>(ordinal & _offset_in_chunk_mask)};
+    }
+    for (size_t col_index = 0; col_index < sorted_lazy_chunk->num_columns(); ++col_index) {
+        Columns partial_columns;
+        partial_columns.reserve(_late_materialized_chunks.size());
+        for (const auto& lazy_chunk : _late_materialized_chunks) {
+            partial_columns.push_back(lazy_chunk->get_column_by_index(col_index));
+        }
+        materialize_column_by_permutation(sorted_lazy_chunk->get_column_by_index(col_index).get(), partial_columns,
+                                          perm);
     }
     auto final_chunk = std::make_shared<Chunk>();
     for (auto slot_id : _column_id_to_slot_id) {
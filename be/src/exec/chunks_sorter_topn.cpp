@@ -55,22 +55,35 @@ void ChunksSorterTopn::setup_runtime(RuntimeState* state, RuntimeProfile* profil
 
 // Cumulative chunks into _raw_chunks for sorting.
 Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
+    ChunkPtr input = chunk;
+
+    // Once _merged_segment holds rows_to_sort sorted rows, any incoming row larger than its max
+    // boundary row would be discarded by the next _sort_chunks anyway, so drop such rows right
+    // away instead of buffering them. For small limits on large inputs most rows are pruned here,
+    // which keeps the buffered batches (and the repeated partial sorts over them) small.
+    if (_init_merged_segment) {
+        RETURN_IF_ERROR(_eager_filter_chunk(state, &input));
+        if (input == nullptr) {
+            return Status::OK();
+        }
+    }
+
     auto& raw_chunks = _raw_chunks.chunks;
     size_t chunk_number = raw_chunks.size();
     if (chunk_number <= 0) {
-        raw_chunks.push_back(chunk);
+        raw_chunks.push_back(input);
         chunk_number++;
-    } else if (raw_chunks[chunk_number - 1]->num_rows() + chunk->num_rows() > _state->chunk_size()) {
-        raw_chunks.push_back(chunk);
+    } else if (raw_chunks[chunk_number - 1]->num_rows() + input->num_rows() > _state->chunk_size()) {
+        raw_chunks.push_back(input);
         chunk_number++;
     } else {
         // Old planner will not remove duplicated sort column.
         // columns in chunk may have same column ptr
         // append_safe will check size of all columns in dest chunk
         // to ensure same column will not apppend repeatedly.
-        raw_chunks[chunk_number - 1]->append_safe(*chunk);
+        raw_chunks[chunk_number - 1]->append_safe(*input);
     }
-    _raw_chunks.size_of_rows += chunk->num_rows();
+    _raw_chunks.size_of_rows += input->num_rows();
 
     // When number of Chunks exceeds _limit or _size_of_chunk_batch, run sort and then part of
     // cached chunks can be dropped, so it can reduce the memory usage.
@@ -84,6 +97,52 @@ Status ChunksSorterTopn::update(RuntimeState* state, const ChunkPtr& chunk) {
     return Status::OK();
 }
 
+Status ChunksSorterTopn::_eager_filter_chunk(RuntimeState* state, ChunkPtr* chunk) {
+    const size_t rows_to_sort = _get_number_of_rows_to_sort();
+    // Without rows_to_sort rows in _merged_segment there is no max boundary to filter against yet.
+    if (_merged_segment.chunk->num_rows() < rows_to_sort) {
+        return Status::OK();
+    }
+    SCOPED_TIMER(_sort_filter_timer);
+
+    DataSegments segments;
+    segments.emplace_back(_sort_exprs, *chunk);
+
+    std::vector<std::vector<uint8_t>> filter_array;
+    uint32_t smaller_num, include_num;
+    RETURN_IF_ERROR(
+            _merged_segment.get_filter_array(segments, rows_to_sort, filter_array, _sort_desc, smaller_num, include_num));
+
+    const size_t num_rows = (*chunk)->num_rows();
+    const size_t kept_rows = smaller_num + include_num;
+    if (kept_rows == num_rows) {
+        return Status::OK();
+    }
+    if (_sort_filter_rows) {
+        COUNTER_UPDATE(_sort_filter_rows, num_rows - kept_rows);
+    }
+    if (kept_rows == 0) {
+        chunk->reset();
+        return Status::OK();
+    }
+
+    // The incoming chunk may be shared with the upstream operator, so gather the surviving rows
+    // into a fresh chunk instead of filtering it in place.
+    std::vector<uint32_t> selected;
+    selected.reserve(kept_rows);
+    const auto& filter = filter_array[0];
+    for (uint32_t i = 0; i < num_rows; ++i) {
+        if (filter[i] != DataSegment::LARGER_THAN_MAX_OF_SEGMENT) {
+            selected.push_back(i);
+        }
+    }
+    ChunkPtr filtered = (*chunk)->clone_empty(kept_rows);
+    filtered->append_selective(**chunk, selected.data(), 0, selected.size());
+    *chunk = std::move(filtered);
+
+    return Status::OK();
+}
+
 Status ChunksSorterTopn::do_done(RuntimeState* state) {
     auto& raw_chunks = _raw_chunks.chunks;
     if (!raw_chunks.empty()) {
@@ -106,6 +106,10 @@ private:
     [[nodiscard]] Status _filter_and_sort_data(RuntimeState* state, std::pair<Permutation, Permutation>& permutations,
                                                DataSegments& segments);
 
+    // Filter the incoming chunk against the boundary rows of _merged_segment before it gets buffered,
+    // so rows that can never enter the final result are dropped without being copied or re-sorted.
+    [[nodiscard]] Status _eager_filter_chunk(RuntimeState* state, ChunkPtr* chunk);
+
     [[nodiscard]] Status _merge_sort_data_as_merged_segment(RuntimeState* state,
                                                             std::pair<Permutation, Permutation>& new_permutation,
                                                             DataSegments& segments);
@@ -57,6 +57,7 @@ Status ConnectorScanNode::init(const TPlanNode& tnode, RuntimeState* state) {
 
     if (runtime_state()->query_ctx() != nullptr) {
         _mem_share_arb = runtime_state()->query_ctx()->connector_scan_operator_mem_share_arbitrator();
+        _io_tasks_arb = runtime_state()->query_ctx()->connector_scan_operator_io_tasks_arbitrator();
     }
     if (_mem_share_arb != nullptr) {
         _scan_mem_limit = _mem_share_arb->set_scan_mem_ratio(mem_ratio);
@@ -137,6 +138,7 @@ pipeline::OpFactories ConnectorScanNode::decompose_to_pipeline(pipeline::Pipelin
 
     // order matters. we will use scan mem limit to limit chunk source mem bytes.
     scan_op->set_mem_share_arb(_mem_share_arb);
+    scan_op->set_io_tasks_arb(_io_tasks_arb);
     scan_op->set_scan_mem_limit(_scan_mem_limit);
     scan_op->set_data_source_mem_bytes(_estimated_data_source_mem_bytes);
     scan_op->set_chunk_source_mem_bytes(_estimated_data_source_mem_bytes +
@@ -28,7 +28,8 @@ class ConnectorScanner;
 
 namespace pipeline {
 class ConnectorScanOperatorMemShareArbitrator;
-}
+class ConnectorScanOperatorIOTasksArbitrator;
+} // namespace pipeline
 
 class ConnectorScanNode final : public starrocks::ScanNode {
 public:
@@ -150,5 +151,6 @@ private:
     std::atomic_bool _use_stream_load_thread_pool = false;
 #endif
     pipeline::ConnectorScanOperatorMemShareArbitrator* _mem_share_arb = nullptr;
+    pipeline::ConnectorScanOperatorIOTasksArbitrator* _io_tasks_arb = nullptr;
 };
 } // namespace starrocks
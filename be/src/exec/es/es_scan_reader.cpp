@@ -34,9 +34,11 @@
 
 #include "exec/es/es_scan_reader.h"
 
+#include <future>
 #include <map>
 #include <sstream>
 #include <string>
+#include <tuple>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -159,28 +161,14 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser)
         if (_exactly_once) {
             return Status::OK();
         }
-        RETURN_IF_ERROR(_network_client.init(_next_scroll_url));
-        _network_client.set_basic_auth(_user_name, _passwd);
-        _network_client.set_content_type("application/json");
-        _network_client.set_timeout_ms(_http_timeout_ms);
-        if (_ssl_enabled) {
-            _network_client.trust_all_ssl();
-        }
-        RETURN_IF_ERROR(_network_client.execute_post_request(
-                ESScrollQueryBuilder::build_next_scroll_body(_scroll_id, _scroll_keep_alive), &response));
-        long status = _network_client.get_http_status();
-        if (status == 404) {
-            LOG(WARNING) << "request scroll search failure 404["
-                         << ", response: " << (response.empty() ? "empty response" : response);
-            return Status::InternalError("No search context found for " + _scroll_id);
-        }
-        if (status != 200) {
-            LOG(WARNING) << "request scroll search failure["
-                         << "http status" << status
-                         << ", response: " << (response.empty() ? "empty response" : response);
-            return Status::InternalError("request scroll search failure: " +
-                                         (response.empty() ? "empty response" : response));
+        Status status;
+        if (_prefetched_response.valid()) {
+            std::tie(status, response) = _prefetched_response.get();
+        } else {
+            std::tie(status, response) = _execute_scroll_request(
+                    ESScrollQueryBuilder::build_next_scroll_body(_scroll_id, _scroll_keep_alive));
         }
+        RETURN_IF_ERROR(status);
     }
 
     scroll_parser.reset(new T(_doc_value_mode));
@@ -203,14 +191,56 @@ Status ESScanReader::get_next(bool* scan_eos, std::unique_ptr<T>& scroll_parser)
         }
 
         _eos = scroll_parser->get_size() < _batch_size;
+        if (!_eos && config::es_enable_scroll_prefetch) {
+            // fetch the next page while the caller converts this batch to columns
+            _prefetched_response = std::async(std::launch::async, [this, scroll_id = _scroll_id]() {
+                return _execute_scroll_request(
+                        ESScrollQueryBuilder::build_next_scroll_body(scroll_id, _scroll_keep_alive));
+            });
+        }
     }
     *scan_eos = false;
     return Status::OK();
 }
 
+std::pair<Status, std::string> ESScanReader::_execute_scroll_request(const std::string& request_body) {
+    std::string response;
+    auto do_request = [&]() -> Status {
+        HttpClient client;
+        RETURN_IF_ERROR(client.init(_next_scroll_url));
+        client.set_basic_auth(_user_name, _passwd);
+        client.set_content_type("application/json");
+        client.set_timeout_ms(_http_timeout_ms);
+        if (_ssl_enabled) {
+            client.trust_all_ssl();
+        }
+        RETURN_IF_ERROR(client.execute_post_request(request_body, &response));
+        long status = client.get_http_status();
+        if (status == 404) {
+            LOG(WARNING) << "request scroll search failure 404["
+                         << ", response: " << (response.empty() ? "empty response" : response);
+            return Status::InternalError("No search context found");
+        }
+        if (status != 200) {
+            LOG(WARNING) << "request scroll search failure["
+                         << "http status" << status
+                         << ", response: " << (response.empty() ? "empty response" : response);
+            return Status::InternalError("request scroll search failure: " +
+                                         (response.empty() ? "empty response" : response));
+        }
+        return Status::OK();
+    };
+    Status status = do_request();
+    return {std::move(status), std::move(response)};
+}
+
 template Status ESScanReader::get_next<ScrollParser>(bool* scan_eos, std::unique_ptr<ScrollParser>& scroll_parser);
 
 Status ESScanReader::close() {
+    // wait for an in-flight prefetch before clearing the scroll context it uses
+    if (_prefetched_response.valid()) {
+        (void)_prefetched_response.get();
+    }
     if (_scroll_id.empty()) {
         return Status::OK();
     }
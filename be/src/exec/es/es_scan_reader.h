@@ -34,7 +34,9 @@
 
 #pragma once
 
+#include <future>
 #include <string>
+#include <utility>
 
 #include "http/http_client.h"
 
@@ -70,6 +72,10 @@ public:
     Status close();
 
 private:
+    // issue one scroll request with its own http client, so it can run on a background thread
+    // while the caller still uses `_network_client`. Returns the request status and the body.
+    std::pair<Status, std::string> _execute_scroll_request(const std::string& request_body);
+
     std::string _target;
     std::string _user_name;
     std::string _passwd;
@@ -107,6 +113,8 @@ private:
     int _batch_size;
 
     std::string _cached_response;
+    // the next scroll page, fetched in the background while the current page is converted
+    std::future<std::pair<Status, std::string>> _prefetched_response;
     // keep-alive for es scroll
     std::string _scroll_keep_alive;
     // timeout for es http connetion
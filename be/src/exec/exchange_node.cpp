@@ -35,6 +35,7 @@
 #include "exec/exchange_node.h"
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/chunk_accumulate_operator.h"
 #include "exec/pipeline/exchange/exchange_merge_sort_source_operator.h"
 #include "exec/pipeline/exchange/exchange_parallel_merge_source_operator.h"
@@ -255,7 +256,12 @@ pipeline::OpFactories ExchangeNode::decompose_to_pipeline(pipeline::PipelineBuil
         exchange_source_op->set_degree_of_parallelism(context->degree_of_parallelism());
         operators.emplace_back(exchange_source_op);
     } else {
-        if (_is_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
+        // The single-driver merge sort source merges all senders on one core. When there are many
+        // senders, force_exchange_parallel_merge_senders lets the BE fall back to the parallel
+        // merge source even if the plan didn't ask for it.
+        const bool force_parallel_merge = config::force_exchange_parallel_merge_senders > 0 &&
+                                          _num_senders >= config::force_exchange_parallel_merge_senders;
+        if (_is_parallel_merge || force_parallel_merge || _sort_exec_exprs.is_constant_lhs_ordering()) {
             auto exchange_merge_sort_source_operator = std::make_shared<ExchangeParallelMergeSourceOperatorFactory>(
                     context->next_operator_id(), id(), _num_senders, _input_row_desc, &_sort_exec_exprs, _is_asc_order,
                     _nulls_first, _offset, _limit);
@@ -72,6 +72,12 @@ bool HdfsScannerParams::is_lazy_materialization_slot(SlotId slot_id) const {
     if (conjunct_ctxs_by_slot.find(slot_id) != conjunct_ctxs_by_slot.end()) {
         return false;
     }
+    // a slot referenced only by multi-slot conjuncts can still be materialized lazily,
+    // because those conjuncts are evaluated on the merged chunk after lazy load, when
+    // the slot has been filled for rows surviving the pushed-down per-slot filters.
+    if (slots_of_mutli_slot_conjunct.find(slot_id) != slots_of_mutli_slot_conjunct.end()) {
+        return true;
+    }
     if (slots_in_conjunct.find(slot_id) != slots_in_conjunct.end()) {
         return false;
     }
@@ -14,6 +14,7 @@
 
 #include "exec/jdbc_scanner.h"
 
+#include <cstring>
 #include <memory>
 
 #include "column/column_helper.h"
@@ -168,6 +169,11 @@ Status JDBCScanner::_init_jdbc_scanner() {
     DCHECK(_scanner_has_next != nullptr);
     _scanner_get_next_chunk = env->GetMethodID(_jdbc_scanner_cls->clazz(), "getNextChunk", "()Ljava/util/List;");
 
+    _scanner_get_column_nulls = env->GetMethodID(_jdbc_scanner_cls->clazz(), "getColumnNulls", "(I)[B");
+    DCHECK(_scanner_get_column_nulls != nullptr);
+    _scanner_get_column_data = env->GetMethodID(_jdbc_scanner_cls->clazz(), "getColumnData", "(I)Ljava/lang/Object;");
+    DCHECK(_scanner_get_column_data != nullptr);
+
     _scanner_result_rows = env->GetMethodID(_jdbc_scanner_cls->clazz(), "getResultNumRows", "()I");
     DCHECK(_scanner_result_rows != nullptr);
 
@@ -375,6 +381,14 @@ StatusOr<LogicalType> JDBCScanner::_precheck_data_type(const std::string& java_c
     __builtin_unreachable();
 }
 
+// Columns of these classes arrive from the Java scanner as a primitive array plus a
+// null-indicator array; must stay consistent with PRIMITIVE_ARRAY_TYPE_MAPPING in JDBCScanner.java.
+static bool is_primitive_interchange_class(const std::string& java_class) {
+    return java_class == "java.lang.Boolean" || java_class == "java.lang.Byte" || java_class == "java.lang.Short" ||
+           java_class == "java.lang.Integer" || java_class == "java.lang.Long" || java_class == "java.lang.Float" ||
+           java_class == "java.lang.Double";
+}
+
 Status JDBCScanner::_init_column_class_name(RuntimeState* state) {
     auto* env = JVMFunctionHelper::getInstance().getEnv();
 
@@ -397,6 +411,7 @@ Status JDBCScanner::_init_column_class_name(RuntimeState* state) {
         ASSIGN_OR_RETURN(auto ret_type, _precheck_data_type(class_name, _slot_descs[i]));
         _column_class_names.emplace_back(class_name);
         _result_column_types.emplace_back(ret_type);
+        _primitive_result_columns.emplace_back(is_primitive_interchange_class(class_name));
         // intermediate means the result type from JDBC Scanner
         // Some types cannot be written directly to the column,
         // so we need to write directly to the intermediate type and then cast to the target type:
@@ -471,6 +486,70 @@ Status JDBCScanner::_close_jdbc_scanner() {
     return Status::OK();
 }
 
+Status JDBCScanner::_fill_primitive_column(size_t col_idx, size_t num_rows) {
+    auto* env = JVMFunctionHelper::getInstance().getEnv();
+    auto& result_column = _result_chunk->columns()[col_idx];
+    result_column->resize(num_rows);
+    auto* nullable_column = down_cast<NullableColumn*>(result_column.get());
+
+    auto jnulls = (jbyteArray)env->CallObjectMethod(_jdbc_scanner.handle(), _scanner_get_column_nulls, (jint)col_idx);
+    CHECK_JAVA_EXCEPTION(env, "getColumnNulls failed")
+    LOCAL_REF_GUARD_ENV(env, jnulls);
+    auto jdata = (jarray)env->CallObjectMethod(_jdbc_scanner.handle(), _scanner_get_column_data, (jint)col_idx);
+    CHECK_JAVA_EXCEPTION(env, "getColumnData failed")
+    LOCAL_REF_GUARD_ENV(env, jdata);
+
+    env->GetByteArrayRegion(jnulls, 0, num_rows, reinterpret_cast<jbyte*>(nullable_column->null_column_data().data()));
+
+    void* dst = nullptr;
+    size_t value_size = 0;
+    const auto& data_column = nullable_column->data_column();
+    switch (_result_column_types[col_idx]) {
+    case TYPE_BOOLEAN:
+        dst = ColumnHelper::cast_to_raw<TYPE_BOOLEAN>(data_column)->get_data().data();
+        value_size = 1;
+        break;
+    case TYPE_TINYINT:
+        dst = ColumnHelper::cast_to_raw<TYPE_TINYINT>(data_column)->get_data().data();
+        value_size = 1;
+        break;
+    case TYPE_SMALLINT:
+        dst = ColumnHelper::cast_to_raw<TYPE_SMALLINT>(data_column)->get_data().data();
+        value_size = 2;
+        break;
+    case TYPE_INT:
+        dst = ColumnHelper::cast_to_raw<TYPE_INT>(data_column)->get_data().data();
+        value_size = 4;
+        break;
+    case TYPE_BIGINT:
+        dst = ColumnHelper::cast_to_raw<TYPE_BIGINT>(data_column)->get_data().data();
+        value_size = 8;
+        break;
+    case TYPE_FLOAT:
+        dst = ColumnHelper::cast_to_raw<TYPE_FLOAT>(data_column)->get_data().data();
+        value_size = 4;
+        break;
+    case TYPE_DOUBLE:
+        dst = ColumnHelper::cast_to_raw<TYPE_DOUBLE>(data_column)->get_data().data();
+        value_size = 8;
+        break;
+    default:
+        return Status::InternalError(fmt::format("unexpected primitive interchange type: {}",
+                                                 logical_type_to_string(_result_column_types[col_idx])));
+    }
+
+    // one critical-array access copies the whole batch of this column
+    void* src = env->GetPrimitiveArrayCritical(jdata, nullptr);
+    if (src == nullptr) {
+        return Status::InternalError("get primitive array from JDBC result failed");
+    }
+    memcpy(dst, src, num_rows * value_size);
+    env->ReleasePrimitiveArrayCritical(jdata, src, JNI_ABORT);
+
+    nullable_column->update_has_null();
+    return Status::OK();
+}
+
 Status JDBCScanner::_fill_chunk(jobject jchunk, size_t num_rows, ChunkPtr* chunk) {
     SCOPED_TIMER(_profile.fill_chunk_timer);
     // get result from JNI
@@ -482,6 +561,10 @@ Status JDBCScanner::_fill_chunk(jobject jchunk, size_t num_rows, ChunkPtr* chunk
         (*chunk)->reset();
 
         for (size_t i = 0; i < _slot_descs.size(); i++) {
+            if (_primitive_result_columns[i]) {
+                RETURN_IF_ERROR(_fill_primitive_column(i, num_rows));
+                continue;
+            }
             jobject jcolumn = helper.list_get(jchunk, i);
             LOCAL_REF_GUARD_ENV(env, jcolumn);
             auto& result_column = _result_chunk->columns()[i];
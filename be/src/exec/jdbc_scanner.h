@@ -83,6 +83,8 @@ private:
 
     [[nodiscard]] Status _fill_chunk(jobject jchunk, size_t num_rows, ChunkPtr* chunk);
 
+    [[nodiscard]] Status _fill_primitive_column(size_t col_idx, size_t num_rows);
+
     [[nodiscard]] Status _close_jdbc_scanner();
 
     JDBCScanContext _scan_ctx;
@@ -91,6 +93,8 @@ private:
     // java class name for each result column
     std::vector<std::string> _column_class_names;
     std::vector<LogicalType> _result_column_types;
+    // columns whose batches arrive as primitive array + null array instead of a boxed Object[]
+    std::vector<bool> _primitive_result_columns;
     std::vector<ExprContext*> _cast_exprs;
     ChunkPtr _result_chunk;
 
@@ -100,6 +104,8 @@ private:
 
     jmethodID _scanner_has_next;
     jmethodID _scanner_get_next_chunk;
+    jmethodID _scanner_get_column_nulls;
+    jmethodID _scanner_get_column_data;
     jmethodID _scanner_result_rows;
     jmethodID _scanner_close;
     // JDBCUtil method
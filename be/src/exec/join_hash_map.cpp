@@ -141,9 +141,10 @@ void SerializedJoinBuildFunc::_build_columns(JoinHashTableItems* table_items, Ha
         *ptr += table_items->build_slice[start + i].size;
     }
 
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
     for (size_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
+        JoinHashMapHelper::insert_bucket_chain<Slice>(table_items, table_items->build_slice, probe_state->buckets[i],
+                                                      start + i, keep_first_only);
     }
 }
 
@@ -168,10 +169,11 @@ void SerializedJoinBuildFunc::_build_nullable_columns(JoinHashTableItems* table_
         }
     }
 
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
+            JoinHashMapHelper::insert_bucket_chain<Slice>(table_items, table_items->build_slice,
+                                                          probe_state->buckets[i], start + i, keep_first_only);
         }
     }
 }
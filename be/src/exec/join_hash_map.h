@@ -26,9 +26,11 @@
 
 #include "column/chunk.h"
 #include "column/column_hash.h"
+#include "common/config.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
 #include "simd/simd.h"
+#include "storage/rowset/block_split_bloom_filter.h"
 #include "util/phmap/phmap.h"
 
 #if defined(__aarch64__)
@@ -135,6 +137,16 @@ struct JoinHashTableItems {
     float get_keys_per_bucket() const { return keys_per_bucket; }
     bool ht_cache_miss_serious() const { return cache_miss_serious; }
 
+    // Left semi/anti joins (including the null-aware anti variant) only test whether a probe
+    // key exists in the table, never which or how many build rows carry it, so duplicated
+    // build keys can be dropped at insertion time to shorten the bucket chains. Not
+    // applicable with other conjuncts, which are evaluated against every matched build row.
+    bool keep_first_key_occurrence_only() const {
+        return !with_other_conjunct &&
+               (join_type == TJoinOp::LEFT_SEMI_JOIN || join_type == TJoinOp::LEFT_ANTI_JOIN ||
+                join_type == TJoinOp::NULL_AWARE_LEFT_ANTI_JOIN);
+    }
+
     void calculate_ht_info(size_t key_bytes) {
         if (used_buckets == 0) { // to avoid redo
             used_buckets = SIMD::count_nonzero(first);
@@ -155,6 +167,13 @@ struct JoinHashTableItems {
 
     std::unique_ptr<MemPool> build_pool = nullptr;
     std::vector<JoinKeyDesc> join_keys;
+
+    // Optional block-split bloom filter over the build keys, built alongside the chained hash
+    // table when config::enable_join_probe_bloom_filter is on. For highly selective joins,
+    // testing it before loading a bucket head avoids walking chains for probe rows that cannot
+    // match. Probing may stop consulting it when the observed pass rate is too high to pay off
+    // (see HashTableProbeState::update_bloom_filter_stats).
+    std::unique_ptr<BloomFilter> probe_bloom_filter;
 };
 
 struct HashTableProbeState {
@@ -228,6 +247,21 @@ struct HashTableProbeState {
     uint32_t detect_step = 1;
     bool last_enable_interleaving = true;
 
+    // Adaptive switch for the optional probe-side bloom filter: once enough rows have been
+    // tested and most of them pass, the filter cannot short-circuit enough chain walks to pay
+    // for itself, so stop consulting it.
+    bool bloom_filter_enabled = true;
+    size_t bloom_tested_rows = 0;
+    size_t bloom_passed_rows = 0;
+
+    void update_bloom_filter_stats(size_t tested, size_t passed) {
+        bloom_tested_rows += tested;
+        bloom_passed_rows += passed;
+        if (bloom_tested_rows >= (1 << 16)) {
+            bloom_filter_enabled = bloom_passed_rows * 2 < bloom_tested_rows;
+        }
+    }
+
     std::set<std::coroutine_handle<ProbeCoroutine::ProbePromise>> handles;
 
     HashTableProbeState(const HashTableProbeState& rhs)
@@ -319,6 +353,45 @@ struct JoinKeyHash<int32_t> {
     }
 };
 
+// BIGINT keys and the packed 8-byte fixed-size keys hash with a single 64-bit crc instruction
+// instead of the word-by-word loop of crc_hash_32.
+template <>
+struct JoinKeyHash<int64_t> {
+    static const uint32_t CRC_SEED = 0x811C9DC5;
+    std::size_t operator()(const int64_t& value) const {
+#if defined(__x86_64__) && defined(__SSE4_2__)
+        size_t hash = _mm_crc32_u64(CRC_SEED, static_cast<uint64_t>(value));
+#elif defined(__x86_64__)
+        size_t hash = crc_hash_32(&value, sizeof(value), CRC_SEED);
+#else
+        size_t hash = __crc32cd(CRC_SEED, static_cast<uint64_t>(value));
+#endif
+        hash = (hash << 16u) | (hash >> 16u);
+        return hash;
+    }
+};
+
+// LARGEINT keys and the packed 16-byte fixed-size keys hash as two 64-bit crc steps.
+template <>
+struct JoinKeyHash<int128_t> {
+    static const uint32_t CRC_SEED = 0x811C9DC5;
+    std::size_t operator()(const int128_t& value) const {
+#if defined(__x86_64__) && defined(__SSE4_2__)
+        const auto* words = reinterpret_cast<const uint64_t*>(&value);
+        size_t hash = _mm_crc32_u64(CRC_SEED, words[0]);
+        hash = _mm_crc32_u64(hash, words[1]);
+#elif defined(__x86_64__)
+        size_t hash = crc_hash_32(&value, sizeof(value), CRC_SEED);
+#else
+        const auto* words = reinterpret_cast<const uint64_t*>(&value);
+        size_t hash = __crc32cd(CRC_SEED, words[0]);
+        hash = __crc32cd(hash, words[1]);
+#endif
+        hash = (hash << 16u) | (hash >> 16u);
+        return hash;
+    }
+};
+
 template <>
 struct JoinKeyHash<Slice> {
     static const uint32_t CRC_SEED = 0x811C9DC5;
@@ -354,6 +427,23 @@ public:
         }
     }
 
+    // Link build row |index| into the chain of |bucket|. When |keep_first_only| is set (see
+    // JoinHashTableItems::keep_first_key_occurrence_only), a row whose key is already present
+    // in the chain is left out of the table entirely.
+    template <typename CppType>
+    static void insert_bucket_chain(JoinHashTableItems* table_items, const Buffer<CppType>& keys, uint32_t bucket,
+                                    uint32_t index, bool keep_first_only) {
+        if (keep_first_only) {
+            for (uint32_t cur = table_items->first[bucket]; cur != 0; cur = table_items->next[cur]) {
+                if (keys[cur] == keys[index]) {
+                    return;
+                }
+            }
+        }
+        table_items->next[index] = table_items->first[bucket];
+        table_items->first[bucket] = index;
+    }
+
     static Slice get_hash_key(const Columns& key_columns, size_t row_idx, uint8_t* buffer) {
         size_t byte_size = 0;
         for (const auto& key_column : key_columns) {
@@ -53,24 +53,68 @@ const Buffer<typename JoinBuildFunc<LT>::CppType>& JoinBuildFunc<LT>::get_key_da
 template <LogicalType LT>
 void JoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, JoinHashTableItems* table_items,
                                              HashTableProbeState* probe_state) {
+    // The insertion into `first` is a random access over a bucket array that doesn't fit in cache
+    // for large build sides. Hash the keys block by block first, so that the bucket heads can be
+    // prefetched before the chain insertion touches them.
+    constexpr size_t BUILD_BLOCK_SIZE = 512;
+    uint32_t buckets[BUILD_BLOCK_SIZE];
+
     auto& data = get_key_data(*table_items);
+    const size_t end = table_items->row_count + 1;
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            if (null_array[i] == 0) {
-                uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-                table_items->next[i] = table_items->first[bucket_num];
-                table_items->first[bucket_num] = i;
+        for (size_t base = 1; base < end; base += BUILD_BLOCK_SIZE) {
+            const size_t count = std::min(BUILD_BLOCK_SIZE, end - base);
+            for (size_t j = 0; j < count; j++) {
+                if (null_array[base + j] == 0) {
+                    buckets[j] = JoinHashMapHelper::calc_bucket_num<CppType>(data[base + j], table_items->bucket_size);
+                    __builtin_prefetch(&table_items->first[buckets[j]], 1 /* rw==write */, 3 /* locality */);
+                }
+            }
+            for (size_t j = 0; j < count; j++) {
+                if (null_array[base + j] == 0) {
+                    JoinHashMapHelper::insert_bucket_chain<CppType>(table_items, data, buckets[j], base + j,
+                                                                    keep_first_only);
+                }
             }
         }
     } else {
-        for (size_t i = 1; i < table_items->row_count + 1; i++) {
-            uint32_t bucket_num = JoinHashMapHelper::calc_bucket_num<CppType>(data[i], table_items->bucket_size);
-            table_items->next[i] = table_items->first[bucket_num];
-            table_items->first[bucket_num] = i;
+        for (size_t base = 1; base < end; base += BUILD_BLOCK_SIZE) {
+            const size_t count = std::min(BUILD_BLOCK_SIZE, end - base);
+            for (size_t j = 0; j < count; j++) {
+                buckets[j] = JoinHashMapHelper::calc_bucket_num<CppType>(data[base + j], table_items->bucket_size);
+                __builtin_prefetch(&table_items->first[buckets[j]], 1 /* rw==write */, 3 /* locality */);
+            }
+            for (size_t j = 0; j < count; j++) {
+                JoinHashMapHelper::insert_bucket_chain<CppType>(table_items, data, buckets[j], base + j,
+                                                                keep_first_only);
+            }
+        }
+    }
+
+    if (config::enable_join_probe_bloom_filter) {
+        auto bloom_filter = std::make_unique<BlockSplitBloomFilter>();
+        if (bloom_filter->init(table_items->row_count + 1, 0.05, HASH_MURMUR3_X64_64).ok()) {
+            using HashFunc = JoinKeyHash<CppType>;
+            if (table_items->key_columns[0]->is_nullable()) {
+                auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
+                auto& null_array = nullable_column->null_column()->get_data();
+                for (size_t i = 1; i < end; i++) {
+                    if (null_array[i] == 0) {
+                        bloom_filter->add_hash(HashFunc()(data[i]));
+                    }
+                }
+            } else {
+                for (size_t i = 1; i < end; i++) {
+                    bloom_filter->add_hash(HashFunc()(data[i]));
+                }
+            }
+            table_items->probe_bloom_filter = std::move(bloom_filter);
         }
     }
+
     table_items->calculate_ht_info(table_items->key_columns[0]->byte_size());
 }
 
@@ -100,12 +144,18 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
     static constexpr CppType MIN_VALUE = RunTimeTypeLimits<LT>::min_value();
 
     auto& data = get_key_data(*table_items);
+    // A bucket maps back to exactly one key value here, so keeping only the first occurrence
+    // of a key boils down to not chaining onto an occupied bucket head.
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
     if (table_items->key_columns[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>(table_items->key_columns[0]);
         auto& null_array = nullable_column->null_column()->get_data();
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             if (null_array[i] == 0) {
                 size_t buckets = data[i] - MIN_VALUE;
+                if (keep_first_only && table_items->first[buckets] != 0) {
+                    continue;
+                }
                 table_items->next[i] = table_items->first[buckets];
                 table_items->first[buckets] = i;
             }
@@ -113,6 +163,9 @@ void DirectMappingJoinBuildFunc<LT>::construct_hash_table(RuntimeState* state, J
     } else {
         for (size_t i = 1; i < table_items->row_count + 1; i++) {
             size_t buckets = data[i] - MIN_VALUE;
+            if (keep_first_only && table_items->first[buckets] != 0) {
+                continue;
+            }
             table_items->next[i] = table_items->first[buckets];
             table_items->first[buckets] = i;
         }
@@ -179,9 +232,13 @@ void FixedSizeJoinBuildFunc<LT>::_build_columns(JoinHashTableItems* table_items,
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
+    for (uint32_t i = 0; i < count; i++) {
+        __builtin_prefetch(&table_items->first[probe_state->buckets[i]], 1 /* rw==write */, 3 /* locality */);
+    }
     for (uint32_t i = 0; i < count; i++) {
-        table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-        table_items->first[probe_state->buckets[i]] = start + i;
+        JoinHashMapHelper::insert_bucket_chain<CppType>(table_items, data, probe_state->buckets[i], start + i,
+                                                        keep_first_only);
     }
 }
 
@@ -204,10 +261,16 @@ void FixedSizeJoinBuildFunc<LT>::_build_nullable_columns(JoinHashTableItems* tab
     const auto& data = get_key_data(*table_items);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items->bucket_size, &probe_state->buckets, start, count);
 
+    const bool keep_first_only = table_items->keep_first_key_occurrence_only();
+    for (size_t i = 0; i < count; i++) {
+        if (probe_state->is_nulls[i] == 0) {
+            __builtin_prefetch(&table_items->first[probe_state->buckets[i]], 1 /* rw==write */, 3 /* locality */);
+        }
+    }
     for (size_t i = 0; i < count; i++) {
         if (probe_state->is_nulls[i] == 0) {
-            table_items->next[start + i] = table_items->first[probe_state->buckets[i]];
-            table_items->first[probe_state->buckets[i]] = start + i;
+            JoinHashMapHelper::insert_bucket_chain<CppType>(table_items, data, probe_state->buckets[i], start + i,
+                                                            keep_first_only);
         }
     }
 }
@@ -265,31 +328,58 @@ void JoinProbeFunc<LT>::lookup_init(const JoinHashTableItems& table_items, HashT
     auto& data = get_key_data(*probe_state);
     JoinHashMapHelper::calc_bucket_nums<CppType>(data, table_items.bucket_size, &probe_state->buckets, 0, data.size());
 
+    // For highly selective joins, test the cache-resident bloom filter before loading the bucket
+    // head, so that probe rows which cannot match never touch the hash table at all.
+    const BloomFilter* bloom_filter =
+            probe_state->bloom_filter_enabled ? table_items.probe_bloom_filter.get() : nullptr;
+    using HashFunc = JoinKeyHash<CppType>;
+
     if ((*probe_state->key_columns)[0]->is_nullable()) {
         auto* nullable_column = ColumnHelper::as_raw_column<NullableColumn>((*probe_state->key_columns)[0]);
 
         if (nullable_column->has_null()) {
             auto& null_array = nullable_column->null_column()->get_data();
-            for (size_t i = 0; i < probe_row_count; i++) {
-                if (null_array[i] == 0) {
-                    probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-                } else {
-                    probe_state->next[i] = 0;
+            if (bloom_filter != nullptr) {
+                size_t passed = 0;
+                for (size_t i = 0; i < probe_row_count; i++) {
+                    if (null_array[i] == 0 && bloom_filter->test_hash(HashFunc()(data[i]))) {
+                        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+                        passed++;
+                    } else {
+                        probe_state->next[i] = 0;
+                    }
+                }
+                probe_state->update_bloom_filter_stats(probe_row_count, passed);
+            } else {
+                for (size_t i = 0; i < probe_row_count; i++) {
+                    if (null_array[i] == 0) {
+                        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+                    } else {
+                        probe_state->next[i] = 0;
+                    }
                 }
             }
             probe_state->null_array = &nullable_column->null_column()->get_data();
-        } else {
-            for (size_t i = 0; i < probe_row_count; i++) {
-                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
-            }
-            probe_state->null_array = nullptr;
+            probe_state->consider_probe_time_locality();
+            return;
         }
-        probe_state->consider_probe_time_locality();
-        return;
     }
 
-    for (size_t i = 0; i < probe_row_count; i++) {
-        probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+    if (bloom_filter != nullptr) {
+        size_t passed = 0;
+        for (size_t i = 0; i < probe_row_count; i++) {
+            if (bloom_filter->test_hash(HashFunc()(data[i]))) {
+                probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+                passed++;
+            } else {
+                probe_state->next[i] = 0;
+            }
+        }
+        probe_state->update_bloom_filter_stats(probe_row_count, passed);
+    } else {
+        for (size_t i = 0; i < probe_row_count; i++) {
+            probe_state->next[i] = table_items.first[probe_state->buckets[i]];
+        }
     }
     probe_state->consider_probe_time_locality();
     probe_state->null_array = nullptr;
@@ -804,24 +804,26 @@ Status JsonReader::_read_and_parse_json() {
         if (_scanner->_strip_outer_array) {
             // Expand outer array automatically according to _is_ndjson.
             if (_is_ndjson) {
-                _parser = std::make_unique<ExpandedJsonDocumentStreamParserWithRoot>(&_simdjson_parser,
+                _parser = std::make_unique<ExpandedJsonDocumentStreamParserWithRoot>(&_scanner->_simdjson_parser,
                                                                                      _scanner->_root_paths);
             } else {
-                _parser = std::make_unique<ExpandedJsonArrayParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<ExpandedJsonArrayParserWithRoot>(&_scanner->_simdjson_parser,
+                                                                           _scanner->_root_paths);
             }
         } else {
             if (_is_ndjson) {
-                _parser = std::make_unique<JsonDocumentStreamParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<JsonDocumentStreamParserWithRoot>(&_scanner->_simdjson_parser,
+                                                                             _scanner->_root_paths);
             } else {
-                _parser = std::make_unique<JsonArrayParserWithRoot>(&_simdjson_parser, _scanner->_root_paths);
+                _parser = std::make_unique<JsonArrayParserWithRoot>(&_scanner->_simdjson_parser, _scanner->_root_paths);
             }
         }
     } else {
         // Without json root set, the strip_outer_array determines whether to expand outer array.
         if (_scanner->_strip_outer_array) {
-            _parser = std::make_unique<JsonArrayParser>(&_simdjson_parser);
+            _parser = std::make_unique<JsonArrayParser>(&_scanner->_simdjson_parser);
         } else {
-            _parser = std::make_unique<JsonDocumentStreamParser>(&_simdjson_parser);
+            _parser = std::make_unique<JsonDocumentStreamParser>(&_scanner->_simdjson_parser);
         }
     }
 
@@ -74,6 +74,12 @@ private:
     std::vector<std::vector<SimpleJsonPath>> _json_paths;
     std::vector<SimpleJsonPath> _root_paths;
     bool _strip_outer_array = false;
+
+    // For performance reason, the simdjson parser should be reused over several files,
+    // so it belongs to the scanner rather than the per-file JsonReader, which keeps the
+    // internal buffers allocated for the first document alive for the whole scan.
+    //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
+    simdjson::ondemand::parser _simdjson_parser;
 };
 
 // Reader to parse the json.
@@ -135,9 +141,6 @@ private:
     // so the lifecycle of _slot_descs should be longer than _slot_desc_dict;
     std::unordered_map<std::string_view, SlotDescriptor*> _slot_desc_dict;
 
-    // For performance reason, the simdjson parser should be reused over several files.
-    //https://github.com/simdjson/simdjson/blob/master/doc/performance.md
-    simdjson::ondemand::parser _simdjson_parser;
     bool _is_ndjson = false;
 
     std::unique_ptr<JsonParser> _parser;
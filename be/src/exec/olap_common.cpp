@@ -166,6 +166,46 @@ void ColumnValueRange<__int128>::convert_to_fixed_value() {}
 template <>
 void ColumnValueRange<bool>::convert_to_fixed_value() {}
 
+template <>
+std::vector<std::pair<StringValue, StringValue>> ColumnValueRange<StringValue>::get_fixed_value_runs() const {
+    return {};
+}
+
+template <>
+std::vector<std::pair<Slice, Slice>> ColumnValueRange<Slice>::get_fixed_value_runs() const {
+    return {};
+}
+
+template <>
+std::vector<std::pair<DecimalV2Value, DecimalV2Value>> ColumnValueRange<DecimalV2Value>::get_fixed_value_runs() const {
+    return {};
+}
+
+template <>
+std::vector<std::pair<bool, bool>> ColumnValueRange<bool>::get_fixed_value_runs() const {
+    return {};
+}
+
+template <class T>
+std::vector<std::pair<T, T>> ColumnValueRange<T>::get_fixed_value_runs() const {
+    std::vector<std::pair<T, T>> runs;
+    if (!is_enumeration_type(_column_type)) {
+        return runs;
+    }
+    for (const T& value : _fixed_values) {
+        if (!runs.empty()) {
+            T successor = runs.back().second;
+            helper::increase(successor);
+            if (successor == value) {
+                runs.back().second = value;
+                continue;
+            }
+        }
+        runs.emplace_back(value, value);
+    }
+    return runs;
+}
+
 template <class T>
 void ColumnValueRange<T>::clear() {
     _fixed_values.clear();
@@ -535,6 +575,15 @@ Status OlapScanKeys::extend_scan_key(ColumnValueRange<T>& range, int32_t max_sca
     if (range.is_fixed_value_range()) {
         const size_t mul = std::max<size_t>(1, _begin_scan_keys.size());
         if (range.get_fixed_value_size() > max_scan_key_num / mul) {
+            // A dense IN set often compresses into few runs of consecutive values, e.g.
+            // 30 consecutive days. Emitting one closed range per run keeps the key
+            // selectivity that collapsing to a single [min, max] range throws away,
+            // while the residual IN predicate still filters the scanned rows.
+            const auto runs = range.get_fixed_value_runs();
+            if (!runs.empty() && runs.size() <= max_scan_key_num / mul) {
+                _extend_scan_key_with_runs(range, runs);
+                return Status::OK();
+            }
             if (range.is_range_value_convertible()) {
                 range.convert_to_range_value();
             } else {
@@ -645,6 +694,49 @@ Status OlapScanKeys::extend_scan_key(ColumnValueRange<T>& range, int32_t max_sca
     return Status::OK();
 }
 
+template <class T>
+void OlapScanKeys::_extend_scan_key_with_runs(const ColumnValueRange<T>& range,
+                                              const std::vector<std::pair<T, T>>& runs) {
+    if (_begin_scan_keys.empty()) {
+        for (const auto& [first, last] : runs) {
+            _begin_scan_keys.emplace_back();
+            _begin_scan_keys.back().add_value(cast_to_string(first, range.type(), range.precision(), range.scale()));
+            _end_scan_keys.emplace_back();
+            _end_scan_keys.back().add_value(cast_to_string(last, range.type(), range.precision(), range.scale()));
+        }
+    } else {
+        const int original_key_range_size = _begin_scan_keys.size();
+
+        for (int i = 0; i < original_key_range_size; ++i) {
+            OlapTuple start_base_key_range = _begin_scan_keys[i];
+            OlapTuple end_base_key_range = _end_scan_keys[i];
+
+            for (auto iter = runs.begin(); iter != runs.end(); ++iter) {
+                // alter the first ScanKey in original place
+                if (iter == runs.begin()) {
+                    _begin_scan_keys[i].add_value(
+                            cast_to_string(iter->first, range.type(), range.precision(), range.scale()));
+                    _end_scan_keys[i].add_value(
+                            cast_to_string(iter->second, range.type(), range.precision(), range.scale()));
+                } // append follow ScanKey
+                else {
+                    _begin_scan_keys.push_back(start_base_key_range);
+                    _begin_scan_keys.back().add_value(
+                            cast_to_string(iter->first, range.type(), range.precision(), range.scale()));
+                    _end_scan_keys.push_back(end_base_key_range);
+                    _end_scan_keys.back().add_value(
+                            cast_to_string(iter->second, range.type(), range.precision(), range.scale()));
+                }
+            }
+        }
+    }
+
+    // the runs are closed intervals, so no further key column can be extended
+    _has_range_value = true;
+    _begin_include = true;
+    _end_include = true;
+}
+
 template <class T>
 ColumnValueRange<T>::ColumnValueRange() = default;
 
@@ -43,6 +43,7 @@
 #include <sstream>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "exec/olap_utils.h"
 #include "exec/scan_node.h"
@@ -121,6 +122,11 @@ public:
 
     size_t get_fixed_value_size() const { return _fixed_values.size(); }
 
+    // Split the sorted fixed values into maximal runs of consecutive values, each run a
+    // closed interval [first, last]. Returns an empty vector for types without a
+    // well-defined successor.
+    std::vector<std::pair<T, T>> get_fixed_value_runs() const;
+
     void set_index_filter_only(bool is_index_only) { _is_index_filter_only = is_index_only; }
 
     template <bool Negative = false>
@@ -192,6 +198,11 @@ public:
     void set_is_convertible(bool is_convertible) { _is_convertible = is_convertible; }
 
 private:
+    // Extend every existing scan key with the closed ranges in |runs|, used when a fixed
+    // value set over the cap compresses into few runs of consecutive values.
+    template <class T>
+    void _extend_scan_key_with_runs(const ColumnValueRange<T>& range, const std::vector<std::pair<T, T>>& runs);
+
     std::vector<OlapTuple> _begin_scan_keys;
     std::vector<OlapTuple> _end_scan_keys;
     bool _has_range_value{false};
@@ -17,6 +17,7 @@
 #include <utility>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/adaptive_dop_param.h"
 #include "exec/pipeline/adaptive/event.h"
@@ -35,11 +36,18 @@ bool BlockState::need_input(int32_t driver_seq) const {
 
 Status BlockState::push_chunk(int32_t driver_seq, ChunkPtr chunk) {
     size_t num_chunk_rows = chunk->num_rows();
+    size_t num_chunk_bytes = chunk->memory_usage();
     _ctx->_buffer_chunk_queue(driver_seq).emplace(std::move(chunk));
-    size_t prev_num_rows = _num_rows.fetch_add(num_chunk_rows);
-
-    // It receives _max_buffer_rows rows after this push_chunk, so transform to PASSTHROUGH state.
-    if (prev_num_rows < _max_buffer_rows && prev_num_rows + num_chunk_rows >= _max_buffer_rows) {
+    size_t num_rows = _num_rows.fetch_add(num_chunk_rows) + num_chunk_rows;
+    size_t num_bytes = _num_bytes.fetch_add(num_chunk_bytes) + num_chunk_bytes;
+
+    // Receiving _max_buffer_rows rows proves that DOP needn't shrink, so transform to PASSTHROUGH state.
+    // Very wide rows may blow the memory budget long before that, so the byte cap stops collecting
+    // early as well; in that case nothing has been learned, so the upstream DOP is kept.
+    const int64_t max_buffer_bytes = config::pipeline_adaptive_dop_max_block_bytes;
+    const bool overflow =
+            num_rows >= _max_buffer_rows || (max_buffer_bytes > 0 && num_bytes >= static_cast<size_t>(max_buffer_bytes));
+    if (overflow && !_passthrough_triggered.exchange(true)) {
         _ctx->_transform_state(CollectStatsStateEnum::PASSTHROUGH, _ctx->_upstream_dop);
     }
     return Status::OK();
@@ -155,6 +155,10 @@ public:
 private:
     std::atomic<int> _num_finished_seqs = 0;
     std::atomic<size_t> _num_rows = 0;
+    std::atomic<size_t> _num_bytes = 0;
+    // Guarantees that the overflow conditions on rows and bytes trigger the transform
+    // to PASSTHROUGH exactly once, even when drivers push chunks concurrently.
+    std::atomic<bool> _passthrough_triggered = false;
     const size_t _max_buffer_rows;
 };
 
@@ -111,9 +111,11 @@ Status AggregateBlockingSinkOperator::push_chunk(RuntimeState* state, const Chun
             size_t zero_count = SIMD::count_zero(_aggregator->streaming_selection().data(), chunk_size);
             if (zero_count == chunk_size) {
                 RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
-            } else {
+            } else if (zero_count > 0) {
                 RETURN_IF_ERROR(_aggregator->compute_batch_agg_states_with_selection(chunk.get(), chunk_size));
             }
+            // if all rows are filtered out (every key is a new group beyond the limit), there is no
+            // state to update, so skip evaluating the aggregate input expressions altogether
         } else {
             RETURN_IF_ERROR(_aggregator->compute_batch_agg_states(chunk.get(), chunk_size));
         }
@@ -69,6 +69,10 @@ public:
     Status send_one_chunk(RuntimeState* state, const Chunk* chunk, int32_t driver_sequence, bool eos,
                           bool* is_real_sent);
 
+    // Send one chunk whose ownership is given up by the caller. For a local pass-through
+    // channel the chunk is handed to the receiver as-is, skipping both serialization and copy.
+    Status send_owned_chunk(RuntimeState* state, ChunkUniquePtr chunk, int32_t driver_sequence);
+
     // Channel will sent input request directly without batch it.
     // This function is only used when broadcast, because request can be reused
     // by all the channels.
@@ -195,9 +199,16 @@ Status ExchangeSinkOperator::Channel::add_rows_selective(Chunk* chunk, int32_t d
     }
 
     if (_chunks[driver_sequence]->num_rows() + size > state->chunk_size()) {
-        RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
-        // we only clear column data, because we need to reuse column schema
-        _chunks[driver_sequence]->set_num_rows(0);
+        if (_use_pass_through) {
+            // Hand the accumulated chunk to the local receiver without serialization or copy,
+            // and rebuild an empty chunk with the same schema below.
+            RETURN_IF_ERROR(send_owned_chunk(state, std::move(_chunks[driver_sequence]), driver_sequence));
+            _chunks[driver_sequence] = chunk->clone_empty_with_slot(size);
+        } else {
+            RETURN_IF_ERROR(send_one_chunk(state, _chunks[driver_sequence].get(), driver_sequence, false));
+            // we only clear column data, because we need to reuse column schema
+            _chunks[driver_sequence]->set_num_rows(0);
+        }
     }
 
     {
@@ -242,6 +253,7 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
                                                        _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
             _current_request_bytes += chunk_size;
             COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
+            COUNTER_UPDATE(_parent->_rows_pass_through_counter, chunk->num_rows());
             COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
         } else {
             if (_parent->_is_pipeline_level_shuffle) {
@@ -250,6 +262,7 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
             auto pchunk = _chunk_request->add_chunks();
             TRY_CATCH_BAD_ALLOC(RETURN_IF_ERROR(_parent->serialize_chunk(chunk, pchunk, &_is_first_chunk)));
             _current_request_bytes += pchunk->data().size();
+            COUNTER_UPDATE(_parent->_rows_sent_remote_counter, chunk->num_rows());
         }
     }
 
@@ -271,6 +284,30 @@ Status ExchangeSinkOperator::Channel::send_one_chunk(RuntimeState* state, const
     return Status::OK();
 }
 
+Status ExchangeSinkOperator::Channel::send_owned_chunk(RuntimeState* state, ChunkUniquePtr chunk,
+                                                       int32_t driver_sequence) {
+    if (_ignore_local_data) {
+        return Status::OK();
+    }
+
+    if (!_use_pass_through) {
+        return send_one_chunk(state, chunk.get(), driver_sequence, false);
+    }
+
+    size_t chunk_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
+    size_t chunk_num_rows = chunk->num_rows();
+    TRY_CATCH_BAD_ALLOC(
+            _pass_through_context.append_owned_chunk(_parent->_sender_id, std::move(chunk), chunk_size,
+                                                     _parent->_is_pipeline_level_shuffle ? driver_sequence : -1));
+    _current_request_bytes += chunk_size;
+    COUNTER_UPDATE(_parent->_bytes_pass_through_counter, chunk_size);
+    COUNTER_UPDATE(_parent->_rows_pass_through_counter, chunk_num_rows);
+    COUNTER_SET(_parent->_pass_through_buffer_peak_mem_usage, _pass_through_context.total_bytes());
+
+    // Run the batched-notification logic of send_one_chunk without appending another chunk.
+    return send_one_chunk(state, nullptr, driver_sequence, false);
+}
+
 Status ExchangeSinkOperator::Channel::send_chunk_request(RuntimeState* state, PTransmitChunkParamsPtr chunk_request,
                                                          const butil::IOBuf& attachment,
                                                          int64_t attachment_physical_bytes) {
@@ -437,6 +474,8 @@ Status ExchangeSinkOperator::prepare(RuntimeState* state) {
     std::shuffle(_channel_indices.begin(), _channel_indices.end(), std::mt19937(std::random_device()()));
 
     _bytes_pass_through_counter = ADD_COUNTER(_unique_metrics, "BytesPassThrough", TUnit::BYTES);
+    _rows_pass_through_counter = ADD_COUNTER(_unique_metrics, "RowsPassThrough", TUnit::UNIT);
+    _rows_sent_remote_counter = ADD_COUNTER(_unique_metrics, "RowsSentRemote", TUnit::UNIT);
     _sender_input_bytes_counter = ADD_COUNTER(_unique_metrics, "SenderInputBytes", TUnit::BYTES);
     _serialized_bytes_counter = ADD_COUNTER(_unique_metrics, "SerializedBytes", TUnit::BYTES);
     _compressed_bytes_counter = ADD_COUNTER(_unique_metrics, "CompressedBytes", TUnit::BYTES);
@@ -178,6 +178,11 @@ private:
     RuntimeProfile::Counter* _shuffle_chunk_append_timer = nullptr;
     RuntimeProfile::Counter* _compress_timer = nullptr;
     RuntimeProfile::Counter* _bytes_pass_through_counter = nullptr;
+    // rows handed to local destinations without serialization vs. rows sent over brpc.
+    // when a colocation group drifts and buckets land on remote instances, the local
+    // ratio in the profile drops, which is much easier to spot than a slow join.
+    RuntimeProfile::Counter* _rows_pass_through_counter = nullptr;
+    RuntimeProfile::Counter* _rows_sent_remote_counter = nullptr;
     RuntimeProfile::Counter* _sender_input_bytes_counter = nullptr;
     RuntimeProfile::Counter* _serialized_bytes_counter = nullptr;
     RuntimeProfile::Counter* _compressed_bytes_counter = nullptr;
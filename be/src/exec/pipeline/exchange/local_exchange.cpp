@@ -14,9 +14,11 @@
 
 #include "exec/pipeline/exchange/local_exchange.h"
 
+#include <limits>
 #include <memory>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "exec/pipeline/exchange/shuffler.h"
 #include "exprs/expr_context.h"
 #include "util/runtime_profile.h"
@@ -164,9 +166,11 @@ Status PartitionExchanger::accept(const ChunkPtr& chunk, const int32_t sink_driv
 
 OrderedPartitionExchanger::OrderedPartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                                      LocalExchangeSourceOperatorFactory* source,
-                                                     std::vector<ExprContext*> partition_expr_ctxs)
+                                                     std::vector<ExprContext*> partition_expr_ctxs,
+                                                     bool enable_intra_partition_split)
         : LocalExchanger("OrderedPartition", memory_manager, source),
-          _partition_exprs(std::move(partition_expr_ctxs)) {}
+          _partition_exprs(std::move(partition_expr_ctxs)),
+          _enable_intra_partition_split(enable_intra_partition_split) {}
 
 Status OrderedPartitionExchanger::prepare(RuntimeState* state) {
     RETURN_IF_ERROR(LocalExchanger::prepare(state));
@@ -194,54 +198,68 @@ Status OrderedPartitionExchanger::accept(const ChunkPtr& chunk, const int32_t si
         _channel_row_nums.assign(source_dop(), 0);
     }
 
+    if (_partition_run_channels.empty()) {
+        _partition_run_channels.assign(source_dop(), false);
+    }
+
     std::vector<std::pair<size_t, ChunkPtr>> chunks;
 
+    auto is_equal = [](const Columns& columns1, size_t offset1, const Columns& columns2, size_t offset2) {
+        for (size_t i = 0; i < columns1.size(); ++i) {
+            auto cmp = columns1[i]->compare_at(offset1, offset2, *columns2[i], 1);
+            if (cmp != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    // Check if the joint of two consecutive chunks are the same
+    bool is_joint_equal = _previous_chunk != nullptr &&
+                          is_equal(_previous_partition_columns, _previous_chunk->num_rows() - 1, partition_columns, 0);
+    bool is_current_of_same_partition = is_equal(partition_columns, 0, partition_columns, chunk->num_rows() - 1);
+
     size_t min_channel_id = _find_min_channel_id();
     if (_previous_chunk == nullptr || _previous_channel_id == min_channel_id) {
+        if (is_joint_equal && is_current_of_same_partition) {
+            _on_partition_continue(min_channel_id, chunk->num_rows());
+        } else {
+            _on_partition_start(min_channel_id, partition_columns, chunk->num_rows());
+        }
+        chunks.emplace_back(min_channel_id, chunk);
+    } else if (!is_joint_equal) {
+        // The first row of current chunk is the start of a new partition, so
+        // send the chunk to the channel with the minimum number of rows.
+        _on_partition_start(min_channel_id, partition_columns, chunk->num_rows());
         chunks.emplace_back(min_channel_id, chunk);
+    } else if (is_current_of_same_partition) {
+        size_t channel_id = _choose_continuation_channel(chunk->num_rows());
+        if (channel_id != _previous_channel_id) {
+            // The partition spills over to a fresh channel. Let the consumer know how many of its
+            // rows were routed elsewhere so it can restore global row numbering.
+            chunk->set_extra_data(std::make_shared<PartitionSplitOffsetExtraData>(_partition_run_rows));
+        }
+        _on_partition_continue(channel_id, chunk->num_rows());
+        chunks.emplace_back(channel_id, chunk);
     } else {
-        auto is_equal = [](const Columns& columns1, size_t offset1, const Columns& columns2, size_t offset2) {
-            for (size_t i = 0; i < columns1.size(); ++i) {
-                auto cmp = columns1[i]->compare_at(offset1, offset2, *columns2[i], 1);
-                if (cmp != 0) {
-                    return false;
-                }
-            }
-            return true;
-        };
-        // Check if the joint of two consecutive chunks are the same
-        bool is_joint_equal =
-                is_equal(_previous_partition_columns, _previous_chunk->num_rows() - 1, partition_columns, 0);
-
-        if (!is_joint_equal) {
-            // The first row of current chunk is the start of a new partition, so
-            // send the chunk to the channel with the minimum number of rows.
-            chunks.emplace_back(min_channel_id, chunk);
-        } else {
-            bool is_current_of_same_partition =
-                    is_equal(partition_columns, 0, partition_columns, chunk->num_rows() - 1);
-            if (is_current_of_same_partition) {
-                chunks.emplace_back(_previous_channel_id, chunk);
-            } else {
-                // Found partition end that belongs to the first row of current chunk, and split the chunk into two parts:
-                // 1. The first part is the rows of the same partition as the last row of previous chunk, and send it to previous channel
-                // 2. The second part is the rows of the different partition, and send it to the channel with the minimum number of rows.
-
-                int64_t end = chunk->num_rows();
-                for (auto& column : partition_columns) {
-                    end = ColumnHelper::find_first_not_equal(column.get(), 0, 0, end);
-                }
-                // First part: [0, end)
-                ChunkPtr first_part = chunk->clone_empty();
-                first_part->append(*chunk, 0, end);
-                chunks.emplace_back(_previous_channel_id, first_part);
-
-                // Second part: [end, chunk->num_rows())
-                ChunkPtr second_part = chunk->clone_empty();
-                second_part->append(*chunk, end, chunk->num_rows() - end);
-                chunks.emplace_back(min_channel_id, second_part);
-            }
+        // Found partition end that belongs to the first row of current chunk, and split the chunk into two parts:
+        // 1. The first part is the rows of the same partition as the last row of previous chunk, and send it to previous channel
+        // 2. The second part is the rows of the different partition, and send it to the channel with the minimum number of rows.
+
+        int64_t end = chunk->num_rows();
+        for (auto& column : partition_columns) {
+            end = ColumnHelper::find_first_not_equal(column.get(), 0, 0, end);
         }
+        // First part: [0, end)
+        ChunkPtr first_part = chunk->clone_empty();
+        first_part->append(*chunk, 0, end);
+        _on_partition_continue(_previous_channel_id, end);
+        chunks.emplace_back(_previous_channel_id, first_part);
+
+        // Second part: [end, chunk->num_rows())
+        ChunkPtr second_part = chunk->clone_empty();
+        second_part->append(*chunk, end, chunk->num_rows() - end);
+        _on_partition_start(min_channel_id, partition_columns, chunk->num_rows());
+        chunks.emplace_back(min_channel_id, second_part);
     }
 
     for (auto& kv : chunks) {
@@ -261,6 +279,75 @@ size_t OrderedPartitionExchanger::_find_min_channel_id() {
                          std::min_element(_channel_row_nums.begin(), _channel_row_nums.end()));
 }
 
+size_t OrderedPartitionExchanger::_partition_tail_start(const Columns& partition_columns, size_t num_rows) {
+    // The chunk is ordered by the partition columns, so the rows equal to the last one form a
+    // contiguous tail which can be found by binary search.
+    auto is_equal_to_last = [&](size_t row) {
+        for (const auto& column : partition_columns) {
+            if (column->compare_at(row, num_rows - 1, *column, 1) != 0) {
+                return false;
+            }
+        }
+        return true;
+    };
+    size_t lo = 0;
+    size_t hi = num_rows - 1;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (is_equal_to_last(mid)) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return lo;
+}
+
+void OrderedPartitionExchanger::_on_partition_start(size_t channel_id, const Columns& partition_columns,
+                                                    size_t num_rows) {
+    if (!_enable_intra_partition_split) {
+        return;
+    }
+    // Only the equal-value run at the end of the chunk may be continued by the next chunk.
+    _partition_run_rows = num_rows - _partition_tail_start(partition_columns, num_rows);
+    _partition_run_channel_rows = _partition_run_rows;
+    _partition_run_channels.assign(_partition_run_channels.size(), false);
+    _partition_run_channels[channel_id] = true;
+}
+
+void OrderedPartitionExchanger::_on_partition_continue(size_t channel_id, size_t num_rows) {
+    if (!_enable_intra_partition_split) {
+        return;
+    }
+    if (!_partition_run_channels[channel_id]) {
+        _partition_run_channels[channel_id] = true;
+        _partition_run_channel_rows = 0;
+    }
+    _partition_run_rows += num_rows;
+    _partition_run_channel_rows += num_rows;
+}
+
+size_t OrderedPartitionExchanger::_choose_continuation_channel(size_t num_rows) {
+    if (!_enable_intra_partition_split) {
+        return _previous_channel_id;
+    }
+    const int64_t split_rows = config::pipeline_analytic_partition_split_rows;
+    if (split_rows <= 0 || _partition_run_channel_rows + num_rows <= static_cast<size_t>(split_rows)) {
+        return _previous_channel_id;
+    }
+    // Continue on the least loaded channel this partition does not occupy yet; once every channel
+    // holds a range of it, there is nothing left to gain.
+    size_t candidate = _previous_channel_id;
+    size_t candidate_rows = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < _channel_row_nums.size(); ++i) {
+        if (!_partition_run_channels[i] && _channel_row_nums[i] < candidate_rows) {
+            candidate = i;
+            candidate_rows = _channel_row_nums[i];
+        }
+    }
+    return candidate;
+}
+
 KeyPartitionExchanger::KeyPartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                                              LocalExchangeSourceOperatorFactory* source,
                                              std::vector<ExprContext*> partition_expr_ctxs, const size_t num_sinks)
@@ -17,6 +17,7 @@
 #include <memory>
 #include <utility>
 
+#include "column/chunk.h"
 #include "column/vectorized_fwd.h"
 #include "exec/chunk_buffer_memory_manager.h"
 #include "exec/pipeline/exchange/local_exchange_source_operator.h"
@@ -198,15 +199,35 @@ private:
     std::vector<std::unique_ptr<ShufflePartitioner>> _partitioners;
 };
 
+// Attached to a chunk that continues a partition which OrderedPartitionExchanger split across
+// channels. Carries the number of rows of that partition routed to other channels in front of this
+// chunk, so the consumer can restore global per-partition row numbering.
+class PartitionSplitOffsetExtraData final : public ChunkExtraData {
+public:
+    explicit PartitionSplitOffsetExtraData(int64_t offset) : _offset(offset) {}
+    ~PartitionSplitOffsetExtraData() override = default;
+
+    int64_t offset() const { return _offset; }
+
+private:
+    int64_t _offset;
+};
+
 // The input stream is already ordered by partition columns.
 // This partitioner is going to split these partitions into different channels, and try to balance the amount of
 // data across channels.
 // And for better performance, there's no row-level split during the entire process.
+//
+// With intra-partition split enabled, a single partition exceeding
+// pipeline_analytic_partition_split_rows rows spills over to further channels, each continuation
+// chunk carrying a PartitionSplitOffsetExtraData. Every channel receives at most one contiguous
+// range of such a partition.
 class OrderedPartitionExchanger final : public LocalExchanger {
 public:
     OrderedPartitionExchanger(const std::shared_ptr<ChunkBufferMemoryManager>& memory_manager,
                               LocalExchangeSourceOperatorFactory* source,
-                              std::vector<ExprContext*> partition_expr_ctxs);
+                              std::vector<ExprContext*> partition_expr_ctxs,
+                              bool enable_intra_partition_split = false);
     ~OrderedPartitionExchanger() override = default;
 
     Status prepare(RuntimeState* state) override;
@@ -216,12 +237,28 @@ public:
 
 private:
     size_t _find_min_channel_id();
+    // The length of the equal-value run at the end of the chunk, i.e. the rows of the partition
+    // which the next chunk may continue. The chunk is ordered by the partition columns.
+    size_t _partition_tail_start(const Columns& partition_columns, size_t num_rows);
+    void _on_partition_start(size_t channel_id, const Columns& partition_columns, size_t num_rows);
+    void _on_partition_continue(size_t channel_id, size_t num_rows);
+    // The channel the current partition should continue on, switching to an unoccupied channel
+    // once the current one received its share of rows. Returns _previous_channel_id if switching
+    // is not possible or not worthwhile.
+    size_t _choose_continuation_channel(size_t num_rows);
 
     std::vector<ExprContext*> _partition_exprs;
     std::vector<size_t> _channel_row_nums;
     Columns _previous_partition_columns;
     size_t _previous_channel_id;
     ChunkPtr _previous_chunk;
+
+    const bool _enable_intra_partition_split;
+    // Rows of the partition currently being routed, in total and on the current channel, plus the
+    // channels it already occupies. Only maintained when intra-partition split is enabled.
+    size_t _partition_run_rows = 0;
+    size_t _partition_run_channel_rows = 0;
+    std::vector<bool> _partition_run_channels;
 };
 
 // key partition mainly means that the column value of each partition is the same.
@@ -171,6 +171,23 @@ ChunkPtr LocalExchangeSourceOperator::_pull_passthrough_chunk(RuntimeState* stat
     return nullptr;
 }
 
+// Returns true if the partition chunk selects all the rows of its source chunk in order, so the
+// source chunk can be returned as-is without materializing a new chunk. Sharing the chunk with
+// the other channels holding row-index views of it is safe, the same as BroadcastExchanger
+// sharing one chunk between all its sources.
+bool LocalExchangeSourceOperator::_is_full_chunk_selection(const PartitionChunk& partition_chunk) {
+    if (partition_chunk.from != 0 || partition_chunk.size != partition_chunk.chunk->num_rows()) {
+        return false;
+    }
+    const uint32_t* indexes = partition_chunk.indexes->data();
+    for (uint32_t i = 0; i < partition_chunk.size; i++) {
+        if (indexes[i] != i) {
+            return false;
+        }
+    }
+    return true;
+}
+
 ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeState* state) {
     std::vector<PartitionChunk> selected_partition_chunks;
     size_t num_rows = 0;
@@ -195,6 +212,10 @@ ChunkPtr LocalExchangeSourceOperator::_pull_shuffle_chunk(RuntimeState* state) {
     if (selected_partition_chunks.empty()) {
         throw std::runtime_error("local exchange gets empty shuffled chunk.");
     }
+    // Zero-copy fast path: a whole source chunk hashed to this channel, pass it through.
+    if (selected_partition_chunks.size() == 1 && _is_full_chunk_selection(selected_partition_chunks[0])) {
+        return std::move(selected_partition_chunks[0].chunk);
+    }
     // Unlock during merging partition chunks into a full chunk.
     ChunkPtr chunk = selected_partition_chunks[0].chunk->clone_empty_with_slot();
     chunk->reserve(num_rows);
@@ -233,6 +254,11 @@ ChunkPtr LocalExchangeSourceOperator::_pull_key_partition_chunk(RuntimeState* st
         _memory_manager->update_memory_usage(-memory_usage, -num_rows);
     }
 
+    // Zero-copy fast path: a whole source chunk belongs to this partition, pass it through.
+    if (selected_partition_chunks.size() == 1 && _is_full_chunk_selection(selected_partition_chunks[0])) {
+        return std::move(selected_partition_chunks[0].chunk);
+    }
+
     // Unlock during merging partition chunks into a full chunk.
     ChunkPtr chunk = selected_partition_chunks[0].chunk->clone_empty_with_slot();
     chunk->reserve(num_rows);
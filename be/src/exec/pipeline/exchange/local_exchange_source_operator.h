@@ -146,6 +146,8 @@ private:
 
     PendingPartitionChunks& _max_row_partition_chunks();
 
+    static bool _is_full_chunk_selection(const PartitionChunk& partition_chunk);
+
     bool _local_buffer_almost_full() const { return _local_memory_usage >= _local_memory_limit; }
 
     bool _key_partition_pending_chunk_empty() const {
@@ -14,7 +14,12 @@
 
 #include "exec/pipeline/exchange/multi_cast_local_exchange.h"
 
+#include "common/config.h"
+#include "exec/pipeline/query_context.h"
+#include "exec/spill/query_spill_manager.h"
+#include "serde/column_array_serde.h"
 #include "util/logging.h"
+#include "util/raw_container.h"
 
 namespace starrocks::pipeline {
 
@@ -39,17 +44,26 @@ MultiCastLocalExchanger::MultiCastLocalExchanger(RuntimeState* runtime_state, si
             "PeakMemoryUsage", TUnit::BYTES, RuntimeProfile::Counter::create_strategy(TUnit::BYTES));
     _peak_buffer_row_size_counter = _runtime_profile->AddHighWaterMarkCounter(
             "PeakBufferRowSize", TUnit::UNIT, RuntimeProfile::Counter::create_strategy(TUnit::UNIT));
+    _spill_bytes_counter = ADD_COUNTER(_runtime_profile.get(), "SpillBytes", TUnit::BYTES);
+    _restore_bytes_counter = ADD_COUNTER(_runtime_profile.get(), "RestoreBytes", TUnit::BYTES);
 }
 
 MultiCastLocalExchanger::~MultiCastLocalExchanger() {
     while (_head != nullptr) {
         auto* t = _head->next;
         _current_memory_usage -= _head->memory_usage;
-        delete _head;
+        _free_cell(_head);
         _head = t;
     }
 }
 
+void MultiCastLocalExchanger::_free_cell(Cell* cell) {
+    if (cell->block != nullptr) {
+        (void)_block_manager->release_block(cell->block);
+    }
+    delete cell;
+}
+
 bool MultiCastLocalExchanger::can_push_chunk() const {
     std::unique_lock l(_mutex);
     // if for the fastest consumer, the exchanger still has enough chunk to be consumed.
@@ -86,11 +100,87 @@ Status MultiCastLocalExchanger::push_chunk(const ChunkPtr& chunk, int32_t sink_d
         _peak_memory_usage_counter->set(_current_memory_usage);
         _peak_buffer_row_size_counter->set(_current_row_size);
         sink_operator->update_counter(_current_memory_usage, _current_row_size);
+        RETURN_IF_ERROR(_spill_backlog());
+    }
+
+    return Status::OK();
+}
+
+Status MultiCastLocalExchanger::_spill_backlog() {
+    const int64_t mem_limit = config::multi_cast_local_exchange_spill_mem_limit;
+    if (mem_limit <= 0 || !_runtime_state->enable_spill()) return Status::OK();
+    if (_current_memory_usage <= mem_limit) return Status::OK();
+    if (_block_manager == nullptr) {
+        auto* query_ctx = _runtime_state->query_ctx();
+        if (query_ctx == nullptr) return Status::OK();
+        _block_manager = query_ctx->spill_manager()->block_manager();
+    }
+    // The oldest cells form the slow consumers' backlog, flush them first so that the window
+    // close to the tail stays memory-resident for the fast consumers. The cell just pushed
+    // is always kept in memory.
+    for (Cell* cell = _head->next; cell != nullptr && cell != _tail && _current_memory_usage > mem_limit;
+         cell = cell->next) {
+        if (cell->block != nullptr || cell->used_count >= _consumer_number) continue;
+        RETURN_IF_ERROR(_spill_cell(cell));
+    }
+    return Status::OK();
+}
+
+Status MultiCastLocalExchanger::_spill_cell(Cell* cell) {
+    int64_t max_serialized_size = 0;
+    for (const auto& column : cell->chunk->columns()) {
+        int64_t column_size = serde::ColumnArraySerde::max_serialized_size(*column);
+        // the column type is not serializable, keep the cell in memory.
+        if (column_size == 0) return Status::OK();
+        max_serialized_size += column_size;
     }
 
+    raw::RawString buffer;
+    buffer.resize(max_serialized_size);
+    auto* begin = reinterpret_cast<uint8_t*>(buffer.data());
+    uint8_t* cur = begin;
+    for (const auto& column : cell->chunk->columns()) {
+        cur = serde::ColumnArraySerde::serialize(*column, cur);
+        if (cur == nullptr) return Status::InternalError("failed to serialize chunk of multi cast local exchanger");
+    }
+    const size_t serialized_size = cur - begin;
+
+    spill::AcquireBlockOptions opts;
+    opts.query_id = _runtime_state->query_id();
+    opts.fragment_instance_id = _runtime_state->fragment_instance_id();
+    opts.plan_node_id = 0;
+    opts.name = "multi_cast_local_exchange";
+    opts.block_size = serialized_size;
+    ASSIGN_OR_RETURN(auto block, _block_manager->acquire_block(opts));
+    RETURN_IF_ERROR(block->append({Slice(begin, serialized_size)}));
+    RETURN_IF_ERROR(block->flush());
+
+    ChunkPtr layout = cell->chunk->clone_empty(0);
+    cell->block = std::move(block);
+    cell->spilled_bytes = serialized_size;
+    cell->chunk = std::move(layout);
+    _current_memory_usage -= cell->memory_usage;
+    cell->memory_usage = 0;
+    COUNTER_UPDATE(_spill_bytes_counter, serialized_size);
     return Status::OK();
 }
 
+StatusOr<ChunkPtr> MultiCastLocalExchanger::_restore_cell_chunk(Cell* cell) {
+    raw::RawString buffer;
+    buffer.resize(cell->spilled_bytes);
+    auto reader = cell->block->get_reader();
+    RETURN_IF_ERROR(reader->read_fully(buffer.data(), cell->spilled_bytes));
+
+    ChunkPtr chunk = cell->chunk->clone_empty(0);
+    const auto* cur = reinterpret_cast<const uint8_t*>(buffer.data());
+    for (auto& column : chunk->columns()) {
+        cur = serde::ColumnArraySerde::deserialize(cur, column.get());
+        if (cur == nullptr) return Status::InternalError("failed to deserialize chunk of multi cast local exchanger");
+    }
+    COUNTER_UPDATE(_restore_bytes_counter, cell->spilled_bytes);
+    return chunk;
+}
+
 bool MultiCastLocalExchanger::can_pull_chunk(int32_t mcast_consumer_index) const {
     DCHECK(mcast_consumer_index < _consumer_number);
 
@@ -115,13 +205,16 @@ StatusOr<ChunkPtr> MultiCastLocalExchanger::pull_chunk(RuntimeState* state, int3
         return Status::InternalError("unreachable in multicast local exchanger");
     }
     cell = cell->next;
-    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
-              << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
 
     _progress[mcast_consumer_index] = cell;
     cell->used_count += 1;
 
     _update_progress(cell);
+    if (cell->block != nullptr) {
+        return _restore_cell_chunk(cell);
+    }
+    VLOG_FILE << "MultiCastLocalExchanger: return chunk to " << mcast_consumer_index
+              << ", row = " << cell->chunk->debug_row(0) << ", size = " << cell->chunk->num_rows();
     return cell->chunk;
 }
 
@@ -178,7 +271,7 @@ void MultiCastLocalExchanger::_update_progress(Cell* fast) {
         Cell* t = _head->next;
         if (t == nullptr) break;
         _current_memory_usage -= _head->memory_usage;
-        delete _head;
+        _free_cell(_head);
         _head = t;
     }
     if (_head != nullptr) {
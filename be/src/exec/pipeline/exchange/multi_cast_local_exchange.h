@@ -16,6 +16,7 @@
 
 #include "column/chunk.h"
 #include "exec/pipeline/source_operator.h"
+#include "exec/spill/block_manager.h"
 
 namespace starrocks::pipeline {
 
@@ -60,6 +61,10 @@ public:
 private:
     struct Cell {
         ChunkPtr chunk = nullptr;
+        // When the cell has been spilled, |chunk| only keeps the column layout (an empty
+        // clone) and the payload lives in |block| as |spilled_bytes| serialized bytes.
+        spill::BlockPtr block = nullptr;
+        size_t spilled_bytes = 0;
         Cell* next = nullptr;
         size_t memory_usage = 0;
         size_t accumulated_row_size = 0;
@@ -68,6 +73,19 @@ private:
     };
     void _update_progress(Cell* fast = nullptr);
     void _closer_consumer(int32_t mcast_consumer_index);
+    // Flush the oldest still-needed in-memory cells to spill blocks while the buffered
+    // memory exceeds config::multi_cast_local_exchange_spill_mem_limit. Cells near the tail
+    // stay memory-resident, so fast consumers keep reading from memory while laggards
+    // replay the spilled stream from disk. Caller must hold _mutex.
+    Status _spill_backlog();
+    // Serialize |cell|'s chunk into a spill block of its own and drop the in-memory
+    // payload. Caller must hold _mutex.
+    Status _spill_cell(Cell* cell);
+    // Deserialize a spilled cell's payload back into a fresh chunk. Every pull creates its
+    // own reader on the shared block, so consumers keep independent read cursors on it.
+    // Caller must hold _mutex.
+    StatusOr<ChunkPtr> _restore_cell_chunk(Cell* cell);
+    void _free_cell(Cell* cell);
     RuntimeState* _runtime_state;
     mutable std::mutex _mutex;
     size_t _consumer_number;
@@ -82,9 +100,13 @@ private:
     Cell* _tail = nullptr;
     size_t _current_memory_usage = 0;
     size_t _current_row_size = 0;
+    // looked up lazily from the query context the first time the backlog overflows.
+    spill::BlockManager* _block_manager = nullptr;
     std::unique_ptr<RuntimeProfile> _runtime_profile;
     RuntimeProfile::HighWaterMarkCounter* _peak_memory_usage_counter = nullptr;
     RuntimeProfile::HighWaterMarkCounter* _peak_buffer_row_size_counter = nullptr;
+    RuntimeProfile::Counter* _spill_bytes_counter = nullptr;
+    RuntimeProfile::Counter* _restore_bytes_counter = nullptr;
 };
 
 // ===== source op =====
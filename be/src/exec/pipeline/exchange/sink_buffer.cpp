@@ -48,7 +48,7 @@ SinkBuffer::SinkBuffer(FragmentContext* fragment_ctx, const std::vector<TPlanFra
             _request_seqs[instance_id.lo] = -1;
             _max_continuous_acked_seqs[instance_id.lo] = -1;
             _discontinuous_acked_seqs[instance_id.lo] = std::unordered_set<int64_t>();
-            _buffers[instance_id.lo] = std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>();
+            _buffers[instance_id.lo] = std::list<TransmitChunkInfo>();
             _num_finished_rpcs[instance_id.lo] = 0;
             _num_in_flight_rpcs[instance_id.lo] = 0;
             _network_times[instance_id.lo] = TimeTrace{};
@@ -105,14 +105,14 @@ Status SinkBuffer::add_request(TransmitChunkInfo& request) {
         }
 
         auto& instance_id = request.fragment_instance_id;
-        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push(request); }));
+        RETURN_IF_ERROR(_try_to_send_rpc(instance_id, [&]() { _buffers[instance_id.lo].push_back(request); }));
     }
 
     return Status::OK();
 }
 
 bool SinkBuffer::is_full() const {
-    // std::queue' read is concurrent safe without mutex
+    // std::list' read is concurrent safe without mutex
     // Judgement may not that accurate because we do not known in advance which
     // instance the data to be sent corresponds to
     size_t max_buffer_size = config::pipeline_sink_buffer_size * _buffers.size();
@@ -313,7 +313,7 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             // so use the instance_mem_tracker passed from ExchangeSinkOperator to release memory.
             // This must be invoked before decrease_defer desctructed to avoid sink_buffer and fragment_ctx released.
             SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
-            buffer.pop();
+            buffer.pop_front();
         });
 
         // The order of data transmiting in IO level may not be strictly the same as
@@ -357,6 +357,13 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
             }
         }
 
+        // Under high fan-out, batches of one destination may pile up behind the dop-limited rpcs,
+        // each paying a full rpc round trip. Merge the queued follow-up batches into this request
+        // up to a byte budget, so the backlog drains with fewer rpcs.
+        if (!request.params->eos()) {
+            _coalesce_requests(request, buffer);
+        }
+
         *request.params->mutable_finst_id() = _instance_id2finst_id[instance_id.lo];
         request.params->set_sequence(++_request_seqs[instance_id.lo]);
 
@@ -439,6 +446,57 @@ Status SinkBuffer::_try_to_send_rpc(const TUniqueId& instance_id, const std::fun
     return Status::OK();
 }
 
+bool SinkBuffer::_can_coalesce(const TransmitChunkInfo& dst, const TransmitChunkInfo& src) {
+    // eos carries finishing semantics and must stay a standalone packet.
+    // Pass-through requests are just notifications whose chunks travel through the
+    // pass-through context, so concatenating them wouldn't save anything.
+    // The remaining metadata must be identical, because the merged request carries it only once,
+    // and chunks/driver_sequences of a pipeline-level shuffle are parallel arrays.
+    return !src.params->eos() && !dst.params->use_pass_through() && !src.params->use_pass_through() &&
+           dst.params->sender_id() == src.params->sender_id() &&
+           dst.params->be_number() == src.params->be_number() &&
+           dst.params->is_pipeline_level_shuffle() == src.params->is_pipeline_level_shuffle();
+}
+
+void SinkBuffer::_coalesce_requests(TransmitChunkInfo& request, std::list<TransmitChunkInfo>& buffer) {
+    const int64_t max_bytes = config::pipeline_sink_coalesce_rpc_max_bytes;
+    if (max_bytes <= 0) {
+        return;
+    }
+    while (buffer.size() > 1) {
+        auto next_it = std::next(buffer.begin());
+        TransmitChunkInfo& next = *next_it;
+        if (!_can_coalesce(request, next)) {
+            break;
+        }
+        if (static_cast<int64_t>(request.attachment.size() + next.attachment.size()) > max_bytes) {
+            break;
+        }
+
+        auto* params = request.params.get();
+        auto* next_params = next.params.get();
+        for (auto& chunk : *next_params->mutable_chunks()) {
+            params->add_chunks()->Swap(&chunk);
+        }
+        for (auto driver_sequence : next_params->driver_sequences()) {
+            params->add_driver_sequences(driver_sequence);
+        }
+        // Keep the most recent statistics snapshot.
+        if (next_params->has_query_statistics()) {
+            params->mutable_query_statistics()->Swap(next_params->mutable_query_statistics());
+        }
+        request.attachment.append(next.attachment);
+        request.attachment_physical_bytes += next.attachment_physical_bytes;
+        if (!next.attachment.empty()) {
+            _request_sent++;
+        }
+
+        // The request memory is acquired by ExchangeSinkOperator, see the comment in _try_to_send_rpc.
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(_mem_tracker);
+        buffer.erase(next_it);
+    }
+}
+
 Status SinkBuffer::_send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure,
                              const TransmitChunkInfo& request) {
     auto expected_iobuf_size = request.attachment.size() + request.params->ByteSizeLong() + sizeof(size_t) * 2;
@@ -116,6 +116,11 @@ private:
     // send by rpc or http
     Status _send_rpc(DisposableClosure<PTransmitChunkResult, ClosureContext>* closure, const TransmitChunkInfo& req);
 
+    // Concatenate the batches queued behind `request` into it, as long as their routing metadata
+    // is identical and the merged attachment stays within pipeline_sink_coalesce_rpc_max_bytes
+    static bool _can_coalesce(const TransmitChunkInfo& dst, const TransmitChunkInfo& src);
+    void _coalesce_requests(TransmitChunkInfo& request, std::list<TransmitChunkInfo>& buffer);
+
     // Roughly estimate network time which is defined as the time between sending a and receiving a packet,
     // and the processing time of both sides are excluded
     // For each destination, we may send multiply packages at the same time, and the time is
@@ -151,7 +156,8 @@ private:
     // The request needs the reference to the allocated finst id,
     // so cache finst id for each dest fragment instance.
     phmap::flat_hash_map<int64_t, PUniqueId> _instance_id2finst_id;
-    phmap::flat_hash_map<int64_t, std::queue<TransmitChunkInfo, std::list<TransmitChunkInfo>>> _buffers;
+    // std::list instead of std::queue, because coalescing inspects and erases entries behind the front.
+    phmap::flat_hash_map<int64_t, std::list<TransmitChunkInfo>> _buffers;
     phmap::flat_hash_map<int64_t, int32_t> _num_finished_rpcs;
     phmap::flat_hash_map<int64_t, int32_t> _num_in_flight_rpcs;
     phmap::flat_hash_map<int64_t, TimeTrace> _network_times;
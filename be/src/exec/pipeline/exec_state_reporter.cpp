@@ -17,6 +17,9 @@
 #include <thrift/Thrift.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "agent/master_info.h"
 #include "runtime/client_cache.h"
 #include "runtime/exec_env.h"
@@ -200,6 +203,51 @@ Status ExecStateReporter::report_exec_status(const TReportExecStatusParams& para
     return rpc_status;
 }
 
+void ExecStateReporter::prune_unchanged_profile_items(const TRuntimeProfileTree& last_report,
+                                                      TRuntimeProfileTree* profile) {
+    // FE applies reports node by node in the same preorder, so pruning is only safe when the
+    // tree has exactly the structure of the last report.
+    if (last_report.nodes.size() != profile->nodes.size()) {
+        return;
+    }
+    for (size_t i = 0; i < profile->nodes.size(); i++) {
+        const auto& last_node = last_report.nodes[i];
+        const auto& node = profile->nodes[i];
+        if (last_node.name != node.name || last_node.num_children != node.num_children) {
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < profile->nodes.size(); i++) {
+        const auto& last_node = last_report.nodes[i];
+        auto& node = profile->nodes[i];
+
+        std::unordered_map<std::string_view, const TCounter*> last_counters;
+        last_counters.reserve(last_node.counters.size());
+        for (const auto& counter : last_node.counters) {
+            last_counters.emplace(counter.name, &counter);
+        }
+        auto counters_end = std::remove_if(node.counters.begin(), node.counters.end(), [&](const TCounter& counter) {
+            auto it = last_counters.find(counter.name);
+            return it != last_counters.end() && *it->second == counter;
+        });
+        node.counters.erase(counters_end, node.counters.end());
+
+        for (auto it = node.info_strings.begin(); it != node.info_strings.end();) {
+            auto last_it = last_node.info_strings.find(it->first);
+            if (last_it != last_node.info_strings.end() && last_it->second == it->second) {
+                it = node.info_strings.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        auto order_end = std::remove_if(node.info_strings_display_order.begin(),
+                                        node.info_strings_display_order.end(),
+                                        [&](const std::string& key) { return node.info_strings.count(key) == 0; });
+        node.info_strings_display_order.erase(order_end, node.info_strings_display_order.end());
+    }
+}
+
 TMVMaintenanceTasks ExecStateReporter::create_report_epoch_params(const QueryContext* query_ctx,
                                                                   const std::vector<FragmentContext*>& fragment_ctxs) {
     TMVMaintenanceTasks params;
@@ -39,6 +39,12 @@ public:
     static Status report_exec_status(const TReportExecStatusParams& params, ExecEnv* exec_env,
                                      const TNetworkAddress& fe_addr);
 
+    // Remove from |profile| the counters and info strings that are identical to the ones in
+    // |last_report|, so that interval reports only carry the items that changed. The node
+    // structure must match exactly, otherwise |profile| is left untouched, because FE applies
+    // reports node by node in the same preorder.
+    static void prune_unchanged_profile_items(const TRuntimeProfileTree& last_report, TRuntimeProfileTree* profile);
+
     void submit(std::function<void()>&& report_task, bool priority = false);
 
     // STREAM MV
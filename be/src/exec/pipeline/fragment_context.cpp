@@ -15,6 +15,7 @@
 #include "exec/pipeline/fragment_context.h"
 
 #include "exec/data_sink.h"
+#include "exec/pipeline/exec_state_reporter.h"
 #include "exec/pipeline/group_execution/execution_group.h"
 #include "exec/pipeline/pipeline_driver_executor.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
@@ -133,6 +134,18 @@ void FragmentContext::report_exec_state_if_necessary() {
     }
 }
 
+void FragmentContext::fold_unchanged_profile_items(TRuntimeProfileTree* profile) {
+    std::lock_guard<std::mutex> l(_last_reported_profile_lock);
+    if (_last_reported_profile == nullptr) {
+        // The first report is always a full one.
+        _last_reported_profile = std::make_unique<TRuntimeProfileTree>(*profile);
+        return;
+    }
+    auto full_tree = std::make_unique<TRuntimeProfileTree>(*profile);
+    ExecStateReporter::prune_unchanged_profile_items(*_last_reported_profile, profile);
+    _last_reported_profile = std::move(full_tree);
+}
+
 void FragmentContext::set_final_status(const Status& status) {
     if (_final_status.load() != nullptr) {
         return;
@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <unordered_map>
 
 #include "exec/exec_node.h"
@@ -79,6 +80,10 @@ public:
     bool need_report_exec_state();
     void report_exec_state_if_necessary();
 
+    // Fold the counters and info strings that did not change since the last interval report out
+    // of |profile|, and remember the full tree for the next report.
+    void fold_unchanged_profile_items(TRuntimeProfileTree* profile);
+
     void set_final_status(const Status& status);
 
     Status final_status() const {
@@ -225,6 +230,11 @@ private:
 
     std::atomic<int64_t> _last_report_exec_state_ns = MonotonicNanos();
 
+    // Guards _last_reported_profile, interval reports may overlap with each other.
+    std::mutex _last_reported_profile_lock;
+    // The last interval-reported profile tree, used to prune unchanged items from the next one.
+    std::unique_ptr<TRuntimeProfileTree> _last_reported_profile;
+
     RuntimeProfile::Counter* _jit_counter = nullptr;
     RuntimeProfile::Counter* _jit_timer = nullptr;
 };
@@ -35,6 +35,7 @@
 #include "exec/workgroup/work_group.h"
 #include "gutil/casts.h"
 #include "gutil/map_util.h"
+#include "gutil/strings/substitute.h"
 #include "runtime/data_stream_mgr.h"
 #include "runtime/data_stream_sender.h"
 #include "runtime/descriptors.h"
@@ -263,8 +264,16 @@ Status FragmentExecutor::_prepare_runtime_state(ExecEnv* exec_env, const Unified
             _query_ctx->set_desc_tbl(desc_tbl);
         }
     } else {
-        RETURN_IF_ERROR(
-                DescriptorTbl::create(runtime_state, obj_pool, t_desc_tbl, &desc_tbl, runtime_state->chunk_size()));
+        // Fragment instances of one query all carry the same descriptor table, so build it
+        // once per query on this BE and share it across the instances instead of rebuilding
+        // it for each of them. A private copy is only built when the incoming table does not
+        // match the shared one.
+        ASSIGN_OR_RETURN(desc_tbl, _query_ctx->get_or_create_shared_desc_tbl(runtime_state, t_desc_tbl,
+                                                                             runtime_state->chunk_size()));
+        if (desc_tbl == nullptr) {
+            RETURN_IF_ERROR(
+                    DescriptorTbl::create(runtime_state, obj_pool, t_desc_tbl, &desc_tbl, runtime_state->chunk_size()));
+        }
     }
     runtime_state->set_desc_tbl(desc_tbl);
     if (query_options.__isset.enable_spill && query_options.enable_spill) {
@@ -681,6 +690,23 @@ Status FragmentExecutor::_prepare_global_dict(const UnifiedExecPlanFragmentParam
     return Status::OK();
 }
 
+Status FragmentExecutor::_check_mem_admission() {
+    auto* pool_mem_tracker = GlobalEnv::GetInstance()->query_pool_mem_tracker();
+    auto query_mem_tracker = _query_ctx->mem_tracker();
+    if (!pool_mem_tracker->has_limit() || query_mem_tracker == nullptr || !query_mem_tracker->has_limit()) {
+        return Status::OK();
+    }
+    int64_t declared_bytes = query_mem_tracker->limit();
+    int64_t available_bytes = pool_mem_tracker->limit() - pool_mem_tracker->consumption();
+    if (declared_bytes > available_bytes) {
+        return Status::TooManyTasks(strings::Substitute(
+                "Memory admission failed: query declares $0 bytes but the query pool only has $1 of $2 bytes "
+                "available, retry later or lower query_mem_limit",
+                declared_bytes, available_bytes, pool_mem_tracker->limit()));
+    }
+    return Status::OK();
+}
+
 Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParams& common_request,
                                  const TExecPlanFragmentParams& unique_request) {
     DCHECK(common_request.__isset.desc_tbl);
@@ -758,6 +784,13 @@ Status FragmentExecutor::prepare(ExecEnv* exec_env, const TExecPlanFragmentParam
         SCOPED_RAW_TIMER(&profiler.prepare_runtime_state_time);
         RETURN_IF_ERROR(_prepare_workgroup(request));
         RETURN_IF_ERROR(_prepare_runtime_state(exec_env, request));
+        // Reservation-based admission: reject the query up front when the query pool cannot hold
+        // its declared memory limit, instead of letting it fail with MEM_LIMIT_EXCEEDED after
+        // doing a lot of work. Only the first prepared fragment instance of a query performs the
+        // check, so an admitted query is never kicked out by its own later fragments.
+        if (config::enable_query_pool_mem_admission_control && _query_ctx->mark_mem_admission_checked()) {
+            RETURN_IF_ERROR(_check_mem_admission());
+        }
 
         auto mem_tracker = _fragment_ctx->runtime_state()->instance_mem_tracker();
         SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
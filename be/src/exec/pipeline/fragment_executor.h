@@ -127,6 +127,7 @@ private:
     Status _prepare_global_dict(const UnifiedExecPlanFragmentParams& request);
     Status _prepare_pipeline_driver(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
     Status _prepare_stream_load_pipe(ExecEnv* exec_env, const UnifiedExecPlanFragmentParams& request);
+    Status _check_mem_admission();
 
     std::unordered_map<int32_t, ExecutionGroupPtr> _colocate_exec_groups;
     bool _is_in_colocate_exec_group(PlanNodeId plan_node_id);
@@ -575,10 +575,19 @@ Status NLJoinProbeOperator::_permute_right_join(size_t chunk_size) {
                 }
             } else {
                 ColumnPtr& src_col = _curr_build_chunk->get_column_by_slot_id(slot->id());
-                for (int i = 0; i < cur_chunk_size; i++) {
-                    if (!build_match_flag[match_flag_index + i]) {
-                        dst_col->append(*src_col, i, 1);
+                // Unmatched build rows usually come in long runs, so append each run at once
+                // rather than row by row.
+                size_t i = 0;
+                while (i < cur_chunk_size) {
+                    if (build_match_flag[match_flag_index + i]) {
+                        i++;
+                        continue;
                     }
+                    size_t run_start = i;
+                    while (i < cur_chunk_size && !build_match_flag[match_flag_index + i]) {
+                        i++;
+                    }
+                    dst_col->append(*src_col, run_start, i - run_start);
                 }
             }
         }
@@ -633,7 +642,11 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_other_join(size_t chunk_
         ChunkPtr chunk = _permute_chunk_for_other_join(chunk_size);
         DCHECK(chunk);
         RETURN_IF_ERROR(_probe_for_other_join(chunk));
-        RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
+        // For selective join conjuncts (e.g. band joins) most tiles are filtered down to nothing,
+        // so don't bother evaluating the remaining conjuncts over an empty chunk.
+        if (!chunk->is_empty()) {
+            RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
+        }
 
         RETURN_IF_ERROR(_output_accumulator.push(std::move(chunk)));
         if (ChunkPtr res = _output_accumulator.pull()) {
@@ -662,7 +675,9 @@ StatusOr<ChunkPtr> NLJoinProbeOperator::_pull_chunk_for_inner_join(size_t chunk_
         ChunkPtr chunk = _permute_chunk_for_inner_join(chunk_size);
         DCHECK(chunk);
         RETURN_IF_ERROR(_probe_for_inner_join(chunk));
-        RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
+        if (!chunk->is_empty()) {
+            RETURN_IF_ERROR(eval_conjuncts(_conjunct_ctxs, chunk.get(), nullptr));
+        }
 
         RETURN_IF_ERROR(_output_accumulator.push(std::move(chunk)));
         if (ChunkPtr res = _output_accumulator.pull()) {
@@ -17,6 +17,7 @@
 #include <algorithm>
 #include <utility>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "exec/exec_node.h"
 #include "exec/pipeline/query_context.h"
@@ -76,6 +77,13 @@ Status Operator::prepare(RuntimeState* state) {
     _push_row_num_counter = ADD_COUNTER(_common_metrics, "PushRowNum", TUnit::UNIT);
     _pull_chunk_num_counter = ADD_COUNTER(_common_metrics, "PullChunkNum", TUnit::UNIT);
     _pull_row_num_counter = ADD_COUNTER(_common_metrics, "PullRowNum", TUnit::UNIT);
+    _copy_on_write_bytes_counter = ADD_COUNTER(_common_metrics, "CopyOnWriteBytes", TUnit::BYTES);
+    if (config::pipeline_enable_pmu_profile_counters) {
+        _pmu_cycles_counter = ADD_COUNTER(_common_metrics, "PmuCycles", TUnit::UNIT);
+        _pmu_instructions_counter = ADD_COUNTER(_common_metrics, "PmuInstructions", TUnit::UNIT);
+        _pmu_cache_misses_counter = ADD_COUNTER(_common_metrics, "PmuCacheMisses", TUnit::UNIT);
+        _pmu_branch_misses_counter = ADD_COUNTER(_common_metrics, "PmuBranchMisses", TUnit::UNIT);
+    }
     if (state->query_ctx() && state->query_ctx()->spill_manager()) {
         _mem_resource_manager.prepare(this, state->query_ctx()->spill_manager());
     }
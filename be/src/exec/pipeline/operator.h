@@ -23,6 +23,7 @@
 #include "exprs/runtime_filter_bank.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/mem_tracker.h"
+#include "util/perf_event_group.h"
 #include "util/runtime_profile.h"
 
 namespace starrocks {
@@ -42,6 +43,7 @@ using LocalRFWaitingSet = std::set<TPlanNodeId>;
 class Operator {
     friend class PipelineDriver;
     friend class StreamPipelineDriver;
+    friend class ScopedOperatorPmuCounters;
 
 public:
     Operator(OperatorFactory* factory, int32_t id, std::string name, int32_t plan_node_id, bool is_subordinate,
@@ -303,6 +305,14 @@ protected:
     RuntimeProfile::Counter* _push_row_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_chunk_num_counter = nullptr;
     RuntimeProfile::Counter* _pull_row_num_counter = nullptr;
+    // bytes deep-copied through Column::clone while this operator pushed/pulled chunks
+    RuntimeProfile::Counter* _copy_on_write_bytes_counter = nullptr;
+    // PMU counters collected around push/pull chunk, only registered when
+    // config::pipeline_enable_pmu_profile_counters is set and the host exposes a PMU
+    RuntimeProfile::Counter* _pmu_cycles_counter = nullptr;
+    RuntimeProfile::Counter* _pmu_instructions_counter = nullptr;
+    RuntimeProfile::Counter* _pmu_cache_misses_counter = nullptr;
+    RuntimeProfile::Counter* _pmu_branch_misses_counter = nullptr;
     RuntimeProfile::Counter* _runtime_in_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _runtime_bloom_filter_num_counter = nullptr;
     RuntimeProfile::Counter* _conjuncts_timer = nullptr;
@@ -329,6 +339,36 @@ private:
     std::vector<ExprContext*> _runtime_in_filters;
 };
 
+// Accumulates the PMU delta of its scope into the operator's Pmu* profile counters. No-op
+// when the counters are not registered (config off) or the thread has no usable event group.
+class ScopedOperatorPmuCounters {
+public:
+    explicit ScopedOperatorPmuCounters(Operator* op)
+            : _op(op->_pmu_cycles_counter != nullptr && PerfEventGroup::current().valid() ? op : nullptr) {
+        if (_op != nullptr) {
+            _begin = PerfEventGroup::current().read();
+        }
+    }
+
+    ~ScopedOperatorPmuCounters() {
+        if (_op == nullptr) {
+            return;
+        }
+        auto delta = PerfEventGroup::current().read() - _begin;
+        COUNTER_UPDATE(_op->_pmu_cycles_counter, delta.cycles);
+        COUNTER_UPDATE(_op->_pmu_instructions_counter, delta.instructions);
+        COUNTER_UPDATE(_op->_pmu_cache_misses_counter, delta.cache_misses);
+        COUNTER_UPDATE(_op->_pmu_branch_misses_counter, delta.branch_misses);
+    }
+
+    ScopedOperatorPmuCounters(const ScopedOperatorPmuCounters&) = delete;
+    void operator=(const ScopedOperatorPmuCounters&) = delete;
+
+private:
+    Operator* _op;
+    PerfEventGroup::Values _begin;
+};
+
 class OperatorFactory {
 public:
     OperatorFactory(int32_t id, std::string name, int32_t plan_node_id);
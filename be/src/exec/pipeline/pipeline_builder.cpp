@@ -251,7 +251,7 @@ OpFactories PipelineBuilderContext::_do_maybe_interpolate_local_shuffle_exchange
 
 OpFactories PipelineBuilderContext::maybe_interpolate_local_ordered_partition_exchange(
         RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
-        const std::vector<ExprContext*>& partition_expr_ctxs) {
+        const std::vector<ExprContext*>& partition_expr_ctxs, bool enable_intra_partition_split) {
     DCHECK(!pred_operators.empty() && pred_operators[0]->is_source());
 
     // interpolate grouped exchange if needed
@@ -277,7 +277,8 @@ OpFactories PipelineBuilderContext::maybe_interpolate_local_ordered_partition_ex
     local_shuffle_source->set_degree_of_parallelism(shuffle_partitions_num);
 
     auto local_shuffle =
-            std::make_shared<OrderedPartitionExchanger>(mem_mgr, local_shuffle_source.get(), partition_expr_ctxs);
+            std::make_shared<OrderedPartitionExchanger>(mem_mgr, local_shuffle_source.get(), partition_expr_ctxs,
+                                                        enable_intra_partition_split);
     auto local_shuffle_sink =
             std::make_shared<LocalExchangeSinkOperatorFactory>(next_operator_id(), plan_node_id, local_shuffle);
 
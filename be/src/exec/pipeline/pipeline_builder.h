@@ -107,7 +107,7 @@ public:
     // as long as the data of the same partition_exprs are in the same channel.
     OpFactories maybe_interpolate_local_ordered_partition_exchange(
             RuntimeState* state, int32_t plan_node_id, OpFactories& pred_operators,
-            const std::vector<ExprContext*>& partition_expr_ctxs);
+            const std::vector<ExprContext*>& partition_expr_ctxs, bool enable_intra_partition_split = false);
 
     void interpolate_spill_process(size_t plan_node_id, const SpillProcessChannelFactoryPtr& channel_factory,
                                    size_t dop);
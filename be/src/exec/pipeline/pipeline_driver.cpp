@@ -18,6 +18,7 @@
 #include <sstream>
 
 #include "column/chunk.h"
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/pipeline/adaptive/event.h"
 #include "exec/pipeline/exchange/exchange_sink_operator.h"
@@ -38,6 +39,7 @@
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/starrocks_metrics.h"
+#include "util/time.h"
 
 namespace starrocks::pipeline {
 
@@ -231,12 +233,14 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
     size_t total_chunks_moved = 0;
     size_t total_rows_moved = 0;
     int64_t time_spent = 0;
+    int64_t begin_cpu_time_ns = GetCurrentThreadCpuTimeNanos();
     Status return_status = Status::OK();
     DeferOp defer([&]() {
         if (ScanOperator* scan = source_scan_operator()) {
             scan->end_driver_process(this);
         }
 
+        driver_acct().update_last_cpu_time_spent(GetCurrentThreadCpuTimeNanos() - begin_cpu_time_ns);
         _update_statistics(runtime_state, total_chunks_moved, total_rows_moved, time_spent);
     });
 
@@ -303,7 +307,13 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                     SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(curr_op);
                     SCOPED_TIMER(curr_op->_pull_timer);
                     QUERY_TRACE_SCOPED(curr_op->get_name(), "pull_chunk");
+                    ScopedOperatorPmuCounters pmu_counters(curr_op.get());
+                    int64_t clone_bytes = ColumnCloneStats::current_thread_bytes();
                     maybe_chunk = curr_op->pull_chunk(runtime_state);
+                    clone_bytes = ColumnCloneStats::current_thread_bytes() - clone_bytes;
+                    if (clone_bytes > 0) {
+                        COUNTER_UPDATE(curr_op->_copy_on_write_bytes_counter, clone_bytes);
+                    }
                 }
                 return_status = maybe_chunk.status();
                 if (!return_status.ok() && !return_status.is_end_of_file()) {
@@ -334,9 +344,15 @@ StatusOr<DriverState> PipelineDriver::process(RuntimeState* runtime_state, int w
                             SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(next_op);
                             SCOPED_TIMER(next_op->_push_timer);
                             QUERY_TRACE_SCOPED(next_op->get_name(), "push_chunk");
+                            ScopedOperatorPmuCounters pmu_counters(next_op.get());
                             _adjust_memory_usage(runtime_state, query_mem_tracker.get(), next_op, maybe_chunk.value());
                             RELEASE_RESERVED_GUARD();
+                            int64_t clone_bytes = ColumnCloneStats::current_thread_bytes();
                             return_status = next_op->push_chunk(runtime_state, maybe_chunk.value());
+                            clone_bytes = ColumnCloneStats::current_thread_bytes() - clone_bytes;
+                            if (clone_bytes > 0) {
+                                COUNTER_UPDATE(next_op->_copy_on_write_bytes_counter, clone_bytes);
+                            }
                         }
                         // ignore empty chunk generated by per-tablet computation when query cache enabled
                         if (row_num > 0L) {
@@ -586,6 +602,17 @@ void PipelineDriver::_adjust_memory_usage(RuntimeState* state, MemTracker* track
     // try to release buffer if memusage > mid level threhold
     _try_to_release_buffer(state, op);
 
+    // under global memory pressure, spill the operators holding substantial revocable memory even
+    // if their own query is still below its per-query limit, so the largest holders release
+    // memory before smaller queries fail with MEM_LIMIT_EXCEEDED
+    if (config::enable_spill_on_process_mem_pressure &&
+        op->revocable_mem_bytes() > state->spill_operator_min_bytes() &&
+        GlobalEnv::GetInstance()->process_mem_tracker()->limit_exceeded_by_ratio(
+                config::spill_process_mem_high_level)) {
+        mem_resource_mgr.to_low_memory_mode();
+        return;
+    }
+
     // force mark operator to low memory mode
     if (state->spill_revocable_max_bytes() > 0 && op->revocable_mem_bytes() > state->spill_revocable_max_bytes()) {
         mem_resource_mgr.to_low_memory_mode();
@@ -122,11 +122,17 @@ public:
     // get last elapsed time for process.
     int64_t get_last_time_spent() { return last_time_spent; }
 
+    // get the thread CPU time consumed by the last process, which excludes the time the worker
+    // thread spent descheduled or blocked, so it is a more accurate charge for CPU quota
+    // enforcement than the elapsed time. 0 if it has not been measured for the last process.
+    int64_t get_last_cpu_time_spent() { return last_cpu_time_spent; }
+
     void update_last_time_spent(int64_t time_spent) {
         this->last_time_spent = time_spent;
         this->accumulated_time_spent += time_spent;
         this->accumulated_local_wait_time_spent += time_spent;
     }
+    void update_last_cpu_time_spent(int64_t cpu_time_spent) { this->last_cpu_time_spent = cpu_time_spent; }
     // This method must be invoked when adding back to ready queue or pending queue.
     void clean_local_queue_infos() {
         this->accumulated_local_wait_time_spent = 0;
@@ -168,6 +174,7 @@ private:
     int64_t schedule_times{0};
     int64_t schedule_effective_times{0};
     int64_t last_time_spent{0};
+    int64_t last_cpu_time_spent{0};
     int64_t last_chunks_moved{0};
     int64_t enter_local_queue_timestamp{0};
     int64_t accumulated_time_spent{0};
@@ -14,12 +14,16 @@
 
 #include "exec/pipeline/pipeline_driver_executor.h"
 
+#include <sched.h>
+
 #include <memory>
 
+#include "common/config.h"
 #include "exec/pipeline/stream_pipeline_driver.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
 #include "runtime/current_thread.h"
+#include "util/cpu_info.h"
 #include "util/debug/query_trace.h"
 #include "util/defer_op.h"
 #include "util/failpoint/fail_point.h"
@@ -73,9 +77,36 @@ void GlobalDriverExecutor::_finalize_driver(DriverRawPtr driver, RuntimeState* r
     driver->finalize(runtime_state, state, _schedule_count, _driver_execution_ns);
 }
 
+void GlobalDriverExecutor::_bind_to_numa_node(int worker_id) {
+    if (!config::pipeline_exec_thread_pool_numa_bind) {
+        return;
+    }
+    const int num_numa_nodes = CpuInfo::get_max_num_numa_nodes();
+    if (num_numa_nodes <= 1) {
+        return;
+    }
+    const int node = worker_id % num_numa_nodes;
+    const auto& cores = CpuInfo::get_cores_of_numa_node(node);
+    if (cores.empty()) {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int core : cores) {
+        CPU_SET(core, &cpu_set);
+    }
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        LOG(WARNING) << "[Driver] Fail to bind executor worker " << worker_id << " to numa node " << node
+                     << ", errno=" << errno;
+    } else {
+        VLOG(1) << "[Driver] Bind executor worker " << worker_id << " to numa node " << node;
+    }
+}
+
 void GlobalDriverExecutor::_worker_thread() {
     auto current_thread = Thread::current_thread();
     const int worker_id = _next_id++;
+    _bind_to_numa_node(worker_id);
     std::queue<DriverRawPtr> local_driver_queue;
     while (true) {
         if (_num_threads_setter.should_shrink()) {
@@ -314,6 +345,10 @@ void GlobalDriverExecutor::report_exec_state(QueryContext* query_ctx, FragmentCo
     auto* load_channel_profile = fragment_ctx->runtime_state()->load_channel_profile();
     auto params = ExecStateReporter::create_report_exec_status_params(query_ctx, fragment_ctx, profile,
                                                                       load_channel_profile, status, done);
+    // The final report always carries the full profile tree.
+    if (!done && params.__isset.profile && config::enable_profile_incremental_report) {
+        fragment_ctx->fold_unchanged_profile_items(&params.profile);
+    }
     auto fe_addr = fragment_ctx->fe_addr();
     if (fe_addr.hostname.empty()) {
         // query executed by external connectors, like spark and flink connector,
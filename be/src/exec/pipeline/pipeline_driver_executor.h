@@ -90,6 +90,11 @@ public:
 private:
     using Base = FactoryMethod<DriverExecutor, GlobalDriverExecutor>;
     void _worker_thread();
+    // Bind the calling worker thread to one NUMA node chosen round-robin by worker_id, so that
+    // drivers tend to run on the socket where their chunks and operator states were allocated.
+    // No-op unless config::pipeline_exec_thread_pool_numa_bind is set and the machine has more
+    // than one NUMA node.
+    void _bind_to_numa_node(int worker_id);
     StatusOr<DriverRawPtr> _get_next_driver(std::queue<DriverRawPtr>& local_driver_queue);
     void _finalize_driver(DriverRawPtr driver, RuntimeState* runtime_state, DriverState state);
     RuntimeProfile* _build_merged_instance_profile(QueryContext* query_ctx, FragmentContext* fragment_ctx,
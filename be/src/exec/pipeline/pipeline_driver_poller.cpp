@@ -15,6 +15,9 @@
 #include "pipeline_driver_poller.h"
 
 #include <chrono>
+
+#include "common/config.h"
+
 namespace starrocks::pipeline {
 
 void PipelineDriverPoller::start() {
@@ -39,8 +42,12 @@ void PipelineDriverPoller::shutdown() {
 
 void PipelineDriverPoller::run_internal() {
     this->_is_polling_thread_initialized.store(true, std::memory_order_release);
+    // start of the idle back-off ladder, doubled after every fruitless sleep up to
+    // config::pipeline_poller_max_idle_sleep_us.
+    constexpr int64_t kMinIdleSleepUs = 64;
     DriverList tmp_blocked_drivers;
     int spin_count = 0;
+    int64_t idle_sleep_us = kMinIdleSleepUs;
     std::vector<DriverRawPtr> ready_drivers;
     while (!_is_shutdown.load(std::memory_order_acquire)) {
         {
@@ -147,6 +154,7 @@ void PipelineDriverPoller::run_internal() {
             spin_count += 1;
         } else {
             spin_count = 0;
+            idle_sleep_us = kMinIdleSleepUs;
 
             _driver_queue->put_back(ready_drivers);
             ready_drivers.clear();
@@ -170,7 +178,21 @@ void PipelineDriverPoller::run_internal() {
         }
         if (spin_count == 640) {
             spin_count = 0;
-            sched_yield();
+            const int64_t max_idle_sleep_us = config::pipeline_poller_max_idle_sleep_us;
+            if (max_idle_sleep_us <= 0) {
+                sched_yield();
+            } else {
+                // Hundreds of consecutive scans made no blocked driver ready, so the whole
+                // population is waiting on external progress. Sleep between scans instead of
+                // re-scanning in a hot loop; add_blocked_driver notifies the condvar, so fresh
+                // arrivals are still examined promptly and the sleep only bounds how late the
+                // poller notices state changes of the already-blocked drivers.
+                std::unique_lock<std::mutex> lock(_global_mutex);
+                if (_blocked_drivers.empty() && !_is_shutdown.load(std::memory_order_acquire)) {
+                    _cond.wait_for(lock, std::chrono::microseconds(idle_sleep_us));
+                }
+                idle_sleep_us = std::min(idle_sleep_us * 2, max_idle_sleep_us);
+            }
         }
     }
 }
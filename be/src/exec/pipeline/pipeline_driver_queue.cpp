@@ -14,6 +14,7 @@
 
 #include "exec/pipeline/pipeline_driver_queue.h"
 
+#include "common/config.h"
 #include "exec/pipeline/source_operator.h"
 #include "exec/workgroup/work_group.h"
 #include "gutil/strings/substitute.h"
@@ -299,6 +300,14 @@ void WorkGroupDriverQueue::update_statistics(const DriverRawPtr driver) {
     std::lock_guard<std::mutex> lock(_global_mutex);
 
     int64_t runtime_ns = driver->driver_acct().get_last_time_spent();
+    if (config::enable_resource_group_cpu_time_accounting) {
+        // Charge the worker thread's CPU time instead of the elapsed time, so a workgroup is not
+        // billed for the time its drivers spent descheduled while other workgroups were running.
+        int64_t cpu_time_ns = driver->driver_acct().get_last_cpu_time_spent();
+        if (cpu_time_ns > 0) {
+            runtime_ns = cpu_time_ns;
+        }
+    }
     auto* wg_entity = driver->workgroup()->driver_sched_entity();
 
     // Update bandwidth control information.
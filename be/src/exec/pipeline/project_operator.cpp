@@ -57,6 +57,11 @@ Status ProjectOperator::push_chunk(RuntimeState* state, const ChunkPtr& chunk) {
     {
         SCOPED_TIMER(_expr_compute_timer);
         for (size_t i = 0; i < _column_ids.size(); ++i) {
+            if (!_reuse_from.empty() && _reuse_from[i] >= 0) {
+                // identical deterministic expr: share the column evaluated for the earlier slot
+                result_columns[i] = result_columns[_reuse_from[i]];
+                continue;
+            }
             ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate(chunk.get()));
 
             if (result_columns[i]->only_null()) {
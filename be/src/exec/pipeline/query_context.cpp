@@ -26,6 +26,7 @@
 #include "runtime/client_cache.h"
 #include "runtime/current_thread.h"
 #include "runtime/data_stream_mgr.h"
+#include "runtime/descriptors.h"
 #include "runtime/exec_env.h"
 #include "runtime/query_statistics.h"
 #include "runtime/runtime_filter_cache.h"
@@ -103,6 +104,25 @@ void QueryContext::cancel(const Status& status) {
     _fragment_mgr->cancel(status);
 }
 
+StatusOr<DescriptorTbl*> QueryContext::get_or_create_shared_desc_tbl(RuntimeState* state,
+                                                                     const TDescriptorTable& t_desc_tbl,
+                                                                     int32_t chunk_size) {
+    std::lock_guard guard(_shared_desc_tbl_mutex);
+    if (_shared_t_desc_tbl != nullptr) {
+        return *_shared_t_desc_tbl == t_desc_tbl ? _desc_tbl : nullptr;
+    }
+    if (_desc_tbl != nullptr) {
+        // built through the FE-driven TDescriptorTable::is_cached path, its thrift source is
+        // unknown so reuse cannot be verified here.
+        return nullptr;
+    }
+    DescriptorTbl* desc_tbl = nullptr;
+    RETURN_IF_ERROR(DescriptorTbl::create(state, &_object_pool, t_desc_tbl, &desc_tbl, chunk_size));
+    _shared_t_desc_tbl = _object_pool.add(new TDescriptorTable(t_desc_tbl));
+    _desc_tbl = desc_tbl;
+    return desc_tbl;
+}
+
 void QueryContext::init_mem_tracker(int64_t query_mem_limit, MemTracker* parent, int64_t big_query_mem_limit,
                                     int64_t spill_mem_limit, workgroup::WorkGroup* wg, RuntimeState* runtime_state) {
     std::call_once(_init_mem_tracker_once, [=]() {
@@ -134,6 +154,8 @@ void QueryContext::init_mem_tracker(int64_t query_mem_limit, MemTracker* parent,
         }
         _connector_scan_operator_mem_share_arbitrator =
                 _object_pool.add(new ConnectorScanOperatorMemShareArbitrator(_static_query_mem_limit));
+        _connector_scan_operator_io_tasks_arbitrator =
+                _object_pool.add(new ConnectorScanOperatorIOTasksArbitrator(config::connector_io_tasks_per_query));
 
         {
             MemTracker* connector_scan_parent = GlobalEnv::GetInstance()->connector_scan_pool_mem_tracker();
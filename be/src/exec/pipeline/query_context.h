@@ -46,6 +46,7 @@ using std::chrono::steady_clock;
 using std::chrono::duration_cast;
 
 class ConnectorScanOperatorMemShareArbitrator;
+class ConnectorScanOperatorIOTasksArbitrator;
 
 // The context for all fragment of one query in one BE
 class QueryContext : public std::enable_shared_from_this<QueryContext> {
@@ -64,6 +65,9 @@ public:
     }
 
     void count_down_fragments();
+    // Returns true for exactly one caller over the query's lifetime, so the memory admission
+    // check runs once per query instead of once per fragment instance.
+    bool mark_mem_admission_checked() { return !_mem_admission_checked.exchange(true); }
     int num_active_fragments() const { return _num_active_fragments.load(); }
     bool has_no_active_instances() { return _num_active_fragments.load() == 0; }
 
@@ -152,6 +156,15 @@ public:
         return _desc_tbl;
     }
 
+    // Returns the descriptor table shared by all fragment instances of this query on this
+    // BE, building it into the query-level object pool on first use. Fragment instances of
+    // one query always carry the same descriptor table, which is double-checked against the
+    // cached thrift copy before reuse: a mismatch returns nullptr and the caller builds a
+    // private table instead. Used when the FE does not drive descriptor table caching
+    // itself through TDescriptorTable::is_cached.
+    StatusOr<DescriptorTbl*> get_or_create_shared_desc_tbl(RuntimeState* state, const TDescriptorTable& t_desc_tbl,
+                                                           int32_t chunk_size);
+
     size_t total_fragments() { return _total_fragments; }
     /// Initialize the mem_tracker of this query.
     /// Positive `big_query_mem_limit` and non-null `wg` indicate
@@ -230,6 +243,9 @@ public:
     ConnectorScanOperatorMemShareArbitrator* connector_scan_operator_mem_share_arbitrator() const {
         return _connector_scan_operator_mem_share_arbitrator;
     }
+    ConnectorScanOperatorIOTasksArbitrator* connector_scan_operator_io_tasks_arbitrator() const {
+        return _connector_scan_operator_io_tasks_arbitrator;
+    }
 
 public:
     static constexpr int DEFAULT_EXPIRE_SECONDS = 300;
@@ -242,6 +258,7 @@ private:
     size_t _total_fragments;
     std::atomic<size_t> _num_fragments;
     std::atomic<size_t> _num_active_fragments;
+    std::atomic<bool> _mem_admission_checked{false};
     int64_t _delivery_deadline = 0;
     int64_t _query_deadline = 0;
     seconds _delivery_expire_seconds = seconds(DEFAULT_EXPIRE_SECONDS);
@@ -260,6 +277,11 @@ private:
     std::unordered_map<int32_t, std::shared_ptr<MemTracker>> _operator_mem_trackers;
     ObjectPool _object_pool;
     DescriptorTbl* _desc_tbl = nullptr;
+    // guards the lazily built shared descriptor table, fragment instances of one query may
+    // be prepared concurrently.
+    std::mutex _shared_desc_tbl_mutex;
+    // thrift source of the shared descriptor table, kept to verify reuse.
+    TDescriptorTable* _shared_t_desc_tbl = nullptr;
     std::once_flag _query_trace_init_flag;
     std::shared_ptr<starrocks::debug::QueryTrace> _query_trace;
     std::atomic_bool _is_prepared = false;
@@ -302,6 +324,7 @@ private:
 
     int64_t _static_query_mem_limit = 0;
     ConnectorScanOperatorMemShareArbitrator* _connector_scan_operator_mem_share_arbitrator = nullptr;
+    ConnectorScanOperatorIOTasksArbitrator* _connector_scan_operator_io_tasks_arbitrator = nullptr;
 };
 
 class QueryContextManager {
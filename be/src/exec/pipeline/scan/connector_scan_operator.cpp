@@ -32,6 +32,21 @@ int64_t ConnectorScanOperatorMemShareArbitrator::update_chunk_source_mem_bytes(i
     return scan_mem_limit * (new_value * 1.0 / std::max(total, new_value));
 }
 
+int ConnectorScanOperatorIOTasksArbitrator::update_expected_io_tasks(int old_value, int new_value) {
+    if (new_value <= old_value) {
+        total_expected_io_tasks.fetch_sub(old_value - new_value);
+        return new_value;
+    }
+    int64_t diff = new_value - old_value;
+    int64_t total = total_expected_io_tasks.fetch_add(diff) + diff;
+    if (total <= query_io_tasks_limit) return new_value;
+    // the raise would push the query-wide total above the budget: grant what is left of it,
+    // but never take away the share the caller already holds.
+    int granted = std::max<int64_t>(old_value, new_value - (total - query_io_tasks_limit));
+    total_expected_io_tasks.fetch_sub(new_value - granted);
+    return granted;
+}
+
 class ConnectorScanOperatorIOTasksMemLimiter {
 private:
     mutable std::mutex lock;
@@ -172,6 +187,10 @@ void ConnectorScanOperatorFactory::set_mem_share_arb(ConnectorScanOperatorMemSha
     _mem_share_arb = arb;
 }
 
+void ConnectorScanOperatorFactory::set_io_tasks_arb(ConnectorScanOperatorIOTasksArbitrator* arb) {
+    _io_tasks_arb = arb;
+}
+
 void ConnectorScanOperatorFactory::set_data_source_mem_bytes(int64_t value) {
     _io_tasks_mem_limiter->set_data_source_mem_bytes(value);
 }
@@ -181,6 +200,8 @@ struct ConnectorScanOperatorAdaptiveProcessor {
     // ----------------------
     // op expected io tasks in this cycle.
     int expected_io_tasks = 0;
+    // share of the query-wide io tasks budget this op holds in the io tasks arbitrator.
+    int arb_registered_io_tasks = 0;
     // if scan operator is in drive process cycle.
     bool in_driver_process = false;
 
@@ -196,6 +217,9 @@ struct ConnectorScanOperatorAdaptiveProcessor {
     std::atomic_int64_t cs_total_io_time = 0;
     std::atomic_int64_t cs_total_running_time = 0;
     std::atomic_int64_t cs_total_scan_bytes = 0;
+    // bytes served by the local cache tier vs. fetched from remote storage.
+    std::atomic_int64_t cs_total_local_io_bytes = 0;
+    std::atomic_int64_t cs_total_remote_io_bytes = 0;
 
     // ----------------------
     std::atomic_int64_t last_chunk_souce_finish_timestamp = 0;
@@ -209,6 +233,8 @@ struct ConnectorScanOperatorAdaptiveProcessor {
     double expected_speedup_ratio = 0;
     double last_cs_scan_speed = 0;
     int64_t last_cs_total_scan_bytes = 0;
+    int64_t last_cs_local_io_bytes = 0;
+    int64_t last_cs_remote_io_bytes = 0;
     int try_add_io_tasks_fail_count = 0;
     int check_slow_io = 0;
     int32_t slow_io_latency_ms = config::connector_io_tasks_adjust_interval_ms;
@@ -273,6 +299,11 @@ Status ConnectorScanOperator::do_prepare(RuntimeState* state) {
 
 void ConnectorScanOperator::do_close(RuntimeState* state) {
     auto* factory = down_cast<ConnectorScanOperatorFactory*>(_factory);
+    if (factory->_io_tasks_arb != nullptr && _adaptive_processor->arb_registered_io_tasks > 0) {
+        // return this op's share of the query-wide io tasks budget to the other scan operators.
+        factory->_io_tasks_arb->update_expected_io_tasks(_adaptive_processor->arb_registered_io_tasks, 0);
+        _adaptive_processor->arb_registered_io_tasks = 0;
+    }
     ConnectorScanOperatorIOTasksMemLimiter* L = factory->_io_tasks_mem_limiter;
     int64_t c = L->update_open_scan_operator_count(-1);
     if (c == 1) {
@@ -498,6 +529,17 @@ int ConnectorScanOperator::available_pickup_morsel_count() {
     double cs_total_scan_bytes_mb = P.cs_total_scan_bytes.load() / (1024 * 1024);
     double io_latency = cs_total_io_time / (cs_total_scan_bytes_mb + 1e-3);
 
+    // cache residency over the last adjustment window. A cache-hot scan answers its reads from
+    // local storage almost immediately while a cold scan has to hide the remote read latency
+    // behind a deep io queue. Using a window instead of the running total lets the strategy
+    // follow the cache as it warms up during the scan.
+    int64_t cs_local_io_bytes = P.cs_total_local_io_bytes.load();
+    int64_t cs_remote_io_bytes = P.cs_total_remote_io_bytes.load();
+    int64_t window_local_io_bytes = cs_local_io_bytes - P.last_cs_local_io_bytes;
+    int64_t window_remote_io_bytes = cs_remote_io_bytes - P.last_cs_remote_io_bytes;
+    P.last_cs_local_io_bytes = cs_local_io_bytes;
+    P.last_cs_remote_io_bytes = cs_remote_io_bytes;
+
     // adjust routines.
     auto try_add_io_tasks = [&]() {
         if (!P.try_add_io_tasks) return true;
@@ -531,6 +573,21 @@ int ConnectorScanOperator::available_pickup_morsel_count() {
         }
     };
 
+    auto check_cache_residency = [&]() {
+        constexpr int64_t kMinWindowIOBytes = 1024 * 1024;
+        int64_t window_io_bytes = window_local_io_bytes + window_remote_io_bytes;
+        if (window_io_bytes < kMinWindowIOBytes) return;
+        double local_ratio = window_local_io_bytes * 1.0 / window_io_bytes;
+        if (local_ratio <= 0.25) {
+            // mostly cold: queue enough io tasks to keep the remote reads in flight.
+            io_tasks = std::max(io_tasks, _io_tasks_per_scan_operator / 2);
+        } else if (local_ratio >= 0.75) {
+            // mostly cache resident: reads return right away, more io tasks only add scheduling
+            // overhead and take worker threads away from the cpu-bound side of the pipeline.
+            io_tasks = std::min(io_tasks, std::max(min_io_tasks, _io_tasks_per_scan_operator / 4));
+        }
+    };
+
     // adjust io tasks according to feedback.
     auto do_adjustment = [&]() {
         // if operator can not consume chunks, dec io task.
@@ -554,9 +611,17 @@ int ConnectorScanOperator::available_pickup_morsel_count() {
     };
 
     do_adjustment();
+    check_cache_residency();
     io_tasks = std::min(io_tasks, max_io_tasks);
     io_tasks = std::max(io_tasks, min_io_tasks);
 
+    // The feedback loop above tunes this operator in isolation. The arbitrator then settles the
+    // new target against the query-wide io tasks budget shared with all other scan operators.
+    if (factory->_io_tasks_arb != nullptr) {
+        io_tasks = factory->_io_tasks_arb->update_expected_io_tasks(P.arb_registered_io_tasks, io_tasks);
+        P.arb_registered_io_tasks = io_tasks;
+    }
+
     [[maybe_unused]] auto build_debug_string = [&]() {
         auto doround = [](double x) { return round(x * 100.0) / 100.0; };
         std::stringstream ss;
@@ -578,6 +643,7 @@ int ConnectorScanOperator::available_pickup_morsel_count() {
         // --- io latency metrics ----
         ss << ", iolatency = " << cs_total_io_time << "/" << cs_total_scan_bytes_mb << "(" << doround(io_latency)
            << "ms/MB)";
+        ss << ", cache = " << window_local_io_bytes << "/" << window_remote_io_bytes;
 
         // --- final decision -----
         ss << ", proposal = " << io_tasks << "(" << doround(P.expected_speedup_ratio)
@@ -782,10 +848,14 @@ Status ConnectorChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
     int64_t total_time_ns = 0;
     int64_t delta_io_time_ns = 0;
     int64_t delta_scan_bytes = 0;
+    int64_t delta_local_io_bytes = 0;
+    int64_t delta_remote_io_bytes = 0;
     {
         SCOPED_RAW_TIMER(&total_time_ns);
         int64_t prev_io_time_ns = get_io_time_spent();
         int64_t prev_scan_bytes = get_scan_bytes();
+        int64_t prev_local_io_bytes = _local_io_bytes;
+        int64_t prev_remote_io_bytes = _remote_io_bytes;
 
         bool mem_alloc_failed = false;
         RETURN_IF_ERROR(_open_data_source(state, &mem_alloc_failed));
@@ -829,8 +899,12 @@ Status ConnectorChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
         _scan_bytes = _data_source->num_bytes_read();
         _cpu_time_spent_ns = _data_source->cpu_time_spent();
         _io_time_spent_ns = _data_source->io_time_spent();
+        _local_io_bytes = _data_source->io_bytes_read_local();
+        _remote_io_bytes = _data_source->io_bytes_read_remote();
         delta_io_time_ns = _io_time_spent_ns - prev_io_time_ns;
         delta_scan_bytes = _scan_bytes - prev_scan_bytes;
+        delta_local_io_bytes = _local_io_bytes - prev_local_io_bytes;
+        delta_remote_io_bytes = _remote_io_bytes - prev_remote_io_bytes;
     }
 
     if (_ck_acc.has_output()) {
@@ -838,6 +912,8 @@ Status ConnectorChunkSource::_read_chunk(RuntimeState* state, ChunkPtr* chunk) {
         P.cs_total_running_time += total_time_ns;
         P.cs_total_io_time += delta_io_time_ns;
         P.cs_total_scan_bytes += delta_scan_bytes;
+        P.cs_total_local_io_bytes += delta_local_io_bytes;
+        P.cs_total_remote_io_bytes += delta_remote_io_bytes;
         _chunk_rows_read += (*chunk)->num_rows();
         _chunk_mem_bytes += (*chunk)->memory_usage();
         _chunk_buffer.update_limiter(chunk->get());
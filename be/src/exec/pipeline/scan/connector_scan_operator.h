@@ -46,6 +46,22 @@ struct ConnectorScanOperatorMemShareArbitrator {
     int64_t update_chunk_source_mem_bytes(int64_t old_value, int64_t new_value);
 };
 
+// Query-level budget of in-flight connector I/O tasks, shared by every connector scan operator
+// of the same query. Each operator still tunes its own target with its adaptive processor, but a
+// raise is only granted while the query-wide total stays under the budget, so one fast scan node
+// (e.g. on object storage) cannot monopolize the I/O threads of a query that also reads from
+// throttled storage.
+struct ConnectorScanOperatorIOTasksArbitrator {
+    int64_t query_io_tasks_limit = 0;
+    std::atomic<int64_t> total_expected_io_tasks = 0;
+
+    ConnectorScanOperatorIOTasksArbitrator(int64_t query_io_tasks_limit) : query_io_tasks_limit(query_io_tasks_limit) {}
+
+    // Moves the caller's registered share from `old_value` to `new_value` and returns the granted
+    // target. Reductions are always granted; raises are truncated to what is left of the budget.
+    int update_expected_io_tasks(int old_value, int new_value);
+};
+
 class ConnectorScanOperatorFactory : public ScanOperatorFactory {
 public:
     using ActiveInputKey = std::pair<int32_t, int32_t>;
@@ -69,6 +85,7 @@ public:
     void set_chunk_source_mem_bytes(int64_t mem_bytes);
     void set_scan_mem_limit(int64_t scan_mem_limit);
     void set_mem_share_arb(ConnectorScanOperatorMemShareArbitrator* arb);
+    void set_io_tasks_arb(ConnectorScanOperatorIOTasksArbitrator* arb);
     void set_data_source_mem_bytes(int64_t value);
 
 private:
@@ -79,6 +96,7 @@ private:
 public:
     ConnectorScanOperatorIOTasksMemLimiter* _io_tasks_mem_limiter = nullptr;
     ConnectorScanOperatorMemShareArbitrator* _mem_share_arb = nullptr;
+    ConnectorScanOperatorIOTasksArbitrator* _io_tasks_arb = nullptr;
 };
 
 struct ConnectorScanOperatorAdaptiveProcessor;
@@ -168,6 +186,8 @@ private:
     uint64_t _chunk_mem_bytes = 0;
     int64_t _request_mem_tracker_bytes = 0;
     int64_t _mem_alloc_failed_count = 0;
+    int64_t _local_io_bytes = 0;
+    int64_t _remote_io_bytes = 0;
 };
 
 } // namespace pipeline
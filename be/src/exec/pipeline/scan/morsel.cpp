@@ -18,6 +18,7 @@
 
 #include <memory>
 
+#include "common/config.h"
 #include "common/statusor.h"
 #include "exec/olap_utils.h"
 #include "storage/chunk_helper.h"
@@ -57,7 +58,7 @@ size_t IndividualMorselQueueFactory::num_original_morsels() const {
 }
 
 IndividualMorselQueueFactory::IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq,
-                                                           bool could_local_shuffle)
+                                                           bool could_local_shuffle, bool enable_stealing)
         : _could_local_shuffle(could_local_shuffle) {
     if (queue_per_driver_seq.empty()) {
         _queue_per_driver_seq.emplace_back(pipeline::create_empty_morsel_queue());
@@ -74,6 +75,19 @@ IndividualMorselQueueFactory::IndividualMorselQueueFactory(std::map<int, MorselQ
             _queue_per_driver_seq.emplace_back(std::move(it->second));
         }
     }
+
+    if (enable_stealing && config::enable_morsel_queue_stealing && _queue_per_driver_seq.size() > 1) {
+        std::vector<StealingMorselQueue*> siblings;
+        siblings.reserve(_queue_per_driver_seq.size());
+        for (auto& queue : _queue_per_driver_seq) {
+            auto wrapped = std::make_unique<StealingMorselQueue>(std::move(queue));
+            siblings.emplace_back(wrapped.get());
+            queue = std::move(wrapped);
+        }
+        for (auto* queue : siblings) {
+            queue->set_siblings(siblings);
+        }
+    }
 }
 
 BucketSequenceMorselQueueFactory::BucketSequenceMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq,
@@ -864,4 +878,41 @@ void DynamicMorselQueue::append_morsels(std::vector<MorselPtr>&& morsels) {
     _queue.insert(_queue.begin(), std::make_move_iterator(morsels.begin()), std::make_move_iterator(morsels.end()));
 }
 
+bool StealingMorselQueue::empty() const {
+    if (_unget_morsel != nullptr || !_queue->empty()) {
+        return false;
+    }
+    if (!_allow_steal.load(std::memory_order_acquire)) {
+        return true;
+    }
+    for (const auto* sibling : _siblings) {
+        if (sibling != this && sibling->_has_stealable_work()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+StatusOr<MorselPtr> StealingMorselQueue::try_get() {
+    if (_unget_morsel != nullptr) {
+        return std::move(_unget_morsel);
+    }
+    ASSIGN_OR_RETURN(auto morsel, _queue->try_get());
+    if (morsel != nullptr || !_allow_steal.load(std::memory_order_acquire)) {
+        return std::move(morsel);
+    }
+    for (auto* sibling : _siblings) {
+        if (sibling == this || !sibling->_has_stealable_work()) {
+            continue;
+        }
+        // The sibling's inner queue is safe for concurrent try_get (atomic or mutexed), and its
+        // local unget slot is never touched from here: ungets always land on the thief's queue.
+        ASSIGN_OR_RETURN(morsel, sibling->_queue->try_get());
+        if (morsel != nullptr) {
+            return std::move(morsel);
+        }
+    }
+    return nullptr;
+}
+
 } // namespace starrocks::pipeline
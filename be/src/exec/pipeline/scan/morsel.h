@@ -265,7 +265,10 @@ private:
 
 class IndividualMorselQueueFactory final : public MorselQueueFactory {
 public:
-    IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq, bool could_local_shuffle);
+    // `enable_stealing` may only be set when the morsel-to-driver assignment is pure load
+    // balancing; driver sequences with bucket or colocation affinity must keep their own morsels.
+    IndividualMorselQueueFactory(std::map<int, MorselQueuePtr>&& queue_per_driver_seq, bool could_local_shuffle,
+                                 bool enable_stealing = false);
     ~IndividualMorselQueueFactory() override = default;
 
     MorselQueue* create(int driver_sequence) override {
@@ -578,6 +581,63 @@ private:
     query_cache::TicketCheckerPtr _ticket_checker;
 };
 
+// Wraps one driver sequence's queue of an IndividualMorselQueueFactory. The driver drains its
+// own queue first; once that runs dry it steals morsels from its sibling driver sequences, so
+// a driver stuck on an oversized tablet no longer leaves the rest of the fragment idle.
+// Stealing starts only after the victim's prepare phase has attached tablets and rowsets to
+// its queue, and stops altogether once a ticket checker is attached, because the query cache
+// accounts morsels per owning driver.
+class StealingMorselQueue final : public MorselQueue {
+public:
+    explicit StealingMorselQueue(MorselQueuePtr&& queue) : _queue(std::move(queue)) {}
+    ~StealingMorselQueue() override = default;
+
+    void set_siblings(const std::vector<StealingMorselQueue*>& siblings) { _siblings = siblings; }
+
+    std::vector<TInternalScanRange*> prepare_olap_scan_ranges() const override {
+        return _queue->prepare_olap_scan_ranges();
+    }
+    void set_key_ranges(const std::vector<std::unique_ptr<OlapScanRange>>& key_ranges) override {
+        _queue->set_key_ranges(key_ranges);
+    }
+    void set_key_ranges(TabletReaderParams::RangeStartOperation range_start_op,
+                        TabletReaderParams::RangeEndOperation range_end_op, std::vector<OlapTuple> range_start_key,
+                        std::vector<OlapTuple> range_end_key) override {
+        _queue->set_key_ranges(range_start_op, range_end_op, std::move(range_start_key), std::move(range_end_key));
+    }
+    void set_tablets(const std::vector<BaseTabletSharedPtr>& tablets) override { _queue->set_tablets(tablets); }
+    void set_tablet_rowsets(const std::vector<std::vector<BaseRowsetSharedPtr>>& tablet_rowsets) override {
+        _queue->set_tablet_rowsets(tablet_rowsets);
+        // morsels handed out from now on carry their rowsets, so siblings may steal them
+        _prepared.store(true, std::memory_order_release);
+    }
+    void set_ticket_checker(const query_cache::TicketCheckerPtr& ticket_checker) override {
+        _queue->set_ticket_checker(ticket_checker);
+        _allow_steal.store(false, std::memory_order_release);
+    }
+    bool could_attch_ticket_checker() const override { return _queue->could_attch_ticket_checker(); }
+
+    size_t num_original_morsels() const override { return _queue->num_original_morsels(); }
+    size_t max_degree_of_parallelism() const override { return _queue->max_degree_of_parallelism(); }
+    bool empty() const override;
+    StatusOr<MorselPtr> try_get() override;
+    std::string name() const override { return "stealing_morsel_queue"; }
+    StatusOr<bool> ready_for_next() const override { return _queue->ready_for_next(); }
+    void append_morsels(Morsels&& morsels) override { _queue->append_morsels(std::move(morsels)); }
+    Type type() const override { return _queue->type(); }
+
+private:
+    bool _has_stealable_work() const {
+        return _allow_steal.load(std::memory_order_acquire) && _prepared.load(std::memory_order_acquire) &&
+               !_queue->empty();
+    }
+
+    MorselQueuePtr _queue;
+    std::vector<StealingMorselQueue*> _siblings;
+    std::atomic<bool> _prepared{false};
+    std::atomic<bool> _allow_steal{true};
+};
+
 MorselQueuePtr create_empty_morsel_queue();
 
 } // namespace pipeline
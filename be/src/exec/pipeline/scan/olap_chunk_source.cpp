@@ -235,6 +235,17 @@ Status OlapChunkSource::_init_reader_params(const std::vector<std::unique_ptr<Ol
         RETURN_IF_ERROR(not_pushdown_predicate_rewriter.rewrite_predicate(&_obj_pool, _non_pushdown_pred_tree));
     }
 
+    // For a key-ordered scan the merge output is already in query order, so if no predicate is
+    // evaluated behind the reader, the first |_limit| rows are the final result: let the reader
+    // stop the per-segment merge there instead of draining the whole tablet.
+    if (_params.sorted_by_keys_per_tablet && _limit != -1 && _non_pushdown_pred_tree.empty() &&
+        _scan_ctx->not_push_down_conjuncts().empty()) {
+        _params.limit = _limit;
+        if (_limit < _params.chunk_size) {
+            _params.chunk_size = _limit;
+        }
+    }
+
     // Range
     for (const auto& key_range : key_ranges) {
         if (key_range->begin_scan_range.size() == 1 && key_range->begin_scan_range.get_value(0) == NEGATIVE_INFINITY) {
@@ -209,16 +209,14 @@ void TableFunctionOperator::_copy_result(const std::vector<ColumnPtr>& columns,
                 << " _input_index_of_first_result=" << _input_index_of_first_result;
 
         if (copy_rows > 0) {
-            // Build outer data, repeat multiple times
+            // Build outer data, repeat multiple times. Replicate straight from the input column
+            // instead of going through a boxed Datum, so wide outer rows don't pay a per-column
+            // type dispatch and copy per produced row.
             for (size_t i = 0; i < _outer_slots.size(); ++i) {
                 ColumnPtr& input_column_ptr = _input_chunk->get_column_by_slot_id(_outer_slots[i]);
-                Datum value = input_column_ptr->get(_input_index_of_first_result + _next_output_row_offset);
-                if (value.is_null()) {
-                    DCHECK(columns[i]->is_nullable());
-                    down_cast<NullableColumn*>(columns[i].get())->append_nulls(copy_rows);
-                } else {
-                    columns[i]->append_value_multiple_times(&value, copy_rows);
-                }
+                columns[i]->append_value_multiple_times(*input_column_ptr,
+                                                        _input_index_of_first_result + _next_output_row_offset,
+                                                        copy_rows);
             }
 
             // Build table function result
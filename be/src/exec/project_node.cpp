@@ -33,6 +33,7 @@
 #include "exprs/column_ref.h"
 #include "exprs/expr.h"
 #include "exprs/expr_context.h"
+#include "gen_cpp/Exprs_types.h"
 #include "glog/logging.h"
 #include "gutil/casts.h"
 #include "runtime/current_thread.h"
@@ -41,6 +42,33 @@
 
 namespace starrocks {
 
+namespace {
+
+// Whether an output expr may share the result column of an identical earlier output expr.
+// Exprs returning random values, non-builtin functions (UDFs) and dictionary-rewritten exprs,
+// whose result depends on the output slot, must always be evaluated separately.
+bool is_result_shareable(const TExpr& texpr) {
+    for (const auto& node : texpr.nodes) {
+        if (node.node_type == TExprNodeType::DICT_EXPR || node.node_type == TExprNodeType::DICT_QUERY_EXPR ||
+            node.node_type == TExprNodeType::DICTIONARY_GET_EXPR) {
+            return false;
+        }
+        if (node.__isset.fn) {
+            if (node.fn.binary_type != TFunctionBinaryType::BUILTIN) {
+                return false;
+            }
+            if (node.fn.fid == 10300 /* rand */ || node.fn.fid == 10301 /* random */ ||
+                node.fn.fid == 10302 /* rand */ || node.fn.fid == 10303 /* random */ ||
+                node.fn.fid == 100015 /* uuid */ || node.fn.fid == 100016 /* uniq_id */) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace
+
 ProjectNode::ProjectNode(starrocks::ObjectPool* pool, const starrocks::TPlanNode& node,
                          const starrocks::DescriptorTbl& desc)
         : ExecNode(pool, node, desc) {}
@@ -63,12 +91,29 @@ Status ProjectNode::init(const TPlanNode& tnode, RuntimeState* state) {
         slot_null_mapping[slot->id()] = slot->is_nullable();
     }
 
+    std::vector<const TExpr*> created_exprs;
+    created_exprs.reserve(column_size);
+    _reuse_from.reserve(column_size);
     for (auto const& [key, val] : tnode.project_node.slot_map) {
         _slot_ids.emplace_back(key);
         ExprContext* context;
         RETURN_IF_ERROR(Expr::create_expr_tree(_pool, val, &context, state, true));
         _expr_ctxs.emplace_back(context);
         _type_is_nullable.emplace_back(slot_null_mapping[key]);
+
+        // Runtime CSE: when the same deterministic expr tree is projected to several slots,
+        // evaluate it once per chunk and share the result column with the other slots.
+        int32_t reuse_from = -1;
+        if (is_result_shareable(val)) {
+            for (size_t j = 0; j < created_exprs.size(); ++j) {
+                if (*created_exprs[j] == val && _type_is_nullable[j] == _type_is_nullable.back()) {
+                    reuse_from = static_cast<int32_t>(j);
+                    break;
+                }
+            }
+        }
+        _reuse_from.emplace_back(reuse_from);
+        created_exprs.emplace_back(&val);
     }
 
     size_t common_sub_column_size = tnode.project_node.common_slot_map.size();
@@ -148,6 +193,10 @@ Status ProjectNode::get_next(RuntimeState* state, ChunkPtr* chunk, bool* eos) {
     {
         SCOPED_TIMER(_expr_compute_timer);
         for (size_t i = 0; i < _slot_ids.size(); ++i) {
+            if (_reuse_from[i] >= 0) {
+                result_columns[i] = result_columns[_reuse_from[i]];
+                continue;
+            }
             ASSIGN_OR_RETURN(result_columns[i], _expr_ctxs[i]->evaluate((*chunk).get()));
             result_columns[i] = ColumnHelper::align_return_type(result_columns[i], _expr_ctxs[i]->root()->type(),
                                                                 (*chunk)->num_rows(), _type_is_nullable[i]);
@@ -293,7 +342,8 @@ pipeline::OpFactories ProjectNode::decompose_to_pipeline(pipeline::PipelineBuild
 
     operators.emplace_back(std::make_shared<ProjectOperatorFactory>(
             context->next_operator_id(), id(), std::move(_slot_ids), std::move(_expr_ctxs),
-            std::move(_type_is_nullable), std::move(_common_sub_slot_ids), std::move(_common_sub_expr_ctxs)));
+            std::move(_type_is_nullable), std::move(_common_sub_slot_ids), std::move(_common_sub_expr_ctxs),
+            std::move(_reuse_from)));
     // Initialize OperatorFactory's fields involving runtime filters.
     this->init_runtime_filter_for_operator(operators.back().get(), context, rc_rf_probe_collector);
     if (limit() != -1) {
@@ -46,6 +46,9 @@ private:
     std::vector<SlotId> _slot_ids;
     std::vector<ExprContext*> _expr_ctxs;
     std::vector<bool> _type_is_nullable;
+    // _reuse_from[i] >= 0 means expr i is identical to the earlier expr _reuse_from[i] and
+    // shares its result column instead of being evaluated again (runtime CSE).
+    std::vector<int32_t> _reuse_from;
 
     std::vector<SlotId> _common_sub_slot_ids;
     std::vector<ExprContext*> _common_sub_expr_ctxs;
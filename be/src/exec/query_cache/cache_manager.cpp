@@ -14,9 +14,23 @@
 
 #include "exec/query_cache/cache_manager.h"
 
+#include "block_cache/block_cache.h"
+#include "common/config.h"
+#include "common/logging.h"
+#include "runtime/exec_env.h"
+#include "serde/column_array_serde.h"
+#include "util/crc32c.h"
 #include "util/defer_op.h"
+#include "util/priority_thread_pool.hpp"
 namespace starrocks::query_cache {
 
+// Entries of the persistent tier live in the datacache under a dedicated key prefix, so they never
+// collide with cached scan data. The on-disk layout is:
+// | payload_size(int64) | checksum(uint32) | version(int64) | populate_time(int64) | num_chunks(uint32) | columns... |
+// the checksum covers everything behind the header and guards against partially overwritten entries.
+static const std::string kPersistentEntryPrefix = "qcache/";
+static constexpr size_t kPersistentEntryHeaderSize = sizeof(int64_t) + sizeof(uint32_t);
+
 CacheManager::CacheManager(size_t capacity) : _cache(capacity) {}
 static void delete_cache_entry(const CacheKey& key, void* value) {
     auto* cache_value = (CacheValue*)value;
@@ -27,11 +41,35 @@ void CacheManager::populate(const std::string& key, const CacheValue& value) {
     auto* cache_value = new CacheValue(value);
     auto* handle = _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry, CachePriority::NORMAL);
     _cache.release(handle);
+    if (config::enable_query_cache_persistent_tier) {
+        // serializing and writing blocks is too expensive for the driver thread, so write the
+        // persistent copy in the background. The captured value shares the immutable cached
+        // columns with the LRU entry, and a failure only loses the persistent copy.
+        auto write_entry = [this, key, value]() {
+            if (auto status = _write_persistent_entry(key, value); !status.ok()) {
+                VLOG(2) << "Failed to write persistent query cache entry, key=" << key << ", status=" << status;
+            }
+        };
+        if (!ExecEnv::GetInstance()->thread_pool()->offer(write_entry)) {
+            write_entry();
+        }
+    }
 }
 
 StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     auto* handle = _cache.lookup(key);
     if (handle == nullptr) {
+        if (config::enable_query_cache_persistent_tier) {
+            auto rehydrate_status = _probe_persistent_entry(key);
+            if (rehydrate_status.ok()) {
+                auto& value = rehydrate_status.value();
+                auto* cache_value = new CacheValue(value);
+                auto* lru_handle = _cache.insert(key, cache_value, cache_value->size(), &delete_cache_entry,
+                                                 CachePriority::NORMAL);
+                _cache.release(lru_handle);
+                return std::move(value);
+            }
+        }
         return Status::NotFound("CacheMiss");
     }
     DeferOp defer([this, handle]() { _cache.release(handle); });
@@ -39,6 +77,148 @@ StatusOr<CacheValue> CacheManager::probe(const std::string& key) {
     return cache_value;
 }
 
+Status CacheManager::_write_persistent_entry(const std::string& key, const CacheValue& value) {
+    auto* block_cache = BlockCache::instance();
+    if (!block_cache->is_initialized()) {
+        return Status::Uninitialized("datacache is not initialized");
+    }
+
+    size_t max_size = kPersistentEntryHeaderSize + sizeof(int64_t) * 2 + sizeof(uint32_t);
+    for (const auto& chunk : value.result) {
+        for (const auto& column : chunk->columns()) {
+            auto column_size = serde::ColumnArraySerde::max_serialized_size(*column);
+            if (column_size == 0) {
+                return Status::NotSupported("column type is not supported by the persistent query cache tier");
+            }
+            max_size += column_size;
+        }
+    }
+
+    std::vector<uint8_t> buffer(max_size);
+    uint8_t* p = buffer.data() + kPersistentEntryHeaderSize;
+    memcpy(p, &value.version, sizeof(value.version));
+    p += sizeof(value.version);
+    memcpy(p, &value.populate_time, sizeof(value.populate_time));
+    p += sizeof(value.populate_time);
+    auto num_chunks = static_cast<uint32_t>(value.result.size());
+    memcpy(p, &num_chunks, sizeof(num_chunks));
+    p += sizeof(num_chunks);
+    for (const auto& chunk : value.result) {
+        for (const auto& column : chunk->columns()) {
+            p = serde::ColumnArraySerde::serialize(*column, p);
+            if (p == nullptr) {
+                return Status::InternalError("failed to serialize cached column");
+            }
+        }
+    }
+
+    auto payload_size = static_cast<int64_t>(p - (buffer.data() + kPersistentEntryHeaderSize));
+    uint32_t checksum = crc32c::Value(reinterpret_cast<const char*>(buffer.data()) + kPersistentEntryHeaderSize,
+                                      payload_size);
+    memcpy(buffer.data(), &payload_size, sizeof(payload_size));
+    memcpy(buffer.data() + sizeof(payload_size), &checksum, sizeof(checksum));
+
+    const std::string block_key = kPersistentEntryPrefix + key;
+    const size_t block_size = block_cache->block_size();
+    const size_t total_size = kPersistentEntryHeaderSize + payload_size;
+    // incremental updates refresh the entry under the same key, so stale blocks must be overwritten.
+    WriteCacheOptions options;
+    options.overwrite = true;
+    for (size_t offset = 0; offset < total_size; offset += block_size) {
+        auto size = std::min(block_size, total_size - offset);
+        RETURN_IF_ERROR(block_cache->write_buffer(block_key, offset, size,
+                                                  reinterpret_cast<const char*>(buffer.data()) + offset, &options));
+    }
+
+    if (!value.result.empty()) {
+        std::lock_guard<std::mutex> guard(_prototype_mutex);
+        _prototypes[key] = value.result[0]->clone_empty_with_slot();
+    }
+    return Status::OK();
+}
+
+StatusOr<CacheValue> CacheManager::_probe_persistent_entry(const std::string& key) {
+    auto* block_cache = BlockCache::instance();
+    if (!block_cache->is_initialized()) {
+        return Status::Uninitialized("datacache is not initialized");
+    }
+
+    ChunkPtr prototype;
+    {
+        std::lock_guard<std::mutex> guard(_prototype_mutex);
+        auto it = _prototypes.find(key);
+        if (it != _prototypes.end()) {
+            prototype = it->second;
+        }
+    }
+
+    const std::string block_key = kPersistentEntryPrefix + key;
+    uint8_t header[kPersistentEntryHeaderSize];
+    ASSIGN_OR_RETURN(auto header_size, block_cache->read_buffer(block_key, 0, kPersistentEntryHeaderSize,
+                                                                reinterpret_cast<char*>(header)));
+    if (header_size != kPersistentEntryHeaderSize) {
+        return Status::NotFound("incomplete persistent query cache entry header");
+    }
+    int64_t payload_size = 0;
+    uint32_t checksum = 0;
+    memcpy(&payload_size, header, sizeof(payload_size));
+    memcpy(&checksum, header + sizeof(payload_size), sizeof(checksum));
+    if (payload_size <= 0 || payload_size > config::query_cache_capacity) {
+        return Status::Corruption("invalid persistent query cache entry size");
+    }
+    const auto payload = static_cast<size_t>(payload_size);
+
+    std::vector<uint8_t> buffer(payload);
+    const size_t block_size = block_cache->block_size();
+    size_t num_read = 0;
+    while (num_read < payload) {
+        size_t offset = kPersistentEntryHeaderSize + num_read;
+        // a read never crosses a block boundary, the datacache addresses entries block by block.
+        size_t size = std::min(block_size - offset % block_size, payload - num_read);
+        ASSIGN_OR_RETURN(auto read_size, block_cache->read_buffer(block_key, offset, size,
+                                                                  reinterpret_cast<char*>(buffer.data()) + num_read));
+        if (read_size != size) {
+            return Status::NotFound("incomplete persistent query cache entry");
+        }
+        num_read += size;
+    }
+    if (crc32c::Value(reinterpret_cast<const char*>(buffer.data()), payload) != checksum) {
+        return Status::Corruption("persistent query cache entry checksum mismatch");
+    }
+
+    const uint8_t* p = buffer.data();
+    const uint8_t* end = p + payload;
+    int64_t version = 0;
+    int64_t populate_time = 0;
+    uint32_t num_chunks = 0;
+    if (payload < sizeof(version) + sizeof(populate_time) + sizeof(num_chunks)) {
+        return Status::Corruption("truncated persistent query cache entry");
+    }
+    memcpy(&version, p, sizeof(version));
+    p += sizeof(version);
+    memcpy(&populate_time, p, sizeof(populate_time));
+    p += sizeof(populate_time);
+    memcpy(&num_chunks, p, sizeof(num_chunks));
+    p += sizeof(num_chunks);
+
+    CacheResult result;
+    result.reserve(num_chunks);
+    for (uint32_t i = 0; i < num_chunks; ++i) {
+        if (prototype == nullptr) {
+            return Status::InternalError("missing prototype chunk for persistent query cache entry");
+        }
+        ChunkPtr chunk = prototype->clone_empty_with_slot();
+        for (const auto& column : chunk->columns()) {
+            p = serde::ColumnArraySerde::deserialize(p, column.get());
+            if (p == nullptr || p > end) {
+                return Status::Corruption("failed to deserialize persistent query cache entry");
+            }
+        }
+        result.emplace_back(std::move(chunk));
+    }
+    return CacheValue(populate_time, version, std::move(result));
+}
+
 size_t CacheManager::memory_usage() {
     return _cache.get_memory_usage();
 }
@@ -60,6 +240,10 @@ void CacheManager::invalidate_all() {
     // set capacity of cache to zero, the cache shall prune all cache entries.
     _cache.set_capacity(0);
     _cache.set_capacity(old_capacity);
+    // dropping the prototypes makes the corresponding persistent entries unreachable, the datacache
+    // evicts their blocks on its own.
+    std::lock_guard<std::mutex> guard(_prototype_mutex);
+    _prototypes.clear();
 }
 
 } // namespace starrocks::query_cache
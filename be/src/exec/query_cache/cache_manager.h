@@ -15,7 +15,9 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "column/chunk.h"
@@ -74,6 +76,15 @@ public:
     void invalidate_all();
 
 private:
+    // The persistent tier writes cache entries through to the datacache (block cache), so entries
+    // evicted from the in-memory LRU cache can be rehydrated instead of being recomputed. Serialized
+    // column bytes are not self-describing, so an empty prototype chunk is kept per key to rebuild
+    // typed columns on rehydration.
+    Status _write_persistent_entry(const std::string& key, const CacheValue& value);
+    StatusOr<CacheValue> _probe_persistent_entry(const std::string& key);
+
     ShardedLRUCache _cache;
+    std::mutex _prototype_mutex;
+    std::unordered_map<std::string, ChunkPtr> _prototypes;
 };
 } // namespace starrocks::query_cache
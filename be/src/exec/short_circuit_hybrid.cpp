@@ -128,27 +128,36 @@ Status ShortCircuitHybridScanNode::_process_key_chunk() {
     _key_chunk = ChunkHelper::new_chunk(key_schema, _num_rows);
     _key_chunk->reset();
 
+    // TODO (jkj) if expr is k1=1 and k2 in (3, 4), we need bind tablet with expr,
+    // tablet 1  <---> k1 =1, k2 =3
+    // tablet 2  <---> k1 =1, k2 =4
+    // this prune need happen in fe
+
+    // flatten the literals of all keys and turn them into expr contexts in one batch,
+    // creating/preparing/opening one context per literal is measurable on the rpc thread
+    // for multi-row point lookups.
+    std::vector<TExpr> key_literal_texprs;
+    key_literal_texprs.reserve(_num_rows * _tablet_schema->num_key_columns());
     for (int i = 0; i < _num_rows; ++i) {
-        // TODO (jkj) if expr is k1=1 and k2 in (3, 4), we need bind tablet with expr,
-        // tablet 1  <---> k1 =1, k2 =3
-        // tablet 2  <---> k1 =1, k2 =4
-        // this prune need happen in fe
-        auto keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
-        size_t num_pk_filters = keys_literal_expr.size();
+        auto& keys_literal_expr = (*_key_literal_exprs)[i].literal_exprs;
         // must all columns
-        if (UNLIKELY(num_pk_filters != _tablet_schema->num_key_columns())) {
+        if (UNLIKELY(keys_literal_expr.size() != _tablet_schema->num_key_columns())) {
             return Status::Corruption("short circuit only support all key predicate");
         }
+        key_literal_texprs.insert(key_literal_texprs.end(), keys_literal_expr.begin(), keys_literal_expr.end());
+    }
+
+    std::vector<ExprContext*> expr_ctxs;
+    RETURN_IF_ERROR(Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_texprs, &expr_ctxs,
+                                            runtime_state()));
+    RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
+    RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
+
+    size_t expr_idx = 0;
+    for (int i = 0; i < _num_rows; ++i) {
+        size_t num_pk_filters = (*_key_literal_exprs)[i].literal_exprs.size();
         for (int j = 0; j < num_pk_filters; ++j) {
-            // init expr context
-            std::vector<ExprContext*> expr_ctxs;
-            std::vector<TExpr> key_literal_expr{keys_literal_expr[j]};
-            // prepare
-            RETURN_IF_ERROR(Expr::create_expr_trees(runtime_state()->obj_pool(), key_literal_expr, &expr_ctxs,
-                                                    runtime_state()));
-            RETURN_IF_ERROR(Expr::prepare(expr_ctxs, runtime_state()));
-            RETURN_IF_ERROR(Expr::open(expr_ctxs, runtime_state()));
-            auto& iteral_expr_ctx = expr_ctxs[0];
+            auto* iteral_expr_ctx = expr_ctxs[expr_idx++];
             ASSIGN_OR_RETURN(ColumnPtr value, iteral_expr_ctx->root()->evaluate_const(iteral_expr_ctx));
             if (UNLIKELY(value == nullptr || value->only_null() || value->is_null(0))) {
                 return Status::EndOfFile("iteral_expr_ctx evaluated to null, won’t execute here");
@@ -28,6 +28,7 @@
 #include "exprs/expr_context.h"
 #include "glog/logging.h"
 #include "runtime/mem_pool.h"
+#include "simd/batch_run_counter.h"
 
 namespace starrocks {
 
@@ -323,6 +324,27 @@ StatusOr<ChunkPtr> SortedStreamingAggregator::streaming_compute_agg_state(size_t
 
     RETURN_IF_ERROR(_compute_group_by(chunk_size));
 
+    // On well-clustered input (e.g. a duplicate-key table sorted by the group by keys) a whole
+    // chunk often belongs to one group. Then every row merges into _last_state and nothing is
+    // output, so the per-row state allocation and the selector/append passes can be skipped.
+    if (_chunk_is_single_run(chunk_size)) {
+        DCHECK(_last_state != nullptr);
+        SCOPED_TIMER(_agg_stat->agg_compute_timer);
+        for (size_t i = 0; i < _agg_fn_ctxs.size(); i++) {
+            if (!_is_merge_funcs[i] && is_update_phase) {
+                _agg_functions[i]->update_batch_single_state(_agg_fn_ctxs[i], chunk_size,
+                                                             _agg_input_raw_columns[i].data(),
+                                                             _last_state + _agg_states_offsets[i]);
+            } else {
+                DCHECK_GE(_agg_input_columns[i].size(), 1);
+                _agg_functions[i]->merge_batch_single_state(_agg_fn_ctxs[i], _last_state + _agg_states_offsets[i],
+                                                            _agg_input_columns[i][0].get(), 0, chunk_size);
+            }
+        }
+        // _last_columns already hold the group by keys of this run
+        return std::make_shared<Chunk>();
+    }
+
     RETURN_IF_ERROR(_update_states(chunk_size, is_update_phase));
 
     // selector[i] == 0 means selected
@@ -372,6 +394,12 @@ StatusOr<ChunkPtr> SortedStreamingAggregator::streaming_compute_distinct(size_t
     }
 
     RETURN_IF_ERROR(_compute_group_by(chunk_size));
+
+    // the whole chunk repeats the group of the previous chunk, nothing new to output
+    if (_chunk_is_single_run(chunk_size)) {
+        return std::make_shared<Chunk>();
+    }
+
     // selector[i] == 0 means selected
     std::vector<uint8_t> selector(chunk_size);
     size_t selected_size = _init_selector(selector, chunk_size);
@@ -390,6 +418,20 @@ StatusOr<ChunkPtr> SortedStreamingAggregator::streaming_compute_distinct(size_t
     return result_chunk;
 }
 
+bool SortedStreamingAggregator::_chunk_is_single_run(size_t chunk_size) {
+    // _cmp_vector[i] == 0 means group[i - 1].equals(group[i]), so a chunk without any set bit
+    // continues the group carried in _last_columns and contains no boundary at all.
+    BatchRunCounter<32> batch_run(_cmp_vector.data(), 0, chunk_size);
+    BatchCount batch = batch_run.next_batch();
+    while (batch.length > 0) {
+        if (!batch.NoneSet()) {
+            return false;
+        }
+        batch = batch_run.next_batch();
+    }
+    return true;
+}
+
 size_t SortedStreamingAggregator::_init_selector(std::vector<uint8_t>& selector, size_t chunk_size) {
     size_t selected_size = 0;
     {
@@ -39,6 +39,9 @@ public:
 private:
     Status _compute_group_by(size_t chunk_size);
 
+    // whether the whole chunk continues the group of the previous chunk without any boundary
+    bool _chunk_is_single_run(size_t chunk_size);
+
     Status _update_states(size_t chunk_size, bool is_update_phase);
     // init selector by _cmp_vector
     // return selected_size (distinct num_rows)
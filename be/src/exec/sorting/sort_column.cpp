@@ -27,6 +27,7 @@
 #include "column/map_column.h"
 #include "column/nullable_column.h"
 #include "column/struct_column.h"
+#include "common/config.h"
 #include "exec/sorting/sort_helper.h"
 #include "exec/sorting/sort_permute.h"
 #include "exec/sorting/sorting.h"
@@ -101,12 +102,14 @@ public:
     template <typename T>
     Status do_visit(const BinaryColumnBase<T>& column) {
         DCHECK_GE(column.size(), _permutation.size());
-        using ItemType = InlinePermuteItem<Slice>;
+        // SortableSlice inlines the string length and leading bytes into the 16-byte
+        // permutation slot, so short-string comparisons never touch the byte array.
+        using ItemType = InlinePermuteItem<SortableSlice>;
         auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
             return lhs.inline_value.compare(rhs.inline_value);
         };
 
-        auto inlined = create_inline_permutation<Slice>(_permutation, column.get_proxy_data());
+        auto inlined = create_inline_permutation<SortableSlice>(_permutation, column.get_proxy_data());
         RETURN_IF_ERROR(
                 sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range, _build_tie));
         restore_inline_permutation(inlined, _permutation);
@@ -212,7 +215,7 @@ public:
         using ColumnType = BinaryColumnBase<T>;
 
         if (_need_inline_value()) {
-            using ItemType = CompactChunkItem<Slice>;
+            using ItemType = CompactChunkItem<SortableSlice>;
             using Container = typename BinaryColumnBase<T>::BinaryDataProxyContainer;
 
             auto cmp = [&](const ItemType& lhs, const ItemType& rhs) -> int {
@@ -225,7 +228,7 @@ public:
                 containers.push_back(&real->get_proxy_data());
             }
 
-            auto inlined = _create_inlined_permutation<Slice>(containers);
+            auto inlined = _create_inlined_permutation<SortableSlice>(containers);
             RETURN_IF_ERROR(sort_and_tie_helper(_cancel, &column, _sort_desc.asc_order(), inlined, _tie, cmp, _range,
                                                 _build_tie, _limit, &_pruned_limit));
             _restore_inlined_permutation(inlined);
@@ -422,7 +425,22 @@ Status sort_and_tie_columns(const std::atomic<bool>& cancel, const Columns& colu
     std::pair<int, int> range{0, num_rows};
     SmallPermutation small_perm = create_small_permutation(num_rows);
 
-    for (int col_index = 0; col_index < columns.size(); col_index++) {
+    // Sort by normalized key prefixes first, so that the comparison-based passes below only
+    // have to resolve rows whose leading key columns are entirely equal.
+    int num_encoded_columns = 0;
+    if (config::enable_sort_key_prefix_radix_sort) {
+        std::vector<uint64_t> prefixes;
+        num_encoded_columns = build_normalized_key_prefixes(columns, sort_desc, &prefixes);
+        if (num_encoded_columns > 0) {
+            RETURN_IF_ERROR(sort_by_normalized_key_prefixes(cancel, prefixes, small_perm, tie));
+            if (num_encoded_columns == columns.size()) {
+                restore_small_permutation(small_perm, *permutation);
+                return Status::OK();
+            }
+        }
+    }
+
+    for (int col_index = num_encoded_columns; col_index < columns.size(); col_index++) {
         ColumnPtr column = columns[col_index];
         bool build_tie = col_index != columns.size() - 1;
         RETURN_IF_ERROR(sort_and_tie_column(cancel, column, sort_desc.get_column_desc(col_index), small_perm, tie,
@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <concepts>
+#include <cstring>
 
 #include "column/nullable_column.h"
 #include "column/type_traits.h"
@@ -52,6 +53,74 @@ struct SorterComparator<Slice> {
     }
 };
 
+// Umbra-style "german string" representation of a Slice, packed into a 16-byte slot:
+// the length and the leading bytes are stored inline, a string of at most 12 bytes is
+// stored entirely inline, and a longer one keeps an overflow pointer after a 4-byte
+// prefix. Most comparisons are decided by the inline bytes with fixed-width memcmp,
+// without chasing the bytes pointer of the BinaryColumn, which matters a lot when
+// sorting short-string heavy columns.
+struct SortableSlice {
+    static constexpr uint32_t kInlineSize = 12;
+
+    uint32_t size = 0;
+    // prefix and the union below are laid out contiguously, so for a short string the
+    // whole payload occupies the 12 bytes starting at prefix.
+    char prefix[4];
+    union {
+        char tail[8];
+        const char* overflow;
+    };
+
+    SortableSlice() : prefix{0, 0, 0, 0}, tail{0, 0, 0, 0, 0, 0, 0, 0} {}
+
+    SortableSlice(const Slice& slice) : size(static_cast<uint32_t>(slice.size)) {
+        if (size <= kInlineSize) {
+            memset(prefix, 0, sizeof(prefix));
+            memset(tail, 0, sizeof(tail));
+            memcpy(prefix, slice.data, std::min<uint32_t>(size, sizeof(prefix)));
+            if (size > sizeof(prefix)) {
+                memcpy(tail, slice.data + sizeof(prefix), size - sizeof(prefix));
+            }
+        } else {
+            memcpy(prefix, slice.data, sizeof(prefix));
+            overflow = slice.data;
+        }
+    }
+
+    const char* data() const { return size <= kInlineSize ? prefix : overflow; }
+
+    Slice to_slice() const { return {data(), size}; }
+
+    int compare(const SortableSlice& rhs) const {
+        int res = memcmp(prefix, rhs.prefix, sizeof(prefix));
+        if (res != 0) {
+            return res;
+        }
+        if (size <= kInlineSize && rhs.size <= kInlineSize) {
+            // both are fully inline and zero padded, so after a tie on the payload only
+            // the length can break the tie, exactly as in Slice::compare.
+            res = memcmp(tail, rhs.tail, sizeof(tail));
+            if (res != 0) {
+                return res;
+            }
+            return size == rhs.size ? 0 : (size < rhs.size ? -1 : 1);
+        }
+        return to_slice().compare(rhs.to_slice());
+    }
+};
+
+static_assert(sizeof(SortableSlice) == 16, "SortableSlice must fit the 16-byte inline slot");
+
+template <>
+struct SorterComparator<SortableSlice> {
+    static int compare(const SortableSlice& lhs, const SortableSlice& rhs) {
+        int x = lhs.compare(rhs);
+        if (x > 0) return 1;
+        if (x < 0) return -1;
+        return x;
+    }
+};
+
 template <>
 struct SorterComparator<DateValue> {
     static int compare(const DateValue& lhs, const DateValue& rhs) {
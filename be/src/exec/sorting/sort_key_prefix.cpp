@@ -0,0 +1,163 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <type_traits>
+
+#include "column/column_helper.h"
+#include "column/fixed_length_column.h"
+#include "column/nullable_column.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
+
+namespace starrocks {
+
+// Append one fully-encoded column to the key prefixes.
+// Layout per column (big-endian, packed from the most significant byte of the prefix):
+// - nullable columns spend one leading byte: 0x00 (nulls first) or 0xff (nulls last) for null
+//   rows and 0x01 for the others, so null placement is resolved before any value byte;
+// - the value is mapped to an unsigned integer whose natural order matches the column order:
+//   signed integers get their sign bit flipped, descending order complements the value bytes.
+template <class T>
+static void encode_integral_column(const typename FixedLengthColumn<T>::Container& data, const NullData* null_data,
+                                   const SortDesc& sort_desc, int value_shift, std::vector<uint64_t>& prefixes) {
+    using UnsignedT = std::make_unsigned_t<T>;
+    constexpr uint64_t sign_mask = std::is_signed_v<T> ? (uint64_t)1 << (sizeof(T) * 8 - 1) : 0;
+    constexpr uint64_t value_mask = sizeof(T) == 8 ? ~(uint64_t)0 : ((uint64_t)1 << (sizeof(T) * 8)) - 1;
+    const bool descending = sort_desc.sort_order == -1;
+    const uint64_t null_byte = sort_desc.is_null_first() ? 0x00 : 0xff;
+    const int null_shift = value_shift + (int)sizeof(T) * 8;
+
+    size_t num_rows = data.size();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (null_data != nullptr && (*null_data)[i] != 0) {
+            prefixes[i] |= null_byte << null_shift;
+            continue;
+        }
+        uint64_t value = ((uint64_t)(UnsignedT)data[i]) ^ sign_mask;
+        if (descending) {
+            value = ~value & value_mask;
+        }
+        if (null_data != nullptr) {
+            prefixes[i] |= (uint64_t)0x01 << null_shift;
+        }
+        prefixes[i] |= value << value_shift;
+    }
+}
+
+template <class T>
+static bool try_encode_integral_column(const Column* data_column, const NullData* null_data,
+                                       const SortDesc& sort_desc, int* used_bytes, std::vector<uint64_t>& prefixes) {
+    const auto* fixed_column = dynamic_cast<const FixedLengthColumn<T>*>(data_column);
+    if (fixed_column == nullptr) {
+        return false;
+    }
+    int required_bytes = (int)sizeof(T) + (null_data != nullptr ? 1 : 0);
+    if (*used_bytes + required_bytes > 8) {
+        return false;
+    }
+    *used_bytes += required_bytes;
+    int value_shift = (8 - *used_bytes) * 8;
+    encode_integral_column<T>(fixed_column->get_data(), null_data, sort_desc, value_shift, prefixes);
+    return true;
+}
+
+int build_normalized_key_prefixes(const Columns& columns, const SortDescs& sort_desc, std::vector<uint64_t>* prefixes) {
+    if (columns.empty() || columns[0]->empty()) {
+        return 0;
+    }
+    size_t num_rows = columns[0]->size();
+    prefixes->assign(num_rows, 0);
+
+    int num_encoded = 0;
+    int used_bytes = 0;
+    for (size_t i = 0; i < columns.size() && used_bytes < 8; i++) {
+        const Column* column = columns[i].get();
+        const NullData* null_data = nullptr;
+        if (column->is_constant()) {
+            break;
+        }
+        if (column->is_nullable()) {
+            const auto* nullable = down_cast<const NullableColumn*>(column);
+            if (nullable->has_null()) {
+                null_data = &nullable->immutable_null_column_data();
+            }
+            column = nullable->data_column().get();
+        }
+        SortDesc desc = sort_desc.get_column_desc((int)i);
+        // bool is stored as uint8_t, the other integral types are signed
+        if (!try_encode_integral_column<uint8_t>(column, null_data, desc, &used_bytes, *prefixes) &&
+            !try_encode_integral_column<int8_t>(column, null_data, desc, &used_bytes, *prefixes) &&
+            !try_encode_integral_column<int16_t>(column, null_data, desc, &used_bytes, *prefixes) &&
+            !try_encode_integral_column<int32_t>(column, null_data, desc, &used_bytes, *prefixes) &&
+            !try_encode_integral_column<int64_t>(column, null_data, desc, &used_bytes, *prefixes)) {
+            break;
+        }
+        num_encoded++;
+    }
+    return num_encoded;
+}
+
+// LSD radix sort over the 8 key bytes, skipping passes whose byte is constant across all rows.
+// The sort is performed on inlined (key, index) pairs for cache efficiency.
+static void lsd_radix_sort(InlinePermutation<uint64_t>& items) {
+    size_t num_rows = items.size();
+    InlinePermutation<uint64_t> buffer(num_rows);
+    InlinePermutation<uint64_t>* src = &items;
+    InlinePermutation<uint64_t>* dst = &buffer;
+
+    for (int shift = 0; shift < 64; shift += 8) {
+        size_t counts[256] = {0};
+        for (size_t i = 0; i < num_rows; i++) {
+            counts[((*src)[i].inline_value >> shift) & 0xff]++;
+        }
+        size_t first_byte = ((*src)[0].inline_value >> shift) & 0xff;
+        if (counts[first_byte] == num_rows) {
+            continue;
+        }
+        size_t offsets[256];
+        size_t total = 0;
+        for (int b = 0; b < 256; b++) {
+            offsets[b] = total;
+            total += counts[b];
+        }
+        for (size_t i = 0; i < num_rows; i++) {
+            (*dst)[offsets[((*src)[i].inline_value >> shift) & 0xff]++] = (*src)[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != &items) {
+        items.swap(buffer);
+    }
+}
+
+Status sort_by_normalized_key_prefixes(const std::atomic<bool>& cancel, const std::vector<uint64_t>& prefixes,
+                                       SmallPermutation& permutation, Tie& tie) {
+    if (UNLIKELY(cancel.load(std::memory_order_acquire))) {
+        return Status::Cancelled("Sort cancelled");
+    }
+    DCHECK_EQ(prefixes.size(), permutation.size());
+
+    InlinePermutation<uint64_t> inlined = create_inline_permutation<uint64_t>(permutation, prefixes);
+    lsd_radix_sort(inlined);
+    restore_inline_permutation(inlined, permutation);
+
+    // rows stay tied only if their whole key prefix is equal
+    tie[0] = 0;
+    for (size_t i = 1; i < inlined.size(); i++) {
+        tie[i] &= inlined[i - 1].inline_value == inlined[i].inline_value;
+    }
+    return Status::OK();
+}
+
+} // namespace starrocks
@@ -55,6 +55,19 @@ Status sort_vertical_chunks(const std::atomic<bool>& cancel, const std::vector<C
                             const SortDescs& sort_desc, Permutation& perm, const size_t limit,
                             const bool is_limit_by_rank = false);
 
+// Encode the leading fixed-width integer sort columns of each row into one order-preserving
+// 64-bit key (sign bit flipped, descending order and null placement handled via complement),
+// so that most of the ordering work becomes a radix sort over the keys and row comparisons
+// are only needed inside key ties.
+// Only columns that fit entirely into the remaining key bytes are encoded.
+// @return the number of fully encoded leading columns, 0 if the first column is not encodable
+int build_normalized_key_prefixes(const Columns& columns, const SortDescs& sort_desc, std::vector<uint64_t>* prefixes);
+
+// Radix sort (LSD, byte-wise) the permutation by the normalized key prefixes, and narrow the tie:
+// rows stay tied only if their whole key prefix is equal.
+Status sort_by_normalized_key_prefixes(const std::atomic<bool>& cancel, const std::vector<uint64_t>& prefixes,
+                                       SmallPermutation& permutation, Tie& tie);
+
 // Compare the column with the `rhs_value`, which must have the some type with column.
 // @param cmp_result compare result is written into this array, value must within -1,0,1
 // @param rhs_value the compare value
@@ -14,6 +14,9 @@
 
 #include "exec/spill/log_block_manager.h"
 
+#include <fcntl.h>
+#include <unistd.h>
+
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -145,6 +148,17 @@ Status LogBlockContainer::flush() {
 
 StatusOr<std::unique_ptr<io::InputStreamWrapper>> LogBlockContainer::get_readable(size_t offset, size_t length) {
     std::string file_path = path();
+    if (config::spill_enable_restore_read_ahead && _dir->fs()->type() == FileSystem::POSIX) {
+        // Kick off kernel readahead for the whole block range before the first read, so the page
+        // cache fills asynchronously while the restore task deserializes the already fetched
+        // pages. The advise itself doesn't block, and readahead sticks to the page cache, so the
+        // fd can be closed right away.
+        int fd = ::open(file_path.c_str(), O_RDONLY);
+        if (fd >= 0) {
+            (void)::posix_fadvise(fd, offset, length, POSIX_FADV_WILLNEED);
+            ::close(fd);
+        }
+    }
     ASSIGN_OR_RETURN(auto f, _dir->fs()->new_sequential_file(file_path));
     RETURN_IF_ERROR(f->skip(offset));
     return f;
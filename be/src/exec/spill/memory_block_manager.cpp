@@ -0,0 +1,145 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/spill/memory_block_manager.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "common/config.h"
+#include "exec/spill/block_manager.h"
+#include "exec/spill/common.h"
+#include "fmt/format.h"
+#include "gutil/casts.h"
+
+namespace starrocks::spill {
+
+class MemoryBlockReader final : public BlockReader {
+public:
+    MemoryBlockReader(const Block* block) : BlockReader(block) {}
+    ~MemoryBlockReader() override = default;
+
+    Status read_fully(void* data, int64_t count) override;
+
+    std::string debug_string() override { return _block->debug_string(); }
+
+    const Block* block() const override { return _block; }
+
+private:
+    size_t _offset = 0;
+};
+
+class MemoryBlock : public Block {
+public:
+    explicit MemoryBlock(int64_t reserved_bytes) : _reserved_bytes(reserved_bytes) {
+        _buffer.reserve(reserved_bytes);
+    }
+
+    ~MemoryBlock() override { MemoryBlockManager::release(_reserved_bytes); }
+
+    Status append(const std::vector<Slice>& data) override {
+        size_t total_size = 0;
+        std::for_each(data.begin(), data.end(), [&](const Slice& slice) { total_size += slice.size; });
+        // every append is covered by a budget reservation made in acquire_block or preallocate
+        DCHECK_LE(_size + total_size, _reserved_bytes);
+        for (const auto& slice : data) {
+            _buffer.append(slice.data, slice.size);
+        }
+        _size += total_size;
+        return Status::OK();
+    }
+
+    Status flush() override { return Status::OK(); }
+
+    std::shared_ptr<BlockReader> get_reader() override { return std::make_shared<MemoryBlockReader>(this); }
+
+    std::string debug_string() const override {
+        return fmt::format("MemoryBlock:{}[len={}, reserved={}]", (void*)this, _size, _reserved_bytes);
+    }
+
+    bool preallocate(size_t write_size) override {
+        if (!MemoryBlockManager::try_reserve(write_size)) {
+            return false;
+        }
+        _reserved_bytes += write_size;
+        return true;
+    }
+
+    const std::string& buffer() const { return _buffer; }
+
+private:
+    std::string _buffer;
+    int64_t _reserved_bytes = 0;
+};
+
+Status MemoryBlockReader::read_fully(void* data, int64_t count) {
+    const auto& buffer = down_cast<const MemoryBlock*>(_block)->buffer();
+    if (_offset + count > buffer.size()) {
+        return Status::EndOfFile("no more data in this block");
+    }
+    memcpy(data, buffer.data() + _offset, count);
+    _offset += count;
+    return Status::OK();
+}
+
+MemoryBlockManager::MemoryBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> backing_block_manager)
+        : _query_id(query_id), _backing_block_manager(std::move(backing_block_manager)) {}
+
+Status MemoryBlockManager::open() {
+    return _backing_block_manager->open();
+}
+
+void MemoryBlockManager::close() {
+    _backing_block_manager->close();
+}
+
+bool MemoryBlockManager::try_reserve(int64_t bytes) {
+    int64_t limit = config::spill_max_in_memory_block_bytes;
+    if (limit <= 0) {
+        return false;
+    }
+    int64_t usage = _s_tier_usage.load(std::memory_order_relaxed);
+    do {
+        if (usage + bytes > limit) {
+            return false;
+        }
+    } while (!_s_tier_usage.compare_exchange_weak(usage, usage + bytes, std::memory_order_relaxed));
+    return true;
+}
+
+void MemoryBlockManager::release(int64_t bytes) {
+    _s_tier_usage.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+StatusOr<BlockPtr> MemoryBlockManager::acquire_block(const AcquireBlockOptions& opts) {
+    DCHECK(opts.block_size > 0) << "block size should be larger than 0";
+    if (try_reserve(opts.block_size)) {
+        auto res = std::make_shared<MemoryBlock>(opts.block_size);
+        TRACE_SPILL_LOG << fmt::format("allocate memory tier block [{}]", res->debug_string());
+        return res;
+    }
+    // the in-memory tier budget is exhausted, demote new blocks to the backing storage
+    return _backing_block_manager->acquire_block(opts);
+}
+
+Status MemoryBlockManager::release_block(const BlockPtr& block) {
+    if (dynamic_cast<MemoryBlock*>(block.get()) != nullptr) {
+        TRACE_SPILL_LOG << "release block: " << block->debug_string();
+        return Status::OK();
+    }
+    return _backing_block_manager->release_block(block);
+}
+
+} // namespace starrocks::spill
@@ -0,0 +1,54 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "exec/spill/block_manager.h"
+
+namespace starrocks::spill {
+
+// MemoryBlockManager keeps spilled blocks in a budgeted in-memory tier and demotes new
+// blocks to the backing BlockManager once the process-wide budget
+// (config::spill_max_in_memory_block_bytes) is used up. The payload handed to blocks is
+// already serialized, and compressed when the spill serde enables it, so the tier stores
+// it as-is. The budget is returned when the blocks of a query are destroyed.
+class MemoryBlockManager : public BlockManager {
+public:
+    MemoryBlockManager(const TUniqueId& query_id, std::unique_ptr<BlockManager> backing_block_manager);
+    ~MemoryBlockManager() override = default;
+
+    Status open() override;
+    void close() override;
+    StatusOr<BlockPtr> acquire_block(const AcquireBlockOptions& opts) override;
+    Status release_block(const BlockPtr& block) override;
+
+    // try to reserve `bytes` of the process-wide in-memory tier budget,
+    // return false if the budget is exhausted.
+    static bool try_reserve(int64_t bytes);
+    static void release(int64_t bytes);
+
+    // number of bytes currently reserved by the in-memory tier.
+    static int64_t tier_usage() { return _s_tier_usage.load(std::memory_order_relaxed); }
+
+private:
+    TUniqueId _query_id;
+    std::unique_ptr<BlockManager> _backing_block_manager;
+
+    static inline std::atomic<int64_t> _s_tier_usage{0};
+};
+
+} // namespace starrocks::spill
@@ -21,15 +21,28 @@
 #include "exec/spill/file_block_manager.h"
 #include "exec/spill/hybird_block_manager.h"
 #include "exec/spill/log_block_manager.h"
+#include "exec/spill/memory_block_manager.h"
 #include "runtime/exec_env.h"
 
 namespace starrocks::spill {
 
+namespace {
+// keep spilled blocks in a budgeted in-memory tier before the persistent block manager,
+// if the tier is enabled.
+std::unique_ptr<BlockManager> wrap_with_memory_tier(const TUniqueId& uid, std::unique_ptr<BlockManager> base) {
+    if (config::spill_max_in_memory_block_bytes <= 0) {
+        return base;
+    }
+    return std::make_unique<MemoryBlockManager>(uid, std::move(base));
+}
+} // namespace
+
 Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options) {
     bool enable_spill_to_remote_storage =
             query_options.__isset.enable_spill_to_remote_storage && query_options.enable_spill_to_remote_storage;
     if (!enable_spill_to_remote_storage) {
-        _block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
+        _block_manager =
+                wrap_with_memory_tier(_uid, std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr()));
         return Status::OK();
     }
     DCHECK(query_options.__isset.spill_to_remote_storage_options);
@@ -38,7 +51,8 @@ Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options)
     if (!options.__isset.remote_storage_paths || !options.__isset.remote_storage_conf) {
         DCHECK(false) << "enable spill_to_remote_storage but remote_storage_paths or remote_storage_conf "
                          "is not set";
-        _block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
+        _block_manager =
+                wrap_with_memory_tier(_uid, std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr()));
         return Status::OK();
     }
     const auto& remote_storage_paths = options.remote_storage_paths;
@@ -56,15 +70,15 @@ Status QuerySpillManager::init_block_manager(const TQueryOptions& query_options)
     bool disable_spill_to_local_disk =
             options.__isset.disable_spill_to_local_disk && options.disable_spill_to_local_disk;
     if (disable_spill_to_local_disk) {
-        _block_manager = std::make_unique<FileBlockManager>(_uid, _remote_dir_manager.get());
+        _block_manager = wrap_with_memory_tier(_uid, std::make_unique<FileBlockManager>(_uid, _remote_dir_manager.get()));
         return Status::OK();
     }
 
     // init block manager
     auto local_block_manager = std::make_unique<LogBlockManager>(_uid, ExecEnv::GetInstance()->spill_dir_mgr());
     auto remote_block_manager = std::make_unique<FileBlockManager>(_uid, _remote_dir_manager.get());
-    _block_manager =
-            std::make_unique<HyBirdBlockManager>(_uid, std::move(local_block_manager), std::move(remote_block_manager));
+    _block_manager = wrap_with_memory_tier(_uid, std::make_unique<HyBirdBlockManager>(_uid, std::move(local_block_manager),
+                                                                                      std::move(remote_block_manager)));
 
     return Status::OK();
 }
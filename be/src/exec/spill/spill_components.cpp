@@ -290,12 +290,21 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
         // for the final flush, we need to control the memory usage on hash join probe side,
         // so we should ensure the partitions loaded in memory under a certain threshold.
 
-        // order by bytes desc
+        // A pinned partition occupies its unflushed mem table plus any bytes already spilled,
+        // which have to be restored during probe. With skewed keys the build-side row count is
+        // the best available proxy for how often the probe side will hit a partition, so pin
+        // the partitions with the most rows per pinned byte and flush the cold rest.
+        auto pinned_footprint = [](SpilledPartition* partition) {
+            return partition->bytes + partition->spill_writer->mem_table()->mem_usage();
+        };
+        auto hotness = [&](SpilledPartition* partition) {
+            return static_cast<double>(partition->num_rows) / static_cast<double>(pinned_footprint(partition) + 1);
+        };
         std::sort(partitions_can_flush.begin(), partitions_can_flush.end(),
-                  [](SpilledPartition* left, SpilledPartition* right) { return left->bytes > right->bytes; });
+                  [&](SpilledPartition* left, SpilledPartition* right) { return hotness(left) > hotness(right); });
         size_t in_mem_bytes = 0;
         for (auto partition : partitions_can_flush) {
-            if (in_mem_bytes + partition->bytes > options().spill_mem_table_bytes_size) {
+            if (in_mem_bytes + pinned_footprint(partition) > options().spill_mem_table_bytes_size) {
                 const auto& mem_table = partition->spill_writer->mem_table();
                 RETURN_IF_ERROR(mem_table->done());
                 partition->in_mem = false;
@@ -303,7 +312,7 @@ Status PartitionedSpillerWriter::_choose_partitions_to_flush(bool is_final_flush
                 partitions_need_flush.emplace_back(partition);
                 continue;
             }
-            in_mem_bytes += partition->bytes;
+            in_mem_bytes += pinned_footprint(partition);
         }
     } else {
         // for the flush during hash join build process, our goal is to reduce memory usage,
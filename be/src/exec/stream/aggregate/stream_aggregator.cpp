@@ -233,7 +233,7 @@ Status StreamAggregator::_output_result_changes_with_retract(size_t chunk_size,
     // compute agg count to decide whehter to generate retract info.
     auto agg_count_column = down_cast<const Int64Column*>(
             final_result_chunk->get_column_by_index(_group_by_columns.size() + _count_agg_idx).get());
-    auto agg_count_column_data = agg_count_column->get_data();
+    const auto& agg_count_column_data = agg_count_column->get_data();
 
     // 2. seek previous results from result state table.
     StateTableResult prev_state_result;
@@ -250,10 +250,16 @@ Status StreamAggregator::_output_result_changes_with_retract(size_t chunk_size,
     size_t j = 0;
     for (size_t i = 0; i < chunk_size; i++) {
         if (!found_in_prev[i]) {
-            // append new row only if count > 0
+            // append new rows only if count > 0; new groups typically arrive in runs
+            // (e.g. the first epoch), so append each run in one shot
             if (agg_count_column_data[i] > 0) {
-                result_chunk->append(*final_result_chunk, i, 1);
-                ops->append(INSERT_OP);
+                size_t run_start = i;
+                while (i + 1 < chunk_size && !found_in_prev[i + 1] && agg_count_column_data[i + 1] > 0) {
+                    i++;
+                }
+                size_t run_length = i - run_start + 1;
+                result_chunk->append(*final_result_chunk, run_start, run_length);
+                ops->append_value_multiple_times(&INSERT_OP, run_length);
             }
         } else {
             if (agg_count_column_data[i] > 0) {
@@ -34,6 +34,7 @@
 
 #include "exec/tablet_sink.h"
 
+#include <climits>
 #include <memory>
 #include <numeric>
 #include <sstream>
@@ -49,6 +50,8 @@
 #include "common/statusor.h"
 #include "config.h"
 #include "exec/pipeline/query_context.h"
+#include "exec/sorting/sort_permute.h"
+#include "exec/sorting/sorting.h"
 #include "exec/tablet_sink_colocate_sender.h"
 #include "exprs/expr.h"
 #include "gutil/strings/fastmem.h"
@@ -59,6 +62,7 @@
 #include "runtime/runtime_state.h"
 #include "serde/protobuf_serde.h"
 #include "simd/simd.h"
+#include "storage/chunk_helper.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_manager.h"
 #include "util/brpc_stub_cache.h"
@@ -181,6 +185,8 @@ void OlapTableSink::_prepare_profile(RuntimeState* state) {
     _ts_profile->prepare_data_timer = ADD_TIMER(_profile, "PrepareDataTime");
     _ts_profile->convert_chunk_timer = ADD_CHILD_TIMER(_profile, "ConvertChunkTime", "PrepareDataTime");
     _ts_profile->validate_data_timer = ADD_CHILD_TIMER(_profile, "ValidateDataTime", "PrepareDataTime");
+    _ts_profile->pre_agg_timer = ADD_CHILD_TIMER(_profile, "PreAggregateTime", "PrepareDataTime");
+    _ts_profile->pre_agg_merged_rows_counter = ADD_COUNTER(_profile, "RowsPreAggregated", TUnit::UNIT);
     _ts_profile->send_data_timer = ADD_TIMER(_profile, "SendDataTime");
     _ts_profile->pack_chunk_timer = ADD_CHILD_TIMER(_profile, "PackChunkTime", "SendDataTime");
     _ts_profile->send_rpc_timer = ADD_CHILD_TIMER(_profile, "SendRpcTime", "SendDataTime");
@@ -269,6 +275,8 @@ Status OlapTableSink::prepare(RuntimeState* state) {
 
     _load_mem_limit = state->get_load_mem_limit();
 
+    _init_pre_aggregation();
+
     // map index_id to TabletBEMap(map tablet_id to backend id)
     IndexIdToTabletBEMap index_id_to_tablet_be_map;
     // open all channels
@@ -298,6 +306,123 @@ Status OlapTableSink::prepare(RuntimeState* state) {
     return Status::OK();
 }
 
+void OlapTableSink::_init_pre_aggregation() {
+    if (!config::enable_olap_table_sink_pre_aggregation || _keys_type != TKeysType::AGG_KEYS ||
+        _auto_increment_slot_id != -1 || _schema->indexes().empty()) {
+        return;
+    }
+    for (auto* index : _schema->indexes()) {
+        // per-index where clauses filter individual rows after the sink, aggregating
+        // beforehand would change which rows they see.
+        if (index->where_clause != nullptr) {
+            return;
+        }
+    }
+    const auto* base_index = _schema->indexes()[0];
+    const auto& columns = base_index->column_param->columns;
+    if (columns.size() != _output_tuple_desc->slots().size()) {
+        return;
+    }
+    std::unordered_map<std::string_view, SlotDescriptor*> slot_by_name;
+    for (auto* slot : _output_tuple_desc->slots()) {
+        slot_by_name.emplace(slot->col_name(), slot);
+    }
+    // key columns first in schema order, as ChunkAggregator requires
+    std::vector<std::string_view> ordered_names;
+    std::vector<SlotId> slot_ids;
+    for (int pass = 0; pass < 2; ++pass) {
+        for (const auto* column : columns) {
+            if (column->is_key() != (pass == 0)) {
+                continue;
+            }
+            if (!column->is_key()) {
+                switch (column->aggregation()) {
+                case STORAGE_AGGREGATE_SUM:
+                case STORAGE_AGGREGATE_MIN:
+                case STORAGE_AGGREGATE_MAX:
+                case STORAGE_AGGREGATE_HLL_UNION:
+                case STORAGE_AGGREGATE_BITMAP_UNION:
+                case STORAGE_AGGREGATE_PERCENTILE_UNION:
+                    break;
+                default:
+                    // the REPLACE family depends on the arrival order of individual rows,
+                    // merging duplicates on the sender could change which row survives.
+                    return;
+                }
+            }
+            auto it = slot_by_name.find(column->name());
+            if (it == slot_by_name.end()) {
+                return;
+            }
+            ordered_names.emplace_back(column->name());
+            slot_ids.push_back(it->second->id());
+        }
+    }
+    _pre_agg_schema = ChunkHelper::convert_schema(columns, ordered_names);
+    if (_pre_agg_schema == nullptr || _pre_agg_schema->num_key_fields() == 0) {
+        return;
+    }
+    _pre_agg_slot_ids = std::move(slot_ids);
+    _pre_agg_aggregator = std::make_unique<ChunkAggregator>(_pre_agg_schema.get(), 0, INT_MAX, 0);
+    _pre_agg_enabled = true;
+}
+
+StatusOr<Chunk*> OlapTableSink::_pre_aggregate_chunk(Chunk* chunk) {
+    size_t num_rows = chunk->num_rows();
+    size_t num_fields = _pre_agg_schema->num_fields();
+    size_t num_keys = _pre_agg_schema->num_key_fields();
+
+    Columns columns(num_fields);
+    for (size_t i = 0; i < num_fields; ++i) {
+        ColumnPtr column = chunk->get_column_by_slot_id(_pre_agg_slot_ids[i]);
+        // align the physical nullability with the storage schema: the expression layer may
+        // produce a non-nullable column for a nullable column and vice versa.
+        if (_pre_agg_schema->field(i)->is_nullable() && !column->is_nullable()) {
+            column = NullableColumn::wrap_if_necessary(column);
+        } else if (!_pre_agg_schema->field(i)->is_nullable() && column->is_nullable()) {
+            auto* nullable = down_cast<NullableColumn*>(column.get());
+            if (nullable->has_null()) {
+                // leave it to the validation stage to report the offending rows
+                return chunk;
+            }
+            column = nullable->data_column();
+        }
+        columns[i] = std::move(column);
+    }
+
+    // sort by key so that duplicates become adjacent and can be merged by ChunkAggregator.
+    // the sort must be stable so rows with equal keys keep their arrival order.
+    SmallPermutation perm;
+    Columns key_columns(columns.begin(), columns.begin() + num_keys);
+    RETURN_IF_ERROR(
+            stable_sort_and_tie_columns(false, key_columns, SortDescs::asc_null_first(num_keys), &perm));
+    std::vector<uint32_t> selective;
+    permutate_to_selective(perm, &selective);
+
+    ChunkPtr source = std::make_shared<Chunk>(std::move(columns), _pre_agg_schema);
+    ChunkPtr sorted = source->clone_empty_with_schema(num_rows);
+    sorted->append_selective(*source, selective.data(), 0, num_rows);
+
+    _pre_agg_aggregator->update_source(sorted);
+    DCHECK(_pre_agg_aggregator->is_do_aggregate());
+    while (!_pre_agg_aggregator->source_exhausted()) {
+        _pre_agg_aggregator->aggregate();
+    }
+    ChunkPtr result = _pre_agg_aggregator->aggregate_result();
+    _pre_agg_aggregator->aggregate_reset();
+    if (result->num_rows() == num_rows) {
+        // nothing merged, keep the original chunk and drop the sorted copy
+        return chunk;
+    }
+
+    // rebuild the slot-id addressed chunk expected by the rest of the send path
+    _pre_agg_chunk = std::make_shared<Chunk>();
+    for (size_t i = 0; i < num_fields; ++i) {
+        _pre_agg_chunk->append_column(result->get_column_by_index(i), _pre_agg_slot_ids[i]);
+    }
+    return _pre_agg_chunk.get();
+}
+
 Status OlapTableSink::_init_node_channels(RuntimeState* state, IndexIdToTabletBEMap& index_id_to_tablet_be_map) {
     const auto& partitions = _vectorized_partition->get_partitions();
     for (int i = 0; i < _schema->indexes().size(); ++i) {
@@ -580,6 +705,7 @@ Status OlapTableSink::send_chunk(RuntimeState* state, Chunk* chunk) {
     SCOPED_TIMER(_profile->total_time_counter());
     DCHECK(chunk->num_rows() > 0);
     size_t num_rows = chunk->num_rows();
+    const size_t num_input_rows = num_rows;
     size_t serialize_size = serde::ProtobufChunkSerde::max_serialized_size(*chunk);
 
     {
@@ -612,6 +738,21 @@ Status OlapTableSink::send_chunk(RuntimeState* state, Chunk* chunk) {
             DCHECK_EQ(chunk->get_slot_id_to_index_map().size(), _output_tuple_desc->slots().size());
         }
 
+        if (_pre_agg_enabled) {
+            SCOPED_TIMER(_ts_profile->pre_agg_timer);
+            ASSIGN_OR_RETURN(auto* pre_agg_chunk, _pre_aggregate_chunk(chunk));
+            if (pre_agg_chunk != chunk) {
+                size_t merged_rows = num_rows - pre_agg_chunk->num_rows();
+                COUNTER_UPDATE(_ts_profile->pre_agg_merged_rows_counter, merged_rows);
+                // merged rows are loaded through their surviving group row, count them as sunk
+                // so the load job's row accounting still adds up.
+                _number_output_rows += merged_rows;
+                state->update_num_rows_load_sink(merged_rows);
+                chunk = pre_agg_chunk;
+                num_rows = chunk->num_rows();
+            }
+        }
+
         {
             SCOPED_TIMER(_ts_profile->alloc_auto_increment_timer);
             RETURN_IF_ERROR(_fill_auto_increment_id(chunk));
@@ -716,9 +857,9 @@ Status OlapTableSink::send_chunk(RuntimeState* state, Chunk* chunk) {
     }
     // update incrementally so that FE can get the progress.
     // the real 'num_rows_load_total' will be set when sink being closed.
-    _number_input_rows += num_rows;
+    _number_input_rows += num_input_rows;
     state->update_num_bytes_load_sink(serialize_size);
-    StarRocksMetrics::instance()->load_rows_total.increment(num_rows);
+    StarRocksMetrics::instance()->load_rows_total.increment(num_input_rows);
     StarRocksMetrics::instance()->load_bytes_total.increment(serialize_size);
 
     SCOPED_TIMER(_ts_profile->send_data_timer);
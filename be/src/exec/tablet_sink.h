@@ -35,6 +35,7 @@
 #pragma once
 
 #include "exec/tablet_sink_sender.h"
+#include "storage/chunk_aggregator.h"
 
 namespace starrocks::stream_load {
 
@@ -124,6 +125,14 @@ private:
 
     Status _fill_auto_increment_id_internal(Chunk* chunk, SlotDescriptor* slot, int64_t table_id);
 
+    // Decide whether rows of an aggregate-key table can be pre-aggregated on the sender
+    // before transmission, and set up the storage schema and aggregator if so.
+    void _init_pre_aggregation();
+
+    // Merge rows sharing the same key within |chunk| with the table's aggregate functions.
+    // Returns |chunk| untouched when nothing was merged or the chunk layout does not allow it.
+    StatusOr<Chunk*> _pre_aggregate_chunk(Chunk* chunk);
+
     void mark_as_failed(const NodeChannel* ch) { _failed_channels.insert(ch->node_id()); }
     bool is_failed_channel(const NodeChannel* ch) { return _failed_channels.count(ch->node_id()) != 0; }
     bool has_intolerable_failure() {
@@ -246,6 +255,15 @@ private:
     std::atomic<bool> _is_automatic_partition_running = false;
     Status _automatic_partition_status;
 
+    // sender-side pre-aggregation for aggregate-key tables, see _init_pre_aggregation
+    bool _pre_agg_enabled = false;
+    SchemaPtr _pre_agg_schema;
+    std::unique_ptr<ChunkAggregator> _pre_agg_aggregator;
+    // for each field of _pre_agg_schema, the slot carrying it in the sink chunk
+    std::vector<SlotId> _pre_agg_slot_ids;
+    // keeps the latest aggregated chunk alive while it is sent
+    ChunkPtr _pre_agg_chunk;
+
     // bucket size for automatic bucket
     int64_t _automatic_bucket_size = 0;
     std::set<int64_t> _immutable_partition_ids;
@@ -447,14 +447,15 @@ Status NodeChannel::add_chunk(Chunk* input, const std::vector<int64_t>& tablet_i
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (_cur_chunk->num_rows() < _runtime_state->chunk_size() &&
+        _cur_chunk->memory_usage() < static_cast<size_t>(config::olap_table_sink_flush_chunk_bytes)) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
         }
         // passthrough: try to send data if queue not empty
     } else {
-        // 3. chunk full push back to queue
+        // 3. chunk full (by row count, or by bytes for wide tables) push back to queue
         _mem_tracker->consume(_cur_chunk->memory_usage());
         _request_queue.emplace_back(std::move(_cur_chunk), _rpc_request);
         _cur_chunk = input->clone_empty_with_slot();
@@ -497,14 +498,15 @@ Status NodeChannel::add_chunks(Chunk* input, const std::vector<std::vector<int64
         }
     }
 
-    if (_cur_chunk->num_rows() < _runtime_state->chunk_size()) {
+    if (_cur_chunk->num_rows() < _runtime_state->chunk_size() &&
+        _cur_chunk->memory_usage() < static_cast<size_t>(config::olap_table_sink_flush_chunk_bytes)) {
         // 2. chunk not full
         if (_request_queue.empty()) {
             return Status::OK();
         }
         // passthrough: try to send data if queue not empty
     } else {
-        // 3. chunk full push back to queue
+        // 3. chunk full (by row count, or by bytes for wide tables) push back to queue
         _mem_tracker->consume(_cur_chunk->memory_usage());
         _request_queue.emplace_back(std::move(_cur_chunk), _rpc_request);
         _cur_chunk = input->clone_empty_with_slot();
@@ -569,43 +571,49 @@ Status NodeChannel::_send_request(bool eos, bool finished) {
 
     _mem_tracker->release(chunk->memory_usage());
 
-    RETURN_IF_ERROR(_wait_one_prev_request());
+    {
+        // serialize and compress the chunk before taking an rpc slot, so this CPU work overlaps
+        // the requests still in flight instead of starting after one of them came back.
+        SCOPED_RAW_TIMER(&_actual_consume_ns);
+
+        for (int i = 0; i < request.requests_size(); i++) {
+            auto req = request.mutable_requests(i);
+            if (UNLIKELY(eos)) {
+                req->set_eos(true);
+
+                auto& partition_ids = _parent->_index_id_partition_ids[req->index_id()];
+                if (!partition_ids.empty()) {
+                    VLOG(2) << "partition_ids:" << std::string(partition_ids.begin(), partition_ids.end());
+                }
+                for (auto pid : partition_ids) {
+                    req->add_partition_ids(pid);
+                }
 
-    SCOPED_RAW_TIMER(&_actual_consume_ns);
+                // eos request must be the last request
+                _closed = true;
+            }
 
-    for (int i = 0; i < request.requests_size(); i++) {
-        auto req = request.mutable_requests(i);
-        if (UNLIKELY(eos)) {
-            req->set_eos(true);
+            // This is added for automatic partition. We need to ensure that
+            // all data has been sent before the incremental channel is closed.
+            if (UNLIKELY(finished)) {
+                req->set_wait_all_sender_close(true);
 
-            auto& partition_ids = _parent->_index_id_partition_ids[req->index_id()];
-            if (!partition_ids.empty()) {
-                VLOG(2) << "partition_ids:" << std::string(partition_ids.begin(), partition_ids.end());
-            }
-            for (auto pid : partition_ids) {
-                req->add_partition_ids(pid);
+                _finished = true;
             }
 
-            // eos request must be the last request
-            _closed = true;
-        }
+            req->set_packet_seq(_next_packet_seq);
 
-        // This is added for automatic partition. We need to ensure that
-        // all data has been sent before the incremental channel is closed.
-        if (UNLIKELY(finished)) {
-            req->set_wait_all_sender_close(true);
-
-            _finished = true;
+            // only serialize one chunk if is_repeated_request is true
+            if ((!_enable_colocate_mv_index || i == 0) && chunk->num_rows() > 0) {
+                auto pchunk = req->mutable_chunk();
+                RETURN_IF_ERROR(_serialize_chunk(chunk.get(), pchunk));
+            }
         }
+    }
 
-        req->set_packet_seq(_next_packet_seq);
+    RETURN_IF_ERROR(_wait_one_prev_request());
 
-        // only serialize one chunk if is_repeated_request is true
-        if ((!_enable_colocate_mv_index || i == 0) && chunk->num_rows() > 0) {
-            auto pchunk = req->mutable_chunk();
-            RETURN_IF_ERROR(_serialize_chunk(chunk.get(), pchunk));
-        }
-    }
+    SCOPED_RAW_TIMER(&_actual_consume_ns);
 
     _add_batch_closures[_current_request_index]->ref();
     _add_batch_closures[_current_request_index]->reset();
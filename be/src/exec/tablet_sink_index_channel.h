@@ -95,6 +95,8 @@ struct TabletSinkProfile {
     RuntimeProfile::Counter* server_rpc_timer = nullptr;
     RuntimeProfile::Counter* alloc_auto_increment_timer = nullptr;
     RuntimeProfile::Counter* server_wait_flush_timer = nullptr;
+    RuntimeProfile::Counter* pre_agg_timer = nullptr;
+    RuntimeProfile::Counter* pre_agg_merged_rows_counter = nullptr;
 };
 
 // map index_id to TabletBEMap(map tablet_id to backend id)
@@ -17,6 +17,7 @@
 #include "common/status.h"
 #include "exec/workgroup/work_group.h"
 #include "exec/workgroup/work_group_fwd.h"
+#include "util/cpu_info.h"
 
 namespace starrocks::workgroup {
 
@@ -46,6 +47,93 @@ void PriorityScanTaskQueue::force_put(ScanTask task) {
     _queue.force_put(std::move(task));
 }
 
+/// WorkStealingScanTaskQueue.
+WorkStealingScanTaskQueue::WorkStealingScanTaskQueue(size_t num_local_queues)
+        : _num_local_queues(std::max<size_t>(1, num_local_queues)) {
+    _local_queues.reserve(_num_local_queues);
+    for (size_t i = 0; i < _num_local_queues; ++i) {
+        _local_queues.emplace_back(std::make_unique<moodycamel::ConcurrentQueue<ScanTask>>());
+    }
+}
+
+void WorkStealingScanTaskQueue::close() {
+    _is_closed.store(true, std::memory_order_release);
+    std::lock_guard<std::mutex> lock(_takers_mutex);
+    _cv.notify_all();
+}
+
+size_t WorkStealingScanTaskQueue::_local_slot() {
+    static thread_local size_t slot = _next_taker_slot.fetch_add(1, std::memory_order_relaxed);
+    return slot % _num_local_queues;
+}
+
+bool WorkStealingScanTaskQueue::_try_take_local(size_t slot, ScanTask* task) {
+    if (_local_queues[slot]->try_dequeue(*task)) {
+        return true;
+    }
+    // Steal from the siblings, starting from the neighbour to spread the contention.
+    for (size_t i = 1; i < _num_local_queues; ++i) {
+        if (_local_queues[(slot + i) % _num_local_queues]->try_dequeue(*task)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool WorkStealingScanTaskQueue::_try_take_overflow(ScanTask* task) {
+    std::lock_guard<std::mutex> lock(_overflow_mutex);
+    if (_overflow_queue.empty()) {
+        return false;
+    }
+    *task = std::move(_overflow_queue.front());
+    _overflow_queue.pop();
+    return true;
+}
+
+StatusOr<ScanTask> WorkStealingScanTaskQueue::take() {
+    const size_t slot = _local_slot();
+    ScanTask task;
+    while (true) {
+        if (_try_take_local(slot, &task) || _try_take_overflow(&task)) {
+            _num_tasks.fetch_sub(1, std::memory_order_release);
+            return task;
+        }
+
+        if (_is_closed.load(std::memory_order_acquire)) {
+            return Status::Cancelled("Shutdown");
+        }
+
+        // The producer enqueues to the lock-free queue before notifying, so a lost notification
+        // is recovered by the bounded wait below.
+        std::unique_lock<std::mutex> lock(_takers_mutex);
+        if (_num_tasks.load(std::memory_order_acquire) > 0 || _is_closed.load(std::memory_order_acquire)) {
+            continue;
+        }
+        _cv.wait_for(lock, std::chrono::microseconds(POLL_INTERVAL_US));
+    }
+}
+
+bool WorkStealingScanTaskQueue::try_offer(ScanTask task) {
+    if (task.peak_scan_task_queue_size_counter != nullptr) {
+        task.peak_scan_task_queue_size_counter->set(_num_tasks.load(std::memory_order_relaxed));
+    }
+
+    const size_t slot = _next_offer_slot.fetch_add(1, std::memory_order_relaxed) % _num_local_queues;
+    if (!_local_queues[slot]->enqueue(std::move(task))) {
+        // enqueue only fails on allocation failure, fall back to the overflow queue.
+        std::lock_guard<std::mutex> lock(_overflow_mutex);
+        _overflow_queue.push(std::move(task));
+    }
+
+    _num_tasks.fetch_add(1, std::memory_order_release);
+    _cv.notify_one();
+    return true;
+}
+
+void WorkStealingScanTaskQueue::force_put(ScanTask task) {
+    (void)try_offer(std::move(task));
+}
+
 /// MultiLevelFeedScanTaskQueue.
 MultiLevelFeedScanTaskQueue::MultiLevelFeedScanTaskQueue() {
     double factor = 1;
@@ -388,6 +476,8 @@ std::unique_ptr<ScanTaskQueue> create_scan_task_queue() {
         return std::make_unique<PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size);
     case 1:
         return std::make_unique<MultiLevelFeedScanTaskQueue>();
+    case 2:
+        return std::make_unique<WorkStealingScanTaskQueue>(CpuInfo::num_cores());
     default:
         return std::make_unique<PriorityScanTaskQueue>(config::pipeline_scan_thread_pool_queue_size);
     }
@@ -25,6 +25,7 @@
 #include "common/statusor.h"
 #include "exec/workgroup/work_group_fwd.h"
 #include "util/blocking_priority_queue.hpp"
+#include "util/moodycamel/concurrentqueue.h"
 #include "util/race_detect.h"
 #include "util/runtime_profile.h"
 
@@ -112,13 +113,15 @@ public:
     RuntimeProfile::HighWaterMarkCounter* peak_scan_task_queue_size_counter = nullptr;
 };
 
-/// There are three types of ScanTaskQueue:
+/// There are four types of ScanTaskQueue:
 /// - WorkGroupScanTaskQueue, which is a two-level queue.
 ///   - The first level selects the workgroup with the shortest execution time.
 ///   - The second level selects an appropriate task using either PriorityScanTaskQueue or MultiLevelFeedScanTaskQueue.
 /// - PriorityScanTaskQueue, which prioritizes scan tasks with lower committed times.
 /// - MultiLevelFeedScanTaskQueue, which prioritizes scan tasks with shorter execution time.
 ///   It is advisable to use MultiLevelFeedScanTaskQueue when scan tasks from large queries may impact those from small queries.
+/// - WorkStealingScanTaskQueue, which spreads tasks over per-worker lock-free queues with work
+///   stealing, and reduces lock contention on many-core machines with many short queries.
 class ScanTaskQueue {
 public:
     ScanTaskQueue() = default;
@@ -184,6 +187,53 @@ private:
     std::atomic<size_t> _num_tasks = 0;
 };
 
+// WorkStealingScanTaskQueue spreads tasks over per-worker lock-free queues to avoid funneling
+// all the scan workers through one mutex. Each worker takes from its own queue first, then
+// steals from the sibling queues, and finally falls back to a shared overflow queue which only
+// receives tasks when a local queue fails to accept one. Fairness accounting is kept outside
+// this queue (in WorkGroupScanTaskQueue), the same as for PriorityScanTaskQueue.
+class WorkStealingScanTaskQueue final : public ScanTaskQueue {
+public:
+    explicit WorkStealingScanTaskQueue(size_t num_local_queues);
+    ~WorkStealingScanTaskQueue() override = default;
+
+    void close() override;
+
+    StatusOr<ScanTask> take() override;
+    bool try_offer(ScanTask task) override;
+    void force_put(ScanTask task) override;
+
+    size_t size() const override { return _num_tasks.load(std::memory_order_acquire); }
+
+    void update_statistics(ScanTask& task, int64_t runtime_ns) override {}
+    bool should_yield(const WorkGroup* wg, int64_t unaccounted_runtime_ns) const override { return false; }
+
+private:
+    // The local queue slot of the calling worker thread, assigned on the first call.
+    size_t _local_slot();
+    // Take from the worker's own queue, then from the siblings in a round-robin manner.
+    bool _try_take_local(size_t slot, ScanTask* task);
+    bool _try_take_overflow(ScanTask* task);
+
+    // The maximum duration that a worker sleeps before re-polling the local queues, which bounds
+    // the latency of a wakeup lost between the lock-free enqueue and the notification.
+    static constexpr int64_t POLL_INTERVAL_US = 1000;
+
+    const size_t _num_local_queues;
+    std::vector<std::unique_ptr<moodycamel::ConcurrentQueue<ScanTask>>> _local_queues;
+
+    mutable std::mutex _overflow_mutex;
+    std::queue<ScanTask> _overflow_queue;
+
+    std::mutex _takers_mutex;
+    std::condition_variable _cv;
+    std::atomic<bool> _is_closed = false;
+
+    std::atomic<size_t> _num_tasks = 0;
+    std::atomic<size_t> _next_offer_slot = 0;
+    std::atomic<size_t> _next_taker_slot = 0;
+};
+
 class PriorityScanTaskQueue final : public ScanTaskQueue {
 public:
     explicit PriorityScanTaskQueue(size_t max_elements);
@@ -174,6 +174,30 @@ public:
         column->get_offset().emplace_back(new_size);
     }
 
+    void batch_serialize(FunctionContext* ctx, size_t chunk_size, const Buffer<AggDataPtr>& agg_states,
+                         size_t state_offset, Column* to) const override {
+        DCHECK(to->is_binary());
+        auto* column = down_cast<BinaryColumn*>(to);
+        Bytes& bytes = column->get_bytes();
+        auto& offsets = column->get_offset();
+
+        // the state is fixed-size, so grow the destination once for the whole batch instead of
+        // resizing it row by row in serialize_to_column
+        size_t one_element_size = sizeof(ImmediateType) + sizeof(int64_t);
+        size_t old_size = bytes.size();
+        size_t old_rows = offsets.size() - 1;
+        bytes.resize(old_size + one_element_size * chunk_size);
+        offsets.resize(old_rows + chunk_size + 1);
+
+        for (size_t i = 0; i < chunk_size; i++) {
+            const auto& state = this->data(agg_states[i] + state_offset);
+            memcpy(bytes.data() + old_size, &state.sum, sizeof(ImmediateType));
+            memcpy(bytes.data() + old_size + sizeof(ImmediateType), &state.count, sizeof(int64_t));
+            old_size += one_element_size;
+            offsets[old_rows + i + 1] = old_size;
+        }
+    }
+
     void convert_to_serialize_format(FunctionContext* ctx, const Columns& src, size_t chunk_size,
                                      ColumnPtr* dst) const override {
         DCHECK((*dst)->is_binary());
@@ -36,6 +36,21 @@ public:
         this->data(state) |= *(col->get_object(row_num));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* col = down_cast<const BitmapColumn*>(columns[0]);
+        _union_rows(col, 0, chunk_size, state);
+    }
+
+    // The storage-side BITMAP_UNION combine (and the merge phase of a single-group union) folds
+    // a whole run of rows into one state; hand the run to a multi-way union instead of growing
+    // the state once per row.
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        const auto* col = down_cast<const BitmapColumn*>(column);
+        _union_rows(col, start, size, state);
+    }
+
     void serialize_to_column(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* to) const override {
         auto* col = down_cast<BitmapColumn*>(to);
         auto& bitmap = const_cast<BitmapValue&>(this->data(state));
@@ -54,6 +69,16 @@ public:
     }
 
     std::string get_name() const override { return "bitmap_union"; }
+
+private:
+    void _union_rows(const BitmapColumn* col, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const BitmapValue*> values;
+        values.reserve(size);
+        for (size_t i = start; i < start + size; ++i) {
+            values.emplace_back(col->get_object(i));
+        }
+        this->data(state).union_many(values);
+    }
 };
 
 } // namespace starrocks
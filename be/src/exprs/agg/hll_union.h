@@ -54,6 +54,21 @@ public:
         this->data(state).merge(*(hll_column->get_object(row_num)));
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        const auto* column = down_cast<const HyperLogLogColumn*>(columns[0]);
+        _merge_rows(column, 0, chunk_size, state);
+    }
+
+    // A run of rows aggregated into one state (the storage-side HLL_UNION combine, or the
+    // merge phase of a single-group hll_union) is handed over as one multi-way merge.
+    void merge_batch_single_state(FunctionContext* ctx, AggDataPtr __restrict state, const Column* column, size_t start,
+                                  size_t size) const override {
+        DCHECK(column->is_object());
+        const auto* hll_column = down_cast<const HyperLogLogColumn*>(column);
+        _merge_rows(hll_column, start, size, state);
+    }
+
     void get_values(FunctionContext* ctx, ConstAggDataPtr __restrict state, Column* dst, size_t start,
                     size_t end) const override {
         DCHECK_GT(end, start);
@@ -87,6 +102,16 @@ public:
     }
 
     std::string get_name() const override { return "hll_union"; }
+
+private:
+    void _merge_rows(const HyperLogLogColumn* column, size_t start, size_t size, AggDataPtr __restrict state) const {
+        std::vector<const HyperLogLog*> values;
+        values.reserve(size);
+        for (size_t i = start; i < start + size; ++i) {
+            values.emplace_back(column->get_object(i));
+        }
+        this->data(state).merge_many(values);
+    }
 };
 
 } // namespace starrocks
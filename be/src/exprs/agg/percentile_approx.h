@@ -43,7 +43,8 @@ public:
             if (columns[0]->is_null(row_num)) {
                 return;
             }
-            column_value = down_cast<const NullableColumn*>(columns[0])->data_column()->get(row_num).get_double();
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            column_value = down_cast<const DoubleColumn*>(nullable_column->data_column().get())->get_data()[row_num];
         } else {
             column_value = down_cast<const DoubleColumn*>(columns[0])->get_data()[row_num];
         }
@@ -56,6 +57,40 @@ public:
         data(state).is_null = false;
     }
 
+    void update_batch_single_state(FunctionContext* ctx, size_t chunk_size, const Column** columns,
+                                   AggDataPtr __restrict state) const override {
+        DCHECK(!columns[1]->only_null());
+        DCHECK(!columns[1]->is_null(0));
+
+        const double* values;
+        const uint8_t* nulls = nullptr;
+        if (columns[0]->is_nullable()) {
+            const auto* nullable_column = down_cast<const NullableColumn*>(columns[0]);
+            values = down_cast<const DoubleColumn*>(nullable_column->data_column().get())->get_data().data();
+            if (nullable_column->has_null()) {
+                nulls = nullable_column->null_column()->get_data().data();
+            }
+        } else {
+            values = down_cast<const DoubleColumn*>(columns[0])->get_data().data();
+        }
+
+        // feed the values straight into the t-digest's unprocessed buffer; the digest sorts the
+        // buffer once at compression time, so there is no need to touch centroids per value
+        bool updated = false;
+        auto* percentile = data(state).percentile.get();
+        for (size_t i = 0; i < chunk_size; ++i) {
+            if (nulls != nullptr && nulls[i] != 0) {
+                continue;
+            }
+            percentile->add(implicit_cast<float>(values[i]));
+            updated = true;
+        }
+        if (updated) {
+            data(state).targetQuantile = columns[1]->get(0).get_double();
+            data(state).is_null = false;
+        }
+    }
+
     void merge(FunctionContext* ctx, const Column* column, AggDataPtr __restrict state, size_t row_num) const override {
         Slice src;
         if (column->is_nullable()) {
@@ -71,11 +106,12 @@ public:
         double quantile;
         memcpy(&quantile, src.data, sizeof(double));
 
-        PercentileApproxState src_percentile;
-        src_percentile.targetQuantile = quantile;
-        src_percentile.percentile->deserialize((char*)src.data + sizeof(double));
+        // deserialize into a stack value instead of a full PercentileApproxState, which would
+        // heap-allocate a PercentileValue for every merged row
+        PercentileValue src_percentile;
+        src_percentile.deserialize((char*)src.data + sizeof(double));
 
-        data(state).percentile->merge(src_percentile.percentile.get());
+        data(state).percentile->merge(&src_percentile);
         data(state).targetQuantile = quantile;
         data(state).is_null = false;
     }
@@ -1168,34 +1168,32 @@ void _array_slice_item(ArrayColumn* column, size_t index, ArrayColumn* dest_colu
         return;
     }
 
-    Datum v = column->get(index);
-    const auto& items = v.get<DatumArray>();
+    const auto& src_offsets = column->offsets().get_data();
+    const int64_t src_start = src_offsets[index];
+    const int64_t num_items = src_offsets[index + 1] - src_start;
 
     if (offset > 0) {
         // because offset start with 1.
         --offset;
     } else {
-        offset += items.size();
+        offset += num_items;
     }
 
-    auto& dest_data_column = dest_column->elements_column();
     int64_t end;
     if constexpr (with_length) {
-        end = std::max((int64_t)0, std::min((int64_t)items.size(), (offset + length)));
+        end = std::max((int64_t)0, std::min(num_items, (offset + length)));
     } else {
-        end = items.size();
+        end = num_items;
     }
     offset = (offset > 0 ? offset : 0);
-    for (size_t i = offset; i < end; ++i) {
-        if (items[i].is_null()) {
-            dest_data_column->append_nulls(1);
-        } else {
-            dest_data_column->append_datum(items[i]);
-        }
-    }
 
     // Protect when length < 0.
     auto offset_delta = ((end < offset) ? 0 : end - offset);
+    if (offset_delta > 0) {
+        // The slice is a contiguous range of the flat element column, so copy it in one
+        // append instead of boxing every element into a Datum.
+        dest_column->elements_column()->append(column->elements(), src_start + offset, offset_delta);
+    }
     dest_offsets.emplace_back(dest_offsets.back() + offset_delta);
 }
 
@@ -1271,14 +1269,15 @@ StatusOr<ColumnPtr> ArrayFunctions::array_slice(FunctionContext* ctx, const Colu
         dest_data_column = down_cast<ArrayColumn*>(dest_column.get());
     }
 
+    const auto& offset_data = offset_column->get_data();
     if (columns.size() > 2) {
+        const auto& length_data = length_column->get_data();
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_slice_item<true>(array_column, i, dest_data_column, offset_column->get(i).get_int64(),
-                                    length_column->get(i).get_int64());
+            _array_slice_item<true>(array_column, i, dest_data_column, offset_data[i], length_data[i]);
         }
     } else {
         for (size_t i = 0; i < chunk_size; i++) {
-            _array_slice_item<false>(array_column, i, dest_data_column, offset_column->get(i).get_int64(), 0);
+            _array_slice_item<false>(array_column, i, dest_data_column, offset_data[i], 0);
         }
     }
 
@@ -22,6 +22,7 @@
 #include "column/column_viewer.h"
 #include "column/type_traits.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "common/object_pool.h"
 #include "exprs/jit/ir_helper.h"
 #include "gutil/casts.h"
@@ -452,13 +453,6 @@ private:
     //  If all `WHEN` is null/false, return NULL
     //  If `WHEN` is not null and true, return `THEN`
     StatusOr<ColumnPtr> evaluate_no_case(ExprContext* context, Chunk* chunk) {
-        ColumnPtr else_column = nullptr;
-        if (!_has_else_expr) {
-            else_column = ColumnHelper::create_const_null_column(chunk != nullptr ? chunk->num_rows() : 1);
-        } else {
-            ASSIGN_OR_RETURN(else_column, _children[_children.size() - 1]->evaluate_checked(context, chunk));
-        }
-
         int loop_end = _children.size() - 1;
 
         Columns when_columns;
@@ -470,7 +464,66 @@ private:
         std::vector<ColumnViewer<TYPE_BOOLEAN>> when_viewers;
         when_viewers.reserve(loop_end);
 
+        // Lazy mode: every WHEN/THEN/ELSE expr only sees the rows the preceding clauses left
+        // unmatched, compacted into a temporary chunk when few enough of them survive, and its
+        // result is scattered back to full size so the blending below stays unchanged. This skips
+        // the bulk of the computation of expensive branches (e.g. regexp) on skewed conditions.
+        const bool lazy =
+                chunk != nullptr && !lt_is_collection<ResultType> && config::enable_case_when_lazy_evaluation;
+        const size_t num_rows = chunk != nullptr ? chunk->num_rows() : 1;
+        // rows no earlier WHEN matched, maintained in lazy mode only
+        Filter remaining;
+        size_t remaining_count = num_rows;
+        if (lazy) {
+            remaining.assign(num_rows, 1);
+        }
+
         for (int i = 0; i < loop_end; i += 2) {
+            if (lazy) {
+                if (remaining_count == 0) {
+                    break; // every row already matched an earlier WHEN
+                }
+                ASSIGN_OR_RETURN(ColumnPtr when_column,
+                                 evaluate_masked(_children[i], context, chunk, remaining, remaining_count));
+
+                // canonical mask of the rows this WHEN is the first to match
+                ColumnViewer<TYPE_BOOLEAN> when_viewer(when_column);
+                Filter match(num_rows, 0);
+                size_t match_count = 0;
+                for (size_t row = 0; row < num_rows; ++row) {
+                    if (remaining[row] && !when_viewer.is_null(row) && when_viewer.value(row)) {
+                        match[row] = 1;
+                        ++match_count;
+                    }
+                }
+
+                // skip if no row reaches this THEN
+                if (match_count == 0) {
+                    continue;
+                }
+
+                ASSIGN_OR_RETURN(ColumnPtr then_column,
+                                 evaluate_masked(_children[i + 1], context, chunk, match, match_count));
+
+                // direct return if first when is all true
+                if (when_viewers.empty() && match_count == num_rows) {
+                    return then_column->clone();
+                }
+
+                for (size_t row = 0; row < num_rows; ++row) {
+                    remaining[row] &= static_cast<uint8_t>(!match[row]);
+                }
+                remaining_count -= match_count;
+
+                auto match_column = BooleanColumn::create();
+                match_column->get_data().swap(match);
+
+                when_columns.emplace_back(std::move(match_column));
+                then_columns.emplace_back(then_column);
+                when_viewers.emplace_back(when_columns.back());
+                continue;
+            }
+
             ASSIGN_OR_RETURN(ColumnPtr when_column, _children[i]->evaluate_checked(context, chunk));
 
             size_t trues_count = ColumnHelper::count_true_with_notnull(when_column);
@@ -492,6 +545,17 @@ private:
             when_viewers.emplace_back(when_column);
         }
 
+        ColumnPtr else_column = nullptr;
+        if (!_has_else_expr || (lazy && remaining_count == 0)) {
+            // no ELSE clause, or every row matched some WHEN so the ELSE result is never read
+            else_column = ColumnHelper::create_const_null_column(num_rows);
+        } else if (lazy) {
+            ASSIGN_OR_RETURN(else_column, evaluate_masked(_children[_children.size() - 1], context, chunk, remaining,
+                                                          remaining_count));
+        } else {
+            ASSIGN_OR_RETURN(else_column, _children[_children.size() - 1]->evaluate_checked(context, chunk));
+        }
+
         if (when_viewers.empty()) {
             return else_column->clone();
         }
@@ -641,6 +705,66 @@ private:
         }
     }
 
+    // Evaluate |expr| only over the rows of |chunk| whose |mask| is set: the columns the expr
+    // references are gathered into a compacted chunk, the expr is evaluated over it, and the
+    // result is scattered back to a full-size column. The values at unmasked positions are
+    // unspecified and must never be read by the caller.
+    static StatusOr<ColumnPtr> evaluate_masked(Expr* expr, ExprContext* context, Chunk* chunk, const Filter& mask,
+                                               size_t mask_count) {
+        const size_t num_rows = chunk->num_rows();
+        // compaction costs a copy of the referenced columns, so only pay for it
+        // when the mask filters at least half of the rows
+        if (mask_count * 2 > num_rows) {
+            return expr->evaluate_checked(context, chunk);
+        }
+
+        std::vector<SlotId> slot_ids;
+        expr->get_slot_ids(&slot_ids);
+        if (slot_ids.empty()) {
+            // no input column referenced, nothing is saved by compaction
+            return expr->evaluate_checked(context, chunk);
+        }
+        for (SlotId slot_id : slot_ids) {
+            if (!chunk->is_slot_exist(slot_id)) {
+                return expr->evaluate_checked(context, chunk);
+            }
+        }
+
+        std::vector<uint32_t> selected;
+        selected.reserve(mask_count);
+        std::vector<uint32_t> scatter_indexes(num_rows, 0);
+        for (uint32_t row = 0; row < num_rows; ++row) {
+            if (mask[row]) {
+                scatter_indexes[row] = selected.size();
+                selected.emplace_back(row);
+            }
+        }
+
+        Chunk compacted_chunk;
+        for (SlotId slot_id : slot_ids) {
+            if (compacted_chunk.is_slot_exist(slot_id)) {
+                continue;
+            }
+            const ColumnPtr& column = chunk->get_column_by_slot_id(slot_id);
+            ColumnPtr compacted = column->clone_empty();
+            compacted->append_selective(*column, selected.data(), 0, selected.size());
+            compacted_chunk.append_column(std::move(compacted), slot_id);
+        }
+
+        ASSIGN_OR_RETURN(ColumnPtr result, expr->evaluate_checked(context, &compacted_chunk));
+        if (result->is_constant()) {
+            // covers only_null: constant over the masked rows is constant over all of them
+            result = result->clone();
+            result->resize(num_rows);
+            return result;
+        }
+        // scatter back: unmasked rows duplicate the first masked row, the caller never reads them
+        ColumnPtr scattered = result->clone_empty();
+        scattered->reserve(num_rows);
+        scattered->append_selective(*result, scatter_indexes.data(), 0, num_rows);
+        return scattered;
+    }
+
 private:
     const bool _has_case_expr;
     const bool _has_else_expr;
@@ -19,6 +19,7 @@
 #include "exprs/binary_function.h"
 #include "exprs/overflow.h"
 #include "gutil/strings/substitute.h"
+#include "simd/simd.h"
 #include "types/logical_type.h"
 
 namespace starrocks {
@@ -79,6 +80,10 @@ struct DecimalBinaryFunction {
             rhs_datum = rhs_data[0];
         }
 
+        // The overflow flags are aggregated outside the loop instead of being checked row by row:
+        // the loop body stays branch-free, so the compiler can keep it in vectorized straight-line
+        // code, and one aggregated check per batch decides whether any row overflowed.
+        [[maybe_unused]] bool batch_overflow = false;
         for (auto i = 0; i < num_rows; ++i) {
             if constexpr (lhs_is_const && rhs_is_const) {
                 overflow = BinaryOperator::template apply<check_overflow<overflow_mode>, false, LhsCppType, RhsCppType,
@@ -98,18 +103,24 @@ struct DecimalBinaryFunction {
                                                                                      &result_data[i], scale_factor);
             }
             if constexpr (check_overflow<overflow_mode>) {
-                if (overflow) {
-                    if constexpr (error_if_overflow<overflow_mode>) {
-                        throw std::overflow_error(strings::Substitute(
-                                "The '$0' operation involving decimal values overflows", get_op_name<Op>()));
-                    } else {
-                        static_assert(null_if_overflow<overflow_mode>);
-                        *has_null = true;
-                        nulls[i] = DATUM_NULL;
-                    }
+                if constexpr (error_if_overflow<overflow_mode>) {
+                    batch_overflow |= overflow;
+                } else {
+                    static_assert(null_if_overflow<overflow_mode>);
+                    nulls[i] = overflow ? DATUM_NULL : DATUM_NOT_NULL;
                 }
             }
         }
+        if constexpr (check_overflow<overflow_mode>) {
+            if constexpr (error_if_overflow<overflow_mode>) {
+                if (batch_overflow) {
+                    throw std::overflow_error(strings::Substitute(
+                            "The '$0' operation involving decimal values overflows", get_op_name<Op>()));
+                }
+            } else {
+                *has_null = SIMD::count_nonzero(nulls, num_rows) != 0;
+            }
+        }
         return false;
     }
 
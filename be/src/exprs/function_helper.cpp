@@ -26,11 +26,13 @@ NullColumnPtr FunctionHelper::union_nullable_column(const ColumnPtr& v1, const C
     if (v1->is_nullable() && v2->is_nullable()) {
         const auto& n1 = ColumnHelper::as_raw_column<NullableColumn>(v1)->null_column();
         const auto& n2 = ColumnHelper::as_raw_column<NullableColumn>(v2)->null_column();
+        // a side without nulls contributes an all-zeros mask, so the union is just a
+        // copy of the other side's mask and the OR over both masks can be skipped.
         if (!v1->has_null()) {
-            result = n2->clone();
+            return ColumnHelper::cast_to<TYPE_NULL>(n2->clone());
         }
         if (!v2->has_null()) {
-            result = n1->clone();
+            return ColumnHelper::cast_to<TYPE_NULL>(n1->clone());
         }
         return union_null_column(n1, n2);
     } else if (v1->is_nullable()) {
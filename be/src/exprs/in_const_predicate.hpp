@@ -14,6 +14,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "column/chunk.h"
 #include "column/column_builder.h"
 #include "column/column_helper.h"
@@ -98,6 +100,8 @@ public:
             const auto& hash_set = that->hash_set();
             _hash_set.insert(hash_set.begin(), hash_set.end());
             _null_in_set = _null_in_set || that->null_in_set();
+            // The range array built at open() doesn't cover the merged values anymore.
+            _use_range_array = false;
             return Status::OK();
         } else {
             return Status::NotSupported(strings::Substitute("$0 cannot be merged with VectorizedInConstPredicate",
@@ -173,6 +177,10 @@ public:
                     _hash_set.emplace(viewer.value(0));
                 }
             }
+
+            if (!use_array) {
+                _try_convert_to_range_array();
+            }
         }
         return Status::OK();
     }
@@ -326,7 +334,11 @@ public:
         return evaluate_with_filter(context, ptr, nullptr);
     }
 
-    void insert(const ValueType& value) { _hash_set.emplace(value); }
+    void insert(const ValueType& value) {
+        _hash_set.emplace(value);
+        // The range array built at open() doesn't cover the inserted value anymore.
+        _use_range_array = false;
+    }
 
     void insert_array(const ValueType& value) {
         if constexpr (can_use_array()) {
@@ -340,6 +352,13 @@ public:
     uint8_t check_value_existence(const ValueType& value) const {
         if constexpr (use_array && can_use_array()) {
             return _get_array_index(value);
+        } else if constexpr (can_use_array()) {
+            if (_use_range_array) {
+                uint64_t offset = static_cast<uint64_t>(static_cast<int64_t>(value)) -
+                                  static_cast<uint64_t>(_range_array_offset);
+                return offset < _range_array_buffer.size() ? _range_array_buffer[offset] : 0;
+            }
+            return static_cast<uint8_t>(_hash_set.contains(value));
         } else {
             return static_cast<uint8_t>(_hash_set.contains(value));
         }
@@ -380,6 +399,36 @@ private:
         }
     }
 
+    // Value-range analysis for the integer IN lists BI tools generate: when the constant values
+    // span a small range, membership becomes one offset check plus one byte load instead of a
+    // hash probe per row. The hash set stays the source of truth, because insert()/merge() may
+    // add values afterwards, which simply falls back to hash probing.
+    void _try_convert_to_range_array() {
+        if constexpr (can_use_array()) {
+            if (is_use_array() || _hash_set.empty()) {
+                return;
+            }
+            int64_t min_value = std::numeric_limits<int64_t>::max();
+            int64_t max_value = std::numeric_limits<int64_t>::min();
+            for (const auto& value : _hash_set) {
+                min_value = std::min<int64_t>(min_value, value);
+                max_value = std::max<int64_t>(max_value, value);
+            }
+            uint64_t range = static_cast<uint64_t>(max_value) - static_cast<uint64_t>(min_value);
+            if (range >= kMaxRangeArraySize) {
+                return;
+            }
+            _range_array_buffer.assign(range + 1, 0);
+            for (const auto& value : _hash_set) {
+                _range_array_buffer[static_cast<int64_t>(value) - min_value] = 1;
+            }
+            _range_array_offset = min_value;
+            _use_range_array = true;
+        }
+    }
+
+    static constexpr uint64_t kMaxRangeArraySize = 65536;
+
     const bool _is_not_in{false};
     bool _is_prepare{false};
     bool _null_in_set{false};
@@ -388,6 +437,11 @@ private:
     int _array_size = 0;
     std::vector<uint8_t> _array_buffer;
 
+    // Checked direct-indexed representation built by _try_convert_to_range_array.
+    bool _use_range_array = false;
+    int64_t _range_array_offset = 0;
+    std::vector<uint8_t> _range_array_buffer;
+
     in_const_pred_detail::LHashSetType<Type> _hash_set;
     // Ensure the string memory don't early free
     std::vector<ColumnPtr> _string_values;
@@ -52,14 +52,9 @@ struct UDFFunctionCallHelper {
         int num_cols = ctx->get_num_args();
         std::vector<const Column*> input_cols;
 
-        for (auto& column : columns) {
-            if (column->only_null()) {
-                // we will handle NULL later
-            } else if (column->is_constant()) {
-                column = ColumnHelper::unpack_and_duplicate_const_column(size, column);
-            }
-        }
-
+        // only-null and constant columns are handled inside convert_to_boxed_array: a constant
+        // argument crosses JNI as a single boxed value replicated by reference, so there is no
+        // need to materialize it into a full column of duplicates here.
         for (const auto& col : columns) {
             input_cols.emplace_back(col.get());
         }
@@ -35,6 +35,7 @@
 #include <llvm/Passes/PassBuilder.h>
 #include <llvm/Passes/PassPlugin.h>
 #include <llvm/Support/Error.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/Host.h>
 #include <llvm/Support/MemoryBuffer.h>
 #include <llvm/Support/TargetSelect.h>
@@ -54,6 +55,8 @@
 #include <llvm/Transforms/Vectorize/LoopVectorize.h>
 #include <llvm/Transforms/Vectorize/SLPVectorizer.h>
 
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -76,6 +79,10 @@ struct JitCacheEntry {
     JITScalarFunction func;
 };
 
+static std::string object_cache_file_path(const std::string& expr_name) {
+    return fmt::format("{}/{:016x}.jo", config::jit_object_cache_dir, std::hash<std::string>()(expr_name));
+}
+
 JitObjectCache::JitObjectCache(const std::string& expr_name, Cache* cache)
         : _cache_key(std::move(expr_name)), _lru_cache(std::move(cache)) {}
 
@@ -174,6 +181,24 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
         return Status::OK();
     }
 
+    if (!config::jit_object_cache_dir.empty()) {
+        auto maybe_obj = _load_object_from_disk(func_cache->get_func_name());
+        if (maybe_obj.ok()) {
+            auto st = [&]() -> Status {
+                ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
+                func_cache->notifyObjectCompiled(nullptr, maybe_obj.value()->getMemBufferRef());
+                RETURN_IF_ERROR(engine->finalize_module_with_object(std::move(maybe_obj.value())));
+                ASSIGN_OR_RETURN(auto function, engine->get_compiled_func(func_cache->get_func_name()));
+                return func_cache->register_func(function);
+            }();
+            if (st.ok()) {
+                return Status::OK();
+            }
+            LOG(WARNING) << "JIT: failed to relink persistent object cache entry, fallback to compiling, func = "
+                         << func_cache->get_func_name() << ", reason: " << st;
+        }
+    }
+
     ASSIGN_OR_RETURN(auto engine, Engine::create(*func_cache))
     // TODO: check need set module?
     // generate ir to module
@@ -186,9 +211,71 @@ Status JITEngine::compile_scalar_function(ExprContext* context, JitObjectCache*
     }
     ASSIGN_OR_RETURN(auto function, engine->get_compiled_func(func_cache->get_func_name()));
     RETURN_IF_ERROR(func_cache->register_func(function));
+    if (!config::jit_object_cache_dir.empty() && func_cache->get_obj_code() != nullptr) {
+        _store_object_to_disk(func_cache->get_func_name(), *func_cache->get_obj_code());
+    }
     return Status::OK();
 }
 
+StatusOr<std::unique_ptr<llvm::MemoryBuffer>> JITEngine::_load_object_from_disk(const std::string& expr_name) {
+    auto path = object_cache_file_path(expr_name);
+    auto maybe_buf = llvm::MemoryBuffer::getFile(path);
+    if (!maybe_buf) {
+        return Status::NotFound(fmt::format("no persistent JIT object for {}", expr_name));
+    }
+    llvm::StringRef data = (*maybe_buf)->getBuffer();
+    uint64_t key_len = 0;
+    if (data.size() < sizeof(key_len)) {
+        return Status::Corruption(fmt::format("persistent JIT object {} is truncated", path));
+    }
+    memcpy(&key_len, data.data(), sizeof(key_len));
+    if (data.size() < sizeof(key_len) + key_len) {
+        return Status::Corruption(fmt::format("persistent JIT object {} is truncated", path));
+    }
+    // The file name is only a hash of the cache key, so verify the embedded key to
+    // guarantee a collision can never resurrect machine code of another expression.
+    if (data.substr(sizeof(key_len), key_len) != llvm::StringRef(expr_name)) {
+        return Status::NotFound(fmt::format("persistent JIT object {} belongs to another expression", path));
+    }
+    return llvm::MemoryBuffer::getMemBufferCopy(data.substr(sizeof(key_len) + key_len), expr_name);
+}
+
+void JITEngine::_store_object_to_disk(const std::string& expr_name, const llvm::MemoryBuffer& obj) {
+    const std::string& dir = config::jit_object_cache_dir;
+    if (auto ec = llvm::sys::fs::create_directories(dir); ec) {
+        LOG(WARNING) << "JIT: failed to create object cache dir " << dir << ", reason: " << ec.message();
+        return;
+    }
+    auto path = object_cache_file_path(expr_name);
+    // Write to a unique temporary file and rename it, so concurrent writers and
+    // readers never observe a partially written object.
+    int fd = -1;
+    llvm::SmallString<256> tmp_path;
+    if (auto ec = llvm::sys::fs::createUniqueFile(path + ".tmp.%%%%%%", fd, tmp_path); ec) {
+        LOG(WARNING) << "JIT: failed to create temporary object cache file for " << path
+                     << ", reason: " << ec.message();
+        return;
+    }
+    {
+        llvm::raw_fd_ostream out(fd, /*shouldClose=*/true);
+        uint64_t key_len = expr_name.size();
+        out.write(reinterpret_cast<const char*>(&key_len), sizeof(key_len));
+        out.write(expr_name.data(), key_len);
+        out.write(obj.getBufferStart(), obj.getBufferSize());
+        out.flush();
+        if (out.has_error()) {
+            LOG(WARNING) << "JIT: failed to write object cache file " << tmp_path.str().str();
+            out.clear_error();
+            (void)llvm::sys::fs::remove(tmp_path);
+            return;
+        }
+    }
+    if (auto ec = llvm::sys::fs::rename(tmp_path, path); ec) {
+        LOG(WARNING) << "JIT: failed to publish object cache file " << path << ", reason: " << ec.message();
+        (void)llvm::sys::fs::remove(tmp_path);
+    }
+}
+
 std::string JITEngine::dump_module_ir(const llvm::Module& module) {
     std::string ir;
     llvm::raw_string_ostream stream(ir);
@@ -441,6 +528,15 @@ Status JITEngine::Engine::optimize_and_finalize_module() {
     return Status::OK();
 }
 
+Status JITEngine::Engine::finalize_module_with_object(std::unique_ptr<llvm::MemoryBuffer> obj_code) {
+    auto err = _lljit->addObjectFile(std::move(obj_code));
+    if (err) {
+        return Status::JitCompileError("Failed to add cached object file to LLJIT: " + llvm::toString(std::move(err)));
+    }
+    _module_finalized = true;
+    return Status::OK();
+}
+
 StatusOr<JITScalarFunction> JITEngine::Engine::get_compiled_func(const std::string& function) {
     if (!_module_finalized) {
         return Status::JitCompileError("module must be finalized before getting compiled function");
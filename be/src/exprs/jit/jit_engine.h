@@ -55,6 +55,8 @@ public:
     }
     JITScalarFunction get_func() const { return _func; }
 
+    const llvm::MemoryBuffer* get_obj_code() const { return _obj_code.get(); }
+
     size_t get_code_size() const { return _obj_code == nullptr ? 0 : _obj_code->getBufferSize(); }
 
 private:
@@ -120,6 +122,10 @@ private:
 
         Status optimize_and_finalize_module();
 
+        // Link pre-compiled object code into LLJIT directly, skipping IR generation
+        // and optimization. Used when the persistent object cache hits.
+        Status finalize_module_with_object(std::unique_ptr<llvm::MemoryBuffer> obj_code);
+
         StatusOr<JITScalarFunction> get_compiled_func(const std::string& function);
 
     private:
@@ -134,6 +140,12 @@ private:
         std::unique_ptr<llvm::TargetMachine> _target_machine;
     };
 
+    // Second-level persistent object cache behind the in-memory LRU, enabled by
+    // config::jit_object_cache_dir. Files are named by a hash of the expression
+    // fingerprint, which is also embedded in the file and verified on load.
+    static StatusOr<std::unique_ptr<llvm::MemoryBuffer>> _load_object_from_disk(const std::string& expr_name);
+    static void _store_object_to_disk(const std::string& expr_name, const llvm::MemoryBuffer& obj);
+
     bool _initialized = false;
     bool _support_jit = false;
     Cache* _func_cache;
@@ -647,6 +647,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_exists(FunctionContext* context, c
         ColumnBuilder<TYPE_BOOLEAN> result(rows);
 
         JsonPath stored_path;
+        vpack::Builder builder;
         for (int row = 0; row < rows; row++) {
             if (columns[0]->is_null(row)) {
                 result.append_null();
@@ -657,7 +658,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_exists(FunctionContext* context, c
                 continue;
             }
             JsonValue* json_value = json_viewer.value(row);
-            vpack::Builder builder;
+            builder.clear();
             vpack::Slice slice = JsonPath::extract(json_value, state->real_path, &builder);
             result.append(!slice.isNone());
         }
@@ -683,6 +684,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_exists(FunctionContext* context, c
     ColumnBuilder<TYPE_BOOLEAN> result(num_rows);
 
     JsonPath stored_path;
+    vpack::Builder builder;
     for (int row = 0; row < num_rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr || path_viewer.is_null(row)) {
             result.append_null();
@@ -699,7 +701,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_exists(FunctionContext* context, c
             continue;
         }
         VLOG(2) << "json_exists for  " << path_str << " of " << json_value->to_string().value();
-        vpack::Builder builder;
+        builder.clear();
         vpack::Slice slice = JsonPath::extract(json_value, *jsonpath.value(), &builder);
         result.append(!slice.isNone());
     }
@@ -834,6 +836,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_length(FunctionContext* context, c
         ColumnViewer<TYPE_JSON> json_viewer(flat_column);
 
         JsonPath stored_path;
+        vpack::Builder builder;
         for (size_t row = 0; row < rows; row++) {
             if (json_viewer.is_null(row)) {
                 result.append_null();
@@ -842,7 +845,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_length(FunctionContext* context, c
 
             JsonValue* json = json_viewer.value(row);
             vpack::Slice target_slice;
-            vpack::Builder builder;
+            builder.clear();
             target_slice = JsonPath::extract(json, state->real_path, &builder);
 
             if (target_slice.isObject() || target_slice.isArray()) {
@@ -894,6 +897,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_length(FunctionContext* context, c
     }
 
     JsonPath stored_path;
+    vpack::Builder builder;
     for (size_t row = 0; row < rows; row++) {
         if (json_column.is_null(row)) {
             result.append_null();
@@ -902,7 +906,6 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_length(FunctionContext* context, c
 
         JsonValue* json = json_column.value(row);
         vpack::Slice target_slice;
-        vpack::Builder builder;
         if (!path_viewer || path_viewer->value(row).empty()) {
             target_slice = json->to_vslice();
         } else {
@@ -913,6 +916,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_length(FunctionContext* context, c
                 continue;
             }
 
+            builder.clear();
             target_slice = JsonPath::extract(json, *jsonpath.value(), &builder);
         }
 
@@ -949,6 +953,7 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_keys_with_path(FunctionContext* co
         ColumnViewer<TYPE_JSON> json_viewer(flat_column);
         ColumnBuilder<TYPE_JSON> result(rows);
 
+        vpack::Builder extract_builder;
         for (size_t row = 0; row < rows; ++row) {
             if (columns[0]->is_null(row) || json_viewer.is_null(row)) {
                 result.append_null();
@@ -956,8 +961,8 @@ StatusOr<ColumnPtr> JsonFunctions::_flat_json_keys_with_path(FunctionContext* co
             }
 
             JsonValue* json = json_viewer.value(row);
-            vpack::Builder builder;
-            auto slice = JsonPath::extract(json, state->real_path, &builder);
+            extract_builder.clear();
+            auto slice = JsonPath::extract(json, state->real_path, &extract_builder);
 
             if (!slice.isObject()) {
                 result.append_null();
@@ -1011,6 +1016,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_keys_with_path(FunctionContext* co
     ColumnBuilder<TYPE_JSON> result(rows);
     ColumnViewer<TYPE_VARCHAR> path_viewer(columns[1]);
     JsonPath stored_path;
+    vpack::Builder extract_builder;
 
     for (size_t row = 0; row < rows; row++) {
         if (json_viewer.is_null(row) || json_viewer.value(row) == nullptr) {
@@ -1020,7 +1026,6 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_keys_with_path(FunctionContext* co
 
         JsonValue* json_value = json_viewer.value(row);
         vpack::Slice vslice;
-        vpack::Builder extract_builder;
         Slice path_str = path_viewer.value(row);
         auto jsonpath = get_prepared_or_parse(context, path_str, &stored_path);
         if (UNLIKELY(!jsonpath.ok())) {
@@ -1028,6 +1033,7 @@ StatusOr<ColumnPtr> JsonFunctions::_full_json_keys_with_path(FunctionContext* co
             continue;
         }
 
+        extract_builder.clear();
         vslice = JsonPath::extract(json_value, *jsonpath.value(), &extract_builder);
 
         if (!vslice.isObject()) {
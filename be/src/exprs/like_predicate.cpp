@@ -14,7 +14,10 @@
 
 #include "exprs/like_predicate.h"
 
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "exprs/binary_function.h"
 #include "glog/logging.h"
@@ -44,23 +47,50 @@ static const re2::RE2 LIKE_STARTS_WITH_RE(R"((((\\%)|(\\_)|([^%_]))+)(?:%+))", r
 static const re2::RE2 LIKE_EQUALS_RE(R"((((\\%)|(\\_)|([^%_]))+))", re2::RE2::Quiet);
 static const char* PROMPT_INFO = " so we switch to use re2.";
 
+// Compiling a hyperscan database is far more expensive than scanning a chunk with it, and
+// log-analytics workloads keep issuing the same handful of patterns, so compiled databases
+// are shared across queries. All callers compile with the same flags, so the converted regex
+// pattern alone is a sufficient key. When the cache is full an arbitrary entry is dropped:
+// in-flight predicates keep their database alive through the shared pointer.
+static constexpr size_t HS_DATABASE_CACHE_CAPACITY = 256;
+static std::mutex hs_database_cache_mutex;
+static std::unordered_map<std::string, HyperscanDatabasePtr> hs_database_cache;
+
 bool LikePredicate::hs_compile_and_alloc_scratch(const std::string& pattern, LikePredicateState* state,
                                                  FunctionContext* context, const Slice& slice) {
-    if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
-                   HS_MODE_BLOCK, nullptr, &state->database, &state->compile_err) != HS_SUCCESS) {
-        std::stringstream error;
-        error << "Invalid hyperscan expression: " << std::string(slice.data, slice.size) << ": "
-              << state->compile_err->message << PROMPT_INFO;
-        LOG(WARNING) << error.str().c_str();
-        hs_free_compile_error(state->compile_err);
-        return false;
+    {
+        std::lock_guard<std::mutex> l(hs_database_cache_mutex);
+        auto iter = hs_database_cache.find(pattern);
+        if (iter != hs_database_cache.end()) {
+            state->database = iter->second;
+        }
+    }
+
+    if (state->database == nullptr) {
+        hs_database_t* database = nullptr;
+        if (hs_compile(pattern.c_str(), HS_FLAG_ALLOWEMPTY | HS_FLAG_DOTALL | HS_FLAG_UTF8 | HS_FLAG_SINGLEMATCH,
+                       HS_MODE_BLOCK, nullptr, &database, &state->compile_err) != HS_SUCCESS) {
+            std::stringstream error;
+            error << "Invalid hyperscan expression: " << std::string(slice.data, slice.size) << ": "
+                  << state->compile_err->message << PROMPT_INFO;
+            LOG(WARNING) << error.str().c_str();
+            hs_free_compile_error(state->compile_err);
+            return false;
+        }
+        state->database = HyperscanDatabasePtr(database, [](hs_database_t* db) { hs_free_database(db); });
+
+        std::lock_guard<std::mutex> l(hs_database_cache_mutex);
+        if (hs_database_cache.size() >= HS_DATABASE_CACHE_CAPACITY) {
+            hs_database_cache.erase(hs_database_cache.begin());
+        }
+        hs_database_cache.emplace(pattern, state->database);
     }
 
-    if (hs_alloc_scratch(state->database, &state->scratch) != HS_SUCCESS) {
+    if (hs_alloc_scratch(state->database.get(), &state->scratch) != HS_SUCCESS) {
         std::stringstream error;
         error << "ERROR: Unable to allocate scratch space," << PROMPT_INFO;
         LOG(WARNING) << error.str().c_str();
-        hs_free_database(state->database);
+        state->database.reset();
         return false;
     }
 
@@ -93,6 +123,27 @@ Status LikePredicate::compile_with_hyperscan_or_re2(const std::string& pattern,
     return Status::OK();
 }
 
+// Returns the literal prefix of a LIKE pattern, i.e. the characters before the first unescaped
+// wildcard. Rows not starting with it cannot match, so they are rejected with a memcmp before the
+// hyperscan scan runs.
+static std::string extract_literal_prefix(const Slice& pattern, char escape_char) {
+    std::string prefix;
+    bool is_escaped = false;
+    for (int i = 0; i < pattern.size; ++i) {
+        char c = pattern.data[i];
+        if (!is_escaped && (c == '%' || c == '_')) {
+            break;
+        }
+        if (!is_escaped && c == escape_char) {
+            is_escaped = true;
+            continue;
+        }
+        prefix.append(1, c);
+        is_escaped = false;
+    }
+    return prefix;
+}
+
 // when pattern is one of (EQUALS | SUBSTRING | STARTS_WITH | ENDS_WITH) or variable value
 // we use Re2.
 // when pattern is a constant value except ((EQUALS | SUBSTRING | STARTS_WITH | ENDS_WITH) variable value)
@@ -139,6 +190,8 @@ Status LikePredicate::like_prepare(FunctionContext* context, FunctionContext::Fu
     } else {
         auto re_pattern = LikePredicate::template convert_like_pattern<true>(context, pattern);
         RETURN_IF_ERROR(compile_with_hyperscan_or_re2<true>(re_pattern, state, context, pattern));
+        // LIKE matches the whole value, so a literal prefix of the pattern pre-filters the rows.
+        state->literal_prefix = extract_literal_prefix(pattern, state->escape_char);
     }
 
     return Status::OK();
@@ -421,17 +474,24 @@ StatusOr<ColumnPtr> LikePredicate::_predicate_const_regex(FunctionContext* conte
         }
     });
 
+    const std::string& prefix = state->literal_prefix;
     for (int row = 0; row < value_viewer.size(); ++row) {
         if (value_viewer.is_null(row)) {
             result->append_null();
             continue;
         }
 
+        auto value = value_viewer.value(row);
+        if (!prefix.empty() && (value.size < prefix.size() || memcmp(value.data, prefix.data(), prefix.size()) != 0)) {
+            result->append(false);
+            continue;
+        }
+
         bool v = false;
-        auto value_size = value_viewer.value(row).size;
+        auto value_size = value.size;
         [[maybe_unused]] auto status = hs_scan(
                 // Use &_DUMMY_STRING_FOR_EMPTY_PATTERN instead of nullptr to avoid crash.
-                state->database, (value_size) ? value_viewer.value(row).data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
+                state->database.get(), (value_size) ? value.data : &_DUMMY_STRING_FOR_EMPTY_PATTERN,
                 value_size, 0, scratch,
                 [](unsigned int id, unsigned long long from, unsigned long long to, unsigned int flags,
                    void* ctx) -> int {
@@ -28,6 +28,10 @@
 
 namespace starrocks {
 
+// A compiled hyperscan database is immutable and scanning it is thread-safe (every caller clones
+// its own scratch space), so it can be shared between predicates and cached across queries.
+using HyperscanDatabasePtr = std::shared_ptr<hs_database_t>;
+
 class LikePredicate {
 public:
     // Like method
@@ -192,8 +196,14 @@ private:
 
         ColumnPtr _search_string_column;
 
-        // a pointer to the generated database that responsible for parsed expression.
-        hs_database_t* database = nullptr;
+        /// The literal prefix of a constant LIKE pattern, i.e. the characters before the first
+        /// unescaped wildcard. When non-empty, rows not starting with it are rejected with a
+        /// memcmp before the hyperscan scan runs.
+        std::string literal_prefix;
+
+        // the compiled database responsible for the parsed expression, shared with the
+        // process-wide pattern cache.
+        HyperscanDatabasePtr database = nullptr;
         // a type containing error details that is returned by the compile calls on failure.
         hs_compile_error_t* compile_err = nullptr;
         // A Hyperscan scratch space, Used to call hs_scan,
@@ -206,10 +216,6 @@ private:
             if (scratch != nullptr) {
                 hs_free_scratch(scratch);
             }
-
-            if (database != nullptr) {
-                hs_free_database(database);
-            }
         }
 
         void set_search_string(const std::string& search_string_arg) {
@@ -28,6 +28,7 @@
 #include "gen_cpp/PlanNodes_types.h"
 #include "gen_cpp/Types_types.h"
 #include "types/logical_type.h"
+#include "util/phmap/phmap.h"
 
 namespace starrocks {
 // 0x1. initial global runtime filter impl
@@ -459,6 +460,14 @@ public:
     using ContainerType = RunTimeProxyContainerType<Type>;
     using SelfType = RuntimeBloomFilter<Type>;
 
+    // When the build side produces few distinct values, the values are kept verbatim and probed
+    // against an exact set, which prunes better than the bloom filter because it has no false
+    // positives. Slice values are excluded so the filter never references build column memory,
+    // json values compare by pointer, and NaN breaks hash-set lookups for floating point values.
+    static constexpr bool support_exact_values =
+            !IsSlice<CppType> && !std::is_floating_point_v<CppType> && Type != TYPE_JSON;
+    static constexpr size_t kMaxExactValueNum = 4096;
+
     RuntimeBloomFilter() { _init_min_max(); }
     ~RuntimeBloomFilter() override = default;
 
@@ -488,6 +497,8 @@ public:
         }
 
         p->_always_true = true;
+        // a range-only filter carries no build values, so an (empty) exact set must not be probed.
+        p->_use_exact_values = false;
         return p;
     }
 
@@ -530,6 +541,15 @@ public:
             _bf.insert_hash(hash);
         }
 
+        if constexpr (support_exact_values) {
+            if (_use_exact_values) {
+                _exact_values.insert(value);
+                if (_exact_values.size() > kMaxExactValueNum) {
+                    _drop_exact_values();
+                }
+            }
+        }
+
         _min = std::min(value, _min);
         _max = std::max(value, _max);
     }
@@ -556,7 +576,9 @@ public:
     // this->max = std::max(other->max, this->max)
     void merge(const JoinRuntimeFilter* rf) override {
         JoinRuntimeFilter::merge(rf);
-        _merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
+        const auto* other = down_cast<const RuntimeBloomFilter*>(rf);
+        _merge_exact_values(other);
+        _merge_min_max(other);
     }
 
     // this->min = std::max(other->min, this->min)
@@ -570,6 +592,8 @@ public:
 
     void concat(JoinRuntimeFilter* rf) override {
         JoinRuntimeFilter::concat(rf);
+        // concatenated filters are probed per hash partition, which bypasses the exact set.
+        _drop_exact_values();
         _merge_min_max(down_cast<const RuntimeBloomFilter*>(rf));
     }
 
@@ -649,6 +673,8 @@ public:
     }
 
     size_t deserialize(int serialize_version, const uint8_t* data) override {
+        // the exact set is not part of the wire format, so a deserialized filter probes the bloom filter.
+        _drop_exact_values();
         size_t offset = 0;
         if (serialize_version == RF_VERSION) {
             RuntimeFilterSerializeType::PrimitiveType ltype = RuntimeFilterSerializeType::to_serialize_type(Type);
@@ -809,6 +835,27 @@ private:
         }
     }
 
+    void _merge_exact_values(const RuntimeBloomFilter* other) {
+        if constexpr (support_exact_values) {
+            if (!_use_exact_values) {
+                return;
+            }
+            if (!other->_use_exact_values) {
+                _drop_exact_values();
+                return;
+            }
+            _exact_values.insert(other->_exact_values.begin(), other->_exact_values.end());
+            if (_exact_values.size() > kMaxExactValueNum) {
+                _drop_exact_values();
+            }
+        }
+    }
+
+    void _drop_exact_values() {
+        _use_exact_values = false;
+        _exact_values = ExactValueSet();
+    }
+
     void _merge_min_max(const RuntimeBloomFilter* bf) {
         if (bf->_has_min_max) {
             _min = std::min(_min, bf->_min);
@@ -832,6 +879,11 @@ private:
     }
 
     bool _test_data(CppType value) const {
+        if constexpr (support_exact_values) {
+            if (_use_exact_values) {
+                return _exact_values.contains(value);
+            }
+        }
         DCHECK(_bf.can_use());
         size_t hash = compute_hash(value);
         return _bf.test_hash(hash);
@@ -925,6 +977,11 @@ private:
     }
 
 private:
+    struct DisabledExactValueSet {};
+    using ExactValueSet =
+            std::conditional_t<support_exact_values, phmap::flat_hash_set<CppType, StdHash<CppType>>,
+                               DisabledExactValueSet>;
+
     CppType _min;
     CppType _max;
     std::string _slice_min;
@@ -932,6 +989,8 @@ private:
     bool _has_min_max = true;
     bool _left_close_interval = true;
     bool _right_close_interval = true;
+    bool _use_exact_values = support_exact_values;
+    ExactValueSet _exact_values;
 };
 
 } // namespace starrocks
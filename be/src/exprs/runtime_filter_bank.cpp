@@ -733,6 +733,42 @@ void RuntimeFilterProbeDescriptor::set_shared_runtime_filter(const std::shared_p
     }
 }
 
+void RuntimeFilterProbeDescriptor::update_runtime_filter(const JoinRuntimeFilter* rf) {
+    if (rf == nullptr) {
+        return;
+    }
+    const JoinRuntimeFilter* old_value = _runtime_filter.load();
+    while (old_value == nullptr || (rf != old_value && rf->rf_version() > old_value->rf_version())) {
+        if (_runtime_filter.compare_exchange_strong(old_value, rf, std::memory_order_seq_cst,
+                                                    std::memory_order_seq_cst)) {
+            break;
+        }
+    }
+    if (_ready_timestamp == 0 && _latency_timer != nullptr) {
+        _ready_timestamp = UnixMillis();
+        _latency_timer->set((_ready_timestamp - _open_timestamp) * 1000);
+    }
+}
+
+void RuntimeFilterProbeDescriptor::update_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf) {
+    if (rf == nullptr) {
+        return;
+    }
+    std::shared_ptr<const JoinRuntimeFilter> old_value = std::atomic_load(&_shared_runtime_filter);
+    while (old_value == nullptr || (rf != old_value && rf->rf_version() > old_value->rf_version())) {
+        if (std::atomic_compare_exchange_strong(&_shared_runtime_filter, &old_value, rf)) {
+            if (old_value != nullptr) {
+                // probers may still be evaluating with the raw pointer of the replaced
+                // version, keep it alive for the lifetime of this descriptor.
+                std::lock_guard<std::mutex> l(_previous_filters_lock);
+                _previous_shared_runtime_filters.emplace_back(std::move(old_value));
+            }
+            update_runtime_filter(rf.get());
+            break;
+        }
+    }
+}
+
 // ========================================================
 template <LogicalType Type>
 class MinMaxPredicate : public Expr {
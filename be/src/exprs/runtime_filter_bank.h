@@ -189,6 +189,12 @@ public:
     }
     void set_runtime_filter(const JoinRuntimeFilter* rf);
     void set_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf);
+    // Versioned swap: install |rf| when no filter is installed yet, or when it carries a
+    // newer version (JoinRuntimeFilter::rf_version) than the installed one. This lets a
+    // publisher refine a filter incrementally and republish it without blocking probers,
+    // which keep reading a consistent snapshot through the atomic pointer.
+    void update_runtime_filter(const JoinRuntimeFilter* rf);
+    void update_shared_runtime_filter(const std::shared_ptr<const JoinRuntimeFilter>& rf);
 
 private:
     friend class HashJoinNode;
@@ -212,6 +218,10 @@ private:
 
     std::atomic<const JoinRuntimeFilter*> _runtime_filter = nullptr;
     std::shared_ptr<const JoinRuntimeFilter> _shared_runtime_filter = nullptr;
+    // Shared filters replaced by a newer version are kept alive here, because probers
+    // may still hold the raw pointer of an older version while evaluating a chunk.
+    std::mutex _previous_filters_lock;
+    std::vector<std::shared_ptr<const JoinRuntimeFilter>> _previous_shared_runtime_filters;
 };
 
 // RuntimeFilterProbeCollector::do_evaluate function apply runtime bloom filter to Operators to filter chunk.
@@ -1935,14 +1935,31 @@ static inline void vectorized_toggle_case(const Bytes* src, Bytes* dst) {
     char* begin = (char*)(src->data());
     char* end = (char*)(begin + size);
     char* src_ptr = begin;
-#if defined(__SSE2__)
+#if defined(__AVX2__)
+    static constexpr int AVX2_BYTES = sizeof(__m256i);
+    const char* avx2_end = begin + (size & ~(AVX2_BYTES - 1));
+    const auto avx2_a_minus1 = _mm256_set1_epi8(CA - 1);
+    const auto avx2_z_plus1 = _mm256_set1_epi8(CZ + 1);
+    const auto avx2_flips = _mm256_set1_epi8(32);
+
+    for (; src_ptr < avx2_end; src_ptr += AVX2_BYTES, dst_ptr += AVX2_BYTES) {
+        auto bytes = _mm256_loadu_si256((const __m256i*)src_ptr);
+        // the i-th byte of masks is set to 0xff if the corresponding byte is
+        // between a..z when computing upper function (A..Z when computing lower function),
+        // otherwise set to 0; bytes of a multi-byte utf8 character are >= 0x80, i.e. negative
+        // in signed comparison, so they never match and keep verbatim.
+        auto masks = _mm256_and_si256(_mm256_cmpgt_epi8(bytes, avx2_a_minus1), _mm256_cmpgt_epi8(avx2_z_plus1, bytes));
+        // only flip 5th bit of lowcase(uppercase) byte, other bytes keep verbatim.
+        _mm256_storeu_si256((__m256i*)dst_ptr, _mm256_xor_si256(bytes, _mm256_and_si256(masks, avx2_flips)));
+    }
+#elif defined(__SSE2__)
     static constexpr int SSE2_BYTES = sizeof(__m128i);
     const char* sse2_end = begin + (size & ~(SSE2_BYTES - 1));
     const auto a_minus1 = _mm_set1_epi8(CA - 1);
     const auto z_plus1 = _mm_set1_epi8(CZ + 1);
     const auto flips = _mm_set1_epi8(32);
 
-    for (; src_ptr > sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
+    for (; src_ptr < sse2_end; src_ptr += SSE2_BYTES, dst_ptr += SSE2_BYTES) {
         auto bytes = _mm_loadu_si128((const __m128i*)src_ptr);
         // the i-th byte of masks is set to 0xff if the corresponding byte is
         // between a..z when computing upper function (A..Z when computing lower function),
@@ -16,6 +16,7 @@
 
 #include "formats/utils.h"
 #include "output_stream_file.h"
+#include "output_stream_string.h"
 #include "runtime/current_thread.h"
 
 namespace starrocks::formats {
@@ -77,32 +78,95 @@ std::future<Status> CSVFileWriter::write(ChunkPtr chunk) {
         columns.push_back(maybe_column.value());
     }
 
-    for (size_t r = 0; r < chunk->num_rows(); r++) {
-        for (size_t c = 0; c < columns.size(); c++) {
-            csv::Converter* converter;
-            if (columns[c]->is_nullable()) {
-                converter = _column_converters[c].first.get();
-            } else {
-                converter = _column_converters[c].second.get();
-            }
+    // Encode on the calling thread, then hand the whole encoded buffer over to the executors so
+    // the fragment driver never blocks on the (possibly remote) file stream.
+    auto payload = std::make_shared<std::string>();
+    if (auto st = _encode_chunk(columns, chunk->num_rows(), payload.get()); !st.ok()) {
+        return make_ready_future(std::move(st));
+    }
 
-            if (auto st = converter->write_string(_output_stream.get(), *columns[c], r, {}); !st.ok()) {
-                return make_ready_future(std::move(st));
-            }
+    auto promise = std::make_shared<std::promise<Status>>();
+    std::future<Status> future = promise->get_future();
 
-            if (c != columns.size() - 1) {
-                if (auto st = _output_stream->write(_writer_options->column_terminated_by); !st.ok()) {
-                    return make_ready_future(std::move(st));
-                }
-            }
+    auto task = [output_stream = _output_stream, payload, p = promise, state = _runtime_state,
+                 execution_state = _execution_state] {
+#ifndef BE_TEST
+        SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
+        CurrentThread::current().set_query_id(state->query_id());
+        CurrentThread::current().set_fragment_instance_id(state->fragment_instance_id());
+#endif
+        p->set_value(output_stream->write(Slice(*payload)));
+
+        {
+            std::lock_guard lock(execution_state->mu);
+            execution_state->has_unfinished_task = false;
+            execution_state->cv.notify_one();
+        }
+    };
+
+    {
+        std::lock_guard lock(_execution_state->mu);
+        _execution_state->has_unfinished_task = true;
+    }
+
+    if (_executors) {
+        bool ok = _executors->try_offer(task);
+        if (!ok) {
+            Status exception = Status::ResourceBusy("submit write chunk task fails");
+            LOG(WARNING) << exception;
+            promise->set_value(exception);
+            std::lock_guard lock(_execution_state->mu);
+            _execution_state->has_unfinished_task = false;
         }
+    } else {
+        task();
+    }
+
+    return future;
+}
+
+Status CSVFileWriter::_encode_chunk(const std::vector<ColumnPtr>& columns, size_t num_rows, std::string* out) {
+    if (num_rows == 0 || columns.empty()) {
+        return Status::OK();
+    }
 
-        if (auto st = _output_stream->write(_writer_options->line_terminated_by); !st.ok()) {
-            return make_ready_future(std::move(st));
+    size_t num_cols = columns.size();
+    std::vector<std::unique_ptr<csv::OutputStreamString>> cell_streams;
+    std::vector<std::vector<size_t>> cell_ends(num_cols);
+    cell_streams.reserve(num_cols);
+    for (size_t c = 0; c < num_cols; c++) {
+        auto stream = std::make_unique<csv::OutputStreamString>();
+        csv::Converter* converter =
+                columns[c]->is_nullable() ? _column_converters[c].first.get() : _column_converters[c].second.get();
+        auto& ends = cell_ends[c];
+        ends.reserve(num_rows);
+        for (size_t r = 0; r < num_rows; r++) {
+            RETURN_IF_ERROR(converter->write_string(stream.get(), *columns[c], r, {}));
+            RETURN_IF_ERROR(stream->finalize());
+            ends.push_back(stream->as_string().size());
         }
+        cell_streams.push_back(std::move(stream));
     }
 
-    return make_ready_future(Status::OK());
+    size_t encoded_bytes = 0;
+    for (auto& stream : cell_streams) {
+        encoded_bytes += stream->as_string().size();
+    }
+    out->reserve(encoded_bytes + num_rows * ((num_cols - 1) * _writer_options->column_terminated_by.size() +
+                                             _writer_options->line_terminated_by.size()));
+
+    for (size_t r = 0; r < num_rows; r++) {
+        for (size_t c = 0; c < num_cols; c++) {
+            const std::string& cells = cell_streams[c]->as_string();
+            size_t begin = r == 0 ? 0 : cell_ends[c][r - 1];
+            out->append(cells.data() + begin, cell_ends[c][r] - begin);
+            if (c != num_cols - 1) {
+                out->append(_writer_options->column_terminated_by);
+            }
+        }
+        out->append(_writer_options->line_terminated_by);
+    }
+    return Status::OK();
 }
 
 std::future<FileWriter::CommitResult> CSVFileWriter::commit() {
@@ -110,12 +174,18 @@ std::future<FileWriter::CommitResult> CSVFileWriter::commit() {
     std::future<FileWriter::CommitResult> future = promise->get_future();
 
     auto task = [output_stream = _output_stream, p = promise, rollback = _rollback_action, row_counter = _num_rows,
-                 location = _location, state = _runtime_state] {
+                 location = _location, state = _runtime_state, execution_state = _execution_state] {
 #ifndef BE_TEST
         SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(state->instance_mem_tracker());
         CurrentThread::current().set_query_id(state->query_id());
         CurrentThread::current().set_fragment_instance_id(state->fragment_instance_id());
 #endif
+        {
+            // commit until all pending write tasks have been done
+            std::unique_lock lock(execution_state->mu);
+            execution_state->cv.wait(lock, [&]() { return !execution_state->has_unfinished_task; });
+        }
+
         FileWriter::CommitResult result{
                 .io_status = Status::OK(), .format = CSV, .location = location, .rollback_action = rollback};
 
@@ -172,6 +242,10 @@ Status CSVFileWriterFactory::init() {
     return Status::OK();
 }
 
+// A large stream buffer turns the per-chunk encoded writes into few big appends, which is what
+// the object storage multipart upload path underneath the writable file wants to see.
+constexpr size_t kOutputStreamBufferSize = 1024 * 1024;
+
 StatusOr<std::shared_ptr<FileWriter>> CSVFileWriterFactory::create(const std::string& path) const {
     ASSIGN_OR_RETURN(auto file, _fs->new_writable_file(path));
     auto rollback_action = [fs = _fs, path = path]() {
@@ -179,7 +253,7 @@ StatusOr<std::shared_ptr<FileWriter>> CSVFileWriterFactory::create(const std::st
     };
     auto column_evaluators = ColumnEvaluator::clone(_column_evaluators);
     auto types = ColumnEvaluator::types(_column_evaluators);
-    auto output_stream = std::make_unique<csv::OutputStreamFile>(std::move(file), 1024);
+    auto output_stream = std::make_unique<csv::OutputStreamFile>(std::move(file), kOutputStreamBufferSize);
     return std::make_shared<CSVFileWriter>(path, std::move(output_stream), _column_names, types,
                                            std::move(column_evaluators), _compression_type, _parsed_options,
                                            rollback_action, _executors, _runtime_state);
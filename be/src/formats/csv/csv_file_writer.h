@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+
 #include "formats/csv/converter.h"
 #include "formats/csv/output_stream.h"
 #include "formats/file_writer.h"
@@ -50,6 +53,11 @@ public:
     std::future<CommitResult> commit() override;
 
 private:
+    // Encode |columns| column by column: each converter runs over its whole column in one tight
+    // loop instead of being re-dispatched for every cell, then the pre-encoded cells are stitched
+    // into rows in |out|.
+    Status _encode_chunk(const std::vector<ColumnPtr>& columns, size_t num_rows, std::string* out);
+
     const std::string _location;
     std::shared_ptr<csv::OutputStream> _output_stream;
     const std::vector<std::string> _column_names;
@@ -64,6 +72,14 @@ private:
     int64_t _num_rows = 0;
     // (nullable converter, not-null converter)
     std::vector<std::pair<std::unique_ptr<csv::Converter>, std::unique_ptr<csv::Converter>>> _column_converters;
+
+    struct ExecutionState {
+        std::mutex mu;
+        std::condition_variable cv;
+        bool has_unfinished_task = false;
+    };
+
+    std::shared_ptr<ExecutionState> _execution_state = std::make_shared<ExecutionState>();
 };
 
 class CSVFileWriterFactory : public FileWriterFactory {
@@ -16,6 +16,8 @@
 
 #include <unordered_set>
 
+#include "simd/simd.h"
+
 namespace starrocks {
 
 using Field = Slice;
@@ -246,6 +248,16 @@ Status CSVReader::more_rows() {
         // 2. trimspace is enabled
         //    Remove the leading space before judging.
         case ENCLOSE:
+            // Enclosed content only reacts to the enclose and escape characters, row and
+            // column delimiters are plain data here, so the run up to the next of the two
+            // can be skipped in bulk.
+            _buff.skip(SIMD::find_any_of(_buff.position(), _buff.available(), _parse_options.enclose,
+                                         _parse_options.escape, _parse_options.enclose, _parse_options.escape));
+            if (UNLIKELY(_buff.available() < 1)) {
+                // Stay in ENCLOSE state and read more data.
+                break;
+            }
+
             // enclose character again, There are two possibilities:
             // 1. ENCLOSE state is over
             // 2. enclose to escape
@@ -311,6 +323,21 @@ Status CSVReader::more_rows() {
                 preState = ORDINARY;
             }
 
+            // Bulk-skip the run of bytes that cannot leave the ORDINARY state: anything
+            // other than the leading byte of the row/column delimiter, the escape and the
+            // enclose character, so long plain fields do not go through the state machine
+            // byte by byte.
+            _buff.skip(SIMD::find_any_of(_buff.position(), _buff.available(), _parse_options.row_delimiter[0],
+                                         _parse_options.column_delimiter[0], _parse_options.escape,
+                                         _parse_options.enclose));
+            if (UNLIKELY(_buff.available() < 1)) {
+                // The skipped run can only be empty when the buffer still has data, so at
+                // least one ordinary byte was consumed here; pin the state for the case
+                // this was reached by the fall through from ESCAPE, and read more data.
+                curState = ORDINARY;
+                break;
+            }
+
             // newrow
             if (UNLIKELY(is_row_delimiter(notGetLine))) {
                 curState = NEWROW;
@@ -555,17 +582,19 @@ void CSVReader::split_record(const Record& record, Fields* columns) const {
     const size_t size = record.size;
 
     if (_column_delimiter_length == 1) {
-        for (size_t i = 0; i < size; ++i, ++ptr) {
-            if (*ptr == _parse_options.column_delimiter[0]) {
-                if (_parse_options.trim_space) {
-                    std::pair<const char*, size_t> newPos = trim(value, ptr - value);
-                    columns->emplace_back(newPos.first, newPos.second);
-                } else {
-                    columns->emplace_back(value, ptr - value);
-                }
-                value = ptr + 1;
+        const char* const end = record.data + size;
+        // NOTE: memchr is much faster than scanning byte by byte.
+        while ((ptr = static_cast<const char*>(memchr(value, _parse_options.column_delimiter[0], end - value))) !=
+               nullptr) {
+            if (_parse_options.trim_space) {
+                std::pair<const char*, size_t> newPos = trim(value, ptr - value);
+                columns->emplace_back(newPos.first, newPos.second);
+            } else {
+                columns->emplace_back(value, ptr - value);
             }
+            value = ptr + 1;
         }
+        ptr = end;
     } else {
         const auto* const base = ptr;
 
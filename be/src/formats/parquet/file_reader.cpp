@@ -738,6 +738,34 @@ Status FileReader::_prepare_cur_row_group() {
         std::vector<io::SharedBufferedInputStream::IORange> ranges;
         int64_t end_offset = 0;
         r->collect_io_ranges(&ranges, &end_offset, ColumnIOType::PAGES);
+        if (_cur_row_group_idx == _lookahead_group_idx) {
+            // the leading ranges of this group were already registered together with
+            // the previous row group.
+            ranges.erase(std::remove_if(ranges.begin(), ranges.end(),
+                                        [this](const auto& range) { return range.offset < _lookahead_end_offset; }),
+                         ranges.end());
+        }
+        // register the leading io ranges of the next row group in the same call, up to
+        // the lookahead budget, so reads coalesce across the row-group boundary and
+        // the tail read of this group already fetches the head of the next one.
+        if (config::parquet_row_group_lookahead_bytes > 0 && _cur_row_group_idx + 1 < _row_group_size) {
+            std::vector<io::SharedBufferedInputStream::IORange> next_ranges;
+            int64_t next_end_offset = 0;
+            _row_group_readers[_cur_row_group_idx + 1]->collect_io_ranges(&next_ranges, &next_end_offset,
+                                                                          ColumnIOType::PAGES);
+            std::sort(next_ranges.begin(), next_ranges.end());
+            int64_t budget = config::parquet_row_group_lookahead_bytes;
+            size_t taken = 0;
+            while (taken < next_ranges.size() && next_ranges[taken].size <= budget) {
+                budget -= next_ranges[taken].size;
+                taken++;
+            }
+            if (taken > 0) {
+                _lookahead_group_idx = _cur_row_group_idx + 1;
+                _lookahead_end_offset = next_ranges[taken - 1].offset + next_ranges[taken - 1].size;
+                ranges.insert(ranges.end(), next_ranges.begin(), next_ranges.begin() + taken);
+            }
+        }
         int32_t counter = _scanner_ctx->lazy_column_coalesce_counter->load(std::memory_order_relaxed);
         if (counter >= 0 || !config::io_coalesce_adaptive_lazy_active) {
             _scanner_ctx->stats->group_active_lazy_coalesce_together += 1;
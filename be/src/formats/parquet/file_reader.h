@@ -141,6 +141,10 @@ private:
     std::vector<std::shared_ptr<GroupReader>> _row_group_readers;
     size_t _cur_row_group_idx = 0;
     size_t _row_group_size = 0;
+    // row group whose leading io ranges were registered ahead, together with the
+    // previous row group, and the file offset up to which they were registered.
+    size_t _lookahead_group_idx = static_cast<size_t>(-1);
+    int64_t _lookahead_end_offset = 0;
 
     size_t _total_row_count = 0;
     size_t _scan_row_count = 0;
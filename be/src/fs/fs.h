@@ -310,6 +310,12 @@ struct WritableFileOptions {
 
     bool direct_write = false;
 
+    // When positive and used together with direct_write, appends are staged in an internal
+    // aligned buffer of roughly this many bytes and issued to disk in aligned batches, so
+    // callers need not align their writes themselves. Only supported when writing a local
+    // file from the beginning.
+    uint32_t direct_write_buffer_size = 0;
+
     // See OpenMode for details.
     FileSystem::OpenMode mode = FileSystem::MUST_CREATE;
 };
@@ -16,6 +16,8 @@
 #include <unistd.h>
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <filesystem>
 #include <memory>
 
@@ -30,8 +32,10 @@
 #include "gutil/strings/util.h"
 #include "io/fd_input_stream.h"
 #include "io/io_profiler.h"
+#include "io/mmap_input_stream.h"
 #include "testutil/sync_point.h"
 #include "util/errno.h"
+#include "util/failpoint/fail_point.h"
 #include "util/slice.h"
 #include "util/stopwatch.hpp"
 
@@ -57,6 +61,8 @@ namespace starrocks {
 using std::string;
 using strings::Substitute;
 
+DEFINE_FAIL_POINT(posix_file_write_throttle);
+
 // Close file descriptor when object goes out of scope.
 class ScopedFdCloser {
 public:
@@ -211,6 +217,7 @@ public:
         watch.start();
         size_t bytes_written = 0;
         RETURN_IF_ERROR(do_writev_at(_fd, _filename, _filesize, data, cnt, &bytes_written));
+        FAIL_POINT_TRIGGER_THROTTLE(posix_file_write_throttle, bytes_written);
         _filesize += bytes_written;
         _pending_sync = true;
 #ifdef USE_STAROS
@@ -318,6 +325,178 @@ private:
     uint64_t _pre_allocated_size = 0;
 };
 
+// A WritableFile that stages appends in an aligned buffer and writes it out in large
+// aligned batches, so callers can stream arbitrary-sized appends to an O_DIRECT file
+// without caring about the alignment constraints of direct I/O. The file on disk may
+// temporarily carry zero padding up to the next alignment boundary; close() truncates
+// it back to the logical size. Only supports writing a file from the beginning.
+class PosixDirectBufferedWritableFile : public WritableFile {
+public:
+    // Logical block size direct I/O must be aligned to. 4KB covers both 512e and 4Kn disks.
+    static constexpr size_t kAlignment = 4096;
+
+    PosixDirectBufferedWritableFile(std::string filename, int fd, bool sync_on_close, size_t buffer_size)
+            : _filename(std::move(filename)), _fd(fd), _sync_on_close(sync_on_close) {
+        _buffer_capacity = std::max(buffer_size, kAlignment) / kAlignment * kAlignment;
+        int ret = posix_memalign(reinterpret_cast<void**>(&_buffer), kAlignment, _buffer_capacity);
+        CHECK_EQ(0, ret) << "posix_memalign failed: " << std::strerror(ret);
+        FileSystem::on_file_write_open(this);
+    }
+
+    ~PosixDirectBufferedWritableFile() override {
+        WARN_IF_ERROR(close(), "Failed to close file, file=" + _filename);
+        free(_buffer);
+    }
+
+    Status append(const Slice& data) override { return appendv(&data, 1); }
+
+    Status appendv(const Slice* data, size_t cnt) override {
+        MonotonicStopWatch watch;
+        watch.start();
+        size_t bytes_written = 0;
+        for (size_t i = 0; i < cnt; i++) {
+            const char* src = data[i].data;
+            size_t rem = data[i].size;
+            while (rem > 0) {
+                size_t n = std::min(rem, _buffer_capacity - _buffer_used);
+                memcpy(_buffer + _buffer_used, src, n);
+                _buffer_used += n;
+                src += n;
+                rem -= n;
+                if (_buffer_used == _buffer_capacity) {
+                    RETURN_IF_ERROR(_write_buffer(_buffer_capacity));
+                    _flushed_offset += _buffer_capacity;
+                    _buffer_used = 0;
+                }
+            }
+            bytes_written += data[i].size;
+        }
+        _filesize += bytes_written;
+        _pending_sync = true;
+        IOProfiler::add_write(bytes_written, watch.elapsed_time());
+        return Status::OK();
+    }
+
+    Status pre_allocate(uint64_t size) override {
+        uint64_t offset = std::max(_filesize, _pre_allocated_size);
+        int ret;
+        RETRY_ON_EINTR(ret, fallocate(_fd, 0, offset, size));
+        if (ret != 0) {
+            if (errno == EOPNOTSUPP) {
+                LOG(WARNING) << "The filesystem does not support fallocate().";
+            } else if (errno == ENOSYS) {
+                LOG(WARNING) << "The kernel does not implement fallocate().";
+            } else {
+                return io_error(_filename, errno);
+            }
+        }
+        _pre_allocated_size = offset + size;
+        return Status::OK();
+    }
+
+    Status close() override {
+        if (_closed) {
+            return Status::OK();
+        }
+        FileSystem::on_file_write_close(this);
+        Status s = _flush_tail();
+        uint64_t padded_end = _flushed_offset + (_buffer_used + kAlignment - 1) / kAlignment * kAlignment;
+        _buffer_used = 0;
+
+        // Drop the zero padding written by the last aligned batch and any unused
+        // pre-allocated space.
+        if (_filesize < std::max(padded_end, _pre_allocated_size)) {
+            int ret;
+            RETRY_ON_EINTR(ret, ftruncate(_fd, _filesize));
+            if (ret != 0 && s.ok()) {
+                s = io_error(_filename, errno);
+            }
+        }
+
+        if (_sync_on_close && _pending_sync) {
+            _pending_sync = false;
+            Status sync_status = do_sync(_fd, _filename);
+            if (!sync_status.ok()) {
+                LOG(ERROR) << "Unable to Sync " << _filename << ": " << sync_status.to_string();
+                if (s.ok()) {
+                    s = sync_status;
+                }
+            }
+        }
+
+        int ret;
+        RETRY_ON_EINTR(ret, ::close(_fd));
+        _closed = true;
+        if (ret < 0 && s.ok()) {
+            s = io_error(_filename, errno);
+        }
+        return s;
+    }
+
+    Status flush(FlushMode mode) override {
+        // Direct writes bypass the page cache, only the staged buffer tail may be unwritten.
+        if (mode == FLUSH_SYNC) {
+            return sync();
+        }
+        return Status::OK();
+    }
+
+    Status sync() override {
+        MonotonicStopWatch watch;
+        watch.start();
+        if (_pending_sync) {
+            _pending_sync = false;
+            RETURN_IF_ERROR(_flush_tail());
+            RETURN_IF_ERROR(do_sync(_fd, _filename));
+        }
+        IOProfiler::add_sync(watch.elapsed_time());
+        return Status::OK();
+    }
+
+    uint64_t size() const override { return _filesize; }
+    const string& filename() const override { return _filename; }
+
+private:
+    // Write the partially filled buffer as one aligned batch, with the bytes between the
+    // logical end and the next alignment boundary zeroed. Does not consume the buffer, so
+    // later appends rewrite the padded region in place.
+    Status _flush_tail() {
+        if (_buffer_used == 0) {
+            return Status::OK();
+        }
+        size_t aligned = (_buffer_used + kAlignment - 1) / kAlignment * kAlignment;
+        memset(_buffer + _buffer_used, 0, aligned - _buffer_used);
+        return _write_buffer(aligned);
+    }
+
+    Status _write_buffer(size_t n) {
+        size_t written = 0;
+        while (written < n) {
+            ssize_t w;
+            RETRY_ON_EINTR(w, pwrite(_fd, _buffer + written, n - written, _flushed_offset + written));
+            if (w < 0) {
+                return io_error(_filename, errno);
+            }
+            written += w;
+        }
+        return Status::OK();
+    }
+
+    std::string _filename;
+    int _fd;
+    const bool _sync_on_close = false;
+    bool _pending_sync = false;
+    bool _closed = false;
+    // logical bytes appended so far, i.e. the file size after close()
+    uint64_t _filesize = 0;
+    // file offset the next full buffer is written at, always a multiple of kAlignment
+    uint64_t _flushed_offset = 0;
+    uint64_t _pre_allocated_size = 0;
+    char* _buffer = nullptr;
+    size_t _buffer_capacity = 0;
+    size_t _buffer_used = 0;
+};
+
 class PosixFileSystem : public FileSystem {
 public:
     ~PosixFileSystem() override = default;
@@ -342,6 +521,21 @@ public:
 
     StatusOr<std::unique_ptr<RandomAccessFile>> new_random_access_file(const RandomAccessFileOptions& opts,
                                                                        const std::string& fname) override {
+        if (config::enable_mmap_segment_read && enable_fd_cache(fname)) {
+            int fd;
+            RETRY_ON_EINTR(fd, ::open(fname.c_str(), O_RDONLY));
+            if (fd < 0) {
+                return io_error(fname, errno);
+            }
+            // the mapping outlives the descriptor, close it right after mmap().
+            ScopedFdCloser fd_closer(fd);
+            auto stream = io::MmapInputStream::mmap_file(fd, fname);
+            if (stream.ok()) {
+                return std::make_unique<RandomAccessFile>(std::move(stream).value(), fname);
+            }
+            LOG(WARNING) << "Fail to mmap " << fname << ": " << stream.status() << ", fall back to buffered read";
+            // fall through to the buffered read paths below.
+        }
         if (config::file_descriptor_cache_capacity > 0 && enable_fd_cache(fname)) {
             FdCache::Handle* h = FdCache::Instance()->lookup(fname);
             if (h == nullptr) {
@@ -387,6 +581,14 @@ public:
         if (opts.mode == MUST_EXIST) {
             ASSIGN_OR_RETURN(file_size, get_file_size(fname));
         }
+        if (opts.direct_write && opts.direct_write_buffer_size > 0) {
+            if (file_size != 0) {
+                ::close(fd);
+                return Status::NotSupported("buffered direct write only supports writing a file from the beginning");
+            }
+            return std::make_unique<PosixDirectBufferedWritableFile>(fname, fd, opts.sync_on_close,
+                                                                     opts.direct_write_buffer_size);
+        }
         return std::make_unique<PosixWritableFile>(fname, fd, file_size, opts.sync_on_close);
     }
 
@@ -0,0 +1,106 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "http/action/failpoint_action.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/stringbuffer.h>
+
+#include "common/logging.h"
+#include "common/status.h"
+#include "gutil/strings/numbers.h"
+#include "gutil/strings/substitute.h"
+#include "http/http_channel.h"
+#include "http/http_headers.h"
+#include "http/http_request.h"
+#include "http/http_status.h"
+#include "util/failpoint/fail_point.h"
+
+namespace starrocks {
+
+const static std::string HEADER_JSON = "application/json";
+
+static Status update_failpoint(HttpRequest* req) {
+    const std::string& name = req->param("name");
+    if (name.empty()) {
+        return Status::InvalidArgument("missing parameter 'name'");
+    }
+    auto* fp = failpoint::FailPointRegistry::GetInstance()->get(name);
+    if (fp == nullptr) {
+        return Status::NotFound(strings::Substitute("failpoint $0 not found", name));
+    }
+
+    PFailPointTriggerMode trigger_mode;
+    const std::string& mode = req->param("mode");
+    if (mode.empty() || mode == "enable") {
+        trigger_mode.set_mode(FailPointTriggerModeType::ENABLE);
+    } else if (mode == "disable") {
+        trigger_mode.set_mode(FailPointTriggerModeType::DISABLE);
+    } else if (mode == "enable_n_times") {
+        int32 n_times = 0;
+        if (!safe_strto32(req->param("n_times").c_str(), &n_times)) {
+            return Status::InvalidArgument("mode enable_n_times requires an integer parameter 'n_times'");
+        }
+        trigger_mode.set_mode(FailPointTriggerModeType::ENABLE_N_TIMES);
+        trigger_mode.set_n_times(n_times);
+    } else if (mode == "probability_enable") {
+        double probability = 0;
+        if (!safe_strtod(req->param("probability").c_str(), &probability)) {
+            return Status::InvalidArgument("mode probability_enable requires a parameter 'probability'");
+        }
+        trigger_mode.set_mode(FailPointTriggerModeType::PROBABILITY_ENABLE);
+        trigger_mode.set_probability(probability);
+    } else {
+        return Status::InvalidArgument(strings::Substitute("unknown mode $0", mode));
+    }
+
+    if (!req->param("delay_ms").empty()) {
+        int64 delay_ms = 0;
+        if (!safe_strto64(req->param("delay_ms").c_str(), &delay_ms)) {
+            return Status::InvalidArgument("parameter 'delay_ms' must be an integer");
+        }
+        trigger_mode.set_delay_ms(delay_ms);
+    }
+    if (!req->param("bytes_per_second").empty()) {
+        int64 bytes_per_second = 0;
+        if (!safe_strto64(req->param("bytes_per_second").c_str(), &bytes_per_second)) {
+            return Status::InvalidArgument("parameter 'bytes_per_second' must be an integer");
+        }
+        trigger_mode.set_bytes_per_second(bytes_per_second);
+    }
+
+    fp->setMode(trigger_mode);
+    return Status::OK();
+}
+
+void FailPointAction::handle(HttpRequest* req) {
+    LOG(INFO) << req->debug_string();
+
+    Status s = update_failpoint(req);
+    std::string status(s.ok() ? "OK" : "BAD");
+    std::string msg(s.ok() ? "" : s.to_string());
+    rapidjson::Document root;
+    root.SetObject();
+    root.AddMember("status", rapidjson::Value(status.c_str(), status.size()), root.GetAllocator());
+    root.AddMember("msg", rapidjson::Value(msg.c_str(), msg.size()), root.GetAllocator());
+    rapidjson::StringBuffer strbuf;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(strbuf);
+    root.Accept(writer);
+
+    req->add_output_header(HttpHeaders::CONTENT_TYPE, HEADER_JSON.c_str());
+    HttpChannel::send_reply(req, HttpStatus::OK, strbuf.GetString());
+}
+
+} // namespace starrocks
@@ -0,0 +1,35 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "http/http_handler.h"
+
+namespace starrocks {
+
+// Update failpoint trigger modes at runtime, e.g. to inject latency into an RPC or throttle an
+// IO path while benchmarking:
+//   POST /api/fail_point?name=<failpoint>&mode=enable&delay_ms=50
+//   POST /api/fail_point?name=<failpoint>&mode=enable&bytes_per_second=104857600
+//   POST /api/fail_point?name=<failpoint>&mode=probability_enable&probability=0.1
+//   POST /api/fail_point?name=<failpoint>&mode=disable
+class FailPointAction : public HttpHandler {
+public:
+    FailPointAction() = default;
+    ~FailPointAction() override = default;
+
+    void handle(HttpRequest* req) override;
+};
+
+} // namespace starrocks
@@ -69,6 +69,8 @@ private:
 
     void _visit_simple_metric(const std::string& name, const MetricLabels& labels, Metric* metric);
 
+    void _visit_histogram_metric(const std::string& name, const MetricLabels& labels, HistogramMetric* metric);
+
     // Return true iff name ends with suffix output by LatencyRecorder.
     bool _dump_latency_recorder_suffix(const butil::StringPiece& name, const butil::StringPiece& desc);
 
@@ -127,6 +129,14 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
     } else {
         metric_name = prefix + "_" + name;
     }
+    if (collector->type() == MetricType::HISTOGRAM) {
+        // histograms are exported as precomputed quantiles, which in prometheus terms is a summary
+        _ss << "# TYPE " << metric_name << " summary\n";
+        for (auto& it : collector->metrics()) {
+            _visit_histogram_metric(metric_name, it.first, (HistogramMetric*)it.second);
+        }
+        return;
+    }
     // Output metric type
     _ss << "# TYPE " << metric_name << " " << collector->type() << "\n";
     switch (collector->type()) {
@@ -141,6 +151,30 @@ void PrometheusMetricsVisitor::visit(const std::string& prefix, const std::strin
     }
 }
 
+void PrometheusMetricsVisitor::_visit_histogram_metric(const std::string& name, const MetricLabels& labels,
+                                                       HistogramMetric* metric) {
+    std::string label_str;
+    if (!labels.empty()) {
+        std::stringstream ss;
+        int i = 0;
+        for (auto& label : labels.labels) {
+            if (i++ > 0) {
+                ss << ",";
+            }
+            ss << label.name << "=\"" << label.value << "\"";
+        }
+        label_str = ss.str();
+    }
+    const std::pair<double, const char*> quantiles[] = {{0.5, "0.5"}, {0.9, "0.9"}, {0.99, "0.99"}, {0.999, "0.999"}};
+    for (const auto& [q, repr] : quantiles) {
+        _ss << name << "{" << label_str << (label_str.empty() ? "" : ",") << "quantile=\"" << repr << "\"} "
+            << metric->quantile(q) << "\n";
+    }
+    std::string label_suffix = label_str.empty() ? "" : "{" + label_str + "}";
+    _ss << name << "_sum" << label_suffix << " " << metric->sum() << "\n";
+    _ss << name << "_count" << label_suffix << " " << metric->count() << "\n";
+}
+
 void PrometheusMetricsVisitor::_visit_simple_metric(const std::string& name, const MetricLabels& labels,
                                                     Metric* metric) {
     _ss << name;
@@ -295,6 +329,7 @@ void JsonMetricsVisitor::visit(const std::string& prefix, const std::string& nam
     switch (collector->type()) {
     case MetricType::COUNTER:
     case MetricType::GAUGE:
+    case MetricType::HISTOGRAM:
         for (auto& it : collector->metrics()) {
             const MetricLabels& labels = it.first;
             auto* metric = reinterpret_cast<Metric*>(it.second);
@@ -149,7 +149,10 @@ void IOProfileAction::handle(HttpRequest* req) {
     }
     topn = std::max(1, topn);
 
-    auto ret = IOProfiler::profile_and_get_topn_stats_str(req->param("mode"), seconds, topn);
+    // group=query attributes io to the query issuing it instead of the (tag, tablet) it touched
+    bool group_by_query = req->param("group") == "query";
+
+    auto ret = IOProfiler::profile_and_get_topn_stats_str(req->param("mode"), seconds, topn, group_by_query);
     HttpChannel::send_reply(req, ret);
 }
 
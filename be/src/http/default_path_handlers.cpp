@@ -233,7 +233,11 @@ void mem_usage_handler(MemTracker* mem_tracker, const WebPageHandler::ArgumentMa
     (*output) << "Memory tracking is not available with address sanitizer builds.";
 #else
     std::string buf;
-    je_malloc_stats_print(malloc_stats_write_cb, &buf, "a");
+    // Per-arena statistics are omitted by default ("a"); /memz?arenas=on includes them, which is
+    // useful for diagnosing dirty-page buildup or fragmentation in individual arenas.
+    auto iter = args.find("arenas");
+    const char* stats_opts = (iter != args.end() && iter->second == "on") ? "" : "a";
+    je_malloc_stats_print(malloc_stats_write_cb, &buf, stats_opts);
     boost::replace_all(buf, "\n", "<br>");
     (*output) << buf << "</pre>";
 #endif
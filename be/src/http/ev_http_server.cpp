@@ -40,6 +40,8 @@
 #include <event2/http.h>
 #include <event2/http_struct.h>
 #include <event2/keyvalq_struct.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
 
 #include <memory>
 #include <sstream>
@@ -211,6 +213,15 @@ Status EvHttpServer::_bind() {
         ss << "Failed to generate a non-blocking socket. error: " << errno_to_string(errno);
         return Status::InternalError(ss.str());
     }
+    // Disable Nagle's algorithm; accepted sockets inherit the option from the listening socket.
+    // Clients sending frequent small requests (e.g. stream load micro-batches) over a keep-alive
+    // connection wait for each reply before sending the next one, and with Nagle enabled the
+    // small reply can be held back until the client's previous segment is acknowledged.
+    int flag = 1;
+    res = setsockopt(_server_fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    if (res < 0) {
+        LOG(WARNING) << "Failed to set TCP_NODELAY on http server socket. error: " << errno_to_string(errno);
+    }
     return Status::OK();
 }
 
@@ -18,6 +18,7 @@
 
 #include <utility>
 
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "util/hash_util.hpp"
 #include "util/runtime_profile.h"
@@ -131,10 +132,14 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
     BlockBuffer block;
     ReadCacheOptions options;
     size_t read_size = 0;
+    // Materializing a whole block to serve a small read (a parquet footer or index
+    // page) pays a block-sized memcpy for a few kilobytes, so such reads fetch only
+    // the requested range from the cache directly into the caller's buffer.
+    const bool use_block_buffer = _enable_block_buffer && size >= config::datacache_block_buffer_min_read_size;
     {
         options.use_adaptor = _enable_cache_io_adaptor;
         SCOPED_RAW_TIMER(&read_cache_ns);
-        if (_enable_block_buffer) {
+        if (use_block_buffer) {
             res = _cache->read_buffer(_cache_key, block_offset, load_size, &block.buffer, &options);
             read_size = load_size;
         } else {
@@ -144,7 +149,7 @@ Status CacheInputStream::_read_block_from_local(const int64_t offset, const int6
         }
     }
     if (res.ok()) {
-        if (_enable_block_buffer) {
+        if (use_block_buffer) {
             block.buffer.copy_to(out, size, shift);
             block.offset = block_offset;
             _block_map[block_id] = block;
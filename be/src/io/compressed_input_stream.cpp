@@ -14,11 +14,41 @@
 
 #include "io/compressed_input_stream.h"
 
+#include "common/config.h"
+#include "common/logging.h"
 #include "gutil/strings/substitute.h"
 #include "util/compression/stream_compression.h"
+#include "util/threadpool.h"
 
 namespace starrocks::io {
 
+namespace {
+
+// Granularity of one background decode step and the amount of decoded data buffered ahead of
+// the consumer. One buffer per step keeps the lock hold times short; the window bound keeps a
+// fast decoder from racing arbitrarily far ahead of a slow parser.
+constexpr size_t kDecodeBlockSize = 1024 * 1024;
+constexpr size_t kDecodeAheadWindowSize = 8 * 1024 * 1024;
+
+// Shared pool running the decode-ahead tasks. One running task occupies a thread for the whole
+// lifetime of its stream, so a saturated pool rejects submission and the stream falls back to
+// decompressing inline, instead of queueing behind other streams.
+ThreadPool* decode_ahead_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        Status st = ThreadPoolBuilder("compressed_stream_decode")
+                            .set_min_threads(0)
+                            .set_max_threads(config::compressed_stream_decode_ahead_max_threads)
+                            .set_max_queue_size(0)
+                            .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "Failed to create compressed stream decode pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+} // namespace
+
 Status CompressedInputStream::CompressedBuffer::read_with_hint_size(InputStream* f, size_t hint_size) {
     if (_eof) return Status::EndOfFile("");
     hint_size = aligned_size(hint_size + MAX_BLOCK_HEADER_SIZE);
@@ -50,7 +80,87 @@ Status CompressedInputStream::CompressedBuffer::read_with_hint_size(InputStream*
     return Status::OK();
 }
 
+CompressedInputStream::~CompressedInputStream() {
+    if (_decode_ahead_started) {
+        std::unique_lock<std::mutex> l(_mutex);
+        _stop_decode = true;
+        _producer_cv.notify_all();
+        _consumer_cv.wait(l, [this]() { return _decode_exited; });
+    }
+}
+
 StatusOr<int64_t> CompressedInputStream::read(void* data, int64_t size) {
+    if (!_decode_ahead_started && !_try_start_decode_task()) {
+        return _read_serial(data, size);
+    }
+
+    std::unique_lock<std::mutex> l(_mutex);
+    _consumer_cv.wait(l, [this]() { return !_decoded_buffers.empty() || _decode_done; });
+    if (_decoded_buffers.empty()) {
+        RETURN_IF_ERROR(_decode_status);
+        return 0;
+    }
+    auto& front = _decoded_buffers.front();
+    size_t n = std::min<size_t>(size, front.size() - _front_consumed);
+    memcpy(data, front.data() + _front_consumed, n);
+    _front_consumed += n;
+    _decoded_bytes -= n;
+    if (_front_consumed == front.size()) {
+        _decoded_buffers.pop_front();
+        _front_consumed = 0;
+    }
+    _producer_cv.notify_one();
+    return n;
+}
+
+bool CompressedInputStream::_try_start_decode_task() {
+    if (_decode_ahead_unavailable) return false;
+    if (!config::enable_compressed_stream_decode_ahead) {
+        _decode_ahead_unavailable = true;
+        return false;
+    }
+    ThreadPool* pool = decode_ahead_pool();
+    if (pool == nullptr || !pool->submit_func([this]() { _decode_loop(); }).ok()) {
+        // stay on the serial path for the whole stream, mixing the two paths would
+        // interleave decoded data out of order.
+        _decode_ahead_unavailable = true;
+        return false;
+    }
+    _decode_ahead_started = true;
+    return true;
+}
+
+void CompressedInputStream::_decode_loop() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> l(_mutex);
+            _producer_cv.wait(l, [this]() { return _stop_decode || _decoded_bytes < kDecodeAheadWindowSize; });
+            if (_stop_decode) break;
+        }
+        raw::RawVector<uint8_t> buff;
+        buff.resize(kDecodeBlockSize);
+        auto res = _read_serial(buff.data(), buff.size());
+
+        std::lock_guard<std::mutex> l(_mutex);
+        if (!res.ok()) {
+            _decode_status = res.status();
+            _decode_done = true;
+        } else if (*res == 0) {
+            _decode_done = true;
+        } else {
+            buff.resize(*res);
+            _decoded_bytes += *res;
+            _decoded_buffers.emplace_back(std::move(buff));
+        }
+        _consumer_cv.notify_all();
+        if (_decode_done) break;
+    }
+    std::lock_guard<std::mutex> l(_mutex);
+    _decode_exited = true;
+    _consumer_cv.notify_all();
+}
+
+StatusOr<int64_t> CompressedInputStream::_read_serial(void* data, int64_t size) {
     size_t output_len = size;
     size_t output_bytes = 0;
 
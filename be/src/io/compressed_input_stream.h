@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <utility>
 
 #include "common/status.h"
@@ -37,6 +40,8 @@ public:
               _decompressor(std::move(decompressor)),
               _compressed_buff(compressed_data_cache_size) {}
 
+    ~CompressedInputStream() override;
+
     StatusOr<int64_t> read(void* data, int64_t size) override;
 
     Status skip(int64_t n) override;
@@ -76,10 +81,34 @@ private:
         bool _eof = false;
     };
 
+    // The plain pull path: read compressed bytes from the source and decompress them into
+    // |data| on the calling thread.
+    StatusOr<int64_t> _read_serial(void* data, int64_t size);
+
+    // Decode-ahead: a background task runs _read_serial into a bounded queue of buffers so
+    // that source reads and decompression overlap with the consumer (e.g. CSV parsing).
+    // Returns false when the feature is disabled or no decode thread is available, in which
+    // case the stream stays on the serial path for its whole lifetime.
+    bool _try_start_decode_task();
+    void _decode_loop();
+
     std::shared_ptr<InputStream> _source_stream;
     std::shared_ptr<StreamCompression> _decompressor;
     CompressedBuffer _compressed_buff;
     bool _stream_end = false;
+
+    bool _decode_ahead_started = false;
+    bool _decode_ahead_unavailable = false;
+    std::mutex _mutex;
+    std::condition_variable _producer_cv;
+    std::condition_variable _consumer_cv;
+    std::deque<raw::RawVector<uint8_t>> _decoded_buffers;
+    size_t _decoded_bytes = 0;
+    size_t _front_consumed = 0;
+    Status _decode_status;
+    bool _decode_done = false;
+    bool _decode_exited = false;
+    bool _stop_decode = false;
 };
 
 class CompressedSeekableInputStream final : public SeekableInputStream {
@@ -14,10 +14,15 @@
 
 #include "io/fd_input_stream.h"
 
+#include <limits.h>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <vector>
+
 #include "common/logging.h"
 #include "gutil/macros.h"
 #include "io/io_error.h"
@@ -89,6 +94,44 @@ StatusOr<int64_t> FdInputStream::read(void* data, int64_t count) {
     return res;
 }
 
+StatusOr<int64_t> FdInputStream::readv_at(int64_t offset, const Slice* iov, size_t iovcnt) {
+    CHECK_IS_CLOSED(_is_closed);
+    MonotonicStopWatch watch;
+    watch.start();
+    std::vector<struct iovec> vecs(iovcnt);
+    for (size_t i = 0; i < iovcnt; ++i) {
+        vecs[i].iov_base = iov[i].data;
+        vecs[i].iov_len = iov[i].size;
+    }
+    int64_t total_read = 0;
+    size_t idx = 0;
+    while (idx < iovcnt) {
+        ssize_t res;
+        auto cnt = static_cast<int>(std::min<size_t>(iovcnt - idx, IOV_MAX));
+        RETRY_ON_EINTR(res, ::preadv(_fd, &vecs[idx], cnt, offset + total_read));
+        if (UNLIKELY(res < 0)) {
+            _errno = errno;
+            return io_error("preadv", _errno);
+        }
+        if (res == 0) {
+            break;
+        }
+        total_read += res;
+        // Skip the fully filled buffers and adjust the partially filled one, so that a short
+        // read (more buffers than IOV_MAX, signal, ...) resumes where it stopped.
+        while (idx < iovcnt && vecs[idx].iov_len <= static_cast<size_t>(res)) {
+            res -= vecs[idx].iov_len;
+            idx++;
+        }
+        if (idx < iovcnt && res > 0) {
+            vecs[idx].iov_base = static_cast<char*>(vecs[idx].iov_base) + res;
+            vecs[idx].iov_len -= res;
+        }
+    }
+    IOProfiler::add_read(total_read, watch.elapsed_time());
+    return total_read;
+}
+
 StatusOr<int64_t> FdInputStream::get_size() {
     CHECK_IS_CLOSED(_is_closed);
     struct stat st;
@@ -32,6 +32,8 @@ public:
 
     StatusOr<int64_t> read(void* data, int64_t count) override;
 
+    StatusOr<int64_t> readv_at(int64_t offset, const Slice* iov, size_t iovcnt) override;
+
     StatusOr<int64_t> get_size() override;
 
     StatusOr<int64_t> position() override { return _offset; }
@@ -19,6 +19,8 @@
 #include <unordered_set>
 
 #include "fmt/format.h"
+#include "runtime/current_thread.h"
+#include "util/uid_util.h"
 
 namespace starrocks {
 
@@ -103,8 +105,53 @@ public:
     size_t operator()(const IOStatEntry& entry) const { return std::hash<uint64_t>()(entry.id); }
 };
 
+// Per-query io statistics, aggregated across all tablets/threads a query touches,
+// so one slow disk can be attributed to the query saturating it
+struct QueryIOStatEntry {
+    UniqueId id;
+    mutable std::atomic<uint64_t> read_bytes{0};
+    mutable std::atomic<uint64_t> write_bytes{0};
+    mutable std::atomic<uint64_t> read_time_ns{0};
+    mutable std::atomic<uint64_t> write_time_ns{0};
+    mutable std::atomic<uint32_t> read_ops{0};
+    mutable std::atomic<uint32_t> write_ops{0};
+
+    QueryIOStatEntry(UniqueId id) : id(id) {}
+
+    bool operator==(const QueryIOStatEntry& other) const { return id == other.id; }
+
+    void add_read(uint64_t bytes, uint64_t latency_ns) const {
+        this->read_bytes.fetch_add(bytes);
+        this->read_time_ns.fetch_add(latency_ns);
+        this->read_ops.fetch_add(1);
+    }
+
+    void add_write(uint64_t bytes, uint64_t latency_ns) const {
+        this->write_bytes.fetch_add(bytes);
+        this->write_time_ns.fetch_add(latency_ns);
+        this->write_ops.fetch_add(1);
+    }
+
+    static std::string header_string() {
+        return fmt::format("{:>36} {:>16} {:>8} {:>12} {:>16} {:>8} {:>12}", "QueryId", "read_bytes", "ops",
+                           "read_ms", "write_bytes", "ops", "write_ms");
+    }
+
+    std::string to_string() const {
+        return fmt::format("{:>36} {:>16} {:>8} {:>12} {:>16} {:>8} {:>12}", id.to_string(), read_bytes.load(),
+                           read_ops.load(), read_time_ns.load() / 1000000, write_bytes.load(), write_ops.load(),
+                           write_time_ns.load() / 1000000);
+    }
+};
+
+class QueryIOStatEntryHash {
+public:
+    size_t operator()(const QueryIOStatEntry& entry) const { return std::hash<UniqueId>()(entry.id); }
+};
+
 static std::mutex _io_stats_mutex;
 static std::unordered_set<IOStatEntry, IOStatEntryHash> _io_stats;
+static std::unordered_set<QueryIOStatEntry, QueryIOStatEntryHash> _query_io_stats;
 
 bool IOProfiler::is_empty() {
     return _io_stats.empty();
@@ -119,11 +166,13 @@ void IOProfiler::reset() {
     {
         std::lock_guard<std::mutex> l(_io_stats_mutex);
         _io_stats.clear();
+        _query_io_stats.clear();
     }
     LOG(INFO) << "io profiler reset";
 }
 
 thread_local IOStatEntry* current_io_stat = nullptr;
+thread_local const QueryIOStatEntry* current_query_io_stat = nullptr;
 
 void IOProfiler::set_context(uint32_t tag, uint64_t tablet_id) {
     if (tablet_id == 0) {
@@ -136,6 +185,18 @@ void IOProfiler::set_context(uint32_t tag, uint64_t tablet_id) {
         it = _io_stats.emplace(key).first;
     }
     current_io_stat = const_cast<IOStatEntry*>(&(*it));
+    if (tag == TAG_QUERY) {
+        // also aggregate by the query this thread is executing, so saturated disks can be
+        // attributed to a query and not just a tablet
+        UniqueId query_id(CurrentThread::current().query_id());
+        if (!(query_id.hi == 0 && query_id.lo == 0)) {
+            auto qit = _query_io_stats.find(QueryIOStatEntry{query_id});
+            if (qit == _query_io_stats.end()) {
+                qit = _query_io_stats.emplace(query_id).first;
+            }
+            current_query_io_stat = &(*qit);
+        }
+    }
 }
 
 IOStatEntry* IOProfiler::get_context() {
@@ -153,22 +214,32 @@ IOProfiler::IOStat IOProfiler::get_context_io() {
 
 void IOProfiler::set_context(IOStatEntry* entry) {
     current_io_stat = entry;
+    if (entry == nullptr) {
+        current_query_io_stat = nullptr;
+    }
 }
 
 void IOProfiler::clear_context() {
     current_io_stat = nullptr;
+    current_query_io_stat = nullptr;
 }
 
-void IOProfiler::_add_context_read(int64_t bytes) {
+void IOProfiler::_add_context_read(int64_t bytes, int64_t latency_ns) {
     if (current_io_stat != nullptr) {
         current_io_stat->add_read(bytes);
     }
+    if (current_query_io_stat != nullptr) {
+        current_query_io_stat->add_read(bytes, latency_ns);
+    }
 }
 
-void IOProfiler::_add_context_write(int64_t bytes) {
+void IOProfiler::_add_context_write(int64_t bytes, int64_t latency_ns) {
     if (current_io_stat != nullptr) {
         current_io_stat->add_write(bytes);
     }
+    if (current_query_io_stat != nullptr) {
+        current_query_io_stat->add_write(bytes, latency_ns);
+    }
 }
 
 // Thread local IO statistics which accumulates all IO since the thread is started
@@ -273,7 +344,32 @@ StatusOr<std::vector<std::string>> IOProfiler::get_topn_total_stats(size_t n) {
                                       [](const IOStatEntry& e) { return e.read_bytes.load() + e.write_bytes.load(); });
 }
 
-std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode, int seconds, size_t topn) {
+StatusOr<std::vector<std::string>> IOProfiler::get_topn_query_stats(size_t n) {
+    std::vector<std::pair<uint64_t, const QueryIOStatEntry*>> stats;
+    std::lock_guard<std::mutex> l(_io_stats_mutex);
+    if (_context_io_mode.load() != IOMode::IOMODE_NONE) {
+        return Status::InternalError("io profiler still running");
+    }
+    stats.reserve(_query_io_stats.size());
+    for (auto& it : _query_io_stats) {
+        auto v = it.read_bytes.load() + it.write_bytes.load();
+        if (v > 0) {
+            stats.emplace_back(v, &it);
+        }
+    }
+    std::sort(stats.begin(), stats.end(), [](const auto& a, const auto& b) { return a.first > b.first; });
+    std::vector<std::string> result;
+    n = std::min(n, stats.size());
+    result.reserve(n + 1);
+    result.emplace_back(QueryIOStatEntry::header_string());
+    for (size_t i = 0; i < n; ++i) {
+        result.emplace_back(stats[i].second->to_string());
+    }
+    return result;
+}
+
+std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode, int seconds, size_t topn,
+                                                       bool group_by_query) {
     StatusOr<std::vector<std::string>> ret;
     if (mode == "read") {
         auto st = IOProfiler::start(IOProfiler::IOMODE_READ);
@@ -282,7 +378,8 @@ std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode,
         } else {
             sleep(seconds);
             IOProfiler::stop();
-            ret = IOProfiler::get_topn_read_stats(topn);
+            ret = group_by_query ? IOProfiler::get_topn_query_stats(topn)
+                                 : IOProfiler::get_topn_read_stats(topn);
         }
     } else if (mode == "write") {
         auto st = IOProfiler::start(IOProfiler::IOMODE_WRITE);
@@ -291,7 +388,8 @@ std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode,
         } else {
             sleep(seconds);
             IOProfiler::stop();
-            ret = IOProfiler::get_topn_write_stats(topn);
+            ret = group_by_query ? IOProfiler::get_topn_query_stats(topn)
+                                 : IOProfiler::get_topn_write_stats(topn);
         }
     } else {
         auto st = IOProfiler::start(IOProfiler::IOMODE_ALL);
@@ -300,7 +398,8 @@ std::string IOProfiler::profile_and_get_topn_stats_str(const std::string& mode,
         } else {
             sleep(seconds);
             IOProfiler::stop();
-            ret = IOProfiler::get_topn_total_stats(topn);
+            ret = group_by_query ? IOProfiler::get_topn_query_stats(topn)
+                                 : IOProfiler::get_topn_total_stats(topn);
         }
     }
 
@@ -110,14 +110,14 @@ public:
     static inline void add_read(int64_t bytes, int64_t latency_ns) {
         _add_tls_read(bytes, latency_ns);
         if (_context_io_mode & IOMode::IOMODE_READ) {
-            _add_context_read(bytes);
+            _add_context_read(bytes, latency_ns);
         }
     }
 
     static inline void add_write(int64_t bytes, int64_t latency_ns) {
         _add_tls_write(bytes, latency_ns);
         if (_context_io_mode & IOMode::IOMODE_WRITE) {
-            _add_context_write(bytes);
+            _add_context_write(bytes, latency_ns);
         }
     }
 
@@ -126,15 +126,18 @@ public:
     static StatusOr<std::vector<std::string>> get_topn_read_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_write_stats(size_t n);
     static StatusOr<std::vector<std::string>> get_topn_total_stats(size_t n);
+    static StatusOr<std::vector<std::string>> get_topn_query_stats(size_t n);
 
     /**
      * profile and get topn stats
      * @param mode read, write, all
      * @param seconds profile seconds
      * @param topn get topn stats
+     * @param group_by_query group stats by query id instead of (tag, tablet)
      * @return stats information as tabular format string
      */
-    static std::string profile_and_get_topn_stats_str(const std::string& mode, int seconds, size_t topn);
+    static std::string profile_and_get_topn_stats_str(const std::string& mode, int seconds, size_t topn,
+                                                      bool group_by_query = false);
 
 protected:
     static StatusOr<std::vector<std::string>> get_topn_stats(size_t n,
@@ -145,9 +148,10 @@ protected:
     static void _add_tls_write(int64_t bytes, int64_t latency_ns);
     static void _add_tls_sync(int64_t latency_ns);
 
-    // Update io statistics associated with a context, such as tag + tablet_id
-    static void _add_context_read(int64_t bytes);
-    static void _add_context_write(int64_t bytes);
+    // Update io statistics associated with a context, such as tag + tablet_id,
+    // and the per-query statistics when the context belongs to a query
+    static void _add_context_read(int64_t bytes, int64_t latency_ns);
+    static void _add_context_write(int64_t bytes, int64_t latency_ns);
 
     static std::atomic<uint32_t> _context_io_mode;
 };
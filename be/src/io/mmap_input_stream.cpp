@@ -0,0 +1,54 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "io/mmap_input_stream.h"
+
+#include <fmt/format.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "common/logging.h"
+
+namespace starrocks::io {
+
+StatusOr<std::shared_ptr<MmapInputStream>> MmapInputStream::mmap_file(int fd, const std::string& filename) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        return Status::IOError(fmt::format("fail to stat {}: {}", filename, std::strerror(errno)));
+    }
+    if (st.st_size == 0) {
+        // mmap() rejects zero-length mappings, serve EOF from an empty stream instead.
+        return std::make_shared<MmapInputStream>(nullptr, 0);
+    }
+    void* addr = ::mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    if (addr == MAP_FAILED) {
+        return Status::IOError(fmt::format("fail to mmap {}: {}", filename, std::strerror(errno)));
+    }
+    return std::make_shared<MmapInputStream>(addr, st.st_size);
+}
+
+MmapInputStream::MmapInputStream(void* addr, int64_t size)
+        : ArrayInputStream(addr, size), _addr(addr), _mapped_size(size) {}
+
+MmapInputStream::~MmapInputStream() {
+    if (_addr != nullptr) {
+        int r = ::munmap(_addr, _mapped_size);
+        PLOG_IF(WARNING, r != 0) << "Fail to munmap " << _addr;
+    }
+}
+
+} // namespace starrocks::io
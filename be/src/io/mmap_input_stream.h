@@ -0,0 +1,50 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "io/array_input_stream.h"
+
+namespace starrocks::io {
+
+// A RandomAccessFile backed by a read-only memory mapping of a local file.
+//
+// Reads are served straight from the kernel page cache without a pread() system call per
+// request, and peek() hands out a zero-copy view of the mapped bytes. The mapping is
+// established once at construction and released in the destructor; the file descriptor used
+// to create it may be closed as soon as the stream is constructed.
+class MmapInputStream final : public ArrayInputStream {
+public:
+    // Maps the whole content of |fd| and returns a stream over it, or an error if the mapping
+    // cannot be established (e.g. the file was truncated to zero length or mmap() failed).
+    static StatusOr<std::shared_ptr<MmapInputStream>> mmap_file(int fd, const std::string& filename);
+
+    MmapInputStream(void* addr, int64_t size);
+
+    ~MmapInputStream() override;
+
+    MmapInputStream(const MmapInputStream&) = delete;
+    MmapInputStream(MmapInputStream&&) = delete;
+    void operator=(const MmapInputStream&) = delete;
+    void operator=(MmapInputStream&&) = delete;
+
+private:
+    void* _addr;
+    int64_t _mapped_size;
+};
+
+} // namespace starrocks::io
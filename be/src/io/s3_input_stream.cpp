@@ -20,6 +20,16 @@
 #include <aws/s3/model/HeadObjectRequest.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "util/threadpool.h"
+
 #ifdef USE_STAROS
 #include "fslib/metric_key.h"
 #include "metrics/metrics.h"
@@ -27,6 +37,91 @@
 
 namespace starrocks::io {
 
+namespace {
+
+// Shared pool issuing hedged GetObject requests. Sized so that a saturated pool rejects
+// submission instead of queueing: a queued hedge would finish after the request it is
+// supposed to beat.
+ThreadPool* hedged_read_pool() {
+    static std::unique_ptr<ThreadPool> pool = []() {
+        std::unique_ptr<ThreadPool> p;
+        Status st = ThreadPoolBuilder("s3_hedged_read")
+                            .set_min_threads(0)
+                            .set_max_threads(config::object_storage_hedged_read_max_threads)
+                            .set_max_queue_size(0)
+                            .build(&p);
+        LOG_IF(WARNING, !st.ok()) << "Failed to create s3 hedged read pool: " << st;
+        return p;
+    }();
+    return pool.get();
+}
+
+// Sends `request` and, if no response has arrived within object_storage_hedged_read_threshold_ms,
+// sends a duplicate; the first successful response wins. The late response is dropped when it
+// eventually completes.
+Aws::S3::Model::GetObjectOutcome hedged_get_object(const std::shared_ptr<Aws::S3::S3Client>& client,
+                                                   const Aws::S3::Model::GetObjectRequest& request) {
+    ThreadPool* pool = hedged_read_pool();
+    if (pool == nullptr) {
+        return client->GetObject(request);
+    }
+
+    struct State {
+        std::mutex mtx;
+        std::condition_variable cv;
+        int pending = 0;
+        std::vector<Aws::S3::Model::GetObjectOutcome> outcomes;
+    };
+    auto state = std::make_shared<State>();
+
+    auto submit_get = [&]() -> Status {
+        {
+            std::lock_guard<std::mutex> l(state->mtx);
+            state->pending++;
+        }
+        Status st = pool->submit_func([state, client, request]() {
+            auto outcome = client->GetObject(request);
+            std::lock_guard<std::mutex> l(state->mtx);
+            state->outcomes.emplace_back(std::move(outcome));
+            state->pending--;
+            state->cv.notify_all();
+        });
+        if (!st.ok()) {
+            std::lock_guard<std::mutex> l(state->mtx);
+            state->pending--;
+        }
+        return st;
+    };
+
+    if (!submit_get().ok()) {
+        // The pool is saturated, fall back to a plain synchronous request.
+        return client->GetObject(request);
+    }
+
+    std::unique_lock<std::mutex> l(state->mtx);
+    auto won = [&]() {
+        return state->pending == 0 ||
+               std::any_of(state->outcomes.begin(), state->outcomes.end(),
+                           [](const auto& outcome) { return outcome.IsSuccess(); });
+    };
+    if (!state->cv.wait_for(l, std::chrono::milliseconds(config::object_storage_hedged_read_threshold_ms), won)) {
+        l.unlock();
+        // Best effort: if the hedge is rejected we just keep waiting for the first request.
+        (void)submit_get();
+        l.lock();
+    }
+    state->cv.wait(l, won);
+
+    for (auto& outcome : state->outcomes) {
+        if (outcome.IsSuccess()) {
+            return std::move(outcome);
+        }
+    }
+    return std::move(state->outcomes.front());
+}
+
+} // namespace
+
 inline Status make_error_status(const Aws::S3::S3Error& error) {
     return Status::IOError(fmt::format(
             "BE access S3 file failed, SdkResponseCode={}, SdkErrorType={}, SdkErrorMessage={}",
@@ -47,7 +142,9 @@ StatusOr<int64_t> S3InputStream::read(void* out, int64_t count) {
     request.SetKey(_object);
     request.SetRange(std::move(range));
 
-    Aws::S3::Model::GetObjectOutcome outcome = _s3client->GetObject(request);
+    Aws::S3::Model::GetObjectOutcome outcome = config::enable_object_storage_hedged_read
+                                                       ? hedged_get_object(_s3client, request)
+                                                       : _s3client->GetObject(request);
     if (outcome.IsSuccess()) {
         Aws::IOStream& body = outcome.GetResult().GetBody();
         body.read(static_cast<char*>(out), count);
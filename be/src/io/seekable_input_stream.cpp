@@ -30,6 +30,18 @@ Status SeekableInputStream::read_at_fully(int64_t offset, void* data, int64_t co
     return read_fully(data, count);
 }
 
+StatusOr<int64_t> SeekableInputStream::readv_at(int64_t offset, const Slice* iov, size_t iovcnt) {
+    int64_t total_read = 0;
+    for (size_t i = 0; i < iovcnt; ++i) {
+        ASSIGN_OR_RETURN(auto nread, read_at(offset + total_read, iov[i].data, iov[i].size));
+        total_read += nread;
+        if (nread < static_cast<int64_t>(iov[i].size)) {
+            break;
+        }
+    }
+    return total_read;
+}
+
 Status SeekableInputStream::skip(int64_t count) {
     ASSIGN_OR_RETURN(auto pos, position());
     return seek(pos + count);
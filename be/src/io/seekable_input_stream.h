@@ -15,6 +15,7 @@
 #pragma once
 
 #include "io/input_stream.h"
+#include "util/slice.h"
 
 namespace starrocks::io {
 
@@ -57,6 +58,15 @@ public:
     // ```
     virtual Status read_at_fully(int64_t offset, void* out, int64_t count);
 
+    // Reads a contiguous region starting at |offset| and scatters it into the |iovcnt| buffers
+    // described by |iov|, like preadv(2). Returns the number of bytes read, which is less than
+    // the summed buffer size only if the end of the stream is reached. The stream position after
+    // the call is unspecified.
+    //
+    // Default implementation calls read_at once per buffer; streams backed by a file descriptor
+    // override it with a single vectored system call.
+    virtual StatusOr<int64_t> readv_at(int64_t offset, const Slice* iov, size_t iovcnt);
+
     // Return the total file size in bytes, or error.
     virtual StatusOr<int64_t> get_size() = 0;
 
@@ -126,6 +136,10 @@ public:
         return _impl->read_at_fully(offset, out, count);
     }
 
+    StatusOr<int64_t> readv_at(int64_t offset, const Slice* iov, size_t iovcnt) override {
+        return _impl->readv_at(offset, iov, iovcnt);
+    }
+
     StatusOr<int64_t> get_size() override { return _impl->get_size(); }
 
     Status seek(int64_t offset) override { return _impl->seek(offset); }
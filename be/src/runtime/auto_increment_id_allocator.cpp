@@ -0,0 +1,173 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/auto_increment_id_allocator.h"
+
+#include <numeric>
+
+#include "common/config.h"
+#include "common/logging.h"
+#include "testutil/sync_point.h"
+#include "util/thread.h"
+
+namespace starrocks {
+
+AutoIncrementIdAllocator::AutoIncrementIdAllocator(LeaseFn lease_fn) : _lease_fn(std::move(lease_fn)) {
+    _refresh_thread = std::thread([this] { _refresh_thread_func(); });
+    Thread::set_thread_name(_refresh_thread, "auto_incr_lease");
+}
+
+AutoIncrementIdAllocator::~AutoIncrementIdAllocator() {
+    stop();
+}
+
+void AutoIncrementIdAllocator::stop() {
+    {
+        std::lock_guard<std::mutex> l(_refresh_lock);
+        if (_stopped) {
+            return;
+        }
+        _stopped = true;
+        _refresh_cv.notify_one();
+    }
+    if (_refresh_thread.joinable()) {
+        _refresh_thread.join();
+    }
+}
+
+Status AutoIncrementIdAllocator::allocate(int64_t table_id, size_t num_row, std::vector<int64_t>& ids) {
+    if (num_row == 0) {
+        return Status::OK();
+    }
+    DCHECK_EQ(num_row, ids.size());
+
+    std::shared_ptr<TableIdRange> table = _get_table(table_id);
+    TEST_SYNC_POINT_CALLBACK("AutoIncrementIdAllocator::allocate.1", table.get());
+
+    {
+        std::shared_lock<std::shared_mutex> rdlock(table->range_lock);
+        int64_t start = table->next.fetch_add(num_row, std::memory_order_relaxed);
+        int64_t limit = table->limit.load(std::memory_order_relaxed);
+        if (start + static_cast<int64_t>(num_row) <= limit) {
+            std::iota(ids.begin(), ids.end(), start);
+            if (limit - (start + static_cast<int64_t>(num_row)) < config::auto_increment_lease_rows / 4) {
+                _maybe_schedule_refresh(table.get(), table_id);
+            }
+            return Status::OK();
+        }
+        // The current range is exhausted. Any remainder skipped by the overshooting
+        // fetch-add stays unused, which only leaves a gap in the id space.
+    }
+    return _allocate_slow(table.get(), table_id, num_row, ids);
+}
+
+void AutoIncrementIdAllocator::remove_table(int64_t table_id) {
+    std::lock_guard<std::mutex> l(_table_map_lock);
+    _table_map.erase(table_id);
+}
+
+std::shared_ptr<AutoIncrementIdAllocator::TableIdRange> AutoIncrementIdAllocator::_get_table(int64_t table_id) {
+    std::lock_guard<std::mutex> l(_table_map_lock);
+    auto& table = _table_map[table_id];
+    if (table == nullptr) {
+        table = std::make_shared<TableIdRange>();
+    }
+    return table;
+}
+
+Status AutoIncrementIdAllocator::_allocate_slow(TableIdRange* table, int64_t table_id, size_t num_row,
+                                                std::vector<int64_t>& ids) {
+    std::unique_lock<std::shared_mutex> wrlock(table->range_lock);
+
+    auto ids_iter = ids.begin();
+    size_t remain = num_row;
+    while (remain > 0) {
+        int64_t next = table->next.load(std::memory_order_relaxed);
+        int64_t limit = table->limit.load(std::memory_order_relaxed);
+        if (next < limit) {
+            size_t take = std::min(remain, static_cast<size_t>(limit - next));
+            std::iota(ids_iter, ids_iter + take, next);
+            ids_iter += take;
+            remain -= take;
+            table->next.store(next + take, std::memory_order_relaxed);
+            continue;
+        }
+        if (table->standby_start < table->standby_limit) {
+            table->next.store(table->standby_start, std::memory_order_relaxed);
+            table->limit.store(table->standby_limit, std::memory_order_relaxed);
+            table->standby_start = 0;
+            table->standby_limit = 0;
+            continue;
+        }
+        // both ranges drained, the FE round trip is unavoidable
+        int64_t start = 0;
+        size_t allocated = 0;
+        size_t rows = std::max(remain, static_cast<size_t>(config::auto_increment_lease_rows));
+        RETURN_IF_ERROR(_lease_fn(table_id, rows, &start, &allocated));
+        table->next.store(start, std::memory_order_relaxed);
+        table->limit.store(start + allocated, std::memory_order_relaxed);
+    }
+    return Status::OK();
+}
+
+void AutoIncrementIdAllocator::_maybe_schedule_refresh(TableIdRange* table, int64_t table_id) {
+    if (table->refresh_inflight.exchange(true)) {
+        return;
+    }
+    std::lock_guard<std::mutex> l(_refresh_lock);
+    if (_stopped) {
+        return;
+    }
+    _refresh_queue.push_back(table_id);
+    _refresh_cv.notify_one();
+}
+
+void AutoIncrementIdAllocator::_refresh_thread_func() {
+    while (true) {
+        int64_t table_id;
+        {
+            std::unique_lock<std::mutex> l(_refresh_lock);
+            _refresh_cv.wait(l, [this] { return _stopped || !_refresh_queue.empty(); });
+            if (_stopped) {
+                return;
+            }
+            table_id = _refresh_queue.front();
+            _refresh_queue.pop_front();
+        }
+
+        std::shared_ptr<TableIdRange> table = _get_table(table_id);
+        bool need_lease;
+        {
+            std::unique_lock<std::shared_mutex> wrlock(table->range_lock);
+            need_lease = table->standby_start >= table->standby_limit;
+        }
+        if (need_lease) {
+            // lease outside the range lock so ingest keeps draining the current range
+            int64_t start = 0;
+            size_t allocated = 0;
+            auto st = _lease_fn(table_id, config::auto_increment_lease_rows, &start, &allocated);
+            if (st.ok()) {
+                std::unique_lock<std::shared_mutex> wrlock(table->range_lock);
+                table->standby_start = start;
+                table->standby_limit = start + allocated;
+            } else {
+                // exhaustion falls back to the synchronous lease in _allocate_slow
+                LOG(WARNING) << "background auto increment lease failed, table_id=" << table_id << ", status=" << st;
+            }
+        }
+        table->refresh_inflight.store(false);
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,96 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "common/status.h"
+
+namespace starrocks {
+
+// Hands out auto-increment ids for a table from id ranges leased from the FE.
+//
+// Ids inside the current leased range are allocated with an atomic fetch-add under a
+// shared lock, so concurrent ingest threads never serialize on a mutex or wait for an
+// RPC. When the current range drains below a low watermark a background thread leases
+// the next range ahead of time; the FE round trip only blocks ingest when a burst
+// consumes the standby range faster than it can be refreshed.
+class AutoIncrementIdAllocator {
+public:
+    // Performs the remote allocation. |*start| receives the first id of the newly
+    // leased range and |*allocated| its size, which may exceed |rows|.
+    using LeaseFn = std::function<Status(int64_t table_id, size_t rows, int64_t* start, size_t* allocated)>;
+
+    // Per-table id ranges. Public so tests can seed a range through a sync point.
+    struct TableIdRange {
+        // current range: ids in [next, limit) are free. A fetch-add on |next| under a
+        // shared lock on |range_lock| is the allocation fast path; |next| may overshoot
+        // |limit|, which only leaves a gap in the id space.
+        std::atomic<int64_t> next{0};
+        std::atomic<int64_t> limit{0};
+        // standby range leased ahead of time by the background thread, guarded by a
+        // unique lock on |range_lock|
+        int64_t standby_start = 0;
+        int64_t standby_limit = 0;
+        // keeps duplicated refresh requests out of the background queue
+        std::atomic<bool> refresh_inflight{false};
+        // taken shared to allocate from the current range, unique to switch ranges
+        std::shared_mutex range_lock;
+    };
+
+    explicit AutoIncrementIdAllocator(LeaseFn lease_fn);
+    ~AutoIncrementIdAllocator();
+
+    // Fill |ids| with |num_row| monotonically increasing ids of |table_id|.
+    Status allocate(int64_t table_id, size_t num_row, std::vector<int64_t>& ids);
+
+    // Drop the leased ranges of |table_id|, e.g. after the table is dropped.
+    void remove_table(int64_t table_id);
+
+    void stop();
+
+private:
+    std::shared_ptr<TableIdRange> _get_table(int64_t table_id);
+
+    // Take the unique lock to drain the remainder of the current range, switch to the
+    // standby range or, when both are empty, lease a new range synchronously.
+    Status _allocate_slow(TableIdRange* table, int64_t table_id, size_t num_row, std::vector<int64_t>& ids);
+
+    void _maybe_schedule_refresh(TableIdRange* table, int64_t table_id);
+
+    void _refresh_thread_func();
+
+    LeaseFn _lease_fn;
+
+    std::mutex _table_map_lock;
+    std::unordered_map<int64_t, std::shared_ptr<TableIdRange>> _table_map;
+
+    std::mutex _refresh_lock;
+    std::condition_variable _refresh_cv;
+    std::deque<int64_t> _refresh_queue;
+    bool _stopped = false;
+    std::thread _refresh_thread;
+};
+
+} // namespace starrocks
@@ -17,6 +17,7 @@
 #include <cstdint>
 #include <string>
 
+#include "common/config.h"
 #include "fmt/format.h"
 #include "gen_cpp/Types_types.h"
 #include "gutil/macros.h"
@@ -31,8 +32,9 @@
 #define SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker) \
     auto VARNAME_LINENUM(tracker_setter) = CurrentThreadMemTrackerSetter(mem_tracker)
 
-#define SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(operator) \
-    auto VARNAME_LINENUM(tracker_setter) = CurrentThreadOperatorMemTrackerSetter(operator->mem_tracker())
+#define SCOPED_THREAD_LOCAL_OPERATOR_MEM_TRACKER_SETTER(operator)                                          \
+    auto VARNAME_LINENUM(tracker_setter) = CurrentThreadOperatorMemTrackerSetter(operator->mem_tracker()); \
+    auto VARNAME_LINENUM(operator_id_setter) = CurrentThreadOperatorIdSetter(operator->get_plan_node_id())
 
 #define SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(check) \
     auto VARNAME_LINENUM(check_setter) = CurrentThreadCheckMemLimitSetter(check)
@@ -57,7 +59,9 @@ class CurrentThread {
 private:
     class MemCacheManager {
     public:
-        MemCacheManager(std::function<MemTracker*()>&& loader) : _loader(std::move(loader)) {}
+        MemCacheManager(std::function<MemTracker*()>&& loader)
+                : _loader(std::move(loader)),
+                  _batch_size(std::max<int64_t>(MIN_BATCH_SIZE, config::mem_tracker_consume_batch_bytes)) {}
         MemCacheManager(const MemCacheManager&) = delete;
         MemCacheManager(MemCacheManager&&) = delete;
 
@@ -66,7 +70,7 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (_cache_size >= BATCH_SIZE) {
+            if (_cache_size >= _batch_size) {
                 commit(false);
             }
         }
@@ -78,7 +82,7 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (cur_tracker != nullptr && _cache_size >= BATCH_SIZE) {
+            if (cur_tracker != nullptr && _cache_size >= _batch_size) {
                 MemTracker* limit_tracker = cur_tracker->try_consume(_cache_size);
                 if (LIKELY(limit_tracker == nullptr)) {
                     _cache_size = 0;
@@ -100,7 +104,7 @@ private:
             _cache_size += size;
             _allocated_cache_size += size;
             _total_consumed_bytes += size;
-            if (cur_tracker != nullptr && _cache_size >= BATCH_SIZE) {
+            if (cur_tracker != nullptr && _cache_size >= _batch_size) {
                 MemTracker* limit_tracker = cur_tracker->try_consume_with_limited(_cache_size);
                 if (LIKELY(limit_tracker == nullptr)) {
                     _cache_size = 0;
@@ -136,7 +140,7 @@ private:
         void release(int64_t size) {
             _cache_size -= size;
             _deallocated_cache_size += size;
-            if (_cache_size <= -BATCH_SIZE) {
+            if (_cache_size <= -_batch_size) {
                 commit(false);
             }
         }
@@ -178,9 +182,13 @@ private:
             return size;
         }
 
-        const static int64_t BATCH_SIZE = 2 * 1024 * 1024;
+        const static int64_t MIN_BATCH_SIZE = 16 * 1024;
 
         std::function<MemTracker*()> _loader;
+        // Number of bytes allocated or released locally before the batch is committed to the
+        // tracker chain. Read from config::mem_tracker_consume_batch_bytes when the thread
+        // starts, so a config change only affects threads created afterwards.
+        const int64_t _batch_size;
 
         int64_t _reserved_bytes = 0;
 
@@ -212,6 +220,11 @@ public:
     const starrocks::TUniqueId& fragment_instance_id() { return _fragment_instance_id; }
     void set_pipeline_driver_id(int32_t driver_id) { _driver_id = driver_id; }
     int32_t get_driver_id() const { return _driver_id; }
+    // plan node id of the operator this thread is executing, -1 when outside an operator.
+    // Together with the query id above it lets sampling tools (perf, BPF, debuggers)
+    // attribute CPU samples to (query, operator) by reading the TLS block.
+    void set_pipeline_operator_id(int32_t operator_id) { _operator_id = operator_id; }
+    int32_t get_operator_id() const { return _operator_id; }
 
     void set_custom_coredump_msg(const std::string& custom_coredump_msg) { _custom_coredump_msg = custom_coredump_msg; }
 
@@ -329,6 +342,7 @@ private:
     TUniqueId _fragment_instance_id;
     std::string _custom_coredump_msg{};
     int32_t _driver_id = 0;
+    int32_t _operator_id = -1;
     bool _is_catched = false;
     bool _check = true;
 };
@@ -389,6 +403,24 @@ private:
     bool _is_same;
 };
 
+class CurrentThreadOperatorIdSetter {
+public:
+    explicit CurrentThreadOperatorIdSetter(int32_t operator_id) {
+        _prev_operator_id = tls_thread_status.get_operator_id();
+        tls_thread_status.set_pipeline_operator_id(operator_id);
+    }
+
+    ~CurrentThreadOperatorIdSetter() { tls_thread_status.set_pipeline_operator_id(_prev_operator_id); }
+
+    CurrentThreadOperatorIdSetter(const CurrentThreadOperatorIdSetter&) = delete;
+    void operator=(const CurrentThreadOperatorIdSetter&) = delete;
+    CurrentThreadOperatorIdSetter(CurrentThreadOperatorIdSetter&&) = delete;
+    void operator=(CurrentThreadOperatorIdSetter&&) = delete;
+
+private:
+    int32_t _prev_operator_id;
+};
+
 class CurrentThreadCheckMemLimitSetter {
 public:
     explicit CurrentThreadCheckMemLimitSetter(bool check) {
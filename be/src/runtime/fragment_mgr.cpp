@@ -205,6 +205,7 @@ Status FragmentExecState::execute() {
     }
     StarRocksMetrics::instance()->fragment_requests_total.increment(1);
     StarRocksMetrics::instance()->fragment_request_duration_us.increment(duration_ns / 1000);
+    StarRocksMetrics::instance()->fragment_request_latency_us.observe(duration_ns / 1000);
     return Status::OK();
 }
 
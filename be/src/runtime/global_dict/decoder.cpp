@@ -15,6 +15,7 @@
 #include "runtime/global_dict/decoder.h"
 
 #include <utility>
+#include <vector>
 
 #include "column/array_column.h"
 #include "column/column_builder.h"
@@ -37,14 +38,41 @@ public:
     using DictColumnType = RunTimeColumnType<LowCardDictType>;
     using StringColumnType = RunTimeColumnType<TYPE_VARCHAR>;
 
-    GlobalDictDecoderBase(Dict dict) : _dict(std::move(dict)) {}
+    GlobalDictDecoderBase(Dict dict) : _dict(std::move(dict)) {
+        // dict codes are small bounded integers, so decoding uses a dense table
+        // indexed by code instead of a hash lookup per row. codes outside the dense
+        // range (if any) still go through the map.
+        for (const auto& [code, value] : _dict) {
+            if (code >= 0 && code < DICT_DECODE_MAX_SIZE) {
+                if (static_cast<size_t>(code) >= _dense_values.size()) {
+                    _dense_values.resize(code + 1);
+                    _dense_valid.resize(code + 1, 0);
+                }
+                _dense_values[code] = value;
+                _dense_valid[code] = 1;
+            }
+        }
+    }
 
     Status decode_string(Column* in, Column* out) override;
 
     Status decode_array(Column* in, Column* out) override;
 
 private:
+    using DictValue = typename Dict::mapped_type;
+
+    // Returns nullptr if the code is not covered by the dict.
+    const DictValue* _find_value(DictCppType code) const {
+        if (LIKELY(code >= 0 && static_cast<size_t>(code) < _dense_values.size())) {
+            return _dense_valid[code] ? &_dense_values[code] : nullptr;
+        }
+        auto iter = _dict.find(code);
+        return iter == _dict.end() ? nullptr : &iter->second;
+    }
+
     Dict _dict;
+    std::vector<DictValue> _dense_values;
+    std::vector<uint8_t> _dense_valid;
 };
 
 template <typename Dict>
@@ -104,11 +132,11 @@ Status GlobalDictDecoderBase<Dict>::decode_string(Column* in, Column* out) {
     // handle const columns
     if (in->is_constant()) {
         auto id = in->get(0).get<DictCppType>();
-        auto iter = _dict.find(id);
-        if (iter == _dict.end()) {
+        const DictValue* value = _find_value(id);
+        if (value == nullptr) {
             return Status::InternalError(fmt::format("Dict Decode failed, Dict can't take cover all key :{}", id));
         }
-        out->append_datum(Datum(iter->second));
+        out->append_datum(Datum(*value));
         out->assign(in->size(), 0);
         return Status::OK();
     }
@@ -118,11 +146,11 @@ Status GlobalDictDecoderBase<Dict>::decode_string(Column* in, Column* out) {
         auto column = down_cast<DictColumnType*>(in);
         for (size_t i = 0; i < in->size(); i++) {
             DictCppType key = column->get_data()[i];
-            auto iter = _dict.find(key);
-            if (iter == _dict.end()) {
+            const DictValue* value = _find_value(key);
+            if (value == nullptr) {
                 return Status::InternalError(fmt::format("Dict Decode failed, Dict can't take cover all key :{}", key));
             }
-            res_column->append(iter->second);
+            res_column->append(*value);
         }
         return Status::OK();
     }
@@ -138,11 +166,11 @@ Status GlobalDictDecoderBase<Dict>::decode_string(Column* in, Column* out) {
         if (column->null_column_data()[i] == 0) {
             res_column->null_column_data()[i] = 0;
             DictCppType key = data_column->get_data()[i];
-            auto iter = _dict.find(key);
-            if (iter == _dict.end()) {
+            const DictValue* value = _find_value(key);
+            if (value == nullptr) {
                 return Status::InternalError(fmt::format("Dict Decode failed, Dict can't take cover all key :{}", key));
             }
-            res_data_column->append(iter->second);
+            res_data_column->append(*value);
         } else {
             res_data_column->append_default();
             res_column->set_null(i);
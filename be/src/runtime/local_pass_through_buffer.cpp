@@ -46,6 +46,19 @@ public:
         _physical_bytes += physical_bytes;
         _total_bytes += physical_bytes;
     }
+    void append_owned_chunk(ChunkUniquePtr chunk, size_t chunk_size, int32_t driver_sequence) {
+        // The chunk is handed over without a copy, so transfer its bytes from the sender's
+        // MemTracker to the buffer, symmetrically to append_chunk.
+        int64_t physical_bytes = chunk->memory_usage();
+        CurrentThread::current().mem_release(physical_bytes);
+
+        std::unique_lock lock(_mutex);
+        _buffer.emplace_back(std::make_pair(std::move(chunk), driver_sequence));
+        _bytes.push_back(chunk_size);
+        _physical_bytes += physical_bytes;
+        _total_bytes += physical_bytes;
+    }
+
     void pull_chunks(ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
         std::unique_lock lock(_mutex);
         chunks->swap(_buffer);
@@ -128,6 +141,11 @@ void PassThroughContext::append_chunk(int sender_id, const Chunk* chunk, size_t
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->append_chunk(chunk, chunk_size, driver_sequence);
 }
+void PassThroughContext::append_owned_chunk(int sender_id, ChunkUniquePtr chunk, size_t chunk_size,
+                                            int32_t driver_sequence) {
+    PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
+    sender_channel->append_owned_chunk(std::move(chunk), chunk_size, driver_sequence);
+}
 void PassThroughContext::pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes) {
     PassThroughSenderChannel* sender_channel = _channel->get_or_create_sender_channel(sender_id);
     sender_channel->pull_chunks(chunks, bytes);
@@ -137,14 +155,22 @@ int64_t PassThroughContext::total_bytes() const {
     return _channel->get_total_bytes();
 }
 
+uint32_t PassThroughChunkBufferManager::_get_bucket(const TUniqueId& query_id) {
+    uint64_t hash = crc_hash_uint64(query_id.hi, CRC_HASH_SEED1);
+    hash = crc_hash_uint64(query_id.lo, hash);
+    return hash % BUCKET_NUM;
+}
+
 void PassThroughChunkBufferManager::open_fragment_instance(const TUniqueId& query_id) {
     VLOG_FILE << "PassThroughChunkBufferManager::open_fragment_instance, query_id = " << query_id;
     {
-        std::unique_lock lock(_mutex);
-        auto it = _query_id_to_buffer.find(query_id);
-        if (it == _query_id_to_buffer.end()) {
+        uint32_t bucket = _get_bucket(query_id);
+        std::unique_lock lock(_mutex[bucket]);
+        auto& buffer_map = _query_id_to_buffer[bucket];
+        auto it = buffer_map.find(query_id);
+        if (it == buffer_map.end()) {
             auto* buffer = new PassThroughChunkBuffer(query_id);
-            _query_id_to_buffer.emplace(std::make_pair(query_id, buffer));
+            buffer_map.emplace(std::make_pair(query_id, buffer));
         } else {
             it->second->ref();
         }
@@ -152,23 +178,28 @@ void PassThroughChunkBufferManager::open_fragment_instance(const TUniqueId& quer
 }
 
 void PassThroughChunkBufferManager::close() {
-    std::unique_lock lock(_mutex);
-    for (auto it = _query_id_to_buffer.begin(); it != _query_id_to_buffer.end();) {
-        delete it->second;
-        it = _query_id_to_buffer.erase(it);
+    for (uint32_t bucket = 0; bucket < BUCKET_NUM; bucket++) {
+        std::unique_lock lock(_mutex[bucket]);
+        auto& buffer_map = _query_id_to_buffer[bucket];
+        for (auto it = buffer_map.begin(); it != buffer_map.end();) {
+            delete it->second;
+            it = buffer_map.erase(it);
+        }
     }
 }
 
 void PassThroughChunkBufferManager::close_fragment_instance(const TUniqueId& query_id) {
     VLOG_FILE << "PassThroughChunkBufferManager::close_fragment_instance, query_id = " << query_id;
     {
-        std::unique_lock lock(_mutex);
-        auto it = _query_id_to_buffer.find(query_id);
-        if (it != _query_id_to_buffer.end()) {
+        uint32_t bucket = _get_bucket(query_id);
+        std::unique_lock lock(_mutex[bucket]);
+        auto& buffer_map = _query_id_to_buffer[bucket];
+        auto it = buffer_map.find(query_id);
+        if (it != buffer_map.end()) {
             int rc = it->second->unref();
             if (rc == 0) {
                 delete it->second;
-                _query_id_to_buffer.erase(it);
+                buffer_map.erase(it);
             }
         }
     }
@@ -176,9 +207,11 @@ void PassThroughChunkBufferManager::close_fragment_instance(const TUniqueId& que
 
 PassThroughChunkBuffer* PassThroughChunkBufferManager::get(const TUniqueId& query_id) {
     {
-        std::unique_lock lock(_mutex);
-        auto it = _query_id_to_buffer.find(query_id);
-        if (it == _query_id_to_buffer.end()) {
+        uint32_t bucket = _get_bucket(query_id);
+        std::shared_lock lock(_mutex[bucket]);
+        auto& buffer_map = _query_id_to_buffer[bucket];
+        auto it = buffer_map.find(query_id);
+        if (it == buffer_map.end()) {
             return nullptr;
         }
         return it->second;
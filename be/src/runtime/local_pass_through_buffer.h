@@ -14,6 +14,7 @@
 
 #pragma once
 #include <map>
+#include <shared_mutex>
 
 #include "column/column_hash.h"
 #include "column/vectorized_fwd.h"
@@ -61,6 +62,9 @@ public:
             : _chunk_buffer(chunk_buffer), _fragment_instance_id(fragment_instance_id), _node_id(node_id) {}
     void init();
     void append_chunk(int sender_id, const Chunk* chunk, size_t chunk_size, int32_t driver_sequence);
+    // Zero-copy variant: takes over the chunk instead of cloning it. Use it when the sender
+    // doesn't touch the chunk after the handoff.
+    void append_owned_chunk(int sender_id, ChunkUniquePtr chunk, size_t chunk_size, int32_t driver_sequence);
     void pull_chunks(int sender_id, ChunkUniquePtrVector* chunks, std::vector<size_t>* bytes);
     int64_t total_bytes() const;
 
@@ -84,8 +88,15 @@ public:
     void close();
 
 private:
-    std::mutex _mutex;
-    std::unordered_map<TUniqueId, PassThroughChunkBuffer*> _query_id_to_buffer;
+    // get() runs on every local pass-through transmit while open/close only happen at fragment
+    // boundaries, so the map is sharded and lookups take a shared lock, keeping concurrent
+    // senders of different queries (and of the same query) from serializing on one mutex.
+    static const uint32_t BUCKET_NUM = 127;
+
+    static uint32_t _get_bucket(const TUniqueId& query_id);
+
+    std::shared_mutex _mutex[BUCKET_NUM];
+    std::unordered_map<TUniqueId, PassThroughChunkBuffer*> _query_id_to_buffer[BUCKET_NUM];
 };
 
 } // namespace starrocks
@@ -16,6 +16,7 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <unordered_map>
@@ -449,10 +450,36 @@ void LocalTabletsChannel::_flush_stale_memtables() {
         }
     }
 
+    // When full mem usage, flushing every sizable memtable at once floods the flush executor
+    // with small segments and stalls all concurrent loads. Flush largest-memtable-first
+    // instead and stop once enough bytes are scheduled to get back under the high watermark.
+    int64_t bytes_to_flush = 0;
+    if (full_mem_usage) {
+        if (_mem_tracker->limit() > 0) {
+            bytes_to_flush = _mem_tracker->consumption() - _mem_tracker->limit() * 70 / 100;
+        }
+        if (auto* parent = _mem_tracker->parent(); parent != nullptr && parent->limit() > 0) {
+            bytes_to_flush = std::max(bytes_to_flush, parent->consumption() - parent->limit() * 70 / 100);
+        }
+    }
+
     int64_t now = butil::gettimeofday_s();
     int64_t total_flush_bytes = 0;
     int64_t total_flush_writer = 0;
     int64_t total_active_writer = 0;
+    std::vector<std::pair<int64_t, AsyncDeltaWriter*>> full_mem_candidates;
+    auto flush_writer = [&](int64_t tablet_id, AsyncDeltaWriter* writer) {
+        VLOG(1) << "Flush stale memtable tablet_id: " << tablet_id << " txn_id: " << _txn_id
+                << " partition_id: " << writer->partition_id() << " is_immutable: " << writer->is_immutable()
+                << " write_buffer_size: " << writer->write_buffer_size()
+                << " stale_time: " << now - writer->last_write_ts()
+                << " job_mem_usage: " << _mem_tracker->consumption() << " job_mem_limit: " << _mem_tracker->limit()
+                << " load_mem_usage: " << _mem_tracker->parent()->consumption()
+                << " load_mem_limit: " << _mem_tracker->parent()->limit();
+        total_flush_bytes += writer->write_buffer_size();
+        ++total_flush_writer;
+        writer->flush();
+    };
     for (auto& [tablet_id, writer] : _delta_writers) {
         bool need_flush = false;
         auto last_write_ts = writer->last_write_ts();
@@ -472,28 +499,30 @@ void LocalTabletsChannel::_flush_stale_memtables() {
                 if (high_mem_usage && now - last_write_ts > config::stale_memtable_flush_time_sec) {
                     need_flush = true;
                 }
-                // when full mem usage, flush all memtable which size is larger than 1/4 of write_buffer_size
-                if (full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
-                    need_flush = true;
+                // when full mem usage, memtables which size is larger than 1/4 of write_buffer_size
+                // are flush candidates, scheduled largest-first below
+                if (!need_flush && full_mem_usage && writer->write_buffer_size() > config::write_buffer_size / 4) {
+                    full_mem_candidates.emplace_back(tablet_id, writer.get());
                 }
             }
             // has write means active writer
             ++total_active_writer;
             if (need_flush) {
-                VLOG(1) << "Flush stale memtable tablet_id: " << tablet_id << " txn_id: " << _txn_id
-                        << " partition_id: " << writer->partition_id() << " is_immutable: " << writer->is_immutable()
-                        << " write_buffer_size: " << writer->write_buffer_size()
-                        << " stale_time: " << now - last_write_ts << " job_mem_usage: " << _mem_tracker->consumption()
-                        << " job_mem_limit: " << _mem_tracker->limit()
-                        << " load_mem_usage: " << _mem_tracker->parent()->consumption()
-                        << " load_mem_limit: " << _mem_tracker->parent()->limit();
-                total_flush_bytes += writer->write_buffer_size();
-                ++total_flush_writer;
-                writer->flush();
+                flush_writer(tablet_id, writer.get());
             }
         }
     }
 
+    std::sort(full_mem_candidates.begin(), full_mem_candidates.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second->write_buffer_size() > rhs.second->write_buffer_size();
+    });
+    for (auto& [tablet_id, writer] : full_mem_candidates) {
+        if (total_flush_bytes >= bytes_to_flush) {
+            break;
+        }
+        flush_writer(tablet_id, writer);
+    }
+
     if (total_flush_bytes > 0 || total_flush_writer > 0) {
         LOG(INFO) << "Flush stale memtable txn_id: " << _txn_id << " total_flush_bytes: " << total_flush_bytes
                   << " total_flush_writer: " << total_flush_writer << " total_active_writer: " << total_active_writer
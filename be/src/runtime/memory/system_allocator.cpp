@@ -44,14 +44,32 @@
 
 namespace starrocks {
 
-#define PAGE_SIZE (4 * 1024) // 4K
+#define PAGE_SIZE (4 * 1024)             // 4K
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024) // 2M
+
+// Ask the kernel to back large page-aligned chunks with transparent huge pages, which
+// cuts TLB misses for allocations that are scanned a lot, e.g. aggregate state extents.
+static void try_madvise_huge_pages(uint8_t* ptr, size_t length) {
+#ifdef MADV_HUGEPAGE
+    if (config::madvise_huge_pages && length >= HUGE_PAGE_SIZE) {
+        if (madvise(ptr, length, MADV_HUGEPAGE) != 0) {
+            PLOG(WARNING) << "fail to madvise(MADV_HUGEPAGE), length=" << length;
+        }
+    }
+#endif
+}
 
 uint8_t* SystemAllocator::allocate(MemTracker* mem_tracker, size_t length) {
+    uint8_t* ptr = nullptr;
     if (config::use_mmap_allocate_chunk) {
-        return allocate_via_mmap(mem_tracker, length);
+        ptr = allocate_via_mmap(mem_tracker, length);
     } else {
-        return allocate_via_malloc(length);
+        ptr = allocate_via_malloc(length);
+    }
+    if (ptr != nullptr) {
+        try_madvise_huge_pages(ptr, length);
     }
+    return ptr;
 }
 
 void SystemAllocator::free(MemTracker* mem_tracker, uint8_t* ptr, size_t length) {
@@ -147,9 +147,11 @@ StatusOr<TFetchDataResultPtr> MysqlResultWriter::_process_chunk(Chunk* chunk) {
                 }
                 result_column->put_mysql_row_buffer(_row_buffer, i, _is_binary_format);
             }
-            size_t len = _row_buffer->length();
-            _row_buffer->move_content(&result_rows[i]);
-            _row_buffer->reserve(len * 1.1);
+            // copy the row out with one exact-size allocation and keep the encode buffer
+            // (and its capacity) for the next row, instead of swapping the buffer into the
+            // result and re-allocating it once per row.
+            result_rows[i].assign(_row_buffer->data().data(), _row_buffer->length());
+            _row_buffer->reset();
         }
     }
     return result;
@@ -181,8 +183,7 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
         int current_rows = 0;
         SCOPED_TIMER(_convert_tuple_timer);
         auto result = std::make_unique<TFetchDataResult>();
-        auto& result_rows = result->result_batch.rows;
-        result_rows.resize(num_rows);
+        result->result_batch.rows.resize(num_rows);
 
         for (int i = 0; i < num_rows; ++i) {
             DCHECK_EQ(0, _row_buffer->length());
@@ -198,24 +199,26 @@ StatusOr<TFetchDataResultPtrs> MysqlResultWriter::process_chunk(Chunk* chunk) {
             size_t len = _row_buffer->length();
 
             if (UNLIKELY(current_bytes + len >= _max_row_buffer_size)) {
-                result_rows.resize(current_rows);
+                result->result_batch.rows.resize(current_rows);
                 results.emplace_back(std::move(result));
 
                 result = std::make_unique<TFetchDataResult>();
-                result_rows = result->result_batch.rows;
-                result_rows.resize(num_rows - i);
+                result->result_batch.rows.resize(num_rows - i);
 
                 current_bytes = 0;
                 current_rows = 0;
             }
-            _row_buffer->move_content(&result_rows[current_rows]);
-            _row_buffer->reserve(len * 1.1);
+            // copy the row out with one exact-size allocation and keep the encode buffer
+            // (and its capacity) for the next row, instead of swapping the buffer into the
+            // result and re-allocating it once per row.
+            result->result_batch.rows[current_rows].assign(_row_buffer->data().data(), len);
+            _row_buffer->reset();
 
             current_bytes += len;
             current_rows += 1;
         }
         if (current_rows > 0) {
-            result_rows.resize(current_rows);
+            result->result_batch.rows.resize(current_rows);
             results.emplace_back(std::move(result));
         }
         TRY_CATCH_ALLOC_SCOPE_END()
@@ -202,7 +202,7 @@ void RuntimeFilterPort::receive_runtime_filter(int32_t filter_id, const JoinRunt
     VLOG_FILE << "RuntimeFilterPort::receive_runtime_filter(local). filter_id = " << filter_id
               << ", filter_size = " << rf->size() << ", wait_list_size = " << wait_list.size();
     for (auto* rf_desc : wait_list) {
-        rf_desc->set_runtime_filter(rf);
+        rf_desc->update_runtime_filter(rf);
     }
 }
 
@@ -215,7 +215,7 @@ void RuntimeFilterPort::receive_shared_runtime_filter(int32_t filter_id,
               << ", filter_size = " << rf->size() << ", wait_list_size = " << wait_list.size()
               << ", can_use_bf = " << rf->can_use_bf();
     for (auto* rf_desc : wait_list) {
-        rf_desc->set_shared_runtime_filter(rf);
+        rf_desc->update_shared_runtime_filter(rf);
     }
 }
 RuntimeFilterMerger::RuntimeFilterMerger(ExecEnv* env, const UniqueId& query_id, const TQueryOptions& query_options,
@@ -768,7 +768,12 @@ void RuntimeFilterWorker::_process_send_broadcast_runtime_filter_event(
         return;
     }
 
-    auto passthrough_delivery = params.data().size() <= config::deliver_broadcast_rf_passthrough_bytes_limit;
+    // A star-shaped fan-out is only cheap when both the payload and the number of destinations are small; for a
+    // wide broadcast the sender would push the filter out in serial batches of inflight_num RPCs. Route wide
+    // broadcasts through the relay path instead, where receivers keep splitting their forward targets in two
+    // (see _receive_total_runtime_filter), so the filter spreads as a tree in O(log n) hops.
+    auto passthrough_delivery = params.data().size() <= config::deliver_broadcast_rf_passthrough_bytes_limit &&
+                                destinations.size() <= config::deliver_broadcast_rf_passthrough_inflight_num;
     if (passthrough_delivery) {
         _deliver_broadcast_runtime_filter_passthrough(std::move(params), std::move(destinations), timeout_ms,
                                                       rpc_http_min_size);
@@ -472,8 +472,12 @@ Status DataStreamRecvr::PipelineSenderQueue::get_chunk(Chunk** chunk, const int3
 
     if (item.chunk_ptr == nullptr) {
         ChunkUniquePtr chunk_ptr = std::make_unique<Chunk>();
-        faststring uncompressed_buffer;
-        RETURN_IF_ERROR(_deserialize_chunk(item.pchunk, chunk_ptr.get(), metrics, &uncompressed_buffer));
+        // Use the per-driver-sequence scratch buffer rather than a local one, so the decompression
+        // buffer is allocated once and recycled across chunks. Note that without pipeline level
+        // shuffle several drivers share queue index 0, so the scratch is indexed by driver sequence
+        // like the metrics above.
+        RETURN_IF_ERROR(_deserialize_chunk(item.pchunk, chunk_ptr.get(), metrics,
+                                           &_chunk_queue_states[driver_sequence].uncompressed_buffer));
         *chunk = chunk_ptr.release();
     } else {
         *chunk = item.chunk_ptr.release();
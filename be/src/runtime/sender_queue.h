@@ -18,8 +18,10 @@
 #include <utility>
 
 #include "column/vectorized_fwd.h"
+#include "common/compiler_util.h"
 #include "runtime/data_stream_recvr.h"
 #include "serde/protobuf_serde.h"
+#include "util/faststring.h"
 #include "util/moodycamel/concurrentqueue.h"
 #include "util/spinlock.h"
 
@@ -241,7 +243,10 @@ private:
     // it is only used when the order needs to be guaranteed
     std::unique_ptr<ChunkQueue::producer_token_t> _producer_token;
 
-    struct ChunkQueueState {
+    // Aligned to a cache line so that the states of adjacent driver sequences don't false-share:
+    // under pipeline-level shuffle each driver polls its own entry while sender threads update
+    // blocked_closure_num of others concurrently.
+    struct ALIGN_CACHE_LINE ChunkQueueState {
         // Record the number of blocked closure in the queue
         std::atomic_int32_t blocked_closure_num = 0;
         // Record whether the queue is in the unplug state.
@@ -249,6 +254,10 @@ private:
         // Otherwise, it will try to batch enough chunks to reduce the scheduling overhead.
         bool unpluging = false;
         std::atomic<bool> is_short_circuited = false;
+        // Scratch buffer for decompressing lazily deserialized chunks, reused across get_chunk
+        // calls to avoid one allocation per chunk. A driver sequence is consumed by a single
+        // driver, so accessing it without a lock is safe.
+        faststring uncompressed_buffer;
     };
     std::vector<ChunkQueueState> _chunk_queue_states;
 
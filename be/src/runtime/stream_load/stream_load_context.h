@@ -36,10 +36,12 @@
 
 #include <rapidjson/prettywriter.h>
 
+#include <algorithm>
 #include <cstdint>
 #include <future>
 #include <vector>
 
+#include "common/config.h"
 #include "common/status.h"
 #include "common/utils.h"
 #include "gen_cpp/BackendService_types.h"
@@ -268,7 +270,10 @@ public:
     int channel_id = -1;
 
     // buffer for reading data from ev_buffer
-    static constexpr size_t kDefaultBufferSize = 64 * 1024;
+    static constexpr size_t kMinBufferSize = 64 * 1024;
+    static size_t buffer_size() {
+        return std::max<size_t>(config::streaming_load_buffer_size, kMinBufferSize);
+    }
     // max buffer size for JSON format is 4GB.
     static constexpr int64_t kJSONMaxBufferSize = 4294967296;
     ByteBufferPtr buffer = nullptr;
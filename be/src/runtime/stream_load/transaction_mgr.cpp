@@ -26,6 +26,7 @@
 #include <rapidjson/prettywriter.h>
 #include <thrift/protocol/TDebugProtocol.h>
 
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/utils.h"
 #include "gen_cpp/FrontendService.h"
@@ -414,11 +415,26 @@ void TransactionMgr::_clean_stream_context() {
                 }
 
                 if ((now - ctx->last_active_ts) > ctx->idle_timeout_sec + interval && ctx->idle_timeout_sec > 0) {
-                    ctx->status = Status::Aborted(fmt::format("transaction is aborted by idle timeout."));
-                    auto st = _rollback_transaction(ctx);
-                    LOG(INFO) << "Abort transaction " << ctx->brief() << " since idle timeout "
-                              << ctx->idle_timeout_sec + interval << " last active ts " << ctx->last_active_ts
-                              << " status " << st;
+                    if (config::enable_transaction_stream_load_idle_commit && ctx->status.ok() &&
+                        ctx->receive_bytes > 0) {
+                        // group-commit style: seal what the transaction already received as one
+                        // rowset instead of discarding it, so clients can keep appending small
+                        // batches and let the idle timeout publish the batch.
+                        auto st = _commit_transaction(ctx, false);
+                        LOG(INFO) << "Commit transaction " << ctx->brief() << " since idle timeout "
+                                  << ctx->idle_timeout_sec + interval << " last active ts " << ctx->last_active_ts
+                                  << " status " << st;
+                        if (!st.ok()) {
+                            ctx->status = st;
+                            (void)_rollback_transaction(ctx);
+                        }
+                    } else {
+                        ctx->status = Status::Aborted(fmt::format("transaction is aborted by idle timeout."));
+                        auto st = _rollback_transaction(ctx);
+                        LOG(INFO) << "Abort transaction " << ctx->brief() << " since idle timeout "
+                                  << ctx->idle_timeout_sec + interval << " last active ts " << ctx->last_active_ts
+                                  << " status " << st;
+                    }
                 }
                 ctx->lock.unlock();
             }
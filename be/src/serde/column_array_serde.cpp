@@ -381,19 +381,40 @@ public:
 class NullableColumnSerde {
 public:
     static int64_t max_serialized_size(const NullableColumn& column, const int encode_level) {
-        return serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
+        // the null column is accounted for even when it may be skipped: the upper bound
+        // has to hold for columns with nulls too.
+        int64_t flag_size = EncodeContext::enable_encode_null(encode_level) ? sizeof(uint8_t) : 0;
+        return flag_size + serde::ColumnArraySerde::max_serialized_size(*column.null_column(), encode_level) +
                serde::ColumnArraySerde::max_serialized_size(*column.data_column(), encode_level);
     }
 
     static uint8_t* serialize(const NullableColumn& column, uint8_t* buff, const int encode_level) {
-        buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        if (EncodeContext::enable_encode_null(encode_level)) {
+            // columns without nulls skip the all-zeros null bytemap and only ship a flag.
+            const uint8_t has_null = column.has_null() ? 1 : 0;
+            *buff++ = has_null;
+            if (has_null) {
+                buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+            }
+        } else {
+            buff = serde::ColumnArraySerde::serialize(*column.null_column(), buff, false, encode_level);
+        }
         buff = serde::ColumnArraySerde::serialize(*column.data_column(), buff, false, encode_level);
         return buff;
     }
 
     static const uint8_t* deserialize(const uint8_t* buff, NullableColumn* column, const int encode_level) {
-        buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        bool null_skipped = false;
+        if (EncodeContext::enable_encode_null(encode_level)) {
+            null_skipped = (*buff++ == 0);
+        }
+        if (!null_skipped) {
+            buff = serde::ColumnArraySerde::deserialize(buff, column->null_column().get(), false, encode_level);
+        }
         buff = serde::ColumnArraySerde::deserialize(buff, column->data_column().get(), false, encode_level);
+        if (null_skipped) {
+            column->null_column()->get_data().assign(column->data_column()->size(), 0);
+        }
         column->update_has_null();
         return buff;
     }
@@ -121,10 +121,13 @@ void PInternalServiceImplBase<T>::transmit_chunk(google::protobuf::RpcController
     }
 }
 
+DEFINE_FAIL_POINT(transmit_chunk_delay);
+
 template <typename T>
 void PInternalServiceImplBase<T>::_transmit_chunk(google::protobuf::RpcController* cntl_base,
                                                   const PTransmitChunkParams* request, PTransmitChunkResult* response,
                                                   google::protobuf::Closure* done) {
+    FAIL_POINT_TRIGGER_SLEEP(transmit_chunk_delay);
     class WrapClosure : public google::protobuf::Closure {
     public:
         WrapClosure(google::protobuf::Closure* done, PTransmitChunkResult* response)
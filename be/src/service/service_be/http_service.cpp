@@ -40,6 +40,7 @@
 #include "http/action/compact_rocksdb_meta_action.h"
 #include "http/action/compaction_action.h"
 #include "http/action/datacache_action.h"
+#include "http/action/failpoint_action.h"
 #include "http/action/greplog_action.h"
 #include "http/action/health_action.h"
 #include "http/action/lake/dump_tablet_metadata_action.h"
@@ -246,6 +247,10 @@ Status HttpServiceBE::start() {
     _ev_http_server->register_handler(HttpMethod::POST, "/api/update_config", update_config_action);
     _http_handlers.emplace_back(update_config_action);
 
+    auto* failpoint_action = new FailPointAction();
+    _ev_http_server->register_handler(HttpMethod::POST, "/api/fail_point", failpoint_action);
+    _http_handlers.emplace_back(failpoint_action);
+
     auto* runtime_filter_cache_action = new RuntimeFilterCacheAction(_env);
     _ev_http_server->register_handler(HttpMethod::GET, "/api/runtime_filter_cache/{action}",
                                       runtime_filter_cache_action);
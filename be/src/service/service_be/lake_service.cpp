@@ -30,9 +30,12 @@
 #include "storage/lake/compaction_policy.h"
 #include "storage/lake/compaction_scheduler.h"
 #include "storage/lake/compaction_task.h"
+#include "storage/lake/rowset.h"
 #include "storage/lake/tablet.h"
+#include "storage/lake/tablet_manager.h"
 #include "storage/lake/transactions.h"
 #include "storage/lake/vacuum.h"
+#include "storage/lake/versioned_tablet.h"
 #include "testutil/sync_point.h"
 #include "util/countdown_latch.h"
 #include "util/defer_op.h"
@@ -703,6 +706,71 @@ void LakeServiceImpl::get_tablet_stats(::google::protobuf::RpcController* contro
     latch.wait();
 }
 
+void LakeServiceImpl::prefetch_tablet_meta(::google::protobuf::RpcController* controller,
+                                           const ::starrocks::PrefetchTabletMetaRequest* request,
+                                           ::starrocks::PrefetchTabletMetaResponse* response,
+                                           ::google::protobuf::Closure* done) {
+    brpc::ClosureGuard guard(done);
+    auto cntl = static_cast<brpc::Controller*>(controller);
+
+    if (request->tablet_infos_size() == 0) {
+        cntl->SetFailed("missing tablet_infos");
+        return;
+    }
+    auto thread_pool = get_tablet_stats_thread_pool(_env);
+    if (UNLIKELY(thread_pool == nullptr)) {
+        cntl->SetFailed("thread pool is null");
+        return;
+    }
+    auto max_pending = std::max(10, thread_pool->max_threads() * 2);
+    auto timeout_ms = request->has_timeout_ms() ? request->timeout_ms() : kDefaultTimeoutForPrefetchTabletMeta;
+    auto timeout_deadline = std::chrono::system_clock::now() + std::chrono::milliseconds(timeout_ms);
+    auto thread_pool_token = ConcurrencyLimitedThreadPoolToken(thread_pool, max_pending);
+    auto latch = BThreadCountDownLatch(request->tablet_infos_size());
+    bthread::Mutex response_mtx;
+    for (const auto& tablet_info : request->tablet_infos()) {
+        auto task = [&, tablet_info]() {
+            DeferOp defer([&] { latch.count_down(); });
+
+            int64_t tablet_id = tablet_info.tablet_id();
+            int64_t version = tablet_info.version();
+            if (std::chrono::system_clock::now() >= timeout_deadline) {
+                LOG(WARNING) << "Cancelled tablet meta prefetch task due to timeout exceeded. tablet_id: " << tablet_id
+                             << ", version: " << version;
+                return;
+            }
+
+            auto res = [&]() -> Status {
+                ASSIGN_OR_RETURN(auto tablet, _tablet_mgr->get_tablet(tablet_id, version));
+                // Load every segment once with the metadata cache enabled: the footer is
+                // parsed and the column readers are built here, so the scans that follow
+                // hit the metadata cache instead of the object store.
+                LakeIOOptions lake_io_opts{.fill_data_cache = false};
+                for (const auto& rowset : tablet.get_rowsets()) {
+                    std::vector<SegmentPtr> segments;
+                    RETURN_IF_ERROR(rowset->load_segments(&segments, lake_io_opts, /*fill_metadata_cache=*/true));
+                }
+                return Status::OK();
+            }();
+            if (!res.ok()) {
+                LOG(WARNING) << "Fail to prefetch tablet meta. tablet_id: " << tablet_id << ", version: " << version
+                             << ", error: " << res;
+                std::lock_guard l(response_mtx);
+                response->add_failed_tablets(tablet_id);
+            }
+        };
+        TEST_SYNC_POINT_CALLBACK("LakeServiceImpl::prefetch_tablet_meta:before_submit", nullptr);
+        if (auto st = thread_pool_token.submit_func(std::move(task), timeout_deadline); !st.ok()) {
+            LOG(WARNING) << "Fail to submit tablet meta prefetch task: " << st;
+            std::lock_guard l(response_mtx);
+            response->add_failed_tablets(tablet_info.tablet_id());
+            latch.count_down();
+        }
+    }
+
+    latch.wait();
+}
+
 void LakeServiceImpl::lock_tablet_metadata(::google::protobuf::RpcController* controller,
                                            const ::starrocks::LockTabletMetadataRequest* request,
                                            ::starrocks::LockTabletMetadataResponse* response,
@@ -56,6 +56,11 @@ public:
     void get_tablet_stats(::google::protobuf::RpcController* controller, const ::starrocks::TabletStatRequest* request,
                           ::starrocks::TabletStatResponse* response, ::google::protobuf::Closure* done) override;
 
+    void prefetch_tablet_meta(::google::protobuf::RpcController* controller,
+                              const ::starrocks::PrefetchTabletMetaRequest* request,
+                              ::starrocks::PrefetchTabletMetaResponse* response,
+                              ::google::protobuf::Closure* done) override;
+
     void publish_log_version(::google::protobuf::RpcController* controller,
                              const ::starrocks::PublishLogVersionRequest* request,
                              ::starrocks::PublishLogVersionResponse* response,
@@ -101,6 +106,7 @@ private:
 
 private:
     static constexpr int64_t kDefaultTimeoutForGetTabletStat = 5 * 60 * 1000L;  // 5 minutes
+    static constexpr int64_t kDefaultTimeoutForPrefetchTabletMeta = 5 * 60 * 1000L; // 5 minutes
     static constexpr int64_t kDefaultTimeoutForPublishVersion = 1 * 60 * 1000L; // 1 minute
 
     ExecEnv* _env;
@@ -207,4 +207,47 @@ inline uint64_t get_nibble_mask(uint8x16_t values) {
 
 #endif
 
+// Find the position of the first byte equal to any of the four given characters,
+// return |size| if none is found. Callers matching fewer than four characters may
+// repeat one of them; unlike memchr there is no single-call libc equivalent.
+inline size_t find_any_of(const char* data, size_t size, char c0, char c1, char c2, char c3) {
+    size_t i = 0;
+#ifdef __SSE2__
+    const __m128i v0 = _mm_set1_epi8(c0);
+    const __m128i v1 = _mm_set1_epi8(c1);
+    const __m128i v2 = _mm_set1_epi8(c2);
+    const __m128i v3 = _mm_set1_epi8(c3);
+    for (; i + 16 <= size; i += 16) {
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        __m128i eq = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(b, v0), _mm_cmpeq_epi8(b, v1)),
+                                  _mm_or_si128(_mm_cmpeq_epi8(b, v2), _mm_cmpeq_epi8(b, v3)));
+        int mask = _mm_movemask_epi8(eq);
+        if (mask != 0) {
+            return i + __builtin_ctz(mask);
+        }
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const uint8x16_t v0 = vdupq_n_u8(c0);
+    const uint8x16_t v1 = vdupq_n_u8(c1);
+    const uint8x16_t v2 = vdupq_n_u8(c2);
+    const uint8x16_t v3 = vdupq_n_u8(c3);
+    for (; i + 16 <= size; i += 16) {
+        uint8x16_t b = vld1q_u8(reinterpret_cast<const uint8_t*>(data + i));
+        uint8x16_t eq = vorrq_u8(vorrq_u8(vceqq_u8(b, v0), vceqq_u8(b, v1)),
+                                 vorrq_u8(vceqq_u8(b, v2), vceqq_u8(b, v3)));
+        uint64_t mask = get_nibble_mask(eq);
+        if (mask != 0) {
+            return i + (__builtin_ctzll(mask) >> 2);
+        }
+    }
+#endif
+    for (; i < size; ++i) {
+        char c = data[i];
+        if (c == c0 || c == c1 || c == c2 || c == c3) {
+            return i;
+        }
+    }
+    return size;
+}
+
 } // namespace SIMD
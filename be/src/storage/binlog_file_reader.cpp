@@ -14,9 +14,11 @@
 
 #include "storage/binlog_file_reader.h"
 
+#include "common/config.h"
 #include "fs/fs.h"
 #include "storage/binlog_file_writer.h"
 #include "storage/binlog_util.h"
+#include "storage/page_cache.h"
 #include "storage/rowset/page_io.h"
 #include "util/coding.h"
 #include "util/crc32c.h"
@@ -213,6 +215,27 @@ Status BinlogFileReader::_read_page_content(int page_index, PageHeaderPB* page_h
     int32_t compressed_size = page_header_pb->compressed_size();
     int32_t uncompressed_size = page_header_pb->uncompressed_size();
 
+    // Every subscriber of a tablet opens its own reader, so without sharing, the hot tail pages
+    // are read and decompressed once per subscriber. Serve the decompressed page content from
+    // the storage page cache so that concurrent subscribers pay the disk read only once.
+    StoragePageCache* cache = StoragePageCache::instance();
+    bool use_page_cache = cache != nullptr && !config::disable_storage_page_cache;
+    StoragePageCache::CacheKey cache_key(_file_path, _current_file_pos);
+    if (use_page_cache) {
+        PageCacheHandle cache_handle;
+        if (cache->lookup(cache_key, &cache_handle)) {
+            Slice cached_slice = cache_handle.data();
+            page_content_pb->Clear();
+            if (!page_content_pb->ParseFromArray(cached_slice.get_data(), cached_slice.get_size())) {
+                return Status::Corruption(strings::Substitute(
+                        "Bad binlog file page $0: failed to parse page content pb, page index $1", _file_path,
+                        page_index));
+            }
+            _current_file_pos += compressed_size;
+            return Status::OK();
+        }
+    }
+
     // TODO Refer to PageIO::read_and_decompress_page, but why allocate APPEND_OVERFLOW_MAX_SIZE
     // hold compressed page at first, reset to decompressed page later
     // Allocate APPEND_OVERFLOW_MAX_SIZE more bytes to make append_strings_overflow work
@@ -251,6 +274,13 @@ Status BinlogFileReader::_read_page_content(int page_index, PageHeaderPB* page_h
                 "Bad binlog file page $0: failed to parse page content pb, page index $1", _file_path, page_index));
     }
 
+    if (use_page_cache) {
+        // the cache takes ownership of the buffer, the handle keeps it alive for other readers
+        PageCacheHandle cache_handle;
+        cache->insert(cache_key, page_slice, &cache_handle, false);
+        page.release();
+    }
+
     return Status::OK();
 }
 
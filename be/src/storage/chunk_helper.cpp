@@ -22,6 +22,7 @@
 #include "column/schema.h"
 #include "column/struct_column.h"
 #include "column/type_traits.h"
+#include "common/config.h"
 #include "gutil/strings/fastmem.h"
 #include "runtime/current_thread.h"
 #include "runtime/descriptors.h"
@@ -31,6 +32,7 @@
 #include "storage/type_traits.h"
 #include "storage/type_utils.h"
 #include "storage/types.h"
+#include "util/hash_util.hpp"
 #include "util/metrics.h"
 #include "util/percentile_value.h"
 
@@ -476,6 +478,60 @@ void ChunkHelper::reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk
     original_chunk.swap_chunk(reordered_chunk);
 }
 
+namespace {
+
+uint64_t combine_slot_index(uint64_t fingerprint, SlotId slot_id, size_t index) {
+    uint64_t v = (static_cast<uint64_t>(static_cast<uint32_t>(slot_id)) << 32) | static_cast<uint32_t>(index);
+    // XOR keeps the fingerprint independent of the iteration order of the slot map,
+    // while staying sensitive to which column index every slot occupies.
+    return fingerprint ^ HashUtil::hash64(&v, sizeof(v), 0x5ca1ab1e);
+}
+
+} // namespace
+
+uint64_t ChunkRecycler::_layout_fingerprint(const std::vector<SlotDescriptor*>& slots) {
+    uint64_t fingerprint = slots.size();
+    for (size_t i = 0; i < slots.size(); i++) {
+        fingerprint = combine_slot_index(fingerprint, slots[i]->id(), i);
+    }
+    return fingerprint;
+}
+
+uint64_t ChunkRecycler::_layout_fingerprint(const Chunk& chunk) {
+    uint64_t fingerprint = chunk.num_columns();
+    for (const auto& [slot_id, index] : chunk.get_slot_id_to_index_map()) {
+        fingerprint = combine_slot_index(fingerprint, slot_id, index);
+    }
+    return fingerprint;
+}
+
+ChunkUniquePtr ChunkRecycler::acquire(const std::vector<SlotDescriptor*>& slots, size_t n) {
+    auto iter = _cache.find(_layout_fingerprint(slots));
+    if (iter != _cache.end() && !iter->second.empty()) {
+        ChunkUniquePtr chunk = std::move(iter->second.back());
+        iter->second.pop_back();
+        _cached_count--;
+        chunk->reserve(n);
+        return chunk;
+    }
+    return ChunkHelper::new_chunk(slots, n);
+}
+
+void ChunkRecycler::recycle(ChunkUniquePtr&& chunk) {
+    if (chunk == nullptr) {
+        return;
+    }
+    auto& cached = _cache[_layout_fingerprint(*chunk)];
+    if (cached.size() >= kMaxCachedPerLayout) {
+        return;
+    }
+    // reset() clears the rows but keeps the capacity of every column, which is
+    // exactly what later acquisitions want to inherit.
+    chunk->reset();
+    cached.emplace_back(std::move(chunk));
+    _cached_count++;
+}
+
 ChunkAccumulator::ChunkAccumulator(size_t desired_size) : _desired_size(desired_size) {}
 
 void ChunkAccumulator::set_desired_size(size_t desired_size) {
@@ -541,35 +597,61 @@ void ChunkAccumulator::finalize() {
 void ChunkPipelineAccumulator::push(const ChunkPtr& chunk) {
     chunk->check_or_die();
     DCHECK(_out_chunk == nullptr);
-    if (_in_chunk == nullptr) {
-        _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
-    } else if (_in_chunk->num_rows() + chunk->num_rows() > _max_size ||
-               _in_chunk->owner_info() != chunk->owner_info()) {
-        _out_chunk = std::move(_in_chunk);
-        _in_chunk = chunk;
-        _mem_usage = chunk->bytes_usage();
-    } else {
-        _in_chunk->append(*chunk);
-        _mem_usage += chunk->bytes_usage();
+    // The soft byte budget of one accumulated chunk: with wide rows the budget is reached before
+    // _max_size rows and the chunk is emitted early, so re-batching doesn't build chunks which
+    // blow the CPU caches. 0 disables the budget.
+    const size_t max_bytes = config::pipeline_chunk_accumulate_max_bytes;
+
+    // The chunk is only buffered here; the buffered segments are physically concatenated
+    // when a batch is emitted, with one exactly-sized allocation instead of growing the
+    // first segment chunk by chunk.
+    if (!_segments.empty() && (_segment_rows + chunk->num_rows() > _max_size ||
+                               (max_bytes > 0 && _mem_usage + chunk->bytes_usage() > max_bytes) ||
+                               _segments.front()->owner_info() != chunk->owner_info())) {
+        _out_chunk = _compact_segments();
+    }
+    _segment_rows += chunk->num_rows();
+    _mem_usage += chunk->bytes_usage();
+    _segments.emplace_back(chunk);
+
+    if (_out_chunk == nullptr && (_segment_rows >= _max_size * LOW_WATERMARK_ROWS_RATE ||
+                                  (max_bytes > 0 && _mem_usage >= max_bytes) || _mem_usage >= LOW_WATERMARK_BYTES ||
+                                  chunk->owner_info().is_last_chunk())) {
+        _out_chunk = _compact_segments();
     }
+}
 
-    if (_out_chunk == nullptr && (_in_chunk->num_rows() >= _max_size * LOW_WATERMARK_ROWS_RATE ||
-                                  _mem_usage >= LOW_WATERMARK_BYTES || _in_chunk->owner_info().is_last_chunk())) {
-        _out_chunk = std::move(_in_chunk);
-        _mem_usage = 0;
+ChunkPtr ChunkPipelineAccumulator::_compact_segments() {
+    DCHECK(!_segments.empty());
+    ChunkPtr merged;
+    if (_segments.size() == 1) {
+        merged = std::move(_segments.front());
+    } else {
+        merged = _segments.front()->clone_empty(_segment_rows);
+        // clone_empty() only clones the layout, carry over the per-chunk metadata the same
+        // way appending into the first segment used to.
+        merged->owner_info() = _segments.front()->owner_info();
+        merged->set_extra_data(_segments.front()->get_extra_data());
+        for (const auto& segment : _segments) {
+            merged->append(*segment);
+        }
     }
+    _segments.clear();
+    _segment_rows = 0;
+    _mem_usage = 0;
+    return merged;
 }
 
 void ChunkPipelineAccumulator::reset() {
     _in_chunk.reset();
     _out_chunk.reset();
+    _segments.clear();
+    _segment_rows = 0;
     _mem_usage = 0;
 }
 
 void ChunkPipelineAccumulator::finalize() {
     _finalized = true;
-    _mem_usage = 0;
 }
 
 void ChunkPipelineAccumulator::reset_state() {
@@ -579,13 +661,16 @@ void ChunkPipelineAccumulator::reset_state() {
 
 ChunkPtr& ChunkPipelineAccumulator::pull() {
     if (_finalized && _out_chunk == nullptr) {
+        if (_in_chunk == nullptr && !_segments.empty()) {
+            _in_chunk = _compact_segments();
+        }
         return _in_chunk;
     }
     return _out_chunk;
 }
 
 bool ChunkPipelineAccumulator::has_output() const {
-    return _out_chunk != nullptr || (_finalized && _in_chunk != nullptr);
+    return _out_chunk != nullptr || (_finalized && (_in_chunk != nullptr || !_segments.empty()));
 }
 
 bool ChunkPipelineAccumulator::need_input() const {
@@ -593,7 +678,7 @@ bool ChunkPipelineAccumulator::need_input() const {
 }
 
 bool ChunkPipelineAccumulator::is_finished() const {
-    return _finalized && _out_chunk == nullptr && _in_chunk == nullptr;
+    return _finalized && _out_chunk == nullptr && _in_chunk == nullptr && _segments.empty();
 }
 
 } // namespace starrocks
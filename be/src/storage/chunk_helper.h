@@ -16,6 +16,8 @@
 
 #include <memory>
 #include <queue>
+#include <unordered_map>
+#include <vector>
 
 #include "column/vectorized_fwd.h"
 #include "storage/olap_common.h"
@@ -91,6 +93,35 @@ public:
     static void reorder_chunk(const std::vector<SlotDescriptor*>& slots, Chunk* chunk);
 };
 
+// Recycle exhausted chunks so that repeated allocations of chunks with the same column
+// layout reuse the memory retained by earlier ones, instead of going back to the
+// allocator for every output chunk. Chunks are keyed by a fingerprint of their slot
+// layout, so one recycler can serve all the schemas of a fragment instance.
+// Not thread-safe: a recycler is meant to be owned by a single driver or operator, and
+// must not be shared across queries because slot ids are only unique within one query.
+class ChunkRecycler {
+public:
+    // Upper bound of cached chunks per distinct layout, chunks recycled beyond this
+    // are simply destroyed to give the memory back.
+    static constexpr size_t kMaxCachedPerLayout = 4;
+
+    // Return an empty chunk with the layout of |slots| and a reserved size of |n|,
+    // reusing a cached chunk (with its column capacity retained) when one is available.
+    ChunkUniquePtr acquire(const std::vector<SlotDescriptor*>& slots, size_t n);
+
+    // Give back an exhausted chunk to serve later acquisitions of the same layout.
+    void recycle(ChunkUniquePtr&& chunk);
+
+    size_t cached_count() const { return _cached_count; }
+
+private:
+    static uint64_t _layout_fingerprint(const std::vector<SlotDescriptor*>& slots);
+    static uint64_t _layout_fingerprint(const Chunk& chunk);
+
+    size_t _cached_count = 0;
+    std::unordered_map<uint64_t, std::vector<ChunkUniquePtr>> _cache;
+};
+
 // Accumulate small chunk into desired size
 class ChunkAccumulator {
 public:
@@ -129,12 +160,21 @@ public:
     bool is_finished() const;
 
 private:
+    // Physically concatenate the buffered segments into one chunk with a single
+    // exactly-sized allocation. A single buffered segment is passed through untouched.
+    ChunkPtr _compact_segments();
+
     static constexpr double LOW_WATERMARK_ROWS_RATE = 0.75; // 0.75 * chunk_size
 #ifdef BE_TEST
     static constexpr size_t LOW_WATERMARK_BYTES = 64 * 1024; // 64KB.
 #else
     static constexpr size_t LOW_WATERMARK_BYTES = 256 * 1024 * 1024; // 256MB.
 #endif
+    // Pushed chunks are buffered here without copying; they are concatenated only when a
+    // batch is emitted, so lone big chunks and the final remainder move through copy-free.
+    std::vector<ChunkPtr> _segments;
+    size_t _segment_rows = 0;
+    // holds the compacted remainder handed out through pull() after finalize()
     ChunkPtr _in_chunk = nullptr;
     ChunkPtr _out_chunk = nullptr;
     size_t _max_size = 4096;
@@ -503,4 +503,11 @@ ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type_info, ColumnId
     }
 }
 
+ColumnPredicate* new_dictionary_code_in_predicate(const TypeInfoPtr& type_info, ColumnId id,
+                                                  std::vector<int32_t> codes, size_t dict_size) {
+    DCHECK_EQ(TYPE_INT, type_info->type());
+    return new ColumnInPredicate<TYPE_INT, DictCodeSet<int32_t>>(type_info, id,
+                                                                 DictCodeSet<int32_t>(std::move(codes), dict_size));
+}
+
 } //namespace starrocks
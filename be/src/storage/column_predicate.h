@@ -246,11 +246,15 @@ ColumnPredicate* new_column_cmp_predicate(PredicateType predicate, const TypeInf
 
 ColumnPredicate* new_column_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                          const std::vector<std::string>& operands);
+// In-predicate over dictionary codes. Codes are non-negative integers smaller than |dict_size|,
+// so membership is tested against a flat lookup table instead of a hash set.
+ColumnPredicate* new_dictionary_code_in_predicate(const TypeInfoPtr& type, ColumnId id, std::vector<int32_t> codes,
+                                                  size_t dict_size);
 ColumnPredicate* new_column_not_in_predicate(const TypeInfoPtr& type, ColumnId id,
                                              const std::vector<std::string>& operands);
 ColumnPredicate* new_column_null_predicate(const TypeInfoPtr& type, ColumnId, bool is_null);
 
 ColumnPredicate* new_column_dict_conjuct_predicate(const TypeInfoPtr& type_info, ColumnId id,
-                                                   std::vector<uint8_t> dict_mapping);
+                                                   std::vector<uint8_t> dict_mapping, bool skip_null = false);
 
 } //namespace starrocks
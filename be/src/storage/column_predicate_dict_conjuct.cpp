@@ -82,11 +82,26 @@ private:
     std::vector<uint8_t> _code_mapping;
 };
 
+// Same as DictConjuctPredicateOperator, except that null rows never touch the code
+// mapping. Used for dict codes whose data slots are uninitialized in null rows
+// (e.g. parquet dict-encoded columns), so indexing the mapping with them would be
+// out of bounds.
+template <LogicalType field_type>
+class DictConjuctSkipNullPredicateOperator : public DictConjuctPredicateOperator<field_type> {
+public:
+    static constexpr bool skip_null = true;
+    using DictConjuctPredicateOperator<field_type>::DictConjuctPredicateOperator;
+};
+
 // used in low_card dict code
 ColumnPredicate* new_column_dict_conjuct_predicate(const TypeInfoPtr& type_info, ColumnId id,
-                                                   std::vector<uint8_t> dict_mapping) {
+                                                   std::vector<uint8_t> dict_mapping, bool skip_null) {
     DCHECK(type_info->type() == TYPE_INT);
     if (type_info->type() == TYPE_INT) {
+        if (skip_null) {
+            return new ColumnOperatorPredicate<TYPE_INT, LowCardDictColumn, DictConjuctSkipNullPredicateOperator,
+                                               decltype(dict_mapping)>(type_info, id, std::move(dict_mapping));
+        }
         return new ColumnOperatorPredicate<TYPE_INT, LowCardDictColumn, DictConjuctPredicateOperator,
                                            decltype(dict_mapping)>(type_info, id, std::move(dict_mapping));
     }
@@ -212,12 +212,9 @@ StatusOr<ColumnPredicateRewriter::RewriteStatus> ColumnPredicateRewriter::_rewri
         if (codewords.empty()) {
             return RewriteStatus::ALWAYS_FALSE;
         }
-        std::vector<std::string> str_codewords;
-        str_codewords.reserve(codewords.size());
-        for (int code : codewords) {
-            str_codewords.emplace_back(std::to_string(code));
-        }
-        *dest_pred = new_column_in_predicate(get_type_info(kDictCodeType), cid, str_codewords);
+        auto dict_size = down_cast<ScalarColumnIterator*>(_column_iterators[cid].get())->dict_size();
+        *dest_pred = new_dictionary_code_in_predicate(get_type_info(kDictCodeType), cid, std::move(codewords),
+                                                      dict_size);
         return RewriteStatus::CHANGED;
     }
 
@@ -256,7 +253,7 @@ StatusOr<ColumnPredicateRewriter::RewriteStatus> ColumnPredicateRewriter::_rewri
         auto iter =
                 std::lower_bound(sorted_dicts.begin(), sorted_dicts.end(), value,
                                  [](const auto& entity, const auto& value) { return entity.first.compare(value) < 0; });
-        std::vector<std::string> str_codewords;
+        std::vector<int32_t> codewords;
         // X > 3.5 find 4, range(4, inf)
         // X > 3 find 3, range(3, inf)
         // X >= 3.5 find 4, range(4, inf)
@@ -265,11 +262,12 @@ StatusOr<ColumnPredicateRewriter::RewriteStatus> ColumnPredicateRewriter::_rewri
             iter++;
         }
         while (iter != sorted_dicts.end()) {
-            str_codewords.push_back(std::to_string(iter->second));
+            codewords.push_back(iter->second);
             iter++;
         }
-        if (!str_codewords.empty()) {
-            *dest_pred = new_column_in_predicate(get_type_info(kDictCodeType), cid, str_codewords);
+        if (!codewords.empty()) {
+            *dest_pred = new_dictionary_code_in_predicate(get_type_info(kDictCodeType), cid, std::move(codewords),
+                                                          sorted_dicts.size());
             return RewriteStatus::CHANGED;
         } else {
             return RewriteStatus::ALWAYS_FALSE;
@@ -285,7 +283,7 @@ StatusOr<ColumnPredicateRewriter::RewriteStatus> ColumnPredicateRewriter::_rewri
         auto iter =
                 std::lower_bound(sorted_dicts.begin(), sorted_dicts.end(), value,
                                  [](const auto& entity, const auto& value) { return entity.first.compare(value) < 0; });
-        std::vector<std::string> str_codewords;
+        std::vector<int32_t> codewords;
         auto begin_iter = sorted_dicts.begin();
         // X < 3.5 find 4, range(-inf, 3)
         // X < 3 find 3, range(-inf, 2)
@@ -295,11 +293,12 @@ StatusOr<ColumnPredicateRewriter::RewriteStatus> ColumnPredicateRewriter::_rewri
             iter--;
         }
         while (begin_iter <= iter && begin_iter != sorted_dicts.end()) {
-            str_codewords.push_back(std::to_string(begin_iter->second));
+            codewords.push_back(begin_iter->second);
             begin_iter++;
         }
-        if (!str_codewords.empty()) {
-            *dest_pred = new_column_in_predicate(get_type_info(kDictCodeType), cid, str_codewords);
+        if (!codewords.empty()) {
+            *dest_pred = new_dictionary_code_in_predicate(get_type_info(kDictCodeType), cid, std::move(codewords),
+                                                          sorted_dicts.size());
             return RewriteStatus::CHANGED;
         } else {
             return RewriteStatus::ALWAYS_FALSE;
@@ -20,6 +20,7 @@
 #include "storage/data_dir.h"
 #include "util/starrocks_metrics.h"
 #include "util/thread.h"
+#include "util/time.h"
 
 using namespace std::chrono_literals;
 
@@ -345,11 +346,30 @@ void CompactionManager::update_tablet(const TabletSharedPtr& tablet) {
         CompactionCandidate candidate;
         candidate.tablet = tablet;
         candidate.score = tablet->compaction_score();
+        if (config::enable_compaction_read_feedback) {
+            candidate.score *= read_feedback_factor(candidate.score, tablet->avg_read_segments(),
+                                                    tablet->last_read_time_s(), UnixSeconds());
+        }
         candidate.type = tablet->compaction_type();
         update_candidates({candidate});
     }
 }
 
+double CompactionManager::read_feedback_factor(double score, double avg_read_segments, int64_t last_read_time_s,
+                                               int64_t now_s) {
+    // never defer a tablet whose version count is already a write-side problem
+    if (score >= config::compaction_read_feedback_bypass_score) {
+        return 1.0;
+    }
+    if (last_read_time_s == 0 || now_s - last_read_time_s > config::compaction_cold_tablet_threshold_seconds) {
+        // cold or write-only tablet: no query pays for its read amplification
+        return config::compaction_cold_tablet_score_factor;
+    }
+    // hot tablet: boost in proportion to the merge work queries repeat per scan
+    double boost = 1.0 + avg_read_segments / 10.0;
+    return std::min<double>(boost, config::compaction_read_feedback_max_boost);
+}
+
 bool CompactionManager::register_task(CompactionTask* compaction_task) {
     if (!compaction_task) {
         return false;
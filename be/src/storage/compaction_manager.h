@@ -59,6 +59,11 @@ public:
 
     void update_tablet(const TabletSharedPtr& tablet);
 
+    // factor applied to a tablet's compaction score when
+    // enable_compaction_read_feedback is on: boost tablets that queries pay
+    // merge-read cost for, damp cold tablets. exposed for tests.
+    static double read_feedback_factor(double score, double avg_read_segments, int64_t last_read_time_s, int64_t now_s);
+
     bool register_task(CompactionTask* compaction_task);
 
     void unregister_task(CompactionTask* compaction_task);
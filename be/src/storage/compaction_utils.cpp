@@ -50,11 +50,12 @@ int32_t CompactionUtils::get_read_chunk_size(int64_t mem_limit, int32_t config_c
     return (uint32_t)chunk_size;
 }
 
-Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t max_rows_per_segment,
-                                                       CompactionAlgorithm algorithm, Version version, int64_t gtid,
-                                                       std::unique_ptr<RowsetWriter>* output_rowset_writer,
-                                                       const TabletSchemaCSPtr& tablet_schema) {
+Status CompactionUtils::construct_output_rowset_writer(
+        Tablet* tablet, uint32_t max_rows_per_segment, CompactionAlgorithm algorithm, Version version, int64_t gtid,
+        std::unique_ptr<RowsetWriter>* output_rowset_writer, const TabletSchemaCSPtr& tablet_schema,
+        std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> seed_dict_words_by_uid) {
     RowsetWriterContext context;
+    context.seed_dict_words_by_uid = std::move(seed_dict_words_by_uid);
     context.rowset_id = StorageEngine::instance()->next_rowset_id();
     context.tablet_uid = tablet->tablet_uid();
     context.tablet_id = tablet->tablet_id();
@@ -69,6 +70,7 @@ Status CompactionUtils::construct_output_rowset_writer(Tablet* tablet, uint32_t
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
     context.gtid = gtid;
+    context.is_compaction = true;
     Status st = RowsetFactory::create_rowset_writer(context, output_rowset_writer);
     if (!st.ok()) {
         std::stringstream ss;
@@ -17,6 +17,9 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "common/status.h"
 #include "storage/olap_common.h"
@@ -52,10 +55,10 @@ public:
     static int32_t get_read_chunk_size(int64_t mem_limit, int32_t config_chunk_size, int64_t total_num_rows,
                                        int64_t total_mem_footprint, size_t source_num);
 
-    static Status construct_output_rowset_writer(Tablet* tablet, uint32_t max_rows_per_segment,
-                                                 CompactionAlgorithm algorithm, Version version, int64_t gtid,
-                                                 std::unique_ptr<RowsetWriter>* output_rowset_writer,
-                                                 const TabletSchemaCSPtr& tablet_schema);
+    static Status construct_output_rowset_writer(
+            Tablet* tablet, uint32_t max_rows_per_segment, CompactionAlgorithm algorithm, Version version, int64_t gtid,
+            std::unique_ptr<RowsetWriter>* output_rowset_writer, const TabletSchemaCSPtr& tablet_schema,
+            std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> seed_dict_words_by_uid = nullptr);
 
     static uint32_t get_segment_max_rows(int64_t max_segment_file_size, int64_t input_row_num, int64_t input_size);
 
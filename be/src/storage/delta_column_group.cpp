@@ -14,6 +14,7 @@
 
 #include "storage/delta_column_group.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "storage/protobuf_file.h"
@@ -23,23 +24,29 @@
 namespace starrocks {
 
 void DeltaColumnGroup::init(int64_t version, const std::vector<std::vector<ColumnUID>>& column_ids,
-                            const std::vector<std::string>& column_files) {
+                            const std::vector<std::string>& column_files,
+                            const std::vector<std::vector<uint32_t>>& column_rowids) {
     _version = version;
     _column_uids = column_ids;
     _column_files = column_files;
+    _column_rowids = column_rowids;
+    _column_rowids.resize(_column_files.size());
     _calc_memory_usage();
 }
 
 void DeltaColumnGroup::_calc_memory_usage() {
     size_t total_ids = 0;
     size_t total_column_name_size = 0;
+    size_t total_rowids = 0;
 
     for (int i = 0; i < _column_uids.size(); ++i) {
         total_ids += _column_uids[i].size();
         total_column_name_size += _column_files[i].length();
+        total_rowids += _column_rowids[i].size();
     }
 
-    _memory_usage = sizeof(size_t) + sizeof(int64_t) + sizeof(uint32_t) * total_ids + total_column_name_size;
+    _memory_usage = sizeof(size_t) + sizeof(int64_t) + sizeof(uint32_t) * (total_ids + total_rowids) +
+                    total_column_name_size;
 }
 
 int DeltaColumnGroup::merge_into_by_version(DeltaColumnGroupList& dcgs, const std::string& dir,
@@ -62,6 +69,7 @@ bool DeltaColumnGroup::merge_by_version(DeltaColumnGroup& dcg, const std::string
     size_t orig_size = _column_files.size();
 
     _column_uids.insert(_column_uids.end(), dcg.column_ids().begin(), dcg.column_ids().end());
+    _column_rowids.insert(_column_rowids.end(), dcg.column_rowids().begin(), dcg.column_rowids().end());
 
     _column_files.resize(_column_files.size() + dcg.relative_column_files().size());
     // update the file name suffix to finish merge
@@ -114,6 +122,10 @@ Status DeltaColumnGroup::load(int64_t version, const char* data, size_t length)
             _column_uids.back().push_back(cid);
         }
     }
+    for (const auto& rowids : dcg_pb.column_rowids()) {
+        _column_rowids.emplace_back(rowids.rowids().begin(), rowids.rowids().end());
+    }
+    _column_rowids.resize(_column_files.size());
     _calc_memory_usage();
     return Status::OK();
 }
@@ -129,6 +141,16 @@ std::string DeltaColumnGroup::save() const {
             dcg_col_pb->add_column_ids(cid);
         }
     }
+    // only persist the rowid lists when some file is sparse, so the metadata
+    // of full-length delta column groups keeps its old format
+    if (std::any_of(_column_rowids.begin(), _column_rowids.end(), [](const auto& r) { return !r.empty(); })) {
+        for (const auto& rowids : _column_rowids) {
+            auto* dcg_rowids_pb = dcg_pb.add_column_rowids();
+            for (const auto& rowid : rowids) {
+                dcg_rowids_pb->add_rowids(rowid);
+            }
+        }
+    }
     std::string result;
     dcg_pb.SerializeToString(&result);
     return result;
@@ -149,6 +171,15 @@ std::string DeltaColumnGroupListSerializer::serialize_delta_column_group_list(co
                 dcg_col_pb->add_column_ids(cid);
             }
         }
+        const auto& column_rowids = dcg->column_rowids();
+        if (std::any_of(column_rowids.begin(), column_rowids.end(), [](const auto& r) { return !r.empty(); })) {
+            for (const auto& rowids : column_rowids) {
+                auto* dcg_rowids_pb = dcg_pb.add_column_rowids();
+                for (const auto& rowid : rowids) {
+                    dcg_rowids_pb->add_rowids(rowid);
+                }
+            }
+        }
         dcgs_pb.add_dcgs()->CopyFrom(dcg_pb);
     }
 
@@ -190,7 +221,11 @@ Status DeltaColumnGroupListSerializer::_deserialize_delta_column_group_list(cons
             }
             column_files.push_back(dcgs_pb.dcgs(i).column_files(j));
         }
-        dcg->init(dcgs_pb.versions(i), column_ids, column_files);
+        std::vector<std::vector<uint32_t>> column_rowids;
+        for (const auto& rowids : dcgs_pb.dcgs(i).column_rowids()) {
+            column_rowids.emplace_back(rowids.rowids().begin(), rowids.rowids().end());
+        }
+        dcg->init(dcgs_pb.versions(i), column_ids, column_files, column_rowids);
         dcgs->push_back(dcg);
     }
     return Status::OK();
@@ -227,8 +262,13 @@ void DeltaColumnGroupListHelper::garbage_collection(DeltaColumnGroupList& dcg_li
                 garbage_files->insert(garbage_files->end(), dcg_files.begin(), dcg_files.end());
                 dcg_itr = dcg_list.erase(dcg_itr);
             } else {
-                for (const auto& cids : all_cids) {
-                    for (uint32_t cid : cids) {
+                for (int idx = 0; idx < all_cids.size(); ++idx) {
+                    // a sparse file only contains part of the rows, so it doesn't
+                    // cover its columns and the older data below it must be kept
+                    if ((*dcg_itr)->sparse(idx)) {
+                        continue;
+                    }
+                    for (uint32_t cid : all_cids[idx]) {
                         column_set.insert(cid);
                     }
                 }
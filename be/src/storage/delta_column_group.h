@@ -34,7 +34,8 @@ public:
     DeltaColumnGroup() {}
     ~DeltaColumnGroup() {}
     void init(int64_t version, const std::vector<std::vector<ColumnUID>>& column_ids,
-              const std::vector<std::string>& column_files);
+              const std::vector<std::string>& column_files,
+              const std::vector<std::vector<uint32_t>>& column_rowids = {});
     Status load(int64_t version, const char* data, size_t length);
     std::string save() const;
     // merge this dcg into dst dcgs by version, returns the number of successful merges
@@ -90,6 +91,13 @@ public:
 
     const std::vector<std::string>& relative_column_files() const { return _column_files; }
 
+    // A sparse `.cols` file only contains the updated rows of the source segment,
+    // `column_rowids(idx)` is the sorted list of source row ids it covers.
+    // A full-length file has an empty row id list.
+    bool sparse(int idx) const { return !_column_rowids[idx].empty(); }
+    const std::vector<uint32_t>& column_rowids(int idx) const { return _column_rowids[idx]; }
+    const std::vector<std::vector<uint32_t>>& column_rowids() const { return _column_rowids; }
+
 private:
     void _calc_memory_usage();
 
@@ -97,6 +105,8 @@ private:
     int64_t _version = 0;
     std::vector<std::vector<ColumnUID>> _column_uids;
     std::vector<std::string> _column_files;
+    // parallel to _column_files, the inner vector is empty for full-length files
+    std::vector<std::vector<uint32_t>> _column_rowids;
     size_t _memory_usage = 0;
 };
 
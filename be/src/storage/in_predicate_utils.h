@@ -65,6 +65,31 @@ struct ArraySet : public std::array<T, N> {
     }
 };
 
+// Set of dictionary codes backed by a flat lookup table: codes are non-negative integers smaller
+// than the dictionary size, so membership testing is a single byte load instead of a hash probe.
+template <typename T>
+class DictCodeSet {
+public:
+    using value_type = T;
+
+    DictCodeSet(std::vector<T> values, size_t dict_size) : _flags(dict_size, 0), _values(std::move(values)) {
+        for (const T& v : _values) {
+            DCHECK(0 <= v && static_cast<size_t>(v) < dict_size);
+            _flags[v] = 1;
+        }
+    }
+
+    bool contains(const T& v) const { return static_cast<size_t>(v) < _flags.size() && _flags[v] != 0; }
+
+    size_t size() const { return _values.size(); }
+    auto begin() const { return _values.begin(); }
+    auto end() const { return _values.end(); }
+
+private:
+    std::vector<uint8_t> _flags;
+    std::vector<T> _values;
+};
+
 namespace predicate_internal {
 
 template <typename T>
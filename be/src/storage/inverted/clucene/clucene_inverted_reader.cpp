@@ -22,7 +22,6 @@
 #include "match_operator.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "types/logical_type.h"
-#include "util/defer_op.h"
 #include "util/faststring.h"
 
 namespace starrocks {
@@ -46,6 +45,38 @@ Status CLuceneInvertedReader::create(const std::string& path, const std::shared_
     }
 }
 
+FullTextCLuceneInvertedReader::~FullTextCLuceneInvertedReader() {
+    try {
+        if (_searcher != nullptr) {
+            _searcher->close();
+            _searcher.reset();
+        }
+        CLOSE_DIR(_directory)
+    } catch (CLuceneError& e) {
+        LOG(WARNING) << "CLuceneError occured when closing inverted reader, error msg: " << e.what();
+    }
+}
+
+Status FullTextCLuceneInvertedReader::_get_searcher(lucene::search::IndexSearcher** searcher) {
+    std::call_once(_searcher_once, [this] {
+        if (!index_exists(_index_path)) {
+            LOG(WARNING) << "inverted index path: " << _index_path << " not exist.";
+            _searcher_status = Status::NotFound(fmt::format("Not exists index_file {}", _index_path.c_str()));
+            return;
+        }
+        try {
+            _directory = lucene::store::FSDirectory::getDirectory(_index_path.c_str());
+            _searcher = std::make_unique<lucene::search::IndexSearcher>(_directory);
+        } catch (CLuceneError& e) {
+            LOG(WARNING) << "CLuceneError occured, error msg: " << e.what();
+            _searcher_status = Status::InternalError(fmt::format("CLuceneError occured, error msg: {}", e.what()));
+        }
+    });
+    RETURN_IF_ERROR(_searcher_status);
+    *searcher = _searcher.get();
+    return Status::OK();
+}
+
 Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const std::string& column_name,
                                             const void* query_value, InvertedIndexQueryType query_type,
                                             roaring::Roaring* bit_map) {
@@ -57,18 +88,11 @@ Status FullTextCLuceneInvertedReader::query(OlapReaderStatistics* stats, const s
             << ", column_name: " << column_name << ", search_str: " << search_str;
     std::wstring column_name_ws = std::wstring(column_name.begin(), column_name.end());
 
-    if (!index_exists(_index_path)) {
-        LOG(WARNING) << "inverted index path: " << _index_path << " not exist.";
-        return Status::NotFound(fmt::format("Not exists index_file {}", _index_path.c_str()));
-    }
-
     std::unique_ptr<MatchOperator> match_operator;
 
-    auto* directory = lucene::store::FSDirectory::getDirectory(_index_path.c_str());
-    // defer must define before IndexSearcher. Because the destory order is matter.
-    // Make sure IndexSearcher destory first and decrement __cl_refcount first.
-    DeferOp defer([&]() { CLOSE_DIR(directory) });
-    lucene::search::IndexSearcher index_searcher(directory);
+    lucene::search::IndexSearcher* index_searcher_ptr = nullptr;
+    RETURN_IF_ERROR(_get_searcher(&index_searcher_ptr));
+    lucene::search::IndexSearcher& index_searcher = *index_searcher_ptr;
 
     switch (query_type) {
     case InvertedIndexQueryType::MATCH_ALL_QUERY:
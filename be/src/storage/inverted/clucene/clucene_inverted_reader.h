@@ -16,6 +16,8 @@
 
 #include <CLucene.h>
 
+#include <memory>
+#include <mutex>
 #include <utility>
 
 #include "storage/inverted/inverted_reader.h"
@@ -72,6 +74,8 @@ public:
         lucene::search::BooleanQuery::setMaxClauseCount(INT_MAX);
     }
 
+    ~FullTextCLuceneInvertedReader() override;
+
     Status query(OlapReaderStatistics* stats, const std::string& column_name, const void* query_value,
                  InvertedIndexQueryType query_type, roaring::Roaring* bit_map) override;
 
@@ -80,7 +84,17 @@ public:
     InvertedIndexReaderType get_inverted_index_reader_type() override { return InvertedIndexReaderType::TEXT; }
 
 private:
+    // One segment's index is probed once per predicate (and once per IN list value), so the
+    // directory and searcher are opened once and shared by every query against this reader.
+    // Searching on one IndexSearcher from multiple threads is safe in CLucene.
+    Status _get_searcher(lucene::search::IndexSearcher** searcher);
+
     InvertedIndexParserType _parser_type;
+
+    std::once_flag _searcher_once;
+    Status _searcher_status;
+    lucene::store::FSDirectory* _directory = nullptr;
+    std::unique_ptr<lucene::search::IndexSearcher> _searcher;
 };
 
 } // namespace starrocks
\ No newline at end of file
@@ -177,13 +177,17 @@ Status KVStore::put(ColumnFamilyIndex column_family_index, const std::string& ke
 }
 
 Status KVStore::write_batch(rocksdb::WriteBatch* batch) {
+    return write_batch(batch, config::sync_tablet_meta);
+}
+
+Status KVStore::write_batch(rocksdb::WriteBatch* batch, bool sync) {
     StarRocksMetrics::instance()->meta_write_request_total.increment(1);
     int64_t duration_ns = 0;
     rocksdb::Status s;
     {
         SCOPED_RAW_TIMER(&duration_ns);
         WriteOptions write_options;
-        write_options.sync = config::sync_tablet_meta;
+        write_options.sync = sync;
         s = _db->Write(write_options, batch);
     }
     StarRocksMetrics::instance()->meta_write_request_duration_us.increment(duration_ns / 1000);
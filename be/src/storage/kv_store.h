@@ -66,8 +66,15 @@ public:
 
     Status put(ColumnFamilyIndex column_family_index, const std::string& key, const std::string& value);
 
+    // Write |batch| atomically, honoring config::sync_tablet_meta for WAL durability.
     Status write_batch(WriteBatch* batch);
 
+    // Same as above, but with an explicit choice on whether to wait for the WAL fsync.
+    // Callers whose updates can be safely redone after a crash (e.g. compaction bookkeeping)
+    // may pass sync=false to skip the fsync wait even when sync_tablet_meta is enabled;
+    // RocksDB still groups such writes into the WAL and any later synced write persists them.
+    Status write_batch(WriteBatch* batch, bool sync);
+
     Status remove(ColumnFamilyIndex column_family_index, const std::string& key);
 
     Status iterate(ColumnFamilyIndex column_family_index, const std::string& prefix,
@@ -14,6 +14,8 @@
 
 #include "storage/lake/horizontal_compaction_task.h"
 
+#include <thread>
+
 #include "runtime/runtime_state.h"
 #include "storage/chunk_helper.h"
 #include "storage/compaction_utils.h"
@@ -26,7 +28,9 @@
 #include "storage/rowset/column_reader.h"
 #include "storage/storage_engine.h"
 #include "storage/tablet_reader_params.h"
+#include "util/blocking_queue.hpp"
 #include "util/defer_op.h"
+#include "util/thread.h"
 
 namespace starrocks::lake {
 
@@ -58,49 +62,112 @@ Status HorizontalCompactionTask::execute(CancelFunc cancel_func, ThreadPool* flu
     RETURN_IF_ERROR(writer->open());
     DeferOp defer([&]() { writer->close(); });
 
-    auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
     auto char_field_indexes = ChunkHelper::get_char_field_indexes(schema);
-    std::vector<uint64_t> rssid_rowids;
-    rssid_rowids.reserve(chunk_size);
 
     int64_t reader_time_ns = 0;
     const bool enable_light_pk_compaction_publish = StorageEngine::instance()->enable_light_pk_compaction_publish();
-    while (true) {
-        if (UNLIKELY(StorageEngine::instance()->bg_worker_stopped())) {
-            return Status::Cancelled("background worker stopped");
+    const bool use_pk_rowids =
+            tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && enable_light_pk_compaction_publish;
+
+    auto write_chunk = [&](Chunk* chunk, const std::vector<uint64_t>& rssid_rowids, int64_t raw_rows_read) -> Status {
+        ChunkHelper::padding_char_columns(char_field_indexes, schema, tablet_schema, chunk);
+        if (rssid_rowids.empty()) {
+            RETURN_IF_ERROR(writer->write(*chunk));
+        } else {
+            // pk table compaction
+            RETURN_IF_ERROR(writer->write(*chunk, rssid_rowids));
         }
-        if (cancel_func()) {
-            return Status::Cancelled("cancelled");
+        _context->progress.update(100 * raw_rows_read / total_num_rows);
+        VLOG_EVERY_N(3, 1000) << "Tablet: " << _tablet.id() << ", compaction progress: " << _context->progress.value();
+        return Status::OK();
+    };
+
+    if (!config::enable_lake_compaction_pipelined_read) {
+        auto chunk = ChunkHelper::new_chunk(schema, chunk_size);
+        std::vector<uint64_t> rssid_rowids;
+        rssid_rowids.reserve(chunk_size);
+        while (true) {
+            if (UNLIKELY(StorageEngine::instance()->bg_worker_stopped())) {
+                return Status::Cancelled("background worker stopped");
+            }
+            if (cancel_func()) {
+                return Status::Cancelled("cancelled");
+            }
+#ifndef BE_TEST
+            RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+#endif
+            {
+                SCOPED_RAW_TIMER(&reader_time_ns);
+                auto st = use_pk_rowids ? reader.get_next(chunk.get(), &rssid_rowids) : reader.get_next(chunk.get());
+                if (st.is_end_of_file()) {
+                    break;
+                } else if (!st.ok()) {
+                    return st;
+                }
+            }
+            RETURN_IF_ERROR(write_chunk(chunk.get(), rssid_rowids, reader.stats().raw_rows_read));
+            chunk->reset();
+            rssid_rowids.clear();
         }
+    } else {
+        // Pipelined merge: a producer thread pulls merged chunks from the reader while
+        // this thread pads and writes them, so the remote reads overlap with the merge
+        // CPU and with the multipart upload done by the output stream. The bounded
+        // queue keeps at most lake_compaction_pipeline_queue_depth chunks in flight.
+        struct MergedChunk {
+            ChunkPtr chunk;
+            std::vector<uint64_t> rssid_rowids;
+            int64_t raw_rows_read = 0;
+            Status status; // EndOfFile marks the end of the stream
+        };
+        BlockingQueue<std::shared_ptr<MergedChunk>> queue(std::max<int>(1, config::lake_compaction_pipeline_queue_depth));
+
+        auto* mem_tracker = _mem_tracker.get();
+        std::thread producer([&, mem_tracker]() {
+            SCOPED_THREAD_LOCAL_MEM_TRACKER_SETTER(mem_tracker);
+            while (true) {
+                auto item = std::make_shared<MergedChunk>();
+                if (UNLIKELY(StorageEngine::instance()->bg_worker_stopped())) {
+                    item->status = Status::Cancelled("background worker stopped");
+                } else if (cancel_func()) {
+                    item->status = Status::Cancelled("cancelled");
+                }
 #ifndef BE_TEST
-        RETURN_IF_ERROR(tls_thread_status.mem_tracker()->check_mem_limit("Compaction"));
+                if (item->status.ok()) {
+                    item->status = tls_thread_status.mem_tracker()->check_mem_limit("Compaction");
+                }
 #endif
-        {
-            SCOPED_RAW_TIMER(&reader_time_ns);
-            auto st = Status::OK();
-            if (tablet_schema->keys_type() == KeysType::PRIMARY_KEYS && enable_light_pk_compaction_publish) {
-                st = reader.get_next(chunk.get(), &rssid_rowids);
-            } else {
-                st = reader.get_next(chunk.get());
+                if (item->status.ok()) {
+                    SCOPED_RAW_TIMER(&reader_time_ns);
+                    item->chunk = ChunkHelper::new_chunk(schema, chunk_size);
+                    item->status = use_pk_rowids ? reader.get_next(item->chunk.get(), &item->rssid_rowids)
+                                                 : reader.get_next(item->chunk.get());
+                    item->raw_rows_read = reader.stats().raw_rows_read;
+                }
+                bool stop = !item->status.ok();
+                if (!queue.blocking_put(item) || stop) {
+                    // the consumer shut the queue down, or the stream ended
+                    return;
+                }
             }
-            if (st.is_end_of_file()) {
+        });
+        Thread::set_thread_name(producer, "lake_compact_read");
+
+        Status merge_status;
+        std::shared_ptr<MergedChunk> item;
+        while (queue.blocking_get(&item)) {
+            if (!item->status.ok()) {
+                merge_status = item->status.is_end_of_file() ? Status::OK() : item->status;
+                break;
+            }
+            if (auto st = write_chunk(item->chunk.get(), item->rssid_rowids, item->raw_rows_read); !st.ok()) {
+                merge_status = st;
                 break;
-            } else if (!st.ok()) {
-                return st;
             }
         }
-        ChunkHelper::padding_char_columns(char_field_indexes, schema, tablet_schema, chunk.get());
-        if (rssid_rowids.empty()) {
-            RETURN_IF_ERROR(writer->write(*chunk));
-        } else {
-            // pk table compaction
-            RETURN_IF_ERROR(writer->write(*chunk, rssid_rowids));
-        }
-        chunk->reset();
-        rssid_rowids.clear();
-
-        _context->progress.update(100 * reader.stats().raw_rows_read / total_num_rows);
-        VLOG_EVERY_N(3, 1000) << "Tablet: " << _tablet.id() << ", compaction progress: " << _context->progress.value();
+        queue.shutdown();
+        producer.join();
+        RETURN_IF_ERROR(merge_status);
     }
 
     // Adjust the progress here for 2 reasons:
@@ -15,6 +15,7 @@
 #include "storage/memtable.h"
 
 #include <memory>
+#include <type_traits>
 
 #include "column/binary_column.h"
 #include "column/json_column.h"
@@ -486,6 +487,79 @@ Status MemTable::_split_upserts_deletes(ChunkPtr& src, ChunkPtr* upserts, std::u
     return Status::OK();
 }
 
+// Stable LSD radix sort on a single fixed-size integer sort key. Each byte-wise
+// counting pass keeps the relative order of equal keys, so the resulting
+// permutation matches what stable_sort_and_tie_columns would produce, without
+// the per-row comparisons of the generic kernels. Passes in which every row
+// shares the same byte (common in the high bytes of ingest keys) are skipped.
+template <typename CppType>
+static void radix_sort_small_permutation(const CppType* data, SmallPermutation* perm) {
+    using UnsignedType = std::make_unsigned_t<CppType>;
+    // flipping the sign bit makes signed values compare correctly as unsigned
+    constexpr UnsignedType bias = static_cast<UnsignedType>(1) << (sizeof(UnsignedType) * 8 - 1);
+    const size_t n = perm->size();
+    SmallPermutation tmp(n);
+    SmallPermutation* src = perm;
+    SmallPermutation* dst = &tmp;
+    size_t counts[256];
+    for (size_t shift = 0; shift < sizeof(UnsignedType) * 8; shift += 8) {
+        std::fill(std::begin(counts), std::end(counts), 0);
+        for (size_t i = 0; i < n; i++) {
+            auto v = static_cast<UnsignedType>(static_cast<UnsignedType>(data[(*src)[i].index_in_chunk]) ^ bias);
+            counts[(v >> shift) & 0xFF]++;
+        }
+        bool single_bucket = false;
+        size_t pos = 0;
+        for (size_t& count : counts) {
+            if (count == n) {
+                single_bucket = true;
+                break;
+            }
+            size_t cur = count;
+            count = pos;
+            pos += cur;
+        }
+        if (single_bucket) {
+            continue;
+        }
+        for (size_t i = 0; i < n; i++) {
+            auto v = static_cast<UnsignedType>(static_cast<UnsignedType>(data[(*src)[i].index_in_chunk]) ^ bias);
+            (*dst)[counts[(v >> shift) & 0xFF]++] = (*src)[i];
+        }
+        std::swap(src, dst);
+    }
+    if (src != perm) {
+        perm->swap(*src);
+    }
+}
+
+// Returns true if |column| was sorted into |perm| by the radix specialization,
+// false if the caller should fall back to the generic sort kernels.
+static bool try_radix_sort_column(const ColumnPtr& column, LogicalType type, SmallPermutation* perm) {
+    if (column->is_nullable() || column->is_constant()) {
+        return false;
+    }
+    switch (type) {
+    case TYPE_BOOLEAN:
+        radix_sort_small_permutation(reinterpret_cast<const uint8_t*>(column->raw_data()), perm);
+        return true;
+    case TYPE_TINYINT:
+        radix_sort_small_permutation(reinterpret_cast<const int8_t*>(column->raw_data()), perm);
+        return true;
+    case TYPE_SMALLINT:
+        radix_sort_small_permutation(reinterpret_cast<const int16_t*>(column->raw_data()), perm);
+        return true;
+    case TYPE_INT:
+        radix_sort_small_permutation(reinterpret_cast<const int32_t*>(column->raw_data()), perm);
+        return true;
+    case TYPE_BIGINT:
+        radix_sort_small_permutation(reinterpret_cast<const int64_t*>(column->raw_data()), perm);
+        return true;
+    default:
+        return false;
+    }
+}
+
 Status MemTable::_sort_column_inc(bool by_sort_key) {
     Columns columns;
     std::vector<ColumnId> sort_key_idxes;
@@ -531,6 +605,16 @@ Status MemTable::_sort_column_inc(bool by_sort_key) {
         }
     }
 
+    // fast path: a single fixed-size integer sort key can be ordered by a stable
+    // radix sort, which is considerably cheaper than the comparison based kernels
+    // when the sort dominates flush time under heavy ingest
+    if (config::enable_memtable_radix_sort && columns.size() == 1) {
+        LogicalType type = _vectorized_schema->field(sort_key_idxes[0])->type()->type();
+        if (try_radix_sort_column(columns[0], type, &_permutations)) {
+            return Status::OK();
+        }
+    }
+
     Status st = stable_sort_and_tie_columns(false, columns, sort_descs, &_permutations);
     return st;
 }
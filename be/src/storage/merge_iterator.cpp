@@ -16,6 +16,7 @@
 
 #include <boost/heap/skew_heap.hpp>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <vector>
 
@@ -106,14 +107,29 @@ public:
 
     // return the next row number of last row whose key value is less than all values in |rhs|
     size_t last_row_less_than(const ComparableChunk& rhs, size_t limit_num) {
-        // As we previously pop this chunk from the heap top, `_compared_row` in this chunk
+        // As we previously pop this chunk from the queue top, `_compared_row` in this chunk
         // must be less than all rows in rhs, thus here we start comparision from _compared_row + 1;
-        size_t next_compare_row = _compared_row + 1;
-        size_t upper_bound = std::min(_compared_row + limit_num, _chunk->num_rows());
-        while (next_compare_row < upper_bound && less_than(next_compare_row, rhs)) {
-            next_compare_row++;
+        // Rows within the chunk are sorted, so `less_than` is monotone: gallop forward with
+        // doubling steps and binary search the boundary instead of scanning row by row.
+        size_t lo = _compared_row + 1;
+        size_t hi = std::min(_compared_row + limit_num, _chunk->num_rows());
+        size_t probe = lo;
+        size_t step = 1;
+        while (probe < hi && less_than(probe, rhs)) {
+            lo = probe + 1;
+            probe += step;
+            step <<= 1;
         }
-        return next_compare_row;
+        hi = std::min(probe, hi);
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (less_than(mid, rhs)) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        return lo;
     }
 
     bool less_than(size_t lhs_row, const ComparableChunk& rhs) {
@@ -123,7 +139,9 @@ public:
     }
 
 private:
-    friend class HeapMergeIterator;
+    template <typename ChunkQueue>
+    friend class SortedMergeIterator;
+    friend class ChunkLoserTree;
 
     // used to determinate the order of two rows when their key columns are all equals.
     uint16_t _order;
@@ -133,6 +151,108 @@ private:
     std::shared_ptr<std::vector<uint64_t>> _rssid_rowids;
 };
 
+template <typename T, typename Container = std::vector<T>>
+using MinPriorityQueue = std::priority_queue<T, Container, std::greater<T>>;
+
+// Binary heap over the children's current chunks, with the same construction
+// interface as ChunkLoserTree.
+class ChunkHeap : public MinPriorityQueue<ComparableChunk> {
+public:
+    explicit ChunkHeap(size_t /*children*/) {}
+};
+
+// K-way tournament (loser) tree over the children's current chunks. Compared with
+// the binary heap, replacing the popped winner costs one comparison per tree level
+// instead of two, which shows up when merging tens of inputs with many equal keys.
+// Each child owns at most one chunk at a time, so leaf |i| holds the chunk of
+// child |i|; an empty leaf loses every match.
+class ChunkLoserTree {
+public:
+    explicit ChunkLoserTree(size_t children) : _leaves(children), _losers(children, 0) {}
+
+    bool empty() const { return _size == 0; }
+
+    const ComparableChunk& top() {
+        _ensure_built();
+        return *_leaves[_winner];
+    }
+
+    void push(ComparableChunk chunk) {
+        size_t slot = chunk._order;
+        DCHECK(!_leaves[slot].has_value());
+        _leaves[slot] = std::move(chunk);
+        ++_size;
+        if (_built) {
+            _replay(slot);
+        }
+    }
+
+    void pop() {
+        _ensure_built();
+        _leaves[_winner].reset();
+        --_size;
+        _replay(_winner);
+    }
+
+private:
+    // return true iff the chunk at leaf |l| wins the match against the one at leaf |r|.
+    bool _wins(size_t l, size_t r) const {
+        if (!_leaves[l].has_value()) {
+            return false;
+        }
+        if (!_leaves[r].has_value()) {
+            return true;
+        }
+        // operator> breaks key ties by child order, so it is a strict total order.
+        return !(*_leaves[l] > *_leaves[r]);
+    }
+
+    // replay the matches on the path from leaf |slot| up to the root.
+    void _replay(size_t slot) {
+        size_t n = _leaves.size();
+        size_t winner = slot;
+        for (size_t node = (slot + n) / 2; node >= 1; node /= 2) {
+            if (_wins(_losers[node], winner)) {
+                std::swap(winner, _losers[node]);
+            }
+        }
+        _winner = winner;
+    }
+
+    // play the initial tournament once all children have delivered their first chunk.
+    void _ensure_built() {
+        if (_built) {
+            return;
+        }
+        size_t n = _leaves.size();
+        DCHECK_GE(n, 2);
+        std::vector<size_t> winners(2 * n);
+        for (size_t i = 0; i < n; i++) {
+            winners[n + i] = i;
+        }
+        for (size_t node = n - 1; node >= 1; node--) {
+            size_t l = winners[2 * node];
+            size_t r = winners[2 * node + 1];
+            if (_wins(l, r)) {
+                winners[node] = l;
+                _losers[node] = r;
+            } else {
+                winners[node] = r;
+                _losers[node] = l;
+            }
+        }
+        _winner = winners[1];
+        _built = true;
+    }
+
+    std::vector<std::optional<ComparableChunk>> _leaves;
+    // _losers[i] is the loser of the match at internal node |i|; index 0 is unused.
+    std::vector<size_t> _losers;
+    size_t _winner = 0;
+    size_t _size = 0;
+    bool _built = false;
+};
+
 class MergeIterator : public ChunkIterator {
 public:
     explicit MergeIterator(std::vector<ChunkIteratorPtr> children)
@@ -152,6 +272,11 @@ public:
 
     ~MergeIterator() override { close(); }
 
+    std::string merge_condition;
+
+    // In PK table compaction, we need to get chunk and each row's rssid & rowid
+    bool need_rssid_rowids = false;
+
     void close() override;
 
     size_t merged_rows() const override { return _merged_rows; }
@@ -216,14 +341,13 @@ inline void MergeIterator::close() {
     _chunk_pool.clear();
 }
 
-class HeapMergeIterator final : public MergeIterator {
+// Merge iterator keeping the children's chunks ordered by their current rows.
+// |ChunkQueue| is either a binary heap (ChunkHeap) or a tournament tree (ChunkLoserTree).
+template <typename ChunkQueue>
+class SortedMergeIterator final : public MergeIterator {
 public:
-    explicit HeapMergeIterator(std::vector<ChunkIteratorPtr> children) : MergeIterator(std::move(children)) {}
-
-    std::string merge_condition;
-
-    // In PK table compaction, we need to get chunk and each row's rssid & rowid
-    bool need_rssid_rowids = false;
+    explicit SortedMergeIterator(std::vector<ChunkIteratorPtr> children)
+            : MergeIterator(std::move(children)), _queue(_children.size()) {}
 
 protected:
     Status do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
@@ -238,33 +362,33 @@ protected:
     Status fill(size_t child) override;
 
 private:
-    template <typename T, typename Container = std::vector<T>>
-    using MinPriorityQueue = std::priority_queue<T, Container, std::greater<T>>;
-    using ChunkHeap = MinPriorityQueue<ComparableChunk>;
-
-    ChunkHeap _heap;
+    ChunkQueue _queue;
 };
 
-inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
-                                             std::vector<uint64_t>* rssid_rowids) {
+using HeapMergeIterator = SortedMergeIterator<ChunkHeap>;
+using LoserTreeMergeIterator = SortedMergeIterator<ChunkLoserTree>;
+
+template <typename ChunkQueue>
+inline Status SortedMergeIterator<ChunkQueue>::do_get_next(Chunk* chunk, std::vector<RowSourceMask>* source_masks,
+                                                           std::vector<uint64_t>* rssid_rowids) {
     if (!_inited) {
         RETURN_IF_ERROR(init());
     }
     size_t rows = 0;
     Status st;
 
-    while (!_heap.empty() && rows < _chunk_size) {
-        ComparableChunk min_chunk = _heap.top();
-        _heap.pop();
+    while (!_queue.empty() && rows < _chunk_size) {
+        ComparableChunk min_chunk = _queue.top();
+        _queue.pop();
         DCHECK_GT(min_chunk.remaining_rows(), 0);
 
         size_t offset = min_chunk.compared_row();
         size_t append_row_num = 0;
-        bool less_than_all = _heap.empty() || min_chunk.less_than_all(_heap.top());
+        bool less_than_all = _queue.empty() || min_chunk.less_than_all(_queue.top());
 
         if (less_than_all) {
             if (offset == 0) {
-                // all keys in |min_chunk| are less than heap top and |min_chunk|'s current offset is 0,
+                // all keys in |min_chunk| are less than the queue top and |min_chunk|'s current offset is 0,
                 // so here we swap the whole min_chunk out.
                 if (rows == 0) {
                     chunk->swap_chunk(*min_chunk._chunk);
@@ -281,11 +405,11 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
                     return fill(min_chunk._order);
                 } else {
                     // retrieve |min_chunk| next time to avoid memory copy.
-                    _heap.push(min_chunk);
+                    _queue.push(min_chunk);
                     break;
                 }
             } else {
-                // all keys in |min_chunk| are less than heap top, but |min_chunk|'s current offset is larger than 0
+                // all keys in |min_chunk| are less than the queue top, but |min_chunk|'s current offset is larger than 0
                 // here we append the remaining rows in |min_chunk| to the chunk.
                 size_t remain_row_num = min_chunk.remaining_rows();
                 if (rows + remain_row_num <= _chunk_size) {
@@ -295,9 +419,9 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
                 }
             }
         } else {
-            // find the last row in |min_chunk| whose key is less than all values in _heap.top(),
+            // find the last row in |min_chunk| whose key is less than all values in _queue.top(),
             // subtract it with the offset to get the append_row_num
-            append_row_num = min_chunk.last_row_less_than(_heap.top(), _chunk_size - rows) - offset;
+            append_row_num = min_chunk.last_row_less_than(_queue.top(), _chunk_size - rows) - offset;
         }
 
         DCHECK_GT(append_row_num, 0);
@@ -318,7 +442,7 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
             source_masks->insert(source_masks->end(), append_row_num, RowSourceMask{min_chunk._order, false});
         }
         if (min_chunk.remaining_rows() > 0) {
-            _heap.push(min_chunk);
+            _queue.push(min_chunk);
         } else {
             st = fill(min_chunk._order);
             if (!st.ok()) {
@@ -335,7 +459,8 @@ inline Status HeapMergeIterator::do_get_next(Chunk* chunk, std::vector<RowSource
     }
 }
 
-inline Status HeapMergeIterator::fill(size_t child) {
+template <typename ChunkQueue>
+inline Status SortedMergeIterator<ChunkQueue>::fill(size_t child) {
     Chunk* chunk = _chunk_pool[child].get();
 
     chunk->reset();
@@ -355,10 +480,10 @@ inline Status HeapMergeIterator::fill(size_t child) {
                     "Merge iterator only supports merging chunks with rows less than $0", max_merge_chunk_size));
         }
         if (need_rssid_rowids) {
-            _heap.push(ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
-                                       merge_condition, std::move(rssid_rowids)});
+            _queue.push(ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(),
+                                        merge_condition, std::move(rssid_rowids)});
         } else {
-            _heap.push(
+            _queue.push(
                     ComparableChunk{chunk, child, _schema.num_key_fields(), _schema.sort_key_idxes(), merge_condition});
         }
     } else if (st.is_end_of_file()) {
@@ -371,6 +496,15 @@ inline Status HeapMergeIterator::fill(size_t child) {
     return Status::OK();
 }
 
+// pick the queue implementation for a sorted merge: the loser tree halves the
+// comparisons per row for wide merges, the binary heap stays as a fallback.
+static std::shared_ptr<MergeIterator> new_sorted_merge_iterator(const std::vector<ChunkIteratorPtr>& children) {
+    if (config::enable_loser_tree_merge) {
+        return std::make_shared<LoserTreeMergeIterator>(children);
+    }
+    return std::make_shared<HeapMergeIterator>(children);
+}
+
 ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& children) {
     DCHECK(!children.empty());
     if (children.size() == 1) {
@@ -382,7 +516,7 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        return std::make_shared<HeapMergeIterator>(children);
+        return new_sorted_merge_iterator(children);
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -406,9 +540,9 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        auto heapMergeIterator = std::make_shared<HeapMergeIterator>(children);
-        heapMergeIterator->merge_condition = merge_condition;
-        return heapMergeIterator;
+        auto merge_iterator = new_sorted_merge_iterator(children);
+        merge_iterator->merge_condition = merge_condition;
+        return merge_iterator;
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -431,9 +565,9 @@ ChunkIteratorPtr new_heap_merge_iterator(const std::vector<ChunkIteratorPtr>& ch
     const static size_t kMaxChildrenSize = std::numeric_limits<uint16_t>::max();
 
     if (children.size() <= kMaxChildrenSize) {
-        auto heapMergeIterator = std::make_shared<HeapMergeIterator>(children);
-        heapMergeIterator->need_rssid_rowids = need_rssid_rowids;
-        return heapMergeIterator;
+        auto merge_iterator = new_sorted_merge_iterator(children);
+        merge_iterator->need_rssid_rowids = need_rssid_rowids;
+        return merge_iterator;
     }
     std::vector<ChunkIteratorPtr> sub_merge_iterators;
     sub_merge_iterators.reserve((children.size() + kMaxChildrenSize - 1) / kMaxChildrenSize);
@@ -183,6 +183,16 @@ Status SegmentMetaCollecter::open() {
 }
 
 Status SegmentMetaCollecter::_init_return_column_iterators() {
+    // max/min/count are answered from the footer metadata already held by the column
+    // readers, so don't open the segment file unless some field reads data pages
+    bool need_read_page = false;
+    for (size_t i = 0; i < _params->read_page.size(); i++) {
+        need_read_page |= _params->read_page[i];
+    }
+    if (!need_read_page) {
+        return Status::OK();
+    }
+
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(_segment->file_name()));
     ASSIGN_OR_RETURN(_read_file, fs->new_random_access_file(_segment->file_name()));
 
@@ -24,6 +24,7 @@
 #include "io/io_profiler.h"
 #include "storage/chunk_helper.h"
 #include "storage/chunk_iterator.h"
+#include "storage/persistent_index_compaction_manager.h"
 #include "storage/persistent_index_tablet_loader.h"
 #include "storage/primary_key_dump.h"
 #include "storage/primary_key_encoder.h"
@@ -91,6 +92,10 @@ struct IndexHash {
     uint64_t hash;
 };
 
+// how far ahead a batch probe prefetches the memory of later probes: deep enough
+// to cover a cache miss, small enough to stay within the prefetch window
+static constexpr size_t kIndexProbePrefetchDistance = 8;
+
 MutableIndex::MutableIndex() = default;
 
 MutableIndex::~MutableIndex() = default;
@@ -777,7 +782,14 @@ public:
     Status get(const Slice* keys, IndexValue* values, KeysInfo* not_found, size_t* num_found,
                const std::vector<size_t>& idxes) const override {
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            // start pulling in the cache lines of a later probe while handling this one
+            if (i + kIndexProbePrefetchDistance < idxes.size()) {
+                const auto& next_key =
+                        *reinterpret_cast<const KeyType*>(keys[idxes[i + kIndexProbePrefetchDistance]].data);
+                _map.prefetch_hash(FixedKeyHash<KeySize>()(next_key));
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             uint64_t hash = FixedKeyHash<KeySize>()(key);
             auto iter = _map.find(key, hash);
@@ -796,7 +808,13 @@ public:
     Status upsert(const Slice* keys, const IndexValue* values, IndexValue* old_values, KeysInfo* not_found,
                   size_t* num_found, const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kIndexProbePrefetchDistance < idxes.size()) {
+                const auto& next_key =
+                        *reinterpret_cast<const KeyType*>(keys[idxes[i + kIndexProbePrefetchDistance]].data);
+                _map.prefetch_hash(FixedKeyHash<KeySize>()(next_key));
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             const auto value = values[idx];
             uint64_t hash = FixedKeyHash<KeySize>()(key);
@@ -816,7 +834,13 @@ public:
     Status upsert(const Slice* keys, const IndexValue* values, KeysInfo* not_found, size_t* num_found,
                   const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kIndexProbePrefetchDistance < idxes.size()) {
+                const auto& next_key =
+                        *reinterpret_cast<const KeyType*>(keys[idxes[i + kIndexProbePrefetchDistance]].data);
+                _map.prefetch_hash(FixedKeyHash<KeySize>()(next_key));
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             const auto value = values[idx];
             uint64_t hash = FixedKeyHash<KeySize>()(key);
@@ -857,7 +881,13 @@ public:
     Status erase(const Slice* keys, IndexValue* old_values, KeysInfo* not_found, size_t* num_found,
                  const std::vector<size_t>& idxes) override {
         size_t nfound = 0;
-        for (const auto idx : idxes) {
+        for (size_t i = 0; i < idxes.size(); i++) {
+            if (i + kIndexProbePrefetchDistance < idxes.size()) {
+                const auto& next_key =
+                        *reinterpret_cast<const KeyType*>(keys[idxes[i + kIndexProbePrefetchDistance]].data);
+                _map.prefetch_hash(FixedKeyHash<KeySize>()(next_key));
+            }
+            const auto idx = idxes[i];
             const auto& key = *reinterpret_cast<const KeyType*>(keys[idx].data);
             uint64_t hash = FixedKeyHash<KeySize>()(key);
             if (auto [it, inserted] = _map.emplace_with_hash(hash, key, IndexValue(NullIndexValue)); inserted) {
@@ -2309,7 +2339,20 @@ Status ImmutableIndex::_get_in_fixlen_shard(size_t shard_idx, size_t n, const Sl
                                             std::unique_ptr<ImmutableIndexShard>* shard) const {
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        // software pipelined probing: prefetch the bucket descriptor of a far-ahead key
+        // (its address only depends on the hash), then the tag pack of a nearer key whose
+        // descriptor should already be cached, so the dependent loads below rarely miss
+        if (i + kIndexProbePrefetchDistance < keys_info.size()) {
+            IndexHash ph(keys_info[i + kIndexProbePrefetchDistance].second);
+            __builtin_prefetch(&(*shard)->bucket(ph.page() % shard_info.npage, ph.bucket() % shard_info.nbucket));
+        }
+        if (i + kIndexProbePrefetchDistance / 2 < keys_info.size()) {
+            IndexHash ph(keys_info[i + kIndexProbePrefetchDistance / 2].second);
+            auto& pb = (*shard)->bucket(ph.page() % shard_info.npage, ph.bucket() % shard_info.nbucket);
+            __builtin_prefetch((*shard)->pack_in_page(pb.pageid, pb.packid));
+        }
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -2341,7 +2384,18 @@ Status ImmutableIndex::_get_in_varlen_shard(size_t shard_idx, size_t n, const Sl
     const auto& shard_info = _shards[shard_idx];
     uint8_t candidate_idxes[kBucketSizeMax];
 
-    for (const auto& key_info : keys_info) {
+    for (size_t i = 0; i < keys_info.size(); i++) {
+        // same two-stage prefetch pipeline as _get_in_fixlen_shard
+        if (i + kIndexProbePrefetchDistance < keys_info.size()) {
+            IndexHash ph(keys_info[i + kIndexProbePrefetchDistance].second);
+            __builtin_prefetch(&(*shard)->bucket(ph.page() % shard_info.npage, ph.bucket() % shard_info.nbucket));
+        }
+        if (i + kIndexProbePrefetchDistance / 2 < keys_info.size()) {
+            IndexHash ph(keys_info[i + kIndexProbePrefetchDistance / 2].second);
+            auto& pb = (*shard)->bucket(ph.page() % shard_info.npage, ph.bucket() % shard_info.nbucket);
+            __builtin_prefetch((*shard)->pack_in_page(pb.pageid, pb.packid));
+        }
+        const auto& key_info = keys_info[i];
         IndexHash h(key_info.second);
         auto pageid = h.page() % shard_info.npage;
         auto bucketid = h.bucket() % shard_info.nbucket;
@@ -3055,6 +3109,8 @@ StatusOr<std::unique_ptr<ImmutableIndex>> ImmutableIndex::load(std::unique_ptr<R
 PersistentIndex::PersistentIndex(std::string path) : _path(std::move(path)) {}
 
 PersistentIndex::~PersistentIndex() {
+    // make sure no background tmp l1 merge is still reading our files
+    (void)_finish_merge_advance_task(true);
     if (!_l1_vec.empty()) {
         for (const auto& l1 : _l1_vec) {
             l1->clear();
@@ -3413,6 +3469,9 @@ Status PersistentIndex::commit(PersistentIndexMetaPB* index_meta, IOStat* stat)
     MonotonicStopWatch watch;
     watch.start();
     DCHECK_EQ(index_meta->key_size(), _key_size);
+    // commit restructures _l1_vec and on_commited deletes tmp files, so a background
+    // tmp l1 merge must be drained first.
+    RETURN_IF_ERROR(_finish_merge_advance_task(true));
     // check if _l0 need be flush, there are two conditions:
     //   1. _l1 is not exist, _flush_l0 and build _l1
     //   2. _l1 is exist, merge _l0 and _l1
@@ -3704,8 +3763,16 @@ Status PersistentIndex::_flush_advance_or_append_wal(size_t n, const Slice* keys
         RETURN_IF_ERROR(flush_advance());
     }
 
+    if (config::enable_pindex_async_merge_advance) {
+        // pick up a merge that finished in the background; only a pointer swap.
+        RETURN_IF_ERROR(_finish_merge_advance_task(false));
+    }
     if (_need_merge_advance()) {
-        RETURN_IF_ERROR(_merge_compaction_advance());
+        if (config::enable_pindex_async_merge_advance) {
+            RETURN_IF_ERROR(_submit_merge_advance_task());
+        } else {
+            RETURN_IF_ERROR(_merge_compaction_advance());
+        }
     } else if (!_flushed) {
         _dump_snapshot |= _can_dump_directly();
         if (!_dump_snapshot) {
@@ -3916,7 +3983,12 @@ Status PersistentIndex::try_replace(size_t n, const Slice* keys, const IndexValu
 
 Status PersistentIndex::flush_advance() {
     // flush l0 into _l1_vec
-    int idx = _l1_vec.size();
+    uint64_t idx = _l1_vec.size();
+    if (config::enable_pindex_async_merge_advance) {
+        // background merges retire tmp l1 files while newer ones are appended, so
+        // position-based names could collide with files that are still alive.
+        idx = _next_tmp_l1_seq++;
+    }
     std::string l1_tmp_file = strings::Substitute("$0/index.l1.$1.$2.$3.tmp", _path, _version.major_number(),
                                                   _version.minor_number(), idx);
     RETURN_IF_ERROR(_l0->flush_to_immutable_index(l1_tmp_file, _version, true, true));
@@ -4380,9 +4452,22 @@ static Status merge_shard_kvs_with_delete(size_t key_size, std::vector<KVRef>& l
     return Status::OK();
 }
 
-Status PersistentIndex::_merge_compaction_internal(ImmutableIndexWriter* writer, int l1_start_idx, int l1_end_idx,
+static std::vector<ImmutableIndex*> l1_merge_inputs(const std::vector<std::unique_ptr<ImmutableIndex>>& l1_vec,
+                                                    size_t start_idx, size_t end_idx) {
+    std::vector<ImmutableIndex*> inputs;
+    inputs.reserve(end_idx - start_idx);
+    for (size_t i = start_idx; i < end_idx; i++) {
+        inputs.push_back(l1_vec[i].get());
+    }
+    return inputs;
+}
+
+Status PersistentIndex::_merge_compaction_internal(ImmutableIndexWriter* writer,
+                                                   const std::vector<ImmutableIndex*>& l1_inputs,
                                                    std::map<uint32_t, std::pair<int64_t, int64_t>>& usage_and_size_stat,
-                                                   bool keep_delete) {
+                                                   bool keep_delete, bool include_l0) {
+    // the key size layout of l0 is fixed at creation, so iterating it here is safe
+    // even when the merge runs on a background thread with include_l0 == false.
     for (const auto& [key_size, shard_info] : _l0->_shard_info_by_key_size) {
         size_t total_usage = 0;
         size_t total_size = 0;
@@ -4398,19 +4483,23 @@ Status PersistentIndex::_merge_compaction_internal(ImmutableIndexWriter* writer,
         if (_key_size > 0) {
             l0_shard_offset = 0;
         }
-        const auto l0_kv_pairs_size = std::accumulate(std::next(_l0->_shards.begin(), l0_shard_offset),
-                                                      std::next(_l0->_shards.begin(), l0_shard_offset + l0_shard_size),
-                                                      0UL, [](size_t s, const auto& e) { return s + e->size(); });
-        auto l0_kvs_by_shard = _l0->_shards[l0_shard_offset]->get_kv_refs_by_shard(nshard, l0_kv_pairs_size, true);
+        std::vector<std::vector<KVRef>> l0_kvs_by_shard(nshard);
+        if (include_l0) {
+            const auto l0_kv_pairs_size =
+                    std::accumulate(std::next(_l0->_shards.begin(), l0_shard_offset),
+                                    std::next(_l0->_shards.begin(), l0_shard_offset + l0_shard_size), 0UL,
+                                    [](size_t s, const auto& e) { return s + e->size(); });
+            l0_kvs_by_shard = _l0->_shards[l0_shard_offset]->get_kv_refs_by_shard(nshard, l0_kv_pairs_size, true);
+        }
 
-        int merge_l1_num = l1_end_idx - l1_start_idx;
+        size_t merge_l1_num = l1_inputs.size();
         std::vector<std::vector<std::vector<KVRef>>> l1_kvs_by_shard;
         std::vector<int32_t> finished_l1_idx(merge_l1_num, -1);
         std::vector<std::pair<size_t, size_t>> l1_shard_info(merge_l1_num, std::make_pair<size_t, size_t>(0, 0));
         size_t index_num = 0;
         for (size_t i = 0; i < merge_l1_num; i++) {
-            auto iter = _l1_vec[i + l1_start_idx]->_shard_info_by_length.find(key_size);
-            if (iter != _l1_vec[i + l1_start_idx]->_shard_info_by_length.end()) {
+            auto iter = l1_inputs[i]->_shard_info_by_length.find(key_size);
+            if (iter != l1_inputs[i]->_shard_info_by_length.end()) {
                 l1_shard_info[i] = iter->second;
                 index_num += (iter->second.second / nshard) + 1;
             }
@@ -4449,7 +4538,7 @@ Status PersistentIndex::_merge_compaction_internal(ImmutableIndexWriter* writer,
                 do {
                     if (finished_l1_idx[l1_idx] < shard_idx_start) {
                         //get kv for l1
-                        RETURN_IF_ERROR(_l1_vec[l1_idx + l1_start_idx]->_get_kvs_for_shard(
+                        RETURN_IF_ERROR(l1_inputs[l1_idx]->_get_kvs_for_shard(
                                 l1_kvs_by_shard[l1_idx], l1_shard_info[l1_idx].first + shard_idx_start, shard_bits,
                                 &index_shards[index_shard_idx]));
                         finished_l1_idx[l1_idx] = shard_idx_start;
@@ -4523,8 +4612,9 @@ Status PersistentIndex::_minor_compaction(PersistentIndexMetaPB* index_meta) {
         // 2. skip merge l1, only merge tmp-l1 and l0
         RETURN_IF_ERROR(_reload_usage_and_size_by_key_length(_has_l1 ? 1 : 0, _l1_vec.size(), false));
         // keep delete flag when l2 or older l1 exist
-        RETURN_IF_ERROR(_merge_compaction_internal(writer.get(), _has_l1 ? 1 : 0, _l1_vec.size(),
-                                                   _usage_and_size_by_key_length, !_l2_vec.empty() || _has_l1));
+        RETURN_IF_ERROR(_merge_compaction_internal(writer.get(),
+                                                   l1_merge_inputs(_l1_vec, _has_l1 ? 1 : 0, _l1_vec.size()),
+                                                   _usage_and_size_by_key_length, !_l2_vec.empty() || _has_l1, true));
         RETURN_IF_ERROR(writer->finish());
         VLOG(2) << "PersistentIndex minor compaction, merge tmp l1, merge cnt: " << _l1_vec.size()
                 << ", output: " << new_l1_filename;
@@ -4574,8 +4664,8 @@ Status PersistentIndex::_merge_compaction() {
     const std::string idx_file_path =
             strings::Substitute("$0/index.l1.$1.$2", _path, _version.major_number(), _version.minor_number());
     RETURN_IF_ERROR(writer->init(idx_file_path, _version, true));
-    RETURN_IF_ERROR(_merge_compaction_internal(writer.get(), 0, _l1_vec.size(), _usage_and_size_by_key_length,
-                                               !_l2_vec.empty()));
+    RETURN_IF_ERROR(_merge_compaction_internal(writer.get(), l1_merge_inputs(_l1_vec, 0, _l1_vec.size()),
+                                               _usage_and_size_by_key_length, !_l2_vec.empty(), true));
     // _usage should be equal to total_kv_size. But they may be differen because of compatibility problem when we upgrade
     // from old version and _usage maybe not accurate.
     // so we use total_kv_size to correct the _usage.
@@ -4638,8 +4728,9 @@ Status PersistentIndex::_merge_compaction_advance() {
         }
     }
 
-    RETURN_IF_ERROR(_merge_compaction_internal(writer.get(), merge_l1_start_idx, merge_l1_end_idx, usage_and_size_stat,
-                                               keep_delete));
+    RETURN_IF_ERROR(_merge_compaction_internal(writer.get(),
+                                               l1_merge_inputs(_l1_vec, merge_l1_start_idx, merge_l1_end_idx),
+                                               usage_and_size_stat, keep_delete, true));
     RETURN_IF_ERROR(writer->finish());
     std::vector<std::unique_ptr<ImmutableIndex>> new_l1_vec;
     std::vector<int> new_l1_merged_num;
@@ -4670,6 +4761,128 @@ Status PersistentIndex::_merge_compaction_advance() {
     return Status::OK();
 }
 
+Status PersistentIndex::_submit_merge_advance_task() {
+    {
+        std::lock_guard<std::mutex> guard(_merge_advance_lock);
+        if (_merge_advance_running || _merge_advance_finished) {
+            // a merge is already in flight or waiting to be swapped in; the tmp l1
+            // count may temporarily exceed max_tmp_l1_num until it is picked up.
+            return Status::OK();
+        }
+        _merge_advance_running = true;
+    }
+    size_t start_idx = _l1_vec.size() - config::max_tmp_l1_num;
+    size_t end_idx = _l1_vec.size();
+    // raw pointers stay valid while the task runs: _l1_vec only grows until the
+    // task is drained, and commit/destruction wait for it.
+    auto inputs = l1_merge_inputs(_l1_vec, start_idx, end_idx);
+    // keep delete flag when older l1 or l2 exist
+    bool keep_delete = (start_idx != 0) || !_l2_vec.empty();
+    const std::string output = strings::Substitute("$0/index.l1.$1.$2.$3.tmp", _path, _version.major_number(),
+                                                   _version.minor_number(), _next_tmp_l1_seq++);
+    auto* mgr = StorageEngine::instance()->update_manager()->get_pindex_compaction_mgr();
+    Status st = (mgr == nullptr) ? Status::ServiceUnavailable("pk index compaction thread pool not available")
+                                 : mgr->submit_task([this, inputs = std::move(inputs), start_idx, end_idx, keep_delete,
+                                                     output]() {
+                                       _merge_advance_task_run(inputs, start_idx, end_idx, keep_delete, output);
+                                   });
+    if (!st.ok()) {
+        {
+            std::lock_guard<std::mutex> guard(_merge_advance_lock);
+            _merge_advance_running = false;
+        }
+        VLOG(1) << "submit async tmp l1 merge failed, fall back to sync merge, path: " << _path << ", status: " << st;
+        return _merge_compaction_advance();
+    }
+    return Status::OK();
+}
+
+void PersistentIndex::_merge_advance_task_run(const std::vector<ImmutableIndex*>& l1_inputs, size_t start_idx,
+                                              size_t end_idx, bool keep_delete, const std::string& output) {
+    auto st = [&]() -> Status {
+        auto writer = std::make_unique<ImmutableIndexWriter>();
+        RETURN_IF_ERROR(writer->init(output, _version, false));
+        // l0 was flushed into a tmp l1 right before this task was submitted, so the
+        // merge covers immutable files only and the stats come from their shards.
+        std::map<uint32_t, std::pair<int64_t, int64_t>> usage_and_size_stat;
+        for (const auto* l1 : l1_inputs) {
+            for (const auto& [key_size, shard_info] : l1->_shard_info_by_length) {
+                auto [l1_shard_offset, l1_shard_size] = shard_info;
+                const int64_t size = std::accumulate(std::next(l1->_shards.begin(), l1_shard_offset),
+                                                     std::next(l1->_shards.begin(), l1_shard_offset + l1_shard_size),
+                                                     0L, [](size_t s, const auto& e) { return s + e.size; });
+                const int64_t usage = std::accumulate(std::next(l1->_shards.begin(), l1_shard_offset),
+                                                      std::next(l1->_shards.begin(), l1_shard_offset + l1_shard_size),
+                                                      0L, [](size_t s, const auto& e) { return s + e.data_size; });
+                auto iter = usage_and_size_stat.find(key_size);
+                if (iter == usage_and_size_stat.end()) {
+                    usage_and_size_stat.insert({static_cast<uint32_t>(key_size), {usage, size}});
+                } else {
+                    iter->second.first += usage;
+                    iter->second.second += size;
+                }
+            }
+        }
+        RETURN_IF_ERROR(_merge_compaction_internal(writer.get(), l1_inputs, usage_and_size_stat, keep_delete, false));
+        return writer->finish();
+    }();
+    std::lock_guard<std::mutex> guard(_merge_advance_lock);
+    _merge_advance_running = false;
+    _merge_advance_finished = true;
+    _merge_advance_status = st;
+    _merge_advance_output = output;
+    _merge_advance_start_idx = start_idx;
+    _merge_advance_end_idx = end_idx;
+    _merge_advance_cond.notify_all();
+}
+
+Status PersistentIndex::_finish_merge_advance_task(bool wait) {
+    std::unique_lock<std::mutex> guard(_merge_advance_lock);
+    if (wait && _merge_advance_running) {
+        _merge_advance_cond.wait(guard, [this]() { return !_merge_advance_running; });
+    }
+    if (!_merge_advance_finished) {
+        return Status::OK();
+    }
+    _merge_advance_finished = false;
+    const std::string output = std::move(_merge_advance_output);
+    const size_t start_idx = _merge_advance_start_idx;
+    const size_t end_idx = _merge_advance_end_idx;
+    Status task_st = _merge_advance_status;
+    guard.unlock();
+    if (!task_st.ok()) {
+        LOG(WARNING) << "background tmp l1 merge failed, path: " << _path << ", status: " << task_st;
+        (void)FileSystem::Default()->delete_file(output);
+        return task_st;
+    }
+    std::unique_ptr<RandomAccessFile> l1_rfile;
+    ASSIGN_OR_RETURN(l1_rfile, _fs->new_random_access_file(output));
+    auto l1_st = ImmutableIndex::load(std::move(l1_rfile), load_bf_or_not());
+    RETURN_IF_ERROR(l1_st.status());
+    // swap the merged index in place of its inputs; tmp l1 files appended while the
+    // merge ran stay on top so lookup order is preserved.
+    std::vector<std::unique_ptr<ImmutableIndex>> new_l1_vec;
+    std::vector<int> new_l1_merged_num;
+    new_l1_vec.reserve(_l1_vec.size() - (end_idx - start_idx) + 1);
+    size_t merge_num = _l1_merged_num[start_idx];
+    for (size_t i = 0; i < start_idx; i++) {
+        new_l1_vec.emplace_back(std::move(_l1_vec[i]));
+        new_l1_merged_num.emplace_back(_l1_merged_num[i]);
+    }
+    for (size_t i = start_idx; i < end_idx; i++) {
+        _l1_vec[i]->destroy();
+    }
+    new_l1_vec.emplace_back(std::move(l1_st).value());
+    new_l1_merged_num.emplace_back((end_idx - start_idx) * merge_num);
+    for (size_t i = end_idx; i < _l1_vec.size(); i++) {
+        new_l1_vec.emplace_back(std::move(_l1_vec[i]));
+        new_l1_merged_num.emplace_back(_l1_merged_num[i]);
+    }
+    _l1_vec.swap(new_l1_vec);
+    _l1_merged_num.swap(new_l1_merged_num);
+    return Status::OK();
+}
+
 // generate all possible key size in l1 and l2
 static void generate_all_key_size(size_t key_size, std::vector<size_t>& key_size_list) {
     if (key_size > 0) {
@@ -833,10 +833,23 @@ private:
 
     Status _flush_l0();
 
-    Status _merge_compaction_internal(ImmutableIndexWriter* writer, int l1_start_idx, int l1_end_idx,
+    // merge |l1_inputs| (and l0, unless |include_l0| is false) into |writer|.
+    // |include_l0| is false when the merge runs on a background thread, which must
+    // not touch the mutable l0 the apply thread keeps inserting into.
+    Status _merge_compaction_internal(ImmutableIndexWriter* writer, const std::vector<ImmutableIndex*>& l1_inputs,
                                       std::map<uint32_t, std::pair<int64_t, int64_t>>& usage_and_size_stat,
-                                      bool keep_delete);
+                                      bool keep_delete, bool include_l0);
     Status _merge_compaction_advance();
+    // asynchronous variant of _merge_compaction_advance (enable_pindex_async_merge_advance):
+    // hand the bounded tmp l1 merge to the pk index compaction thread pool so the apply
+    // thread only appends tmp l1 files and swaps the merged result in afterwards.
+    Status _submit_merge_advance_task();
+    // swap a finished background merge into _l1_vec in place of its inputs. |wait| blocks
+    // until a running merge completes; callers that restructure _l1_vec or delete tmp
+    // files (commit, destruction) must pass true.
+    Status _finish_merge_advance_task(bool wait);
+    void _merge_advance_task_run(const std::vector<ImmutableIndex*>& l1_inputs, size_t start_idx, size_t end_idx,
+                                 bool keep_delete, const std::string& output);
     // merge l0 and l1 into new l1, then clear l0
     Status _merge_compaction();
 
@@ -925,6 +938,18 @@ private:
     // std::vector<std::unique_ptr<BloomFilter>> _bf_vec;
     // set if major compaction is running
     std::atomic<bool> _major_compaction_running{false};
+    // state of the background tmp l1 merge, guarded by |_merge_advance_lock|
+    std::mutex _merge_advance_lock;
+    std::condition_variable _merge_advance_cond;
+    bool _merge_advance_running = false;
+    bool _merge_advance_finished = false;
+    Status _merge_advance_status;
+    std::string _merge_advance_output;
+    size_t _merge_advance_start_idx = 0;
+    size_t _merge_advance_end_idx = 0;
+    // monotonic sequence for tmp l1 file names; position-based names could collide
+    // once background merges retire files out of order
+    uint64_t _next_tmp_l1_seq = 0;
     // Latest major compaction time. In second.
     int64_t _latest_compaction_time = 0;
     // Re-calculated when commit end
@@ -84,6 +84,10 @@ void PersistentIndexCompactionManager::schedule(const std::function<std::vector<
     }
 }
 
+Status PersistentIndexCompactionManager::submit_task(std::function<void()> task) {
+    return _worker_thread_pool->submit_func(std::move(task));
+}
+
 void PersistentIndexCompactionManager::update_ready_tablet_queue(
         const std::function<std::vector<TabletAndScore>()>& pick_algo) {
     size_t current_time = time(nullptr);
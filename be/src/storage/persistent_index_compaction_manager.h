@@ -33,6 +33,8 @@ public:
     ~PersistentIndexCompactionManager();
     Status init();
     void schedule(const std::function<std::vector<TabletAndScore>()>& pick_algo);
+    // Submit a small standalone task (e.g. a bounded tmp-l1 merge) to the worker pool.
+    Status submit_task(std::function<void()> task);
     // Mark tablet is running and increase disk concurrency
     void mark_running(Tablet* tablet);
     // Mark tablet is no running and decrease disk concurrency
@@ -326,6 +326,17 @@ struct CompoundNodeContext {
     struct CompoundAndContext {
         std::vector<const PredicateColumnNode*> non_vec_children;
         std::vector<ConstPredicateNodePtr> vec_children;
+
+        /// Per-child selectivity and cost measured over the first evaluated chunks,
+        /// used to reorder |vec_children| cheapest-most-selective first.
+        struct ChildStats {
+            int64_t eval_ns = 0;
+            int64_t rows_in = 0;
+            int64_t rows_out = 0;
+        };
+        std::vector<ChildStats> vec_children_stats;
+        int64_t sampled_rows = 0;
+        bool reorder_done = false;
     };
     std::optional<CompoundAndContext> and_context;
 
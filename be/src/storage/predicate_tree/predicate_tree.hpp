@@ -14,12 +14,22 @@
 
 #pragma once
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "common/config.h"
 #include "gutil/strings/substitute.h"
 #include "simd/simd.h"
 #include "storage/predicate_tree/predicate_tree.h"
+#include "util/time.h"
 
 namespace starrocks {
 
+/// Number of rows an AND node samples per-child selectivity and cost over before it reorders
+/// its vectorized children cheapest-most-selective first.
+inline constexpr int64_t kPredicateReorderSampleRows = 32768;
+
 // ------------------------------------------------------------------------------------
 // PredicateCompoundNode
 // ------------------------------------------------------------------------------------
@@ -187,13 +197,23 @@ inline Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNod
         for (const auto& child : _compound_children) {
             ctx.vec_children.emplace_back(&child);
         }
+        ctx.vec_children_stats.resize(ctx.vec_children.size());
     }
     auto& ctx = node_ctx.and_context.value();
 
+    // Measure per-child selectivity and cost over the first chunks, until the children are
+    // reordered once. Afterwards only one bool check per chunk is left.
+    const bool sampling =
+            !ctx.reorder_done && ctx.vec_children.size() > 1 && config::enable_adaptive_predicate_reorder;
+
     // Evaluate vectorized predicates first.
     bool first = true;
+    uint16_t num_selected = num_rows;
     bool contains_true = true;
-    for (const auto& child : ctx.vec_children) {
+    for (size_t i = 0; i < ctx.vec_children.size(); ++i) {
+        const auto& child = ctx.vec_children[i];
+        const int64_t start_ns = sampling ? MonotonicNanos() : 0;
+        const auto num_before = num_selected;
         if (first) {
             first = false;
             RETURN_IF_ERROR(
@@ -203,12 +223,49 @@ inline Status PredicateCompoundNode<CompoundNodeType::AND>::evaluate(CompoundNod
                     [&](const auto& pred) { return pred.evaluate_and(contexts, chunk, selection, from, to); }));
         }
 
-        contains_true = SIMD::count_nonzero(selection + from, num_rows);
+        num_selected = SIMD::count_nonzero(selection + from, num_rows);
+        contains_true = num_selected > 0;
+        if (sampling) {
+            auto& stats = ctx.vec_children_stats[i];
+            stats.eval_ns += MonotonicNanos() - start_ns;
+            stats.rows_in += num_before;
+            stats.rows_out += num_selected;
+        }
         if (!contains_true) {
             break;
         }
     }
 
+    if (sampling) {
+        ctx.sampled_rows += num_rows;
+        if (ctx.sampled_rows >= kPredicateReorderSampleRows) {
+            // Rank each child by cost-per-row divided by the fraction of rows it filters out, so
+            // cheap and selective predicates (e.g. range checks) run before expensive unselective
+            // ones (e.g. LIKE expressions). Children that never got evaluated, because earlier
+            // ones already filtered everything, stay at the end.
+            const auto score = [](const CompoundNodeContext::CompoundAndContext::ChildStats& stats) {
+                if (stats.rows_in == 0) {
+                    return std::numeric_limits<double>::max();
+                }
+                const double cost_per_row = static_cast<double>(stats.eval_ns) / stats.rows_in;
+                const double filtered_ratio = 1.0 - static_cast<double>(stats.rows_out) / stats.rows_in;
+                return filtered_ratio > 0 ? cost_per_row / filtered_ratio : std::numeric_limits<double>::max() / 2;
+            };
+            std::vector<size_t> order(ctx.vec_children.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+                return score(ctx.vec_children_stats[lhs]) < score(ctx.vec_children_stats[rhs]);
+            });
+            std::vector<ConstPredicateNodePtr> reordered_children;
+            reordered_children.reserve(ctx.vec_children.size());
+            for (const auto idx : order) {
+                reordered_children.emplace_back(ctx.vec_children[idx]);
+            }
+            ctx.vec_children = std::move(reordered_children);
+            ctx.reorder_done = true;
+        }
+    }
+
     // Evaluate non-vectorized predicates using evaluate_branchless.
     if (contains_true && !ctx.non_vec_children.empty()) {
         auto& selected_idx_buffer = node_ctx.selected_idx_buffer;
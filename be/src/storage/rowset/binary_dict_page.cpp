@@ -62,6 +62,16 @@ BinaryDictPageBuilder::BinaryDictPageBuilder(const PageBuilderOptions& options)
     dict_builder_options.data_page_size = _options.dict_page_size;
     _dict_builder = std::make_unique<BinaryPlainPageBuilder>(dict_builder_options);
     reset();
+    if (_options.seed_dict_words != nullptr) {
+        // carry the source dictionary forward: pre-insert the known words so the
+        // dictionary page comes out identical instead of being rebuilt per segment
+        for (const auto& word : *_options.seed_dict_words) {
+            if (!_dict_builder->add_slice(Slice(word))) {
+                break;
+            }
+            _dictionary.insert_or_assign(word, static_cast<uint32_t>(_dictionary.size()));
+        }
+    }
 }
 
 bool BinaryDictPageBuilder::is_page_full() {
@@ -39,6 +39,7 @@
 #include "gen_cpp/segment.pb.h"
 #include "gutil/strings/substitute.h"
 #include "storage/rowset/block_split_bloom_filter.h"
+#include "storage/rowset/cuckoo_filter.h"
 #include "storage/utils.h"
 
 namespace starrocks {
@@ -46,6 +47,8 @@ namespace starrocks {
 Status BloomFilter::create(BloomFilterAlgorithmPB algorithm, std::unique_ptr<BloomFilter>* bf) {
     if (algorithm == BLOCK_BLOOM_FILTER) {
         *bf = std::make_unique<BlockSplitBloomFilter>();
+    } else if (algorithm == CUCKOO_FILTER) {
+        *bf = std::make_unique<CuckooFilter>();
     } else {
         return Status::InternalError(strings::Substitute("invalid bloom filter algorithm:$0", algorithm));
     }
@@ -61,7 +64,7 @@ inline uint32_t used_bits(uint64_t value) {
     return 64 - __builtin_clzll(value);
 }
 
-uint32_t BloomFilter::_optimal_bit_num(uint64_t n, double fpp) {
+uint32_t BloomFilter::_optimal_bit_num(uint64_t n, double fpp) const {
     // ref parquet bloom_filter branch(BlockSplitBloomFilter.java)
     uint32_t num_bits = -8 * (double)n / log(1 - pow(fpp, 1.0 / 8));
     uint32_t max_bits = MAXIMUM_BYTES << 3;
@@ -55,6 +55,7 @@ struct BloomFilterOptions {
     // false positive probablity
     double fpp = 0.05;
     HashStrategyPB strategy = HASH_MURMUR3_X64_64;
+    BloomFilterAlgorithmPB algorithm = BLOCK_BLOOM_FILTER;
     bool use_ngram = false;
     // only use when use_ngram is true
     size_t gram_num = 0;
@@ -174,15 +175,14 @@ public:
     virtual void add_hash(uint64_t hash) = 0;
     virtual bool test_hash(uint64_t hash) const = 0;
 
-private:
+protected:
     // Compute the optimal bit number according to the following rule:
     //     m = -n * ln(fpp) / (ln(2) ^ 2)
     // n: expected distinct record number
     // fpp: false positive probablity
     // the result will be power of 2
-    uint32_t _optimal_bit_num(uint64_t n, double fpp);
+    virtual uint32_t _optimal_bit_num(uint64_t n, double fpp) const;
 
-protected:
     // bloom filter data
     // specially add one byte for null flag
     char* _data{nullptr};
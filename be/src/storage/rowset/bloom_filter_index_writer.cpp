@@ -131,7 +131,7 @@ public:
 
     Status flush() override {
         std::unique_ptr<BloomFilter> bf;
-        RETURN_IF_ERROR(BloomFilter::create(BLOCK_BLOOM_FILTER, &bf));
+        RETURN_IF_ERROR(BloomFilter::create(_bf_options.algorithm, &bf));
         RETURN_IF_ERROR(bf->init(_values.size(), _bf_options.fpp, _bf_options.strategy));
         bf->set_has_null(_has_null);
         for (auto& v : _values) {
@@ -149,7 +149,7 @@ public:
         index_meta->set_type(BLOOM_FILTER_INDEX);
         BloomFilterIndexPB* meta = index_meta->mutable_bloom_filter_index();
         meta->set_hash_strategy(_bf_options.strategy);
-        meta->set_algorithm(BLOCK_BLOOM_FILTER);
+        meta->set_algorithm(_bf_options.algorithm);
 
         // write bloom filters
         TypeInfoPtr bf_typeinfo = get_type_info(TYPE_VARCHAR);
@@ -0,0 +1,235 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/brin_index.h"
+
+#include <algorithm>
+
+#include "column/column_viewer.h"
+#include "runtime/exec_env.h"
+#include "runtime/mem_tracker.h"
+#include "storage/chunk_helper.h"
+#include "storage/decimal_type_info.h"
+#include "storage/olap_type_infra.h"
+#include "storage/rowset/encoding_info.h"
+#include "storage/rowset/indexed_column_reader.h"
+#include "storage/rowset/indexed_column_writer.h"
+#include "storage/type_traits.h"
+#include "storage/types.h"
+#include "util/unaligned_access.h"
+
+namespace starrocks {
+
+template <LogicalType type>
+class BrinIndexWriterImpl final : public BrinIndexWriter {
+    using CppType = typename TypeTraits<type>::CppType;
+
+public:
+    BrinIndexWriterImpl(TypeInfo* type_info, uint32_t block_size) : _type_info(type_info), _block_size(block_size) {
+        _reset_block();
+    }
+
+    void add_values(const void* values, size_t count) override {
+        const auto* vals = reinterpret_cast<const CppType*>(values);
+        while (count > 0) {
+            size_t n = std::min<size_t>(count, _block_size - _block_rows);
+            auto [pmin, pmax] = std::minmax_element(vals, vals + n);
+            if (!_has_not_null || unaligned_load<CppType>(pmin) < _min_value) {
+                _type_info->direct_copy(&_min_value, pmin);
+            }
+            if (!_has_not_null || unaligned_load<CppType>(pmax) > _max_value) {
+                _type_info->direct_copy(&_max_value, pmax);
+            }
+            _has_not_null = true;
+            vals += n;
+            count -= n;
+            _advance(n);
+        }
+    }
+
+    void add_nulls(uint32_t count) override {
+        while (count > 0) {
+            auto n = std::min<uint32_t>(count, _block_size - _block_rows);
+            _has_null = true;
+            count -= n;
+            _advance(n);
+        }
+    }
+
+    Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) override {
+        if (_block_rows > 0) {
+            _flush_block();
+        }
+        RETURN_IF_ERROR(_flush_status);
+
+        index_meta->set_type(BRIN_INDEX);
+        BrinIndexPB* meta = index_meta->mutable_brin_index();
+        meta->set_block_size(_block_size);
+
+        // store the block zone maps the same way the zone map index stores its page
+        // entries: serialized ZoneMapPB in an IndexedColumn with ordinal index.
+        TypeInfoPtr typeinfo = get_type_info(TYPE_OBJECT);
+        IndexedColumnWriterOptions options;
+        options.write_ordinal_index = true;
+        options.write_value_index = false;
+        options.encoding = EncodingInfo::get_default_encoding(TYPE_OBJECT, false);
+        options.compression = NO_COMPRESSION; // currently not compressed
+
+        IndexedColumnWriter writer(options, typeinfo, wfile);
+        RETURN_IF_ERROR(writer.init());
+
+        for (auto& value : _values) {
+            Slice value_slice(value);
+            RETURN_IF_ERROR(writer.add(&value_slice));
+        }
+        return writer.finish(meta->mutable_block_zone_maps());
+    }
+
+    uint64_t size() const override { return _estimated_size; }
+
+private:
+    void _advance(size_t n) {
+        _block_rows += n;
+        if (_block_rows == _block_size) {
+            _flush_block();
+        }
+    }
+
+    void _flush_block() {
+        ZoneMapPB zone_map_pb;
+        zone_map_pb.set_min(_to_zone_map_string(_min_value));
+        zone_map_pb.set_max(_to_zone_map_string(_max_value));
+        zone_map_pb.set_has_null(_has_null);
+        zone_map_pb.set_has_not_null(_has_not_null);
+
+        std::string serialized;
+        if (!zone_map_pb.SerializeToString(&serialized)) {
+            _flush_status = Status::InternalError("serialize block zone map failed");
+        }
+        _estimated_size += serialized.size() + sizeof(uint32_t);
+        _values.push_back(std::move(serialized));
+        _reset_block();
+    }
+
+    std::string _to_zone_map_string(const CppType& value) const {
+        if constexpr (type == TYPE_DECIMAL32 || type == TYPE_DECIMAL64 || type == TYPE_DECIMAL128) {
+            return get_decimal_zone_map_string(_type_info, &value);
+        } else {
+            return _type_info->to_string(&value);
+        }
+    }
+
+    void _reset_block() {
+        _type_info->set_to_min(&_min_value);
+        _type_info->set_to_min(&_max_value);
+        _has_null = false;
+        _has_not_null = false;
+        _block_rows = 0;
+    }
+
+    TypeInfo* _type_info;
+    const uint32_t _block_size;
+    uint32_t _block_rows = 0;
+    CppType _min_value;
+    CppType _max_value;
+    bool _has_null = false;
+    bool _has_not_null = false;
+    Status _flush_status;
+
+    // serialized ZoneMapPB for each block
+    std::vector<std::string> _values;
+    uint64_t _estimated_size = 0;
+};
+
+struct BrinIndexWriterBuilder {
+    template <LogicalType ftype>
+    std::unique_ptr<BrinIndexWriter> operator()(TypeInfo* type_info, uint32_t block_size) {
+        if constexpr (ftype == TYPE_CHAR || ftype == TYPE_VARCHAR) {
+            // variable-length types would need owned min/max containers per block and
+            // rarely benefit from sub-page ranges; keep the index to fixed-size types.
+            return nullptr;
+        } else {
+            return std::make_unique<BrinIndexWriterImpl<ftype>>(type_info, block_size);
+        }
+    }
+};
+
+std::unique_ptr<BrinIndexWriter> BrinIndexWriter::create(TypeInfo* type_info, uint32_t block_size) {
+    DCHECK_GT(block_size, 0);
+    return field_type_dispatch_zonemap_index(type_info->type(), BrinIndexWriterBuilder(), type_info, block_size);
+}
+
+// the block entries are zone maps, so account them to the zone map index tracker.
+BrinIndexReader::BrinIndexReader() {
+    MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(), sizeof(BrinIndexReader));
+}
+
+BrinIndexReader::~BrinIndexReader() {
+    MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(), mem_usage());
+}
+
+StatusOr<bool> BrinIndexReader::load(const IndexReadOptions& opts, const BrinIndexPB& meta) {
+    return success_once(_load_once, [&]() {
+        Status st = _do_load(opts, meta);
+        if (st.ok()) {
+            MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(),
+                                     mem_usage() - sizeof(BrinIndexReader))
+        } else {
+            _reset();
+        }
+        return st;
+    });
+}
+
+Status BrinIndexReader::_do_load(const IndexReadOptions& opts, const BrinIndexPB& meta) {
+    _block_size = meta.block_size();
+    if (_block_size == 0) {
+        return Status::Corruption("Invalid brin index block size");
+    }
+
+    IndexedColumnReader reader(meta.block_zone_maps());
+    RETURN_IF_ERROR(reader.load(opts));
+    std::unique_ptr<IndexedColumnIterator> iter;
+    RETURN_IF_ERROR(reader.new_iterator(opts, &iter));
+
+    _block_zone_maps.resize(reader.num_values());
+
+    auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    // read and cache all block zone maps
+    for (int i = 0; i < reader.num_values(); ++i) {
+        RETURN_IF_ERROR(iter->seek_to_ordinal(i));
+        size_t num_to_read = 1;
+        size_t num_read = num_to_read;
+        RETURN_IF_ERROR(iter->next_batch(&num_read, column.get()));
+        DCHECK(num_to_read == num_read);
+
+        ColumnViewer<TYPE_VARCHAR> viewer(column);
+        auto value = viewer.value(0);
+        if (!_block_zone_maps[i].ParseFromArray(value.data, value.size)) {
+            return Status::Corruption("Failed to parse block zone map");
+        }
+        column->resize(0);
+    }
+    return Status::OK();
+}
+
+size_t BrinIndexReader::mem_usage() const {
+    size_t size = sizeof(BrinIndexReader);
+    for (const auto& zone_map : _block_zone_maps) {
+        size += zone_map.SpaceUsedLong();
+    }
+    return size;
+}
+
+} // namespace starrocks
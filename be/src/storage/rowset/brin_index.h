@@ -0,0 +1,89 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/status.h"
+#include "gen_cpp/segment.pb.h"
+#include "util/once.h"
+
+namespace starrocks {
+
+class TypeInfo;
+class WritableFile;
+class IndexReadOptions;
+
+// BRIN-style secondary range index: one ZoneMapPB per fixed-size block of rows,
+// finer than the per-page zone maps. Unlike the zone map index, block boundaries
+// are independent of page boundaries, so a range predicate over semi-sorted data
+// can prune slices of a big page instead of reading it whole.
+//
+// Block i covers rows [i * block_size, (i + 1) * block_size); the last block may
+// cover fewer rows. The block zone maps are stored in an IndexedColumn with an
+// ordinal index, the same layout the zone map index uses for its page entries.
+class BrinIndexWriter {
+public:
+    static std::unique_ptr<BrinIndexWriter> create(TypeInfo* type_info, uint32_t block_size);
+
+    virtual ~BrinIndexWriter() = default;
+
+    virtual void add_values(const void* values, size_t count) = 0;
+
+    virtual void add_nulls(uint32_t count) = 0;
+
+    virtual Status finish(WritableFile* wfile, ColumnIndexMetaPB* index_meta) = 0;
+
+    virtual uint64_t size() const = 0;
+};
+
+class BrinIndexReader {
+public:
+    BrinIndexReader();
+    ~BrinIndexReader();
+
+    // load all block zone maps into memory.
+    //
+    // Multiple callers may call this method concurrently, but only the first one
+    // can load the data, the others will wait until the first one finished loading
+    // data.
+    //
+    // Return true if the index data was successfully loaded by the caller, false if
+    // the data was loaded by another caller.
+    StatusOr<bool> load(const IndexReadOptions& opts, const BrinIndexPB& meta);
+
+    // REQUIRES: the index data has been successfully `load()`ed into memory.
+    const std::vector<ZoneMapPB>& block_zone_maps() const { return _block_zone_maps; }
+
+    // REQUIRES: the index data has been successfully `load()`ed into memory.
+    uint32_t block_size() const { return _block_size; }
+
+    bool loaded() const { return invoked(_load_once); }
+
+    size_t mem_usage() const;
+
+private:
+    void _reset() { std::vector<ZoneMapPB>{}.swap(_block_zone_maps); }
+
+    Status _do_load(const IndexReadOptions& opts, const BrinIndexPB& meta);
+
+    OnceFlag _load_once;
+    uint32_t _block_size = 0;
+    std::vector<ZoneMapPB> _block_zone_maps;
+};
+
+} // namespace starrocks
@@ -61,6 +61,9 @@ struct ColumnIteratorOptions {
     // reader statistics
     OlapReaderStatistics* stats = nullptr;
     bool use_page_cache = false;
+    // cache the read pages at durable priority, so that they are evicted only when the page cache
+    // runs out of normal-priority pages. Only meaningful when use_page_cache is on.
+    bool kept_in_memory = false;
     LakeIOOptions lake_io_opts{.fill_data_cache = true};
 
     // check whether column pages are all dictionary encoding.
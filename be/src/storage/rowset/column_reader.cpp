@@ -54,6 +54,7 @@
 #include "storage/rowset/bitmap_index_reader.h"
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_reader.h"
+#include "storage/rowset/brin_index.h"
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/json_column_iterator.h"
 #include "storage/rowset/map_column_iterator.h"
@@ -97,6 +98,11 @@ ColumnReader::~ColumnReader() {
                                  _zonemap_index_meta->SpaceUsedLong());
         _zonemap_index_meta.reset(nullptr);
     }
+    if (_brin_index_meta != nullptr) {
+        MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(),
+                                 _brin_index_meta->SpaceUsedLong());
+        _brin_index_meta.reset(nullptr);
+    }
     if (_bitmap_index_meta != nullptr) {
         MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->bitmap_index_mem_tracker(),
                                  _bitmap_index_meta->SpaceUsedLong());
@@ -107,6 +113,11 @@ ColumnReader::~ColumnReader() {
                                  _bloom_filter_index_meta->SpaceUsedLong());
         _bloom_filter_index_meta.reset(nullptr);
     }
+    if (_pre_agg_hll_index_meta != nullptr) {
+        MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_metadata_mem_tracker(),
+                                 _pre_agg_hll_index_meta->SpaceUsedLong());
+        _pre_agg_hll_index_meta.reset(nullptr);
+    }
     MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_metadata_mem_tracker(), sizeof(ColumnReader));
 }
 
@@ -129,6 +140,12 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
     if (is_scalar_field_type(delegate_type(_column_type))) {
         RETURN_IF_ERROR(EncodingInfo::get(delegate_type(_column_type), meta->encoding(), &_encoding_info));
         RETURN_IF_ERROR(get_block_compression_codec(meta->compression(), &_compress_codec));
+        if (meta->has_compression_dict()) {
+            // the writer compressed every page of this column against a trained zstd
+            // dictionary (see config::enable_zstd_dictionary_compression), decompress with it.
+            ASSIGN_OR_RETURN(_dict_compress_codec, new_zstd_dict_decompressor(meta->compression_dict()));
+            _compress_codec = _dict_compress_codec.get();
+        }
 
         for (int i = 0; i < meta->indexes_size(); i++) {
             auto* index_meta = meta->mutable_indexes(i);
@@ -170,6 +187,13 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
                 _meta_mem_usage.fetch_add(_bitmap_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
                 _bitmap_index = std::make_unique<BitmapIndexReader>();
                 break;
+            case BRIN_INDEX:
+                _brin_index_meta.reset(index_meta->release_brin_index());
+                MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(),
+                                         _brin_index_meta->SpaceUsedLong());
+                _meta_mem_usage.fetch_add(_brin_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
+                _brin_index = std::make_unique<BrinIndexReader>();
+                break;
             case BLOOM_FILTER_INDEX:
                 _bloom_filter_index_meta.reset(index_meta->release_bloom_filter_index());
                 MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->bloom_filter_index_mem_tracker(),
@@ -177,6 +201,12 @@ Status ColumnReader::_init(ColumnMetaPB* meta) {
                 _meta_mem_usage.fetch_add(_bloom_filter_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
                 _bloom_filter_index = std::make_unique<BloomFilterIndexReader>();
                 break;
+            case PRE_AGG_HLL_INDEX:
+                _pre_agg_hll_index_meta.reset(index_meta->release_pre_agg_hll_index());
+                MEM_TRACKER_SAFE_CONSUME(GlobalEnv::GetInstance()->column_metadata_mem_tracker(),
+                                         _pre_agg_hll_index_meta->SpaceUsedLong());
+                _meta_mem_usage.fetch_add(_pre_agg_hll_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
+                break;
             case UNKNOWN_INDEX_TYPE:
                 return Status::Corruption(fmt::format("Bad file {}: unknown index type", file_name()));
             }
@@ -311,10 +341,13 @@ Status ColumnReader::read_page(const ColumnIteratorOptions& iter_opts, const Pag
     opts.page_pointer = pp;
     opts.codec = _compress_codec;
     opts.stats = iter_opts.stats;
-    opts.verify_checksum = true;
+    // Pages were verified when written, so query reads may sample the verification (see
+    // page_checksum_verify_sample_ratio). Compaction and schema change always verify: they
+    // rewrite data and would bake a corruption into the new version.
+    opts.verify_checksum = is_query(iter_opts.reader_type) ? PageIO::sample_verify_checksum() : true;
     opts.use_page_cache = iter_opts.use_page_cache;
     opts.encoding_type = _encoding_info->encoding();
-    opts.kept_in_memory = false;
+    opts.kept_in_memory = iter_opts.kept_in_memory;
 
     return PageIO::read_and_decompress_page(opts, handle, page_body, footer);
 }
@@ -427,6 +460,22 @@ Status ColumnReader::_load_zonemap_index(const IndexReadOptions& opts) {
     return Status::OK();
 }
 
+Status ColumnReader::_load_brin_index(const IndexReadOptions& opts) {
+    if (_brin_index == nullptr || _brin_index->loaded()) return Status::OK();
+    SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
+    auto meta = _brin_index_meta.get();
+    ASSIGN_OR_RETURN(auto first_load, _brin_index->load(opts, *meta));
+    if (UNLIKELY(first_load)) {
+        MEM_TRACKER_SAFE_RELEASE(GlobalEnv::GetInstance()->column_zonemap_index_mem_tracker(),
+                                 _brin_index_meta->SpaceUsedLong());
+        _meta_mem_usage.fetch_sub(_brin_index_meta->SpaceUsedLong(), std::memory_order_relaxed);
+        _meta_mem_usage.fetch_add(_brin_index->mem_usage());
+        _brin_index_meta.reset();
+        _segment->update_cache_size();
+    }
+    return Status::OK();
+}
+
 Status ColumnReader::_load_bitmap_index(const IndexReadOptions& opts) {
     if (_bitmap_index == nullptr || _bitmap_index->loaded()) return Status::OK();
     SCOPED_THREAD_LOCAL_CHECK_MEM_LIMIT_SETTER(false);
@@ -537,6 +586,55 @@ Status ColumnReader::zone_map_filter(const std::vector<const ColumnPredicate*>&
     }
 
     RETURN_IF_ERROR(_calculate_row_ranges(page_indexes, row_ranges));
+
+    // refine the surviving page ranges with the finer-grained block zone maps, if present.
+    if (has_brin_index() && !predicates.empty() && !row_ranges->empty()) {
+        RETURN_IF_ERROR(_brin_index_filter(predicates, row_ranges, opts, pred_relation));
+    }
+    return Status::OK();
+}
+
+Status ColumnReader::_brin_index_filter(const std::vector<const ColumnPredicate*>& predicates,
+                                        SparseRange<>* row_ranges, const IndexReadOptions& opts,
+                                        CompoundNodeType pred_relation) {
+    RETURN_IF_ERROR(_load_brin_index(opts));
+
+    const uint32_t block_size = _brin_index->block_size();
+    const auto& block_zone_maps = _brin_index->block_zone_maps();
+    RETURN_IF(block_size == 0 || block_zone_maps.empty(), Status::OK());
+    // a well-formed index covers every row; never prune on a truncated one.
+    RETURN_IF(static_cast<uint64_t>(block_zone_maps.size()) * block_size < static_cast<uint64_t>(num_rows()),
+              Status::OK());
+
+    LogicalType lt = predicates[0]->type_info()->type();
+    auto block_satisfies = [&](const ZoneMapDetail& detail) {
+        if (pred_relation == CompoundNodeType::AND) {
+            return std::ranges::all_of(predicates, [&](const auto* pred) { return pred->zone_map_filter(detail); });
+        } else {
+            return std::ranges::any_of(predicates, [&](const auto* pred) { return pred->zone_map_filter(detail); });
+        }
+    };
+
+    // only evaluate the blocks overlapping the candidate ranges.
+    SparseRange<> selected;
+    size_t next_block = 0;
+    const size_t range_size = row_ranges->size();
+    for (size_t i = 0; i < range_size; ++i) {
+        Range<> r = (*row_ranges)[i];
+        size_t first = std::max<size_t>(next_block, r.begin() / block_size);
+        size_t last = std::min<size_t>((r.end() + block_size - 1) / block_size, block_zone_maps.size());
+        for (size_t b = first; b < last; ++b) {
+            ZoneMapDetail detail;
+            RETURN_IF_ERROR(_parse_zone_map(lt, block_zone_maps[b], &detail));
+            if (block_satisfies(detail)) {
+                auto block_first = static_cast<rowid_t>(b * block_size);
+                auto block_last = static_cast<rowid_t>(std::min<uint64_t>((b + 1) * block_size, num_rows()));
+                selected.add({block_first, block_last});
+            }
+        }
+        next_block = last;
+    }
+    *row_ranges = row_ranges->intersection(selected);
     return Status::OK();
 }
 
@@ -589,10 +687,18 @@ bool ColumnReader::segment_zone_map_filter(const std::vector<const ColumnPredica
     if (_segment_zone_map == nullptr || predicates.empty()) {
         return true;
     }
-    LogicalType lt = predicates[0]->type_info()->type();
-    ZoneMapDetail detail;
-    auto st = _parse_zone_map(lt, *_segment_zone_map, &detail);
-    CHECK(st.ok()) << st;
+    // A query over a tablet with thousands of small segments hits this once per segment, and
+    // the string-to-datum decode of ZoneMapPB dominates the actual range compare. Decode it
+    // on the first use and keep the result for later queries. The decoded datums of string
+    // columns reference |_segment_zone_map|, which lives as long as this reader.
+    invoke_once(_segment_zone_map_detail_once, [&] {
+        LogicalType lt = predicates[0]->type_info()->type();
+        auto parsed_detail = std::make_unique<ZoneMapDetail>();
+        auto st = _parse_zone_map(lt, *_segment_zone_map, parsed_detail.get());
+        CHECK(st.ok()) << st;
+        _segment_zone_map_detail = std::move(parsed_detail);
+    });
+    const ZoneMapDetail& detail = *_segment_zone_map_detail;
     auto filter = [&](const ColumnPredicate* pred) { return pred->zone_map_filter(detail); };
     return std::all_of(predicates.begin(), predicates.end(), filter);
 }
@@ -70,6 +70,7 @@ class ZoneMapDetail;
 
 class BitmapIndexIterator;
 class BitmapIndexReader;
+class BrinIndexReader;
 class ColumnIterator;
 struct ColumnIteratorOptions;
 class EncodingInfo;
@@ -125,6 +126,10 @@ public:
     const EncodingInfo* encoding_info() const { return _encoding_info; }
 
     bool has_zone_map() const { return _zonemap_index != nullptr; }
+    bool has_brin_index() const { return _brin_index != nullptr; }
+    bool has_pre_agg_hll() const { return _pre_agg_hll_index_meta != nullptr; }
+    // serialized HyperLogLog over all non-null values of the segment, see PreAggHllIndexWriter.
+    const std::string& pre_agg_hll() const { return _pre_agg_hll_index_meta->hll(); }
     bool has_bitmap_index() const { return _bitmap_index != nullptr; }
     bool has_bloom_filter_index() const { return _bloom_filter_index != nullptr; }
     bool has_original_bloom_filter_index() const {
@@ -202,6 +207,7 @@ private:
     Status _init(ColumnMetaPB* meta);
 
     Status _load_zonemap_index(const IndexReadOptions& opts);
+    Status _load_brin_index(const IndexReadOptions& opts);
     Status _load_bitmap_index(const IndexReadOptions& opts);
     Status _load_bloom_filter_index(const IndexReadOptions& opts);
 
@@ -213,6 +219,11 @@ private:
     Status _zone_map_filter(const std::vector<const ColumnPredicate*>& predicates, const ColumnPredicate* del_predicate,
                             std::unordered_set<uint32_t>* del_partial_filtered_pages, std::vector<uint32_t>* pages);
 
+    // refine |row_ranges| with the BRIN-style block zone maps, which are finer than
+    // the per-page zone maps.
+    Status _brin_index_filter(const std::vector<const ColumnPredicate*>& predicates, SparseRange<>* row_ranges,
+                              const IndexReadOptions& opts, CompoundNodeType pred_relation);
+
     Status _load_inverted_index(const std::shared_ptr<TabletIndex>& index_meta, const SegmentReadOptions& opts);
 
     NgramBloomFilterReaderOptions _get_reader_options_for_ngram() const;
@@ -231,19 +242,29 @@ private:
     // initialized in init(), used for create PageDecoder
     const EncodingInfo* _encoding_info = nullptr;
     const BlockCompressionCodec* _compress_codec = nullptr; // initialized in init()
+    // owns the codec behind |_compress_codec| when the column meta carries a trained
+    // zstd compression dictionary, see ColumnMetaPB::compression_dict.
+    std::unique_ptr<BlockCompressionCodec> _dict_compress_codec;
 
     std::unique_ptr<ZoneMapIndexPB> _zonemap_index_meta;
+    std::unique_ptr<BrinIndexPB> _brin_index_meta;
     std::unique_ptr<OrdinalIndexPB> _ordinal_index_meta;
     std::unique_ptr<BitmapIndexPB> _bitmap_index_meta;
     std::unique_ptr<BloomFilterIndexPB> _bloom_filter_index_meta;
+    std::unique_ptr<PreAggHllIndexPB> _pre_agg_hll_index_meta;
 
     std::unique_ptr<ZoneMapIndexReader> _zonemap_index;
+    std::unique_ptr<BrinIndexReader> _brin_index;
     std::unique_ptr<OrdinalIndexReader> _ordinal_index;
     std::unique_ptr<BitmapIndexReader> _bitmap_index;
     std::unique_ptr<BloomFilterIndexReader> _bloom_filter_index;
     std::unique_ptr<InvertedReader> _inverted_index;
 
     std::unique_ptr<ZoneMapPB> _segment_zone_map;
+    // decoded form of |_segment_zone_map|, parsed lazily on the first zone map filter and
+    // then reused, so each query does a plain range compare instead of a protobuf decode.
+    mutable OnceFlag _segment_zone_map_detail_once;
+    mutable std::unique_ptr<ZoneMapDetail> _segment_zone_map_detail;
 
     using SubReaderList = std::vector<std::unique_ptr<ColumnReader>>;
     std::unique_ptr<SubReaderList> _sub_readers;
@@ -34,6 +34,8 @@
 
 #include "storage/rowset/column_writer.h"
 
+#include <array>
+#include <cmath>
 #include <cstddef>
 #include <memory>
 
@@ -52,6 +54,8 @@
 #include "storage/rowset/bitshuffle_page.h"
 #include "storage/rowset/bloom_filter.h"
 #include "storage/rowset/bloom_filter_index_writer.h"
+#include "storage/rowset/brin_index.h"
+#include "storage/rowset/pre_agg_hll_index.h"
 #include "storage/rowset/encoding_info.h"
 #include "storage/rowset/json_column_writer.h"
 #include "storage/rowset/map_column_writer.h"
@@ -278,6 +282,10 @@ public:
     template <LogicalType Type>
     inline EncodingTypePB speculate_encoding(const Column& column);
 
+    // Speculate frame-of-reference encoding for (near-)monotonic sample columns
+    template <LogicalType Type>
+    inline EncodingTypePB speculate_sorted_encoding(const Column& column);
+
     Status finish_current_page() override { return _scalar_column_writer->finish_current_page(); };
 
     uint64_t estimate_buffer_size() override { return _scalar_column_writer->estimate_buffer_size(); };
@@ -313,7 +321,7 @@ StatusOr<std::unique_ptr<ColumnWriter>> ColumnWriter::create(const ColumnWriterO
         str_opts.field_name = column->name();
         auto column_writer = std::make_unique<ScalarColumnWriter>(str_opts, type_info, wfile);
         return std::make_unique<StringColumnWriter>(str_opts, std::move(type_info), std::move(column_writer));
-    } else if (enable_non_string_column_dict_encoding() &&
+    } else if ((enable_non_string_column_dict_encoding() || enable_sorted_column_for_encoding()) &&
                numeric_types_support_dict_encoding(delegate_type(column->type()))) {
         DCHECK(column->type() != TYPE_VARCHAR);
         DCHECK(column->type() != TYPE_CHAR);
@@ -374,6 +382,14 @@ ScalarColumnWriter::~ScalarColumnWriter() {
 Status ScalarColumnWriter::init() {
     RETURN_IF_ERROR(get_block_compression_codec(_opts.meta->compression(), &_compress_codec));
 
+    // string columns full of short similar values compress much better against a shared
+    // dictionary. Since the pages are buffered in memory until write_data() anyway, keep
+    // them uncompressed there and train the dictionary over all of them before writing.
+    if (config::enable_zstd_dictionary_compression && _opts.meta->compression() == CompressionTypePB::ZSTD &&
+        (type_info()->type() == TYPE_CHAR || type_info()->type() == TYPE_VARCHAR)) {
+        _defer_page_compression = true;
+    }
+
     if (!_opts.need_speculate_encoding) {
         auto st = set_encoding(_opts.meta->encoding());
         CHECK(st.ok()) << st;
@@ -393,6 +409,16 @@ Status ScalarColumnWriter::init() {
         _has_index_builder = true;
         _zone_map_index_builder = ZoneMapIndexWriter::create(type_info());
     }
+    if (_opts.need_brin_index && config::brin_index_block_size > 0) {
+        // may return nullptr for types the brin index does not support.
+        _brin_index_builder = BrinIndexWriter::create(type_info(), config::brin_index_block_size);
+        _has_index_builder |= _brin_index_builder != nullptr;
+    }
+    if (_opts.need_pre_agg_hll) {
+        // may return nullptr for types the sketch does not support.
+        _pre_agg_hll_index_builder = PreAggHllIndexWriter::create(type_info());
+        _has_index_builder |= _pre_agg_hll_index_builder != nullptr;
+    }
     if (_opts.need_bitmap_index) {
         _has_index_builder = true;
         RETURN_IF_ERROR(BitmapIndexWriter::create(_type_info, &_bitmap_index_builder));
@@ -400,6 +426,7 @@ Status ScalarColumnWriter::init() {
     if (_opts.need_bloom_filter) {
         _has_index_builder = true;
         BloomFilterOptions bf_options;
+        bf_options.algorithm = _opts.bloom_filter_algorithm;
         if (_opts.tablet_index.contains(NGRAMBF)) {
             bf_options.use_ngram = true;
             const TabletIndex& ngram_bf_index = _opts.tablet_index[NGRAMBF];
@@ -455,6 +482,12 @@ uint64_t ScalarColumnWriter::estimate_buffer_size() {
     if (_zone_map_index_builder != nullptr) {
         size += _zone_map_index_builder->size();
     }
+    if (_brin_index_builder != nullptr) {
+        size += _brin_index_builder->size();
+    }
+    if (_pre_agg_hll_index_builder != nullptr) {
+        size += _pre_agg_hll_index_builder->size();
+    }
     if (_bitmap_index_builder != nullptr) {
         size += _bitmap_index_builder->size();
     }
@@ -480,6 +513,11 @@ Status ScalarColumnWriter::finish() {
 }
 
 Status ScalarColumnWriter::write_data() {
+    if (_defer_page_compression) {
+        // the buffered pages are still uncompressed, train the compression dictionary over
+        // them before any page (including the encoding dictionary page) is written out.
+        RETURN_IF_ERROR(_train_compression_dict());
+    }
     // dict will be load before data,
     // so write column dict first
     if (_encoding_info->encoding() == DICT_ENCODING) {
@@ -529,6 +567,7 @@ inline Status ScalarColumnWriter::set_encoding(const EncodingTypePB& encoding) {
     _opts.meta->set_encoding(_encoding_info->encoding());
     PageBuilderOptions opts;
     opts.data_page_size = _opts.data_page_size;
+    opts.seed_dict_words = _opts.seed_dict_words;
     RETURN_IF_ERROR(_encoding_info->create_page_builder(opts, &page_builder));
     if (page_builder == nullptr) {
         return Status::NotSupported(strings::Substitute("Failed to create page builder for type $0 and encoding $1",
@@ -547,7 +586,16 @@ Status ScalarColumnWriter::write_ordinal_index() {
 
 Status ScalarColumnWriter::write_zone_map() {
     if (_zone_map_index_builder != nullptr) {
-        return _zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes());
+        RETURN_IF_ERROR(_zone_map_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    // the brin index is a finer-grained value range index, write it out along with
+    // the zone map so the wrapper column writers need no extra forwarding method.
+    if (_brin_index_builder != nullptr) {
+        RETURN_IF_ERROR(_brin_index_builder->finish(_wfile, _opts.meta->add_indexes()));
+    }
+    // the pre-aggregated NDV sketch lives inline in the column meta, no file pages needed.
+    if (_pre_agg_hll_index_builder != nullptr) {
+        RETURN_IF_ERROR(_pre_agg_hll_index_builder->finish(_opts.meta->add_indexes()));
     }
     return Status::OK();
 }
@@ -576,15 +624,87 @@ Status ScalarColumnWriter::write_inverted_index() {
 // write a data page into file and update ordinal index
 Status ScalarColumnWriter::_write_data_page(Page* page) {
     PagePointer pp;
-    std::vector<Slice> compressed_body;
+    std::vector<Slice> page_body;
     for (auto& data : page->data) {
-        compressed_body.push_back(data.slice());
+        page_body.push_back(data.slice());
+    }
+    if (_defer_page_compression) {
+        // the page body was kept uncompressed in finish_current_page(), compress it here
+        // with the trained dictionary (or without one when training did not pay off).
+        RETURN_IF_ERROR(PageIO::compress_and_write_page(_compress_codec, _opts.compression_min_space_saving, _wfile,
+                                                        page_body, page->footer, &pp));
+    } else {
+        RETURN_IF_ERROR(PageIO::write_page(_wfile, page_body, page->footer, &pp));
     }
-    RETURN_IF_ERROR(PageIO::write_page(_wfile, compressed_body, page->footer, &pp));
     _ordinal_index_builder->append_entry(page->footer.data_page_footer().first_ordinal(), pp);
     return Status::OK();
 }
 
+Status ScalarColumnWriter::_train_compression_dict() {
+    // bounds for the training set: a dictionary only pays off when it is shared by many
+    // pages, and ZDICT gains little from more than a few MB of samples.
+    constexpr size_t kMinSamplePages = 8;
+    constexpr size_t kMaxSampleBytes = 4 * 1024 * 1024;
+    constexpr size_t kMaxDictSize = 64 * 1024;
+
+    // ZDICT wants the samples back to back in a single buffer, use one page body per sample.
+    std::string sample_buffer;
+    std::vector<size_t> sample_sizes;
+    for (Page* page = _pages.head; page != nullptr; page = page->next) {
+        size_t page_bytes = 0;
+        for (auto& data : page->data) {
+            page_bytes += data.slice().size;
+        }
+        if (page_bytes == 0) {
+            continue;
+        }
+        if (sample_buffer.size() + page_bytes > kMaxSampleBytes) {
+            break;
+        }
+        for (auto& data : page->data) {
+            sample_buffer.append(data.slice().data, data.slice().size);
+        }
+        sample_sizes.push_back(page_bytes);
+    }
+    if (sample_sizes.size() < kMinSamplePages) {
+        // too small a column, the stored dictionary would outweigh its savings
+        return Status::OK();
+    }
+
+    // byte entropy of the samples in bits per byte, to pick the compression level:
+    // near-random bodies (pre-compressed or encrypted payloads) gain nothing from a
+    // dictionary at any level, while repetitive ones are worth a slower level.
+    std::array<size_t, 256> freq{};
+    for (unsigned char c : sample_buffer) {
+        freq[c]++;
+    }
+    double entropy = 0;
+    for (size_t count : freq) {
+        if (count > 0) {
+            double p = static_cast<double>(count) / static_cast<double>(sample_buffer.size());
+            entropy -= p * std::log2(p);
+        }
+    }
+    if (entropy >= 7.5) {
+        return Status::OK();
+    }
+    // 3 is the upstream zstd default, 7 trades extra cpu for a better ratio
+    int level = entropy >= 6.0 ? 3 : 7;
+
+    auto dict = zstd_train_dictionary(sample_buffer, sample_sizes, kMaxDictSize);
+    if (!dict.ok()) {
+        // not enough shared structure between the samples, keep dictionary-less compression
+        VLOG(2) << "skip zstd dictionary for column " << _opts.field_name << ": " << dict.status();
+        return Status::OK();
+    }
+    ASSIGN_OR_RETURN(_dict_compress_codec, new_zstd_dict_compressor(*dict, level));
+    _opts.meta->set_compression_dict(*dict);
+    // from here on every page of this column, the encoding dictionary page included, is
+    // compressed with the trained dictionary.
+    _compress_codec = _dict_compress_codec.get();
+    return Status::OK();
+}
+
 Status ScalarColumnWriter::finish_current_page() {
     if (_zone_map_index_builder != nullptr) {
         RETURN_IF_ERROR(_zone_map_index_builder->flush());
@@ -631,32 +751,40 @@ Status ScalarColumnWriter::finish_current_page() {
         // for page format v2 or above, use the encoding type of config::null_encoding
         data_page_footer->set_null_encoding(_null_map_builder_v2->null_encoding());
     }
-    // trying to compress page body
-    faststring compressed_body;
-    RETURN_IF_ERROR(
-            PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body, &compressed_body));
-    if (compressed_body.size() == 0) {
-        // page body is uncompressed
-        double space_saving =
-                1.0 - static_cast<double>(encoded_values->size()) / static_cast<double>(encoded_values->capacity());
-        // when the page is first compressed by bitshuffle, the compression effect of lz4 is not obvious.
-        // Then the compressed page (may be much larger then the actual size,
-        // e.g. the page is 6K, but the compressed page allocated is 256K),
-        // is swaped to the encoded_values for opt the memory allocation.
-        // In this scenario, the page is all 256K, bug actual data size is 6K.
-        // So, we should shrink the page to the right size.
-        if (space_saving >= _opts.compression_min_space_saving) {
-            encoded_values->shrink_to_fit();
-        }
-
+    if (_defer_page_compression) {
+        // keep the body uncompressed: write_data() trains a compression dictionary over all
+        // buffered pages and compresses each of them with it right before writing.
+        encoded_values->shrink_to_fit();
         page->data.emplace_back(encoded_values->build());
         page->data.emplace_back(std::move(nullmap));
-        // Move the ownership of the internal storage of |compressed_body| to |encoded_values|,
-        // in order to reduce the internal memory allocations/deallocations of |_page_builder|.
-        encoded_values->swap(compressed_body);
     } else {
-        // page body is compressed
-        page->data.emplace_back(compressed_body.build());
+        // trying to compress page body
+        faststring compressed_body;
+        RETURN_IF_ERROR(PageIO::compress_page_body(_compress_codec, _opts.compression_min_space_saving, body,
+                                                   &compressed_body));
+        if (compressed_body.size() == 0) {
+            // page body is uncompressed
+            double space_saving = 1.0 - static_cast<double>(encoded_values->size()) /
+                                                static_cast<double>(encoded_values->capacity());
+            // when the page is first compressed by bitshuffle, the compression effect of lz4 is not obvious.
+            // Then the compressed page (may be much larger then the actual size,
+            // e.g. the page is 6K, but the compressed page allocated is 256K),
+            // is swaped to the encoded_values for opt the memory allocation.
+            // In this scenario, the page is all 256K, bug actual data size is 6K.
+            // So, we should shrink the page to the right size.
+            if (space_saving >= _opts.compression_min_space_saving) {
+                encoded_values->shrink_to_fit();
+            }
+
+            page->data.emplace_back(encoded_values->build());
+            page->data.emplace_back(std::move(nullmap));
+            // Move the ownership of the internal storage of |compressed_body| to |encoded_values|,
+            // in order to reduce the internal memory allocations/deallocations of |_page_builder|.
+            encoded_values->swap(compressed_body);
+        } else {
+            // page body is compressed
+            page->data.emplace_back(compressed_body.build());
+        }
     }
 
     _push_back_page(page.release());
@@ -777,11 +905,15 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
                 auto [run, is_null] = pair;
                 if (is_null) {
                     INDEX_ADD_NULLS(_zone_map_index_builder, run);
+                    INDEX_ADD_NULLS(_brin_index_builder, run);
+                    INDEX_ADD_NULLS(_pre_agg_hll_index_builder, run);
                     INDEX_ADD_NULLS(_bitmap_index_builder, run);
                     INDEX_ADD_NULLS(_bloom_filter_index_builder, run);
                     INDEX_ADD_NULLS(_inverted_index_builder, run);
                 } else {
                     INDEX_ADD_VALUES(_zone_map_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_brin_index_builder, pdata, run);
+                    INDEX_ADD_VALUES(_pre_agg_hll_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bitmap_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_bloom_filter_index_builder, pdata, run);
                     INDEX_ADD_VALUES(_inverted_index_builder, pdata, run);
@@ -790,6 +922,8 @@ Status ScalarColumnWriter::append(const uint8_t* data, const uint8_t* null_flags
             }
         } else {
             INDEX_ADD_VALUES(_zone_map_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_brin_index_builder, data, num_written);
+            INDEX_ADD_VALUES(_pre_agg_hll_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bitmap_index_builder, data, num_written);
             INDEX_ADD_VALUES(_bloom_filter_index_builder, data, num_written);
             INDEX_ADD_VALUES(_inverted_index_builder, data, num_written);
@@ -1027,6 +1161,10 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
     auto ratio = config::dictionary_encoding_ratio_for_non_string_column;
     auto max_card = static_cast<size_t>(static_cast<double>(row_count) * ratio);
 
+    if (!enable_non_string_column_dict_encoding()) {
+        return speculate_sorted_encoding<Type>(column);
+    }
+
     if (row_count > dictionary_min_rowcount) {
         using CppType = typename RunTimeTypeTraits<Type>::CppType;
         phmap::flat_hash_set<CppType> hash_set;
@@ -1034,7 +1172,7 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
             CppType value = numerical_col->get_data()[i];
             hash_set.insert(value);
             if (hash_set.size() > max_card) {
-                return BIT_SHUFFLE;
+                return speculate_sorted_encoding<Type>(column);
             }
         }
     }
@@ -1042,6 +1180,47 @@ inline EncodingTypePB DictColumnWriter::speculate_encoding(const Column& column)
     return DICT_ENCODING;
 }
 
+// Frame-of-reference pages store a per-page minimum and bit-pack the offsets from it, so a
+// (near-)monotonically increasing column, e.g. an event timestamp or an auto-increment id,
+// compresses much better with it than with bitshuffle, where the high bytes keep changing.
+// The sample column qualifies when at least for_encoding_min_ordered_ratio of its adjacent
+// value pairs is non-decreasing. Only types with a registered FOR page builder may qualify.
+template <LogicalType Type>
+inline EncodingTypePB DictColumnWriter::speculate_sorted_encoding(const Column& column) {
+    if constexpr (Type == TYPE_SMALLINT || Type == TYPE_INT || Type == TYPE_BIGINT || Type == TYPE_LARGEINT ||
+                  Type == TYPE_DATE || Type == TYPE_DATETIME) {
+        if (!enable_sorted_column_for_encoding()) {
+            return BIT_SHUFFLE;
+        }
+
+        using ColumnType = typename RunTimeTypeTraits<Type>::ColumnType;
+        const ColumnType* numerical_col;
+        if (column.is_nullable()) {
+            const auto& data_col = down_cast<const NullableColumn&>(column).data_column();
+            numerical_col = &down_cast<ColumnType&>(*data_col);
+        } else {
+            numerical_col = &down_cast<const ColumnType&>(column);
+        }
+
+        auto row_count = numerical_col->size();
+        if (row_count <= dictionary_min_rowcount) {
+            return BIT_SHUFFLE;
+        }
+
+        const auto& data = numerical_col->get_data();
+        size_t ordered_count = 0;
+        for (size_t i = 1; i < row_count; i++) {
+            ordered_count += (data[i - 1] <= data[i]);
+        }
+        auto min_ordered =
+                static_cast<size_t>(static_cast<double>(row_count - 1) * config::for_encoding_min_ordered_ratio);
+        if (ordered_count >= min_ordered) {
+            return FOR_ENCODING;
+        }
+    }
+    return BIT_SHUFFLE;
+}
+
 Status DictColumnWriter::finish() {
     if (_is_speculated) {
         return _scalar_column_writer->finish();
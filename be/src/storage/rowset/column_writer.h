@@ -70,8 +70,11 @@ struct ColumnWriterOptions {
     // space saving = 1 - compressed_size / uncompressed_size
     double compression_min_space_saving = 0.1;
     bool need_zone_map = false;
+    bool need_brin_index = false;
+    bool need_pre_agg_hll = false;
     bool need_bitmap_index = false;
     bool need_bloom_filter = false;
+    BloomFilterAlgorithmPB bloom_filter_algorithm = BLOCK_BLOOM_FILTER;
     bool need_inverted_index = false;
     std::unordered_map<IndexType, std::string> standalone_index_file_paths;
     std::unordered_map<IndexType, TabletIndex> tablet_index;
@@ -84,6 +87,10 @@ struct ColumnWriterOptions {
     // if global_dict is not nullptr, will checkout whether global_dict can cover all data
     GlobalDictMap* global_dict = nullptr;
 
+    // if not nullptr, pre-seed the dict page builder with these words so an
+    // identical source dictionary is carried forward instead of being rebuilt
+    const std::vector<std::string>* seed_dict_words = nullptr;
+
     bool need_flat = false;
 
     std::string field_name;
@@ -96,6 +103,8 @@ class NullFlagsBuilder;
 class OrdinalIndexWriter;
 class PageBuilder;
 class BloomFilterIndexWriter;
+class BrinIndexWriter;
+class PreAggHllIndexWriter;
 class ZoneMapIndexWriter;
 
 class ColumnWriter {
@@ -231,6 +240,10 @@ private:
 
     Status _write_data_page(Page* page);
 
+    // Train a zstd dictionary over the buffered page bodies, called from write_data()
+    // before any page is written out. Only used when _defer_page_compression is true.
+    Status _train_compression_dict();
+
     ColumnWriterOptions _opts;
     WritableFile* _wfile;
     uint32_t _curr_page_format;
@@ -245,6 +258,12 @@ private:
     const BlockCompressionCodec* _compress_codec = nullptr;
     const EncodingInfo* _encoding_info = nullptr;
 
+    // When true the buffered pages stay uncompressed until write_data(), which first trains
+    // a zstd dictionary over them and then compresses every page with it. Set in init()
+    // when the column qualifies, see config::enable_zstd_dictionary_compression.
+    bool _defer_page_compression = false;
+    std::unique_ptr<BlockCompressionCodec> _dict_compress_codec;
+
     std::unique_ptr<PageBuilder> _page_builder;
 
     // Used when _opts.page_format == 1, using Run-Length encoding to build the null map.
@@ -256,6 +275,8 @@ private:
 
     std::unique_ptr<OrdinalIndexWriter> _ordinal_index_builder;
     std::unique_ptr<ZoneMapIndexWriter> _zone_map_index_builder;
+    std::unique_ptr<BrinIndexWriter> _brin_index_builder;
+    std::unique_ptr<PreAggHllIndexWriter> _pre_agg_hll_index_builder;
     std::unique_ptr<BitmapIndexWriter> _bitmap_index_builder;
     std::unique_ptr<BloomFilterIndexWriter> _bloom_filter_index_builder;
     std::unique_ptr<InvertedWriter> _inverted_index_builder;
@@ -0,0 +1,101 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/cuckoo_filter.h"
+
+#include <cstring>
+
+#include "util/unaligned_access.h"
+
+namespace starrocks {
+
+namespace {
+
+// True iff any byte of |word| is zero, branch-free over all four lanes.
+inline bool has_zero_byte(uint32_t word) {
+    return ((word - 0x01010101U) & ~word & 0x80808080U) != 0;
+}
+
+} // namespace
+
+uint32_t CuckooFilter::_optimal_bit_num(uint64_t n, double fpp) const {
+    // One byte of fingerprint per key at a target occupancy of 95%. The
+    // resulting false positive rate (~3%) does not depend on fpp, so fpp only
+    // matters through the caller's decision to use a cuckoo filter at all.
+    uint64_t num_bytes = static_cast<uint64_t>(static_cast<double>(n) / 0.95) + 1;
+    if (num_bytes > MAXIMUM_BYTES) {
+        num_bytes = MAXIMUM_BYTES;
+    }
+    // Round up to a power of 2 so bucket indexes can be masked.
+    uint32_t bits = 64 - __builtin_clzll(num_bytes);
+    num_bytes = (num_bytes & (num_bytes - 1)) == 0 ? num_bytes : 1ULL << bits;
+    if (num_bytes < MINIMUM_BYTES) {
+        num_bytes = MINIMUM_BYTES;
+    }
+    return num_bytes << 3;
+}
+
+bool CuckooFilter::_bucket_contains(uint32_t bucket, uint8_t fp) const {
+    uint32_t word = unaligned_load<uint32_t>(data() + bucket * SLOTS_PER_BUCKET);
+    // Compare all four slots against fp at once; also match the overflow
+    // marker, which reads back as a zero byte in ~word.
+    return has_zero_byte(word ^ (fp * 0x01010101U)) || has_zero_byte(~word);
+}
+
+bool CuckooFilter::_insert_into(uint32_t bucket, uint8_t fp) {
+    char* slots = data() + bucket * SLOTS_PER_BUCKET;
+    for (uint32_t i = 0; i < SLOTS_PER_BUCKET; ++i) {
+        uint8_t slot = static_cast<uint8_t>(slots[i]);
+        if (slot == EMPTY_SLOT || slot == fp) {
+            slots[i] = static_cast<char>(fp);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CuckooFilter::_saturate() {
+    memset(data(), OVERFLOW_MARKER, num_bytes());
+}
+
+void CuckooFilter::add_hash(uint64_t hash) {
+    uint8_t fp = _fingerprint(hash);
+    uint32_t bucket = _bucket_index(hash);
+    if (_insert_into(bucket, fp) || _insert_into(_alt_bucket(bucket, fp), fp)) {
+        return;
+    }
+    // Both buckets are full: relocate a random victim to its alternate bucket
+    // until a slot frees up, as in the original cuckoo filter paper.
+    for (int kick = 0; kick < MAX_KICKS; ++kick) {
+        _kick_seed = _kick_seed * 1103515245 + 12345;
+        char* slots = data() + bucket * SLOTS_PER_BUCKET;
+        uint32_t victim = (_kick_seed >> 16) % SLOTS_PER_BUCKET;
+        uint8_t evicted = static_cast<uint8_t>(slots[victim]);
+        slots[victim] = static_cast<char>(fp);
+        fp = evicted;
+        bucket = _alt_bucket(bucket, fp);
+        if (_insert_into(bucket, fp)) {
+            return;
+        }
+    }
+    _saturate();
+}
+
+bool CuckooFilter::test_hash(uint64_t hash) const {
+    uint8_t fp = _fingerprint(hash);
+    uint32_t bucket = _bucket_index(hash);
+    return _bucket_contains(bucket, fp) || _bucket_contains(_alt_bucket(bucket, fp), fp);
+}
+
+} // namespace starrocks
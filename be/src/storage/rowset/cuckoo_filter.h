@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "storage/rowset/bloom_filter.h"
+
+namespace starrocks {
+
+// Cuckoo filter from Fan et al.'s "Cuckoo Filter: Practically Better Than Bloom".
+// Keys are stored as one-byte fingerprints in buckets of four slots, and each
+// fingerprint may live in one of two buckets related by partial-key cuckoo
+// hashing, so a membership probe touches at most two 32-bit bucket words.
+// At the sizes produced by _optimal_bit_num the false positive rate is about
+// 2 * 4 / 254 ~= 3%, below the 5% default of the block bloom filter while
+// using roughly one byte per key.
+//
+// The filter shares the BloomFilter serialization format (raw bucket array
+// plus the trailing null-flag byte), so readers reconstruct it from
+// BloomFilterIndexPB::algorithm without any extra metadata.
+class CuckooFilter : public BloomFilter {
+public:
+    void add_hash(uint64_t hash) override;
+
+    bool test_hash(uint64_t hash) const override;
+
+protected:
+    uint32_t _optimal_bit_num(uint64_t n, double fpp) const override;
+
+private:
+    // Fingerprints occupy [1, 0xFE]: 0 marks an empty slot, and 0xFF marks a
+    // slot of a filter that overflowed during build and always tests positive.
+    static const uint8_t EMPTY_SLOT = 0;
+    static const uint8_t OVERFLOW_MARKER = 0xFF;
+
+    static const uint32_t SLOTS_PER_BUCKET = 4;
+
+    // Upper bound on evictions per insert before the filter is declared full.
+    static const int MAX_KICKS = 256;
+
+    uint32_t _num_buckets() const { return num_bytes() / SLOTS_PER_BUCKET; }
+
+    static uint8_t _fingerprint(uint64_t hash) { return static_cast<uint8_t>(hash % 254 + 1); }
+
+    uint32_t _bucket_index(uint64_t hash) const { return (hash >> 32) & (_num_buckets() - 1); }
+
+    // The two candidate buckets satisfy b2 = b1 ^ h(fp), so either one can be
+    // derived from the other without knowing the original key.
+    uint32_t _alt_bucket(uint32_t bucket, uint8_t fp) const {
+        return (bucket ^ (fp * 0x5bd1e995U)) & (_num_buckets() - 1);
+    }
+
+    bool _insert_into(uint32_t bucket, uint8_t fp);
+
+    bool _bucket_contains(uint32_t bucket, uint8_t fp) const;
+
+    // Marks every slot so that all subsequent probes return true. Only taken
+    // when an insert still fails after MAX_KICKS evictions, which requires the
+    // bucket array to be nearly full.
+    void _saturate();
+
+    // state of the LCG that picks eviction victims
+    uint32_t _kick_seed = 0x9e3779b9;
+};
+
+} // namespace starrocks
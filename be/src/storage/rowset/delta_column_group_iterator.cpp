@@ -0,0 +1,105 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/delta_column_group_iterator.h"
+
+#include <algorithm>
+
+#include "column/column.h"
+
+namespace starrocks {
+
+Status DeltaColumnGroupIterator::init(const ColumnIteratorOptions& opts) {
+    RETURN_IF_ERROR(ColumnIterator::init(opts));
+    // the overlays read from their own files, the base falls back to the
+    // |read_file| of |opts| when its creator left the file to the caller
+    ColumnIteratorOptions base_opts = opts;
+    if (_base.read_file != nullptr) {
+        base_opts.read_file = _base.read_file.get();
+    }
+    RETURN_IF_ERROR(_base.iter->init(base_opts));
+    for (auto& overlay : _overlays) {
+        ColumnIteratorOptions overlay_opts = opts;
+        overlay_opts.read_file = overlay.read_file.get();
+        RETURN_IF_ERROR(overlay.iter->init(overlay_opts));
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnGroupIterator::next_batch(size_t* n, Column* dst) {
+    ordinal_t start = _base.iter->get_current_ordinal();
+    size_t dst_offset = dst->size();
+    RETURN_IF_ERROR(_base.iter->next_batch(n, dst));
+    return _patch(start, *n, dst_offset, dst);
+}
+
+Status DeltaColumnGroupIterator::next_batch(const SparseRange<>& range, Column* dst) {
+    size_t dst_offset = dst->size();
+    RETURN_IF_ERROR(_base.iter->next_batch(range, dst));
+    for (size_t i = 0; i < range.size(); i++) {
+        RETURN_IF_ERROR(_patch(range[i].begin(), range[i].span_size(), dst_offset, dst));
+        dst_offset += range[i].span_size();
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnGroupIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) {
+    size_t dst_offset = values->size();
+    RETURN_IF_ERROR(_base.iter->fetch_values_by_rowid(rowids, size, values));
+    for (auto& overlay : _overlays) {
+        std::vector<rowid_t> overlay_rowids;
+        std::vector<uint32_t> dst_indexes;
+        for (size_t i = 0; i < size; i++) {
+            auto itr = std::lower_bound(overlay.rowids.begin(), overlay.rowids.end(), rowids[i]);
+            if (itr != overlay.rowids.end() && *itr == rowids[i]) {
+                overlay_rowids.push_back(itr - overlay.rowids.begin());
+                dst_indexes.push_back(dst_offset + i);
+            }
+        }
+        RETURN_IF_ERROR(_fill_from_overlay(overlay, overlay_rowids, dst_indexes, values));
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnGroupIterator::_patch(ordinal_t start, size_t n, size_t dst_offset, Column* dst) {
+    for (auto& overlay : _overlays) {
+        auto begin = std::lower_bound(overlay.rowids.begin(), overlay.rowids.end(), start);
+        auto end = std::lower_bound(begin, overlay.rowids.end(), start + n);
+        if (begin == end) {
+            continue;
+        }
+        std::vector<rowid_t> overlay_rowids;
+        std::vector<uint32_t> dst_indexes;
+        for (auto itr = begin; itr != end; itr++) {
+            overlay_rowids.push_back(itr - overlay.rowids.begin());
+            dst_indexes.push_back(dst_offset + (*itr - start));
+        }
+        RETURN_IF_ERROR(_fill_from_overlay(overlay, overlay_rowids, dst_indexes, dst));
+    }
+    return Status::OK();
+}
+
+Status DeltaColumnGroupIterator::_fill_from_overlay(Source& overlay, const std::vector<rowid_t>& overlay_rowids,
+                                                    const std::vector<uint32_t>& dst_indexes, Column* dst) {
+    if (overlay_rowids.empty()) {
+        return Status::OK();
+    }
+    auto patch_column = dst->clone_empty();
+    RETURN_IF_ERROR(
+            overlay.iter->fetch_values_by_rowid(overlay_rowids.data(), overlay_rowids.size(), patch_column.get()));
+    dst->update_rows(*patch_column, dst_indexes.data());
+    return Status::OK();
+}
+
+} // namespace starrocks
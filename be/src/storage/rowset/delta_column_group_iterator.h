@@ -0,0 +1,74 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "fs/fs.h"
+#include "storage/rowset/column_iterator.h"
+
+namespace starrocks {
+
+// Iterator which merges sparse `.cols` files into a base column at read time.
+// A sparse delta column group file only contains the rows updated by a column
+// mode partial update, together with the sorted source row ids it covers.
+// This iterator reads the base column (the segment itself or a full-length
+// `.cols` file) and patches the rows covered by the sparse overlays, newest
+// overlay wins.
+class DeltaColumnGroupIterator final : public ColumnIterator {
+public:
+    // One data source of the overlay stack. |rowids| is the sorted list of source
+    // row ids covered by a sparse `.cols` file, it is empty for the base source
+    // which covers every row of the segment.
+    struct Source {
+        std::unique_ptr<ColumnIterator> iter;
+        std::unique_ptr<RandomAccessFile> read_file;
+        std::vector<uint32_t> rowids;
+    };
+
+    // |base| covers every row of the segment, |overlays| are sparse sources
+    // ordered from old version to new version.
+    DeltaColumnGroupIterator(Source base, std::vector<Source> overlays)
+            : _base(std::move(base)), _overlays(std::move(overlays)) {}
+
+    ~DeltaColumnGroupIterator() override = default;
+
+    [[nodiscard]] Status init(const ColumnIteratorOptions& opts) override;
+
+    [[nodiscard]] Status seek_to_first() override { return _base.iter->seek_to_first(); }
+
+    [[nodiscard]] Status seek_to_ordinal(ordinal_t ord) override { return _base.iter->seek_to_ordinal(ord); }
+
+    ordinal_t get_current_ordinal() const override { return _base.iter->get_current_ordinal(); }
+
+    ordinal_t num_rows() const override { return _base.iter->num_rows(); }
+
+    [[nodiscard]] Status next_batch(size_t* n, Column* dst) override;
+
+    [[nodiscard]] Status next_batch(const SparseRange<>& range, Column* dst) override;
+
+    [[nodiscard]] Status fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) override;
+
+private:
+    // overwrite the rows in |dst| starting at |dst_offset| which hold the source
+    // rows [start, start + n) with the values from the sparse overlays
+    Status _patch(ordinal_t start, size_t n, size_t dst_offset, Column* dst);
+
+    Status _fill_from_overlay(Source& overlay, const std::vector<rowid_t>& overlay_rowids,
+                              const std::vector<uint32_t>& dst_indexes, Column* dst);
+
+    Source _base;
+    std::vector<Source> _overlays;
+};
+
+} // namespace starrocks
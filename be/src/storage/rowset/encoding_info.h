@@ -56,6 +56,11 @@ inline bool enable_non_string_column_dict_encoding() {
     return std::abs(config::dictionary_encoding_ratio_for_non_string_column - 0) > epsilon;
 }
 
+inline bool enable_sorted_column_for_encoding() {
+    double epsilon = 0.0001;
+    return std::abs(config::for_encoding_min_ordered_ratio - 0) > epsilon;
+}
+
 // We dont make TYPE_TINYINT support dict encoding. The reason is that TYPE_TINYINT is only have
 // 256 different values, that is too small to make our speculation mechanism work. And according
 // test results, when TINY_INT column is encoded using dict, the space usage is not necessarily
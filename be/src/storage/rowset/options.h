@@ -50,6 +50,10 @@ public:
     uint32_t data_page_size = DEFAULT_PAGE_SIZE;
 
     uint32_t dict_page_size = config::dictionary_page_size;
+
+    // when not nullptr, a dict-encoded page builder pre-seeds its dictionary
+    // with these words in order, instead of rebuilding it value by value
+    const std::vector<std::string>* seed_dict_words = nullptr;
 };
 
 class IndexReadOptions {
@@ -38,6 +38,7 @@
 #include <string>
 
 #include "column/column.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "fs/fs.h"
 #include "gutil/strings/substitute.h"
@@ -54,6 +55,17 @@ namespace starrocks {
 
 using strings::Substitute;
 
+bool PageIO::sample_verify_checksum() {
+    double ratio = config::page_checksum_verify_sample_ratio;
+    if (ratio >= 1.0) return true;
+    if (ratio <= 0.0) return false;
+    // a cheap thread-local LCG is enough here, the only requirement is that the sampled
+    // pages change between reads so repeated corruption cannot hide forever.
+    thread_local uint32_t seed = static_cast<uint32_t>(reinterpret_cast<uintptr_t>(&seed));
+    seed = seed * 1103515245u + 12345u;
+    return ((seed >> 16) & 0x7fff) < static_cast<uint32_t>(ratio * 0x8000);
+}
+
 Status PageIO::compress_page_body(const BlockCompressionCodec* codec, double min_space_saving,
                                   const std::vector<Slice>& body, faststring* compressed_body) {
     size_t uncompressed_size = Slice::compute_total_size(body);
@@ -118,6 +118,11 @@ public:
     //     `footer' stores the page footer.
     static Status read_and_decompress_page(const PageReadOptions& opts, PageHandle* handle, Slice* body,
                                            PageFooterPB* footer);
+
+    // Whether this particular page read should verify the checksum, honoring
+    // config::page_checksum_verify_sample_ratio. Callers that rewrite data (compaction,
+    // schema change) must keep full verification and not consult this.
+    static bool sample_verify_checksum();
 };
 
 } // namespace starrocks
@@ -0,0 +1,77 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/pre_agg_hll_index.h"
+
+#include "storage/olap_type_infra.h"
+#include "storage/type_traits.h"
+#include "storage/types.h"
+#include "types/hll.h"
+#include "util/hash_util.hpp"
+#include "util/slice.h"
+
+namespace starrocks {
+
+template <LogicalType type>
+class PreAggHllIndexWriterImpl final : public PreAggHllIndexWriter {
+    using CppType = typename TypeTraits<type>::CppType;
+
+public:
+    PreAggHllIndexWriterImpl() = default;
+
+    void add_values(const void* values, size_t count) override {
+        const auto* vals = reinterpret_cast<const CppType*>(values);
+        for (size_t i = 0; i < count; i++) {
+            if constexpr (std::is_same_v<CppType, Slice>) {
+                _hll.update(HashUtil::murmur_hash64A(vals[i].data, vals[i].size, HashUtil::MURMUR_SEED));
+            } else {
+                _hll.update(HashUtil::murmur_hash64A(&vals[i], sizeof(CppType), HashUtil::MURMUR_SEED));
+            }
+        }
+    }
+
+    // approx_count_distinct ignores nulls, so does the sketch.
+    void add_nulls(uint32_t count) override {}
+
+    Status finish(ColumnIndexMetaPB* index_meta) override {
+        index_meta->set_type(PRE_AGG_HLL_INDEX);
+        std::string buffer;
+        buffer.resize(_hll.max_serialized_size());
+        size_t actual_size = _hll.serialize(reinterpret_cast<uint8_t*>(buffer.data()));
+        buffer.resize(actual_size);
+        index_meta->mutable_pre_agg_hll_index()->set_hll(std::move(buffer));
+        return Status::OK();
+    }
+
+    uint64_t size() const override { return _hll.max_serialized_size(); }
+
+private:
+    HyperLogLog _hll;
+};
+
+std::unique_ptr<PreAggHllIndexWriter> PreAggHllIndexWriter::create(TypeInfo* type_info) {
+    switch (type_info->type()) {
+#define M(ftype) \
+    case ftype:  \
+        return std::make_unique<PreAggHllIndexWriterImpl<ftype>>();
+        APPLY_FOR_BITMAP_INDEX_TYPE(M)
+        M(TYPE_VARBINARY)
+#undef M
+    default:
+        // composite and object-like types have no well-defined per-value hash at this layer.
+        return nullptr;
+    }
+}
+
+} // namespace starrocks
@@ -0,0 +1,52 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "common/status.h"
+#include "gen_cpp/segment.pb.h"
+
+namespace starrocks {
+
+class TypeInfo;
+
+// Write-time pre-aggregated NDV sketch: a single HyperLogLog over all non-null values of the
+// column, stored inline in the column meta like the segment-level zone map. A query computing
+// approx_count_distinct with no row filter can merge the per-segment sketches directly instead
+// of re-hashing every row.
+//
+// Values are hashed with the same murmur hash the approx_count_distinct aggregate uses. For
+// types whose storage representation equals the in-memory representation (integers, strings)
+// the sketches are interchangeable with sketches built at query time; for types with a distinct
+// storage layout (dates, decimals) they are only consistent among themselves, so a consumer must
+// use sketches for either all segments or none.
+class PreAggHllIndexWriter {
+public:
+    // may return nullptr for types the sketch does not support.
+    static std::unique_ptr<PreAggHllIndexWriter> create(TypeInfo* type_info);
+
+    virtual ~PreAggHllIndexWriter() = default;
+
+    virtual void add_values(const void* values, size_t count) = 0;
+
+    virtual void add_nulls(uint32_t count) = 0;
+
+    virtual Status finish(ColumnIndexMetaPB* index_meta) = 0;
+
+    virtual uint64_t size() const = 0;
+};
+
+} // namespace starrocks
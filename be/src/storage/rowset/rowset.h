@@ -50,6 +50,7 @@
 #include "storage/rowset/base_rowset.h"
 #include "storage/rowset/rowset_meta.h"
 #include "storage/rowset/segment.h"
+#include "util/time.h"
 
 namespace starrocks {
 
@@ -317,7 +318,15 @@ public:
     }
 
     // this function is called by reader to increase reference of rowset
-    void acquire() { ++_refs_by_reader; }
+    void acquire() {
+        ++_refs_by_reader;
+        _last_access_time.store(UnixSeconds(), std::memory_order_relaxed);
+    }
+
+    // timestamp (seconds since epoch) of the most recent read access, or the rowset object's
+    // creation time if it has never been read. tiering policies use this recency signal to
+    // tell hot rowsets from cold ones.
+    int64_t last_access_time() const { return _last_access_time.load(std::memory_order_relaxed); }
 
     void release() {
         // if the refs by reader is 0 and the rowset is closed, should release the resouce
@@ -399,6 +408,8 @@ protected:
     bool _need_delete_file = false;
     // variable to indicate how many rowset readers owned this rowset
     std::atomic<uint64_t> _refs_by_reader;
+    // updated on every reader acquire, see last_access_time()
+    std::atomic<int64_t> _last_access_time;
     RowsetStateMachine _rowset_state_machine;
 
 private:
@@ -121,6 +121,7 @@ Status RowsetWriter::init() {
     _writer_options.segment_file_mark.rowset_id = _context.rowset_id.to_string();
 
     _writer_options.global_dicts = _context.global_dicts != nullptr ? _context.global_dicts : nullptr;
+    _writer_options.seed_dict_words_by_uid = _context.seed_dict_words_by_uid;
     _writer_options.referenced_column_ids = _context.referenced_column_ids;
 
     if (_context.tablet_schema->keys_type() == KeysType::PRIMARY_KEYS &&
@@ -466,6 +467,16 @@ HorizontalRowsetWriter::~HorizontalRowsetWriter() {
     }
 }
 
+WritableFileOptions RowsetWriter::_segment_file_options() const {
+    WritableFileOptions opts;
+    if (_context.is_compaction && config::enable_compaction_segment_direct_write &&
+        _fs->type() == FileSystem::POSIX) {
+        opts.direct_write = true;
+        opts.direct_write_buffer_size = config::compaction_segment_direct_write_buffer_size;
+    }
+    return opts;
+}
+
 StatusOr<std::unique_ptr<SegmentWriter>> HorizontalRowsetWriter::_create_segment_writer() {
     std::lock_guard<std::mutex> l(_lock);
     std::string path;
@@ -478,7 +489,7 @@ StatusOr<std::unique_ptr<SegmentWriter>> HorizontalRowsetWriter::_create_segment
         // temporary segment files.
         path = Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id, _num_segment);
     }
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(path));
+    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(_segment_file_options(), path));
     const auto schema = _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init());
@@ -1228,8 +1239,10 @@ Status VerticalRowsetWriter::final_flush() {
 StatusOr<std::unique_ptr<SegmentWriter>> VerticalRowsetWriter::_create_segment_writer(
         const std::vector<uint32_t>& column_indexes, bool is_key) {
     std::lock_guard<std::mutex> l(_lock);
-    ASSIGN_OR_RETURN(auto wfile, _fs->new_writable_file(Rowset::segment_file_path(_context.rowset_path_prefix,
-                                                                                  _context.rowset_id, _num_segment)));
+    ASSIGN_OR_RETURN(auto wfile,
+                     _fs->new_writable_file(_segment_file_options(),
+                                            Rowset::segment_file_path(_context.rowset_path_prefix, _context.rowset_id,
+                                                                      _num_segment)));
     const auto schema = _context.tablet_schema;
     auto segment_writer = std::make_unique<SegmentWriter>(std::move(wfile), _num_segment, schema, _writer_options);
     RETURN_IF_ERROR(segment_writer->init(column_indexes, is_key));
@@ -178,6 +178,10 @@ private:
     Status _flush_update_file(const SegmentPB& segment_pb, butil::IOBuf& data);
 
 protected:
+    // Options for creating segment data files. Compaction output may opt into buffered
+    // direct writes so rewriting cold rowsets does not pollute the OS page cache.
+    WritableFileOptions _segment_file_options() const;
+
     RowsetWriterContext _context;
     std::shared_ptr<FileSystem> _fs;
     std::unique_ptr<RowsetMetaPB> _rowset_meta_pb;
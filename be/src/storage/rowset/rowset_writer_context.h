@@ -34,6 +34,11 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 #include "fs/fs.h"
 #include "gen_cpp/olap_file.pb.h"
 #include "runtime/global_dict/types_fwd_decl.h"
@@ -82,6 +87,12 @@ public:
 
     GlobalDictByNameMaps* global_dicts = nullptr;
 
+    // column unique id -> dictionary words shared by every input segment of a
+    // compaction; when set, the output dict builders are pre-seeded with them so
+    // an identical source dictionary is carried forward instead of being rebuilt
+    // for each output segment
+    std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> seed_dict_words_by_uid;
+
     RowsetWriterType writer_type = kHorizontal;
 
     std::string merge_condition;
@@ -95,6 +106,9 @@ public:
     int64_t gtid = 0;
     // Is pk compaction output writer
     bool is_pk_compaction = false;
+    // Is compaction output writer, may write its segments with O_DIRECT,
+    // see enable_compaction_segment_direct_write
+    bool is_compaction = false;
 };
 
 } // namespace starrocks
@@ -316,10 +316,14 @@ template <LogicalType Type>
 Status ScalarColumnIterator::_load_dict_page() {
     DCHECK(_dict_decoder == nullptr);
     // read dictionary page
+    // a dictionary page is shared by all the data pages of the column and is expensive to re-decode,
+    // cache it at durable priority so bulk scans of normal-priority data pages do not evict it.
+    ColumnIteratorOptions dict_opts = _opts;
+    dict_opts.kept_in_memory = config::enable_dict_memory_page_cache;
     Slice dict_data;
     PageFooterPB dict_footer;
-    RETURN_IF_ERROR(
-            _reader->read_page(_opts, _reader->get_dict_page_pointer(), &_dict_page_handle, &dict_data, &dict_footer));
+    RETURN_IF_ERROR(_reader->read_page(dict_opts, _reader->get_dict_page_pointer(), &_dict_page_handle, &dict_data,
+                                       &dict_footer));
     // ignore dict_footer.dict_page_footer().encoding() due to only
     // PLAIN_ENCODING is supported for dict page right now
     if constexpr (Type == TYPE_CHAR || Type == TYPE_VARCHAR) {
@@ -591,25 +595,30 @@ Status ScalarColumnIterator::_fetch_by_rowid(const rowid_t* rowids, size_t size,
     size_t prev_bytes = values->byte_size();
     const rowid_t* const end = rowids + size;
     bool contain_deleted_row = (values->delete_state() != DEL_NOT_SATISFIED);
+    SparseRange<> read_range;
     do {
         RETURN_IF_ERROR(seek_to_ordinal(*rowids));
         contain_deleted_row = contain_deleted_row || _contains_deleted_row(_page->page_index());
         auto last_rowid = implicit_cast<rowid_t>(_page->first_ordinal() + _page->num_rows());
         const rowid_t* next_page_rowid = std::lower_bound(rowids, end, last_rowid);
+        // merge all the rowids that hit the current page into one sparse range relative to
+        // the page start, so the page decoder is entered once per page instead of once per
+        // run of consecutive rowids. This matters for highly selective scans, where most
+        // runs contain a single row.
+        read_range.clear();
         while (rowids != next_page_rowid) {
-            DCHECK_EQ(_current_ordinal, _page->first_ordinal() + _page->offset());
-            rowid_t curr = *rowids;
-            _current_ordinal = implicit_cast<ordinal_t>(curr);
-            RETURN_IF_ERROR(_page->seek(curr - _page->first_ordinal()));
+            const rowid_t first = *rowids;
+            rowid_t curr = first;
             const rowid_t* p = rowids + 1;
             while ((next_page_rowid != p) && (*p == curr + 1)) {
                 curr = *p++;
             }
-            size_t nread = p - rowids;
-            RETURN_IF_ERROR(page_parse(values, &nread));
-            _current_ordinal += nread;
+            read_range.add(Range<>(first - _page->first_ordinal(), curr + 1 - _page->first_ordinal()));
             rowids = p;
         }
+        DCHECK_EQ(_current_ordinal, _page->first_ordinal() + read_range.begin());
+        RETURN_IF_ERROR(page_parse(values, read_range));
+        _current_ordinal = _page->first_ordinal() + read_range.end();
         DCHECK_EQ(_current_ordinal, _page->first_ordinal() + _page->offset());
     } while (rowids != end);
     values->set_delete_state(contain_deleted_row ? DEL_PARTIAL_SATISFIED : DEL_NOT_SATISFIED);
@@ -619,12 +628,12 @@ Status ScalarColumnIterator::_fetch_by_rowid(const rowid_t* rowids, size_t size,
 }
 
 Status ScalarColumnIterator::fetch_values_by_rowid(const rowid_t* rowids, size_t size, Column* values) {
-    auto page_parse = [&](Column* column, size_t* count) { return _page->read(column, count); };
+    auto page_parse = [&](Column* column, const SparseRange<>& range) { return _page->read(column, range); };
     return _fetch_by_rowid(rowids, size, values, page_parse);
 }
 
 Status ScalarColumnIterator::fetch_dict_codes_by_rowid(const rowid_t* rowids, size_t size, Column* values) {
-    auto page_parse = [&](Column* column, size_t* count) { return _page->read_dict_codes(column, count); };
+    auto page_parse = [&](Column* column, const SparseRange<>& range) { return _page->read_dict_codes(column, range); };
     return _fetch_by_rowid(rowids, size, values, page_parse);
 }
 
@@ -0,0 +1,98 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/rowset/segment_cache.h"
+
+#include <bvar/bvar.h>
+
+#include "common/config.h"
+#include "storage/rowset/segment.h"
+#include "util/defer_op.h"
+#include "util/lru_cache.h"
+
+bvar::Adder<int64_t> g_segment_cache_hit("starrocks", "segment_cache_hit");   // NOLINT
+bvar::Adder<int64_t> g_segment_cache_miss("starrocks", "segment_cache_miss"); // NOLINT
+
+namespace starrocks {
+
+SegmentCache* SegmentCache::instance() {
+    static SegmentCache cache(std::max<int64_t>(0, config::segment_metadata_cache_capacity));
+    return &cache;
+}
+
+SegmentCache::SegmentCache(size_t capacity) {
+    if (capacity > 0) {
+        _cache.reset(new_lru_cache(capacity));
+    }
+}
+
+SegmentCache::~SegmentCache() = default;
+
+void SegmentCache::_segment_deleter(const CacheKey& /*key*/, void* value) {
+    delete static_cast<SegmentSharedPtr*>(value);
+}
+
+SegmentSharedPtr SegmentCache::lookup(std::string_view path) {
+    if (_cache == nullptr) {
+        return nullptr;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _lookup_no_lock(path);
+}
+
+SegmentSharedPtr SegmentCache::_lookup_no_lock(std::string_view path) {
+    auto* handle = _cache->lookup(CacheKey(path.data(), path.size()));
+    if (handle == nullptr) {
+        g_segment_cache_miss << 1;
+        return nullptr;
+    }
+    DeferOp defer([this, handle]() { _cache->release(handle); });
+    g_segment_cache_hit << 1;
+    return *static_cast<SegmentSharedPtr*>(_cache->value(handle));
+}
+
+SegmentSharedPtr SegmentCache::cache_if_absent(std::string_view path, SegmentSharedPtr segment) {
+    if (_cache == nullptr) {
+        return segment;
+    }
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (auto cached = _lookup_no_lock(path); cached != nullptr) {
+        return cached;
+    }
+    auto charge = segment->mem_usage();
+    auto* value = new SegmentSharedPtr(std::move(segment));
+    auto* handle = _cache->insert(CacheKey(path.data(), path.size()), value, charge, _segment_deleter);
+    DeferOp defer([this, handle]() { _cache->release(handle); });
+    return *static_cast<SegmentSharedPtr*>(_cache->value(handle));
+}
+
+void SegmentCache::erase(std::string_view path) {
+    if (_cache == nullptr) {
+        return;
+    }
+    _cache->erase(CacheKey(path.data(), path.size()));
+}
+
+void SegmentCache::prune() {
+    if (_cache == nullptr) {
+        return;
+    }
+    _cache->prune();
+}
+
+size_t SegmentCache::memory_usage() const {
+    return _cache != nullptr ? _cache->get_memory_usage() : 0;
+}
+
+} // namespace starrocks
@@ -0,0 +1,76 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string_view>
+
+#include "gutil/macros.h"
+
+namespace starrocks {
+
+class Cache;
+class CacheKey;
+class Segment;
+using SegmentSharedPtr = std::shared_ptr<Segment>;
+
+// A process-wide LRU cache of opened Segment objects keyed by segment file path, so that code
+// paths which open segments ad-hoc (instead of through a loaded Rowset, which already retains
+// its segments) do not re-read and re-parse the segment footer on every call.
+//
+// The cache capacity is a memory budget in bytes (`segment_metadata_cache_capacity`), each entry
+// is charged with Segment::mem_usage(). A capacity <= 0 disables the cache. File descriptors are
+// budgeted separately by FdCache; a cached Segment holds no open file.
+//
+// Entries must be erased when the underlying segment file is deleted or rewritten, see
+// Rowset::remove() and Rowset::reload_segment().
+class SegmentCache {
+public:
+    static SegmentCache* instance();
+
+    ~SegmentCache();
+
+    DISALLOW_COPY(SegmentCache);
+
+    // Returns the cached segment for |path|, or nullptr if not cached.
+    SegmentSharedPtr lookup(std::string_view path);
+
+    // Caches |segment| under |path| if no entry exists yet, returns the segment stored in the
+    // cache (the existing one on conflict, otherwise |segment|).
+    SegmentSharedPtr cache_if_absent(std::string_view path, SegmentSharedPtr segment);
+
+    // If the cache contains an entry for |path|, erase it. The Segment itself is kept alive
+    // until the last shared_ptr to it is dropped.
+    void erase(std::string_view path);
+
+    // Remove all cache entries that are not actively in use.
+    void prune();
+
+    size_t memory_usage() const;
+
+private:
+    explicit SegmentCache(size_t capacity);
+
+    static void _segment_deleter(const CacheKey& key, void* value);
+
+    SegmentSharedPtr _lookup_no_lock(std::string_view path);
+
+    std::unique_ptr<Cache> _cache;
+    // serializes the lookup-then-insert in cache_if_absent().
+    std::mutex _mutex;
+};
+
+} // namespace starrocks
@@ -49,6 +49,7 @@
 #include "storage/rowset/column_decoder.h"
 #include "storage/rowset/common.h"
 #include "storage/rowset/default_value_column_iterator.h"
+#include "storage/rowset/delta_column_group_iterator.h"
 #include "storage/rowset/dictcode_column_iterator.h"
 #include "storage/rowset/fill_subfield_iterator.h"
 #include "storage/rowset/rowid_column_iterator.h"
@@ -272,10 +273,11 @@ private:
     void _init_column_access_paths();
 
     // search delta column group by column uniqueid, if this column exist in delta column group,
-    // then return column iterator and delta column's fillname.
+    // then return column iterator and the file name of the column's base data
+    // (which may be the segment itself when only sparse `.cols` files cover it).
     // Or just return null
-    StatusOr<std::unique_ptr<ColumnIterator>> _new_dcg_column_iterator(uint32_t ucid, std::string* filename,
-                                                                       ColumnAccessPath* path);
+    StatusOr<std::unique_ptr<ColumnIterator>> _new_dcg_column_iterator(ColumnId cid, uint32_t ucid,
+                                                                       std::string* filename, ColumnAccessPath* path);
 
     // This function is a unified entry for creating column iterators.
     // `ucid` means unique column id, use it for searching delta column group.
@@ -514,18 +516,61 @@ StatusOr<std::shared_ptr<Segment>> SegmentIterator::_get_dcg_segment(uint32_t uc
     return nullptr;
 }
 
-StatusOr<std::unique_ptr<ColumnIterator>> SegmentIterator::_new_dcg_column_iterator(uint32_t ucid,
+StatusOr<std::unique_ptr<ColumnIterator>> SegmentIterator::_new_dcg_column_iterator(ColumnId cid, uint32_t ucid,
                                                                                     std::string* filename,
                                                                                     ColumnAccessPath* path) {
-    // build column iter from delta column group
-    ASSIGN_OR_RETURN(auto dcg_segment, _get_dcg_segment(ucid));
-    if (dcg_segment != nullptr) {
-        if (filename != nullptr) {
-            *filename = dcg_segment->file_name();
+    RandomAccessFileOptions file_opts{.skip_fill_local_cache = !_opts.lake_io_opts.fill_data_cache,
+                                      .buffer_size = _opts.lake_io_opts.buffer_size};
+    // build column iter from delta column group, walk the dcgs from new version
+    // to old version and collect sparse `.cols` overlays until the first
+    // full-length file (or the segment itself) which covers every row
+    std::vector<DeltaColumnGroupIterator::Source> overlays;
+    for (const auto& dcg : _dcgs) {
+        // cols file index -> column index in corresponding file
+        std::pair<int32_t, int32_t> idx = dcg->get_column_idx(ucid);
+        if (idx.first < 0) {
+            continue;
         }
-        return dcg_segment->new_column_iterator(ucid, path);
-    }
-    return nullptr;
+        auto column_file = dcg->column_files(parent_name(_segment->file_name()))[idx.first];
+        if (_dcg_segments.count(column_file) == 0) {
+            ASSIGN_OR_RETURN(auto dcg_segment, _segment->new_dcg_segment(*dcg, idx.first, _opts.tablet_schema));
+            _dcg_segments[column_file] = dcg_segment;
+        }
+        auto dcg_segment = _dcg_segments[column_file];
+        if (!dcg->sparse(idx.first)) {
+            if (filename != nullptr) {
+                *filename = dcg_segment->file_name();
+            }
+            ASSIGN_OR_RETURN(auto base_iter, dcg_segment->new_column_iterator(ucid, path));
+            if (overlays.empty()) {
+                // common case: the newest delta column group covers every row
+                return base_iter;
+            }
+            std::reverse(overlays.begin(), overlays.end());
+            // the base file is opened by the caller and wired through init()
+            return std::make_unique<DeltaColumnGroupIterator>(
+                    DeltaColumnGroupIterator::Source{std::move(base_iter), nullptr, {}}, std::move(overlays));
+        }
+        // sparse overlay, it owns its read file
+        DeltaColumnGroupIterator::Source overlay;
+        ASSIGN_OR_RETURN(overlay.iter, dcg_segment->new_column_iterator(ucid, path));
+        ASSIGN_OR_RETURN(overlay.read_file, _opts.fs->new_random_access_file(file_opts, dcg_segment->file_info()));
+        overlay.rowids = dcg->column_rowids(idx.first);
+        overlays.emplace_back(std::move(overlay));
+    }
+    if (overlays.empty()) {
+        // the column not exist in delta column group
+        return nullptr;
+    }
+    // only sparse overlays cover this column, the base is the segment itself
+    if (filename != nullptr) {
+        *filename = _segment->file_name();
+    }
+    auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
+    ASSIGN_OR_RETURN(auto base_iter, _segment->new_column_iterator_or_default(tablet_schema->column(cid), path));
+    std::reverse(overlays.begin(), overlays.end());
+    return std::make_unique<DeltaColumnGroupIterator>(
+            DeltaColumnGroupIterator::Source{std::move(base_iter), nullptr, {}}, std::move(overlays));
 }
 
 void SegmentIterator::_init_column_access_paths() {
@@ -565,15 +610,17 @@ Status SegmentIterator::_init_column_iterator_by_cid(const ColumnId cid, const C
         LOG(ERROR) << "invalid unique columnid in segment iterator, ucid: " << ucid
                    << ", segment: " << _segment->file_name();
     }
-    ASSIGN_OR_RETURN(auto col_iter, _new_dcg_column_iterator((uint32_t)ucid, &dcg_filename, access_path));
+    ASSIGN_OR_RETURN(auto col_iter, _new_dcg_column_iterator(cid, (uint32_t)ucid, &dcg_filename, access_path));
     if (col_iter == nullptr) {
         // not found in delta column group, create normal column iterator
         auto tablet_schema = _opts.tablet_schema ? _opts.tablet_schema : _segment->tablet_schema_share_ptr();
         const auto& col = tablet_schema->column(cid);
         ASSIGN_OR_RETURN(_column_iterators[cid], _segment->new_column_iterator_or_default(col, access_path));
         ASSIGN_OR_RETURN(auto rfile, _opts.fs->new_random_access_file(opts, _segment->file_info()));
-        if (config::io_coalesce_lake_read_enable && !_segment->is_default_column(col) &&
-            _segment->lake_tablet_manager() != nullptr) {
+        const bool is_lake_segment = _segment->lake_tablet_manager() != nullptr;
+        const bool enable_io_coalesce = is_lake_segment ? config::io_coalesce_lake_read_enable
+                                                        : config::io_coalesce_local_read_enable;
+        if (enable_io_coalesce && !_segment->is_default_column(col)) {
             ASSIGN_OR_RETURN(auto file_size, _segment->get_data_size());
             auto shared_buffered_input_stream =
                     std::make_unique<io::SharedBufferedInputStream>(rfile->stream(), _segment->file_name(), file_size);
@@ -1979,6 +2026,16 @@ Status SegmentIterator::_apply_inverted_index() {
         cid_2_fid.emplace(_schema.field(i)->id(), i);
     }
 
+    // Batch the index probes: evaluate every predicate into its own docid bitmap first, then
+    // combine the bitmaps from the smallest cardinality on, so the candidate set shrinks as
+    // fast as possible. Once some probe comes back empty the remaining probes are skipped,
+    // since the final scan range is already empty.
+    struct InvertedIndexHit {
+        const ColumnPredicate* pred;
+        roaring::Roaring hits;
+    };
+    std::vector<InvertedIndexHit> index_hits;
+    bool hit_empty = false;
     for (auto& [cid, pred_list] : _cid_to_predicates) {
         InvertedIndexIterator* inverted_iter = _inverted_index_iterators[cid];
         if (inverted_iter == nullptr) {
@@ -1990,12 +2047,27 @@ Status SegmentIterator::_apply_inverted_index() {
         std::string column_name(_schema.field(it->second)->name());
         for (const ColumnPredicate* pred : pred_list) {
             if (_inverted_index_iterators[cid]->is_untokenized() || pred->type() == PredicateType::kExpr) {
-                Status res = pred->seek_inverted_index(column_name, _inverted_index_iterators[cid], &row_bitmap);
+                roaring::Roaring hits = row_bitmap;
+                Status res = pred->seek_inverted_index(column_name, _inverted_index_iterators[cid], &hits);
                 if (res.ok()) {
-                    erased_preds.emplace(pred);
+                    hit_empty |= hits.isEmpty();
+                    index_hits.push_back({pred, std::move(hits)});
                 }
             }
+            if (hit_empty) {
+                break;
+            }
         }
+        if (hit_empty) {
+            break;
+        }
+    }
+    std::sort(index_hits.begin(), index_hits.end(), [](const InvertedIndexHit& lhs, const InvertedIndexHit& rhs) {
+        return lhs.hits.cardinality() < rhs.hits.cardinality();
+    });
+    for (auto& index_hit : index_hits) {
+        row_bitmap &= index_hit.hits;
+        erased_preds.emplace(index_hit.pred);
     }
     DCHECK_LE(row_bitmap.cardinality(), _scan_range.span_size());
     _scan_range = roaring2range(row_bitmap);
@@ -42,16 +42,20 @@
 #include "column/datum_tuple.h"
 #include "column/nullable_column.h"
 #include "column/schema.h"
+#include "common/config.h"
 #include "common/logging.h" // LOG
 #include "fs/fs.h"          // FileSystem
 #include "gen_cpp/segment.pb.h"
+#include "runtime/current_thread.h"
 #include "storage/inverted/index_descriptor.hpp"
 #include "storage/row_store_encoder.h"
 #include "storage/rowset/column_writer.h" // ColumnWriter
 #include "storage/rowset/page_io.h"
 #include "storage/seek_tuple.h"
 #include "storage/short_key_index.h"
+#include "storage/storage_engine.h"
 #include "types/logical_type.h"
+#include "util/threadpool.h"
 #include "util/crc32c.h"
 #include "util/faststring.h"
 #include "util/json.h"
@@ -168,7 +172,18 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
         if (column.type() == LogicalType::TYPE_ARRAY) {
             opts.need_zone_map = false;
         }
+        // the brin index refines the zone map within pages, so write it for the same columns.
+        opts.need_brin_index = opts.need_zone_map && config::brin_index_block_size > 0;
+        // the pre-aggregated NDV sketch is cheap to maintain, write it for every column that
+        // supports it (the writer factory rejects composite and object-like types).
+        opts.need_pre_agg_hll = config::enable_pre_agg_hll_index;
         opts.need_bloom_filter = column.is_bf_column();
+        // primary-key tables mostly see point lookups, where the cuckoo filter
+        // gives a lower false positive rate for the same space.
+        if (opts.need_bloom_filter && config::enable_cuckoo_filter_index &&
+            _tablet_schema->keys_type() == KeysType::PRIMARY_KEYS) {
+            opts.bloom_filter_algorithm = CUCKOO_FILTER;
+        }
         opts.need_bitmap_index = column.has_bitmap_index();
         opts.need_inverted_index = _tablet_schema->has_index(column.unique_id(), GIN);
 
@@ -197,6 +212,13 @@ Status SegmentWriter::init(const std::vector<uint32_t>& column_indexes, bool has
             }
         }
 
+        if (is_string_type(column.type()) && _opts.seed_dict_words_by_uid != nullptr) {
+            auto iter = _opts.seed_dict_words_by_uid->find(column.unique_id());
+            if (iter != _opts.seed_dict_words_by_uid->end()) {
+                opts.seed_dict_words = &iter->second;
+            }
+        }
+
         opts.need_flat = config::enable_json_flat;
         ASSIGN_OR_RETURN(auto writer, ColumnWriter::create(opts, &column, _wfile.get()));
         RETURN_IF_ERROR(writer->init());
@@ -275,6 +297,11 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
     }
     _num_rows_written = 0;
 
+    // finish all writers up front: the final page encode of each column is
+    // independent and may run concurrently, while the data/index writes below
+    // must stay ordered on the shared segment file
+    RETURN_IF_ERROR(_finish_column_writers());
+
     size_t num_columns = _tablet_schema->num_columns();
     for (size_t i = 0; i < _column_indexes.size(); ++i) {
         uint32_t column_index = _column_indexes[i];
@@ -284,7 +311,6 @@ Status SegmentWriter::finalize_columns(uint64_t* index_size) {
         }
 
         auto& column_writer = _column_writers[i];
-        RETURN_IF_ERROR(column_writer->finish());
         // write data
         RETURN_IF_ERROR(column_writer->write_data());
         // write index
@@ -369,13 +395,84 @@ Status SegmentWriter::_write_raw_data(const std::vector<Slice>& slices) {
     return Status::OK();
 }
 
-Status SegmentWriter::append_chunk(const Chunk& chunk) {
-    size_t chunk_num_rows = chunk.num_rows();
+// Returns the pool used to encode the column writers of one segment concurrently,
+// or nullptr when the feature is disabled or the segment is too narrow to benefit.
+static ThreadPool* column_encode_pool(size_t num_columns) {
+    if (num_columns < 2 || config::segment_flush_column_concurrency <= 1) {
+        return nullptr;
+    }
+    auto* engine = StorageEngine::instance();
+    return engine == nullptr ? nullptr : engine->segment_flush_column_pool();
+}
+
+// Encode |chunk| into the column writers, fanning the columns out to the
+// segment_flush_column pool when it is enabled so that flushing a wide table
+// does not serialize all column encoding on one flush thread. The writers only
+// buffer pages in memory here; every write to the shared segment file stays on
+// the calling thread.
+Status SegmentWriter::_append_chunk_columns(const Chunk& chunk) {
     size_t chunk_num_columns = chunk.num_columns();
+    ThreadPool* pool = column_encode_pool(chunk_num_columns);
+    if (pool == nullptr) {
+        for (size_t i = 0; i < chunk_num_columns; ++i) {
+            const Column* col = chunk.get_column_by_index(i).get();
+            RETURN_IF_ERROR(_column_writers[i]->append(*col));
+        }
+        return Status::OK();
+    }
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    std::vector<Status> statuses(chunk_num_columns);
+    auto* mem_tracker = CurrentThread::mem_tracker();
     for (size_t i = 0; i < chunk_num_columns; ++i) {
-        const Column* col = chunk.get_column_by_index(i).get();
-        RETURN_IF_ERROR(_column_writers[i]->append(*col));
+        auto task = [&, mem_tracker, i]() {
+            SCOPED_THREAD_LOCAL_MEM_SETTER(mem_tracker, false);
+            statuses[i] = _column_writers[i]->append(*chunk.get_column_by_index(i));
+        };
+        if (!token->submit_func(task).ok()) {
+            // the pool is shutting down or overloaded, encode on the calling thread
+            task();
+        }
+    }
+    token->wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
     }
+    return Status::OK();
+}
+
+// Finish all column writers, encoding their final pages concurrently when the
+// segment_flush_column pool is enabled.
+Status SegmentWriter::_finish_column_writers() {
+    ThreadPool* pool = column_encode_pool(_column_writers.size());
+    if (pool == nullptr) {
+        for (auto& column_writer : _column_writers) {
+            RETURN_IF_ERROR(column_writer->finish());
+        }
+        return Status::OK();
+    }
+    auto token = pool->new_token(ThreadPool::ExecutionMode::CONCURRENT);
+    std::vector<Status> statuses(_column_writers.size());
+    auto* mem_tracker = CurrentThread::mem_tracker();
+    for (size_t i = 0; i < _column_writers.size(); ++i) {
+        auto task = [&, mem_tracker, i]() {
+            SCOPED_THREAD_LOCAL_MEM_SETTER(mem_tracker, false);
+            statuses[i] = _column_writers[i]->finish();
+        };
+        if (!token->submit_func(task).ok()) {
+            task();
+        }
+    }
+    token->wait();
+    for (auto& st : statuses) {
+        RETURN_IF_ERROR(st);
+    }
+    return Status::OK();
+}
+
+Status SegmentWriter::append_chunk(const Chunk& chunk) {
+    size_t chunk_num_rows = chunk.num_rows();
+    size_t chunk_num_columns = chunk.num_columns();
+    RETURN_IF_ERROR(_append_chunk_columns(chunk));
 
     // TODO(cbl): put the fill full row column logic here is a bit hacky, this segment writer is used in many other
     //            situations(compaction etc.), so better to put it into somewhere early in the write pipeline
@@ -37,6 +37,7 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -76,6 +77,9 @@ struct SegmentWriterOptions {
     GlobalDictByNameMaps* global_dicts = nullptr;
     std::vector<int32_t> referenced_column_ids;
     SegmentFileMark segment_file_mark;
+    // column unique id -> dictionary words shared by every input segment of a
+    // compaction, used to pre-seed the dict builders of the output columns
+    std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> seed_dict_words_by_uid;
 };
 
 // SegmentWriter is responsible for writing data into single segment by all or partital columns.
@@ -144,6 +148,8 @@ public:
     uint64_t current_filesz() const;
 
 private:
+    Status _append_chunk_columns(const Chunk& chunk);
+    Status _finish_column_writers();
     Status _write_short_key_index();
     Status _write_footer();
     Status _write_raw_data(const std::vector<Slice>& slices);
@@ -14,6 +14,8 @@
 
 #include "rowset_column_update_state.h"
 
+#include <algorithm>
+
 #include "common/tracer.h"
 #include "fs/fs_util.h"
 #include "gutil/strings/substitute.h"
@@ -25,6 +27,7 @@
 #include "storage/rowset/default_value_column_iterator.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_options.h"
+#include "storage/rowset/segment_cache.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset/segment_rewriter.h"
 #include "storage/tablet.h"
@@ -297,12 +300,16 @@ static StatusOr<ChunkPtr> read_from_source_segment(Rowset* rowset, const Schema&
                                                    OlapReaderStatistics* stats, int64_t version,
                                                    RowsetSegmentId rowset_seg_id, const std::string& path) {
     ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(rowset->rowset_path()));
-    auto segment = Segment::open(fs, FileInfo{path}, rowset_seg_id.segment_id, rowset->schema());
-    if (!segment.ok()) {
-        LOG(WARNING) << "Fail to open " << path << ": " << segment.status();
-        return segment.status();
+    auto segment = SegmentCache::instance()->lookup(path);
+    if (segment == nullptr) {
+        auto res = Segment::open(fs, FileInfo{path}, rowset_seg_id.segment_id, rowset->schema());
+        if (!res.ok()) {
+            LOG(WARNING) << "Fail to open " << path << ": " << res.status();
+            return res.status();
+        }
+        segment = SegmentCache::instance()->cache_if_absent(path, std::move(res).value());
     }
-    if ((*segment)->num_rows() == 0) {
+    if (segment->num_rows() == 0) {
         return Status::InternalError("empty segment");
     }
     SegmentReadOptions seg_options;
@@ -314,8 +321,8 @@ static StatusOr<ChunkPtr> read_from_source_segment(Rowset* rowset, const Schema&
     seg_options.version = version;
     // not use delvec loader
     seg_options.dcg_loader = std::make_shared<LocalDeltaColumnGroupLoader>(tablet->data_dir()->get_meta());
-    ASSIGN_OR_RETURN(auto seg_iter, (*segment)->new_iterator(schema, seg_options));
-    auto source_chunk_ptr = ChunkHelper::new_chunk(schema, (*segment)->num_rows());
+    ASSIGN_OR_RETURN(auto seg_iter, segment->new_iterator(schema, seg_options));
+    auto source_chunk_ptr = ChunkHelper::new_chunk(schema, segment->num_rows());
     auto tmp_chunk_ptr = ChunkHelper::new_chunk(schema, 1024);
     while (true) {
         tmp_chunk_ptr->reset();
@@ -430,6 +437,48 @@ Status RowsetColumnUpdateState::_update_source_chunk_by_upt(const UptidToRowidPa
     return Status::OK();
 }
 
+// build the chunk for a sparse `.cols` file without touching the source segment:
+// only the updated rows are read from the update files and scattered to their
+// positions in the (rowid sorted) sparse chunk.
+StatusOr<ChunkPtr> RowsetColumnUpdateState::_build_sparse_update_chunk(const UptidToRowidPairs& upt_id_to_rowid_pairs,
+                                                                       const std::vector<uint32_t>& rowids,
+                                                                       const Schema& partial_schema, Rowset* rowset,
+                                                                       OlapReaderStatistics* stats,
+                                                                       MemTracker* tracker) {
+    ChunkPtr sparse_chunk = ChunkHelper::new_chunk(partial_schema, rowids.size());
+    for (auto& column : sparse_chunk->columns()) {
+        column->append_default(rowids.size());
+    }
+    // handle upt files one by one, a later update file overwrites an earlier one
+    // for the same source row, like the full-length path does
+    for (const auto& each : upt_id_to_rowid_pairs) {
+        const uint32_t upt_id = each.first;
+        ChunkUniquePtr upt_chunk = ChunkHelper::new_chunk(partial_schema, DEFAULT_CHUNK_SIZE);
+        ASSIGN_OR_RETURN(auto update_iterator, rowset->get_update_file_iterator(partial_schema, upt_id, stats));
+        DeferOp iter_defer([&]() {
+            if (update_iterator != nullptr) {
+                update_iterator->close();
+            }
+        });
+        RETURN_IF_ERROR(read_chunk_from_update_file(update_iterator, upt_chunk));
+        const size_t upt_chunk_size = upt_chunk->memory_usage();
+        tracker->consume(upt_chunk_size);
+        DeferOp tracker_defer([&]() { tracker->release(upt_chunk_size); });
+        std::vector<uint32_t> upt_rowids;
+        std::vector<uint32_t> sparse_positions;
+        for (const auto& each_pair : each.second) {
+            auto pos_itr = std::lower_bound(rowids.begin(), rowids.end(), each_pair.first);
+            DCHECK(pos_itr != rowids.end() && *pos_itr == each_pair.first);
+            sparse_positions.push_back(pos_itr - rowids.begin());
+            upt_rowids.push_back(each_pair.second);
+        }
+        auto tmp_chunk = ChunkHelper::new_chunk(partial_schema, upt_rowids.size());
+        tmp_chunk->append_selective(*upt_chunk, upt_rowids.data(), 0, upt_rowids.size());
+        RETURN_IF_EXCEPTION(sparse_chunk->update_rows(*tmp_chunk, sparse_positions.data()));
+    }
+    return sparse_chunk;
+}
+
 // this function build segment writer for segment files
 StatusOr<std::unique_ptr<SegmentWriter>> RowsetColumnUpdateState::_prepare_segment_writer(
         Rowset* rowset, const TabletSchemaCSPtr& tablet_schema, int segment_id) {
@@ -668,6 +717,27 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
         insert_rows += _partial_update_states[upt_id].insert_rowids.size();
         update_rows += _partial_update_states[upt_id].rss_rowid_to_update_rowid.size();
     }
+    // decide which segments take the sparse `.cols` fast path: when only a few
+    // rows of a segment are updated, rewriting the updated columns full length
+    // costs I/O proportional to the segment size, so write only the updated rows
+    // plus their source rowids and merge them lazily at read instead
+    std::map<uint32_t, std::vector<uint32_t>> rssid_to_sparse_rowids;
+    if (config::partial_update_sparse_dcg_max_rows > 0) {
+        for (const auto& each : rss_upt_id_to_rowid_pairs) {
+            std::vector<uint32_t> rowids;
+            for (const auto& upt : each.second) {
+                for (const auto& each_pair : upt.second) {
+                    rowids.push_back(each_pair.first);
+                }
+            }
+            if (rowids.size() > static_cast<size_t>(config::partial_update_sparse_dcg_max_rows)) {
+                continue;
+            }
+            std::sort(rowids.begin(), rowids.end());
+            rowids.erase(std::unique(rowids.begin(), rowids.end()), rowids.end());
+            rssid_to_sparse_rowids.emplace(each.first, std::move(rowids));
+        }
+    }
     cost_str << " [generate delta column group writer] " << watch.elapsed_time();
     watch.reset();
     OlapReaderStatistics stats;
@@ -696,20 +766,33 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
             // 3.2 build partial schema
             auto partial_tschema = TabletSchema::create(tschema, selective_update_column_uids);
             Schema partial_schema = ChunkHelper::convert_schema(tschema, selective_update_column_ids);
-            // 3.3 read from source segment
+            // 3.3 read from source segment, or skip it entirely when this
+            // segment takes the sparse fast path
             ASSIGN_OR_RETURN(auto rowsetid_segid, _find_rowset_seg_id(each.first));
-            const std::string seg_path = Rowset::segment_file_path(
-                    rowset->rowset_path(), rowsetid_segid.unique_rowset_id, rowsetid_segid.segment_id);
-            ASSIGN_OR_RETURN(auto source_chunk_ptr,
-                             read_from_source_segment(rowset, partial_schema, tablet, &stats,
-                                                      latest_applied_version.major_number(), rowsetid_segid, seg_path));
-            const size_t source_chunk_size = source_chunk_ptr->memory_usage();
-            tracker->consume(source_chunk_size);
+            ChunkPtr source_chunk_ptr;
+            size_t source_chunk_size = 0;
             DeferOp tracker_defer([&]() { tracker->release(source_chunk_size); });
+            auto sparse_itr = rssid_to_sparse_rowids.find(each.first);
+            if (sparse_itr == rssid_to_sparse_rowids.end()) {
+                const std::string seg_path = Rowset::segment_file_path(
+                        rowset->rowset_path(), rowsetid_segid.unique_rowset_id, rowsetid_segid.segment_id);
+                ASSIGN_OR_RETURN(source_chunk_ptr, read_from_source_segment(rowset, partial_schema, tablet, &stats,
+                                                                            latest_applied_version.major_number(),
+                                                                            rowsetid_segid, seg_path));
+                source_chunk_size = source_chunk_ptr->memory_usage();
+                tracker->consume(source_chunk_size);
+            }
             // 3.2 read from update segment
             int64_t t2 = MonotonicMillis();
-            RETURN_IF_ERROR(_update_source_chunk_by_upt(each.second, partial_schema, rowset, &stats, tracker,
-                                                        &source_chunk_ptr));
+            if (sparse_itr == rssid_to_sparse_rowids.end()) {
+                RETURN_IF_ERROR(_update_source_chunk_by_upt(each.second, partial_schema, rowset, &stats, tracker,
+                                                            &source_chunk_ptr));
+            } else {
+                ASSIGN_OR_RETURN(source_chunk_ptr, _build_sparse_update_chunk(each.second, sparse_itr->second,
+                                                                              partial_schema, rowset, &stats, tracker));
+                source_chunk_size = source_chunk_ptr->memory_usage();
+                tracker->consume(source_chunk_size);
+            }
             int64_t t3 = MonotonicMillis();
             uint64_t segment_file_size = 0;
             uint64_t index_size = 0;
@@ -732,8 +815,16 @@ Status RowsetColumnUpdateState::finalize(Tablet* tablet, Rowset* rowset, uint32_
     // 4 generate delta columngroup
     for (const auto& each : rss_upt_id_to_rowid_pairs) {
         _rssid_to_delta_column_group[each.first] = std::make_shared<DeltaColumnGroup>();
+        // sparse `.cols` files record the source rowids they cover, each column
+        // batch file of one segment shares the same rowid list
+        std::vector<std::vector<uint32_t>> dcg_column_rowids;
+        auto sparse_itr = rssid_to_sparse_rowids.find(each.first);
+        if (sparse_itr != rssid_to_sparse_rowids.end()) {
+            dcg_column_rowids.assign(dcg_column_files[each.first].size(), sparse_itr->second);
+        }
         _rssid_to_delta_column_group[each.first]->init(latest_applied_version.major_number() + 1,
-                                                       dcg_column_ids[each.first], dcg_column_files[each.first]);
+                                                       dcg_column_ids[each.first], dcg_column_files[each.first],
+                                                       dcg_column_rowids);
     }
     cost_str << " [generate delta column group] " << watch.elapsed_time();
     watch.reset();
@@ -210,6 +210,12 @@ private:
                                        Rowset* rowset, OlapReaderStatistics* stats, MemTracker* tracker,
                                        ChunkPtr* source_chunk);
 
+    // build the chunk for a sparse `.cols` file which only contains the rows of
+    // |rowids| (sorted source rowids of one segment), filled from update files
+    StatusOr<ChunkPtr> _build_sparse_update_chunk(const UptidToRowidPairs& upt_id_to_rowid_pairs,
+                                                  const std::vector<uint32_t>& rowids, const Schema& partial_schema,
+                                                  Rowset* rowset, OlapReaderStatistics* stats, MemTracker* tracker);
+
 private:
     int64_t _tablet_id = 0;
     std::once_flag _load_once_flag;
@@ -380,8 +380,11 @@ bool ChunkChanger::change_chunk_v2(ChunkPtr& base_chunk, ChunkPtr& new_chunk, co
         } else {
             VLOG(2) << "no ref column: i=" << i << ", ref_column=" << ref_column;
             ColumnPtr& new_col = new_chunk->get_column_by_index(i);
-            for (size_t row_index = 0; row_index < base_chunk->num_rows(); ++row_index) {
-                new_col->append_datum(_schema_mapping[i].default_value_datum);
+            // materialize the default value once and replicate it, instead of a datum append per row.
+            if (size_t row_num = base_chunk->num_rows(); row_num > 0) {
+                auto default_col = new_col->clone_empty();
+                default_col->append_datum(_schema_mapping[i].default_value_datum);
+                new_col->append_value_multiple_times(*default_col, 0, row_num);
             }
         }
     }
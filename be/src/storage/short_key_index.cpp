@@ -34,6 +34,8 @@
 
 #include "storage/short_key_index.h"
 
+#include <algorithm>
+#include <numeric>
 #include <string>
 
 #include "gutil/strings/substitute.h"
@@ -101,4 +103,90 @@ Status ShortKeyIndexDecoder::parse(const Slice& body, const ShortKeyFooterPB& fo
     return Status::OK();
 }
 
+uint64_t ShortKeyIndexDecoder::_key_prefix_of(const Slice& key) {
+    uint64_t prefix = 0;
+    size_t len = std::min<size_t>(key.size, sizeof(prefix));
+    for (size_t i = 0; i < len; i++) {
+        prefix |= (uint64_t)(uint8_t)key.data[i] << (56 - i * 8);
+    }
+    return prefix;
+}
+
+void ShortKeyIndexDecoder::_ensure_key_prefixes() const {
+    std::call_once(_key_prefixes_once, [this] {
+        std::vector<uint64_t> prefixes(num_items());
+        for (uint32_t i = 0; i < num_items(); i++) {
+            prefixes[i] = _key_prefix_of(key(i));
+        }
+        _key_prefixes.swap(prefixes);
+    });
+}
+
+// Find the first index whose prefix is greater than `target` (upper) or not less than it.
+// The prefixes of a sorted segment are close to uniformly distributed, so a few interpolation
+// probes usually converge much faster than a binary search; if they do not, a binary search
+// over the remaining range takes over to bound the worst case.
+static size_t interpolation_bound(const std::vector<uint64_t>& prefixes, uint64_t target, bool upper) {
+    size_t lo = 0;
+    size_t hi = prefixes.size();
+    int probes = 8;
+    while (hi - lo > 16 && probes-- > 0) {
+        uint64_t lo_value = prefixes[lo];
+        uint64_t hi_value = prefixes[hi - 1];
+        if (lo_value >= hi_value) {
+            break;
+        }
+        uint64_t clamped = std::clamp(target, lo_value, hi_value);
+        size_t pos = lo + (size_t)((unsigned __int128)(clamped - lo_value) * (hi - 1 - lo) / (hi_value - lo_value));
+        bool go_right = upper ? prefixes[pos] <= target : prefixes[pos] < target;
+        if (go_right) {
+            lo = pos + 1;
+        } else {
+            hi = pos;
+        }
+    }
+    if (upper) {
+        return std::upper_bound(prefixes.begin() + lo, prefixes.begin() + hi, target) - prefixes.begin();
+    }
+    return std::lower_bound(prefixes.begin() + lo, prefixes.begin() + hi, target) - prefixes.begin();
+}
+
+std::pair<uint32_t, uint32_t> ShortKeyIndexDecoder::_prefix_equal_range(const Slice& key) const {
+    _ensure_key_prefixes();
+    uint64_t target = _key_prefix_of(key);
+    auto first = (uint32_t)interpolation_bound(_key_prefixes, target, false);
+    auto last = (uint32_t)interpolation_bound(_key_prefixes, target, true);
+    return {first, last};
+}
+
+void ShortKeyIndexDecoder::batch_lower_bound(const std::vector<Slice>& keys, std::vector<uint32_t>* ordinals) const {
+    DCHECK(_parsed);
+    ordinals->resize(keys.size());
+
+    std::vector<uint32_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&keys](uint32_t lhs, uint32_t rhs) { return keys[lhs].compare(keys[rhs]) < 0; });
+
+    auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
+    uint32_t start = 0;
+    for (uint32_t idx : order) {
+        const Slice& probe = keys[idx];
+        // The result is at or after the previous hit, so gallop from there and finish
+        // with a binary search over the located window.
+        uint32_t lo = start;
+        uint32_t hi = num_items();
+        uint32_t step = 1;
+        while (lo + step < hi && key(lo + step).compare(probe) < 0) {
+            lo += step;
+            step <<= 1;
+        }
+        hi = std::min<uint32_t>(lo + step, hi);
+        auto iter = std::lower_bound(ShortKeyIndexIterator(this, lo), ShortKeyIndexIterator(this, hi), probe,
+                                     comparator);
+        (*ordinals)[idx] = (uint32_t)iter.ordinal();
+        start = (uint32_t)iter.ordinal();
+    }
+}
+
 } // namespace starrocks
@@ -36,7 +36,9 @@
 
 #include <cstdint>
 #include <iterator>
+#include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "common/status.h"
@@ -199,6 +201,13 @@ public:
         return seek<false>(key);
     }
 
+    // Locate lower_bound for a batch of probe keys in one pass over the index: the keys are
+    // visited in ascending order and every probe continues from the previous hit with a
+    // galloping search instead of restarting a full binary search, which is what the batch
+    // point-read path wants.
+    // `ordinals` is resized to keys.size() and `(*ordinals)[i]` == lower_bound(keys[i]).ordinal().
+    void batch_lower_bound(const std::vector<Slice>& keys, std::vector<uint32_t>* ordinals) const;
+
     uint32_t num_items() const {
         DCHECK(_parsed);
         return _footer.num_items();
@@ -216,27 +225,46 @@ public:
     }
 
     int64_t mem_usage() const {
-        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() + _key_data.size +
-               _footer.ByteSizeLong() - sizeof(_footer);
+        return sizeof(ShortKeyIndexDecoder) + sizeof(uint32_t) * _offsets.size() +
+               sizeof(uint64_t) * _key_prefixes.size() + _key_data.size + _footer.ByteSizeLong() - sizeof(_footer);
     }
 
 private:
     template <bool lower_bound>
     ShortKeyIndexIterator seek(const Slice& key) const {
         auto comparator = [](const Slice& lhs, const Slice& rhs) { return lhs.compare(rhs) < 0; };
+        // narrow the search to the entries sharing the probe's 8-byte prefix, so the
+        // per-probe key decode and byte-wise compare only run inside that range
+        auto [first, last] = _prefix_equal_range(key);
         if (lower_bound) {
-            return std::lower_bound(begin(), end(), key, comparator);
+            return std::lower_bound(ShortKeyIndexIterator(this, first), ShortKeyIndexIterator(this, last), key,
+                                    comparator);
         } else {
-            return std::upper_bound(begin(), end(), key, comparator);
+            return std::upper_bound(ShortKeyIndexIterator(this, first), ShortKeyIndexIterator(this, last), key,
+                                    comparator);
         }
     }
 
+    // Build _key_prefixes on first use.
+    void _ensure_key_prefixes() const;
+
+    // Range [first, last) of the entries whose 8-byte prefix equals the probe's,
+    // located by interpolation search over _key_prefixes.
+    std::pair<uint32_t, uint32_t> _prefix_equal_range(const Slice& key) const;
+
+    static uint64_t _key_prefix_of(const Slice& key);
+
     bool _parsed{false};
 
     // All following fields are only valid after parse has been executed successfully
     ShortKeyFooterPB _footer;
     std::vector<uint32_t> _offsets;
     Slice _key_data;
+
+    // The first 8 bytes of every key, big-endian and zero padded: an order-preserving
+    // fixed-width image of the keys, built lazily on the first seek.
+    mutable std::once_flag _key_prefixes_once;
+    mutable std::vector<uint64_t> _key_prefixes;
 };
 
 inline Slice ShortKeyIndexIterator::operator*() const {
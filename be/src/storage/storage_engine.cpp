@@ -52,6 +52,7 @@
 #include "fs/fs_util.h"
 #include "gen_cpp/FrontendService.h"
 #include "gen_cpp/FrontendService_types.h"
+#include "runtime/auto_increment_id_allocator.h"
 #include "runtime/client_cache.h"
 #include "runtime/current_thread.h"
 #include "runtime/exec_env.h"
@@ -64,6 +65,7 @@
 #include "storage/replication_txn_manager.h"
 #include "storage/rowset/rowset_meta.h"
 #include "storage/rowset/rowset_meta_manager.h"
+#include "storage/rowset/segment_cache.h"
 #include "storage/rowset/unique_rowset_id_generator.h"
 #include "storage/segment_flush_executor.h"
 #include "storage/segment_replicate_executor.h"
@@ -118,7 +120,11 @@ StorageEngine::StorageEngine(const EngineOptions& options)
           _update_manager(new UpdateManager(options.update_mem_tracker)),
           _compaction_manager(new CompactionManager()),
           _publish_version_manager(new PublishVersionManager()),
-          _dictionary_cache_manager(new DictionaryCacheManager()) {
+          _dictionary_cache_manager(new DictionaryCacheManager()),
+          _auto_increment_id_allocator(new AutoIncrementIdAllocator(
+                  [this](int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+                      return _lease_auto_increment_ids(table_id, rows, start, allocated);
+                  })) {
 #ifdef BE_TEST
     _p_instance = _s_instance;
     _s_instance = this;
@@ -241,6 +247,14 @@ Status StorageEngine::_open(const EngineOptions& options) {
     RETURN_IF_ERROR_WITH_WARN(_segment_replicate_executor->init(dirs), "init SegmentReplicateExecutor failed");
     REGISTER_THREAD_POOL_METRICS(segment_replicate, _segment_replicate_executor->get_thread_pool());
 
+    if (config::segment_flush_column_concurrency > 1) {
+        RETURN_IF_ERROR(ThreadPoolBuilder("segment_flush_column")
+                                .set_min_threads(1)
+                                .set_max_threads(config::segment_flush_column_concurrency)
+                                .set_idle_timeout(MonoDelta::FromMilliseconds(/*5 minutes=*/5 * 60 * 1000))
+                                .build(&_segment_flush_column_pool));
+    }
+
     RETURN_IF_ERROR_WITH_WARN(_replication_txn_manager->init(dirs), "init ReplicationTxnManager failed");
 
     return Status::OK();
@@ -666,6 +680,10 @@ void StorageEngine::stop() {
         _compaction_checker_thread.join();
     }
 
+    if (_segment_flush_column_pool) {
+        _segment_flush_column_pool->shutdown();
+    }
+
     if (_update_manager) {
         _update_manager->stop();
     }
@@ -673,6 +691,10 @@ void StorageEngine::stop() {
     if (_compaction_manager) {
         _compaction_manager->stop();
     }
+
+    if (_auto_increment_id_allocator) {
+        _auto_increment_id_allocator->stop();
+    }
 }
 
 void StorageEngine::clear_transaction_task(const TTransactionId transaction_id) {
@@ -711,6 +733,7 @@ void StorageEngine::clear_transaction_task(const TTransactionId transaction_id,
 void StorageEngine::_start_clean_fd_cache() {
     VLOG(10) << "Cleaning file descriptor cache";
     FdCache::Instance()->prune();
+    SegmentCache::instance()->prune();
     VLOG(10) << "Cleaned file descriptor cache";
 }
 
@@ -1413,74 +1436,33 @@ void StorageEngine::increase_update_compaction_thread(const int num_threads_per_
 }
 
 void StorageEngine::remove_increment_map_by_table_id(int64_t table_id) {
-    std::unique_lock<std::mutex> l(_auto_increment_mutex);
-    if (_auto_increment_meta_map.find(table_id) != _auto_increment_meta_map.end()) {
-        _auto_increment_meta_map.erase(_auto_increment_meta_map.find(table_id));
-    }
+    _auto_increment_id_allocator->remove_table(table_id);
 }
 
 Status StorageEngine::get_next_increment_id_interval(int64_t tableid, size_t num_row, std::vector<int64_t>& ids) {
-    if (num_row == 0) {
-        return Status::OK();
-    }
-    DCHECK_EQ(num_row, ids.size());
-
-    std::shared_ptr<AutoIncrementMeta> meta;
-
-    {
-        std::unique_lock<std::mutex> l(_auto_increment_mutex);
-
-        if (UNLIKELY(_auto_increment_meta_map.find(tableid) == _auto_increment_meta_map.end())) {
-            _auto_increment_meta_map.insert({tableid, std::make_shared<AutoIncrementMeta>()});
-        }
-        meta = _auto_increment_meta_map[tableid];
-        TEST_SYNC_POINT_CALLBACK("StorageEngine::get_next_increment_id_interval.1", &meta);
-    }
-
-    // lock for different tableid
-    std::unique_lock<std::mutex> l(meta->mutex);
-
-    // avaliable id interval: [cur_avaliable_min_id, cur_max_id)
-    int64_t& cur_avaliable_min_id = meta->min;
-    int64_t& cur_max_id = meta->max;
-    CHECK_GE(cur_max_id, cur_avaliable_min_id);
-
-    size_t cur_avaliable_rows = cur_max_id - cur_avaliable_min_id;
-    auto ids_iter = ids.begin();
-    if (UNLIKELY(num_row > cur_avaliable_rows)) {
-        size_t alloc_rows = num_row - cur_avaliable_rows;
-        // rpc request for the new available interval from fe
-        TAllocateAutoIncrementIdParam alloc_params;
-        TAllocateAutoIncrementIdResult alloc_result;
-
-        alloc_params.__set_table_id(tableid);
-        alloc_params.__set_rows(alloc_rows);
+    return _auto_increment_id_allocator->allocate(tableid, num_row, ids);
+}
 
-        auto st = _get_remote_next_increment_id_interval(alloc_params, &alloc_result);
+Status StorageEngine::_lease_auto_increment_ids(int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+    TAllocateAutoIncrementIdParam alloc_params;
+    TAllocateAutoIncrementIdResult alloc_result;
 
-        if (!st.ok() || alloc_result.status.status_code != TStatusCode::OK) {
-            std::stringstream err_msg;
-            for (auto& msg : alloc_result.status.error_msgs) {
-                err_msg << msg;
-            }
+    alloc_params.__set_table_id(table_id);
+    alloc_params.__set_rows(rows);
 
-            return Status::InternalError("auto increment allocate failed, err msg: " + err_msg.str());
-        }
+    auto st = _get_remote_next_increment_id_interval(alloc_params, &alloc_result);
 
-        if (cur_avaliable_rows > 0) {
-            std::iota(ids_iter, ids_iter + cur_avaliable_rows, cur_avaliable_min_id);
-            ids_iter += cur_avaliable_rows;
+    if (!st.ok() || alloc_result.status.status_code != TStatusCode::OK) {
+        std::stringstream err_msg;
+        for (auto& msg : alloc_result.status.error_msgs) {
+            err_msg << msg;
         }
 
-        cur_avaliable_min_id = alloc_result.auto_increment_id;
-        cur_max_id = alloc_result.auto_increment_id + alloc_result.allocated_rows;
-
-        num_row -= cur_avaliable_rows;
+        return Status::InternalError("auto increment allocate failed, err msg: " + err_msg.str());
     }
 
-    std::iota(ids_iter, ids.end(), cur_avaliable_min_id);
-    cur_avaliable_min_id += num_row;
-
+    *start = alloc_result.auto_increment_id;
+    *allocated = alloc_result.allocated_rows;
     return Status::OK();
 }
 
@@ -81,6 +81,8 @@ class PublishVersionManager;
 class DictionaryCacheManager;
 class SegmentFlushExecutor;
 class SegmentReplicateExecutor;
+class ThreadPool;
+class AutoIncrementIdAllocator;
 
 struct DeltaColumnGroupKey {
     int64_t tablet_id;
@@ -110,17 +112,6 @@ struct DeltaColumnGroupKey {
     }
 };
 
-struct AutoIncrementMeta {
-    int64_t min;
-    int64_t max;
-    std::mutex mutex;
-
-    AutoIncrementMeta() {
-        min = 0;
-        max = 0;
-    }
-};
-
 // StorageEngine singleton to manage all Table pointers.
 // Providing add/drop/get operations.
 // StorageEngine instance doesn't own the Table resources, just hold the pointer,
@@ -238,6 +229,10 @@ public:
 
     SegmentFlushExecutor* segment_flush_executor() { return _segment_flush_executor.get(); }
 
+    // pool encoding the column writers of one segment concurrently, nullptr when
+    // segment_flush_column_concurrency is disabled
+    ThreadPool* segment_flush_column_pool() { return _segment_flush_column_pool.get(); }
+
     UpdateManager* update_manager() { return _update_manager.get(); }
 
     bool check_rowset_id_in_unused_rowsets(const RowsetId& rowset_id);
@@ -332,6 +327,9 @@ private:
     Status _get_remote_next_increment_id_interval(const TAllocateAutoIncrementIdParam& request,
                                                   TAllocateAutoIncrementIdResult* result);
 
+    // lease an auto-increment id range from the FE, used by |_auto_increment_id_allocator|
+    Status _lease_auto_increment_ids(int64_t table_id, size_t rows, int64_t* start, size_t* allocated);
+
     // All these xxx_callback() functions are for Background threads
     // update cache expire thread
     void* _update_cache_expire_thread_callback(void* arg);
@@ -480,6 +478,8 @@ private:
 
     std::unique_ptr<SegmentFlushExecutor> _segment_flush_executor;
 
+    std::unique_ptr<ThreadPool> _segment_flush_column_pool;
+
     std::unique_ptr<UpdateManager> _update_manager;
 
     std::unique_ptr<CompactionManager> _compaction_manager;
@@ -488,9 +488,7 @@ private:
 
     std::unique_ptr<DictionaryCacheManager> _dictionary_cache_manager;
 
-    std::unordered_map<int64_t, std::shared_ptr<AutoIncrementMeta>> _auto_increment_meta_map;
-
-    std::mutex _auto_increment_mutex;
+    std::unique_ptr<AutoIncrementIdAllocator> _auto_increment_id_allocator;
 
     bool _need_write_cluster_id = true;
 
@@ -624,13 +624,18 @@ Status Tablet::add_inc_rowset(const RowsetSharedPtr& rowset, int64_t version) {
         StorageEngine::instance()->compaction_manager()->update_tablet_async(
                 std::static_pointer_cast<Tablet>(shared_from_this()));
     }
+    ++_newly_created_rowset_num;
 
-    // warm-up this rowset
+    // Warm up the rowset outside of _meta_lock: load() opens the segment files and reads
+    // their footers, and doing that io under the meta lock blocks readers of the freshly
+    // published version and stretches publish latency when many tablets publish at once.
+    // Rowset::load is internally synchronized, so readers that grab the rowset before the
+    // warm-up finishes just load it themselves.
+    wrlock.unlock();
     st = rowset->load();
     // ignore this error, only log load failure
     LOG_IF(WARNING, !st.ok()) << "ignore load rowset error tablet:" << tablet_id() << " rowset:" << rowset->rowset_id()
                               << " " << st;
-    ++_newly_created_rowset_num;
     return Status::OK();
 }
 
@@ -1682,6 +1687,27 @@ bool Tablet::enable_compaction() {
     return _enable_compaction;
 }
 
+void Tablet::record_read_stats(int64_t segments_read) {
+    _last_read_time_s.store(UnixSeconds(), std::memory_order_relaxed);
+    int64_t queries = _read_query_count.fetch_add(1, std::memory_order_relaxed) + 1;
+    _read_segment_count.fetch_add(segments_read, std::memory_order_relaxed);
+    // halve the counters periodically so the average follows recent behavior.
+    // the counters are advisory, racing stores only lose some history.
+    constexpr int64_t kReadStatsDecayQueries = 4096;
+    if (queries >= kReadStatsDecayQueries) {
+        _read_query_count.store(queries / 2, std::memory_order_relaxed);
+        _read_segment_count.store(_read_segment_count.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+}
+
+double Tablet::avg_read_segments() const {
+    int64_t queries = _read_query_count.load(std::memory_order_relaxed);
+    if (queries <= 0) {
+        return 0;
+    }
+    return static_cast<double>(_read_segment_count.load(std::memory_order_relaxed)) / static_cast<double>(queries);
+}
+
 void Tablet::get_basic_info(TabletBasicInfo& info) {
     std::shared_lock rdlock(_meta_lock);
     info.table_id = _tablet_meta->table_id();
@@ -279,6 +279,16 @@ public:
 
     bool enable_compaction();
 
+    // read-amplification feedback for the compaction scheduler: queries record
+    // how many segments they touched, the scheduler prioritizes tablets whose
+    // reads actually pay for merge work
+    void record_read_stats(int64_t segments_read);
+
+    // average number of segments touched per recorded query read
+    double avg_read_segments() const;
+
+    int64_t last_read_time_s() const { return _last_read_time_s.load(std::memory_order_relaxed); }
+
     std::string get_storage_type() const { return _tablet_meta->get_storage_type(); }
 
     const bool is_column_with_row_store() const {
@@ -419,6 +429,11 @@ private:
     std::unique_ptr<CompactionContext> _compaction_context;
     bool _enable_compaction = true;
 
+    // read-amplification feedback, updated by TabletReader for query reads
+    std::atomic<int64_t> _last_read_time_s{0};
+    std::atomic<int64_t> _read_query_count{0};
+    std::atomic<int64_t> _read_segment_count{0};
+
     std::mutex _compaction_task_lock;
 
     // used for default base cumulative compaction strategy to control the
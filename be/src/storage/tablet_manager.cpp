@@ -157,6 +157,7 @@ Status TabletManager::_update_tablet_map_and_partition_info(const TabletSharedPt
     if (!inserted) {
         return Status::InternalError(fmt::format("tablet {} already exist in map", tablet->tablet_id()));
     }
+    _publish_shard_snapshot(_get_tablets_shard(tablet->tablet_id()));
     _add_tablet_to_partition(*tablet);
     return Status::OK();
 }
@@ -395,6 +396,7 @@ Status TabletManager::drop_tablet(TTabletId tablet_id, TabletDropFlag flag) {
         LOG(INFO) << "Start to drop tablet " << tablet_id;
         dropped_tablet = it->second;
         tablet_map.erase(it);
+        _publish_shard_snapshot(_get_tablets_shard(tablet_id));
         _remove_tablet_from_partition(*dropped_tablet);
     }
     if (config::enable_event_based_compaction_framework) {
@@ -466,6 +468,7 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
                 dropped_tablets.push_back(dropped_tablet);
             }
         }
+        _publish_shard_snapshot(_tablets_shards[i]);
     }
 
     for (const auto& dropped_tablet : dropped_tablets) {
@@ -485,6 +488,23 @@ Status TabletManager::drop_tablets_on_error_root_path(const std::vector<TabletIn
 }
 
 TabletSharedPtr TabletManager::get_tablet(TTabletId tablet_id, bool include_deleted, std::string* err) {
+    // Lock-free fast path: resolve the tablet against the shard's RCU-style snapshot, keeping
+    // scan/load RPCs off the shard lock. Writers publish a new snapshot before releasing the
+    // shard lock, so a miss here falls back to the locked path, which also covers deleted
+    // tablets parked in _shutdown_tablets.
+    auto snapshot = std::atomic_load(&_get_tablets_shard(tablet_id).tablet_map_snapshot);
+    if (auto it = snapshot->find(tablet_id); it != snapshot->end()) {
+        const TabletSharedPtr& tablet = it->second;
+        if (!tablet->is_used()) {
+            LOG(WARNING) << "tablet_id=" << tablet_id << " cannot be used";
+            if (err != nullptr) {
+                *err = "tablet cannot be used";
+            }
+            return nullptr;
+        }
+        return tablet;
+    }
+
     std::shared_lock rlock(_get_tablets_shard_lock(tablet_id));
     return _get_tablet_unlocked(tablet_id, include_deleted, err);
 }
@@ -968,8 +988,11 @@ Status TabletManager::report_all_tablets_info(std::map<TTabletId, TTablet>* tabl
 
     size_t max_tablet_rowset_num = 0;
     for (const auto& tablets_shard : _tablets_shards) {
-        std::shared_lock rlock(tablets_shard.lock);
-        for (const auto& [tablet_id, tablet_ptr] : tablets_shard.tablet_map) {
+        // Walk an RCU-style snapshot instead of the live map: building the report info of
+        // millions of tablets takes seconds and must not stall tablet additions and drops
+        // behind the shard lock.
+        auto snapshot = std::atomic_load(&tablets_shard.tablet_map_snapshot);
+        for (const auto& [tablet_id, tablet_ptr] : *snapshot) {
             TTablet t_tablet;
             TTabletInfo tablet_info;
             tablet_ptr->build_tablet_report_info(&tablet_info);
@@ -999,10 +1022,9 @@ Status TabletManager::start_trash_sweep() {
         // we use this vector to save all tablet ptr for saving lock time.
         std::vector<TabletSharedPtr> all_tablets;
         for (auto& tablets_shard : _tablets_shards) {
-            TabletMap& tablet_map = tablets_shard.tablet_map;
             {
-                std::shared_lock rlock(tablets_shard.lock);
-                for (auto& [tablet_id, tablet] : tablet_map) {
+                auto snapshot = std::atomic_load(&tablets_shard.tablet_map_snapshot);
+                for (const auto& [tablet_id, tablet] : *snapshot) {
                     all_tablets.push_back(tablet);
                 }
             }
@@ -1470,6 +1492,7 @@ Status TabletManager::_drop_tablet_unlocked(TTabletId tablet_id, TabletDropFlag
     LOG(INFO) << "Start to drop tablet " << tablet_id;
     TabletSharedPtr dropped_tablet = it->second;
     tablet_map.erase(it);
+    _publish_shard_snapshot(_get_tablets_shard(tablet_id));
     _remove_tablet_from_partition(*dropped_tablet);
     if (config::enable_event_based_compaction_framework) {
         dropped_tablet->stop_compaction();
@@ -1609,6 +1632,10 @@ TabletManager::TabletsShard& TabletManager::_get_tablets_shard(TTabletId tabletI
     return _tablets_shards[tabletId & _tablets_shards_mask];
 }
 
+void TabletManager::_publish_shard_snapshot(TabletsShard& shard) {
+    std::atomic_store(&shard.tablet_map_snapshot, std::make_shared<const TabletMap>(shard.tablet_map));
+}
+
 Status TabletManager::create_tablet_from_meta_snapshot(DataDir* store, TTabletId tablet_id, SchemaHash schema_hash,
                                                        const string& schema_hash_path, bool restore) {
     auto meta_path = strings::Substitute("$0/meta", schema_hash_path);
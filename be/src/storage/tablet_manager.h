@@ -36,6 +36,7 @@
 
 #include <list>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
 #include <string>
@@ -206,6 +207,11 @@ private:
         mutable std::shared_mutex lock;
         TabletMap tablet_map;
         TabletSet tablets_under_clone;
+        // Read-only copy of |tablet_map|, replaced wholesale after every mutation (RCU style).
+        // Readers resolve tablets against it through std::atomic_load without taking |lock|;
+        // tablet additions and drops are rare compared to lookups, so copying the shard map
+        // on mutation is cheap relative to the contention it removes.
+        std::shared_ptr<const TabletMap> tablet_map_snapshot = std::make_shared<const TabletMap>();
     };
 
     struct DroppedTabletInfo {
@@ -259,6 +265,10 @@ private:
 
     void _remove_tablet_from_partition(const Tablet& tablet);
 
+    // Rebuild the read-only snapshot of `shard`'s tablet map. Must be called with `shard.lock`
+    // held exclusively after every mutation of `shard.tablet_map`.
+    static void _publish_shard_snapshot(TabletsShard& shard);
+
     std::shared_mutex& _get_tablets_shard_lock(TTabletId tabletId);
 
     TabletMap& _get_tablet_map(TTabletId tablet_id);
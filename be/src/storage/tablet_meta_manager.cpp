@@ -46,6 +46,7 @@
 #include <vector>
 
 #include "common/compiler_util.h"
+#include "common/config.h"
 #include "common/logging.h"
 #include "common/tracer.h"
 #include "fmt/format.h"
@@ -774,7 +775,7 @@ void decode_delta_column_group_key(std::string_view enc_key, TTabletId* tablet_i
 }
 
 Status TabletMetaManager::rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid, EditVersionMetaPB* edit,
-                                        const RowsetMetaPB& rowset, const string& rowset_meta_key) {
+                                        const RowsetMetaPB& rowset, const string& rowset_meta_key, bool wait_sync) {
     WriteBatch batch;
     auto handle = store->get_meta()->handle(META_COLUMN_FAMILY_INDEX);
     string logkey = encode_meta_log_key(tablet_id, logid);
@@ -806,7 +807,7 @@ Status TabletMetaManager::rowset_commit(DataDir* store, TTabletId tablet_id, int
     }
     // pending rowset may exists or not, but delete it anyway
     RETURN_IF_ERROR(delete_pending_rowset(store, &batch, tablet_id, edit->version().major_number()));
-    return store->get_meta()->write_batch(&batch);
+    return store->get_meta()->write_batch(&batch, wait_sync && config::sync_tablet_meta);
 }
 
 Status TabletMetaManager::write_persistent_index_meta(DataDir* store, TTabletId tablet_id,
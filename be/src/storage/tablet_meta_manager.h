@@ -128,9 +128,11 @@ public:
     // Updatable tablet meta operations
     //
 
-    // commit a rowset into tablet
+    // commit a rowset into tablet.
+    // |wait_sync|=false skips waiting for the WAL fsync when sync_tablet_meta is enabled, for
+    // commits that can be redone after a crash (e.g. compaction results).
     static Status rowset_commit(DataDir* store, TTabletId tablet_id, int64_t logid, EditVersionMetaPB* edit,
-                                const RowsetMetaPB& rowset, const string& rowset_meta_key);
+                                const RowsetMetaPB& rowset, const string& rowset_meta_key, bool wait_sync = true);
 
     static Status write_persistent_index_meta(DataDir* store, TTabletId tablet_id, const PersistentIndexMetaPB& meta);
 
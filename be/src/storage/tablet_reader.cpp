@@ -80,6 +80,10 @@ TabletReader::TabletReader(TabletSharedPtr tablet, const Version& version, const
 }
 
 void TabletReader::close() {
+    if (_is_query_read && _stats.segments_read_count > 0) {
+        _tablet->record_read_stats(_stats.segments_read_count);
+        _is_query_read = false;
+    }
     if (_collect_iter != nullptr) {
         _collect_iter->close();
         _collect_iter.reset();
@@ -122,6 +126,8 @@ Status TabletReader::open(const TabletReaderParams& read_params) {
         read_params.reader_type != ReaderType::READER_ALTER_TABLE && !is_compaction(read_params.reader_type)) {
         return Status::NotSupported("reader type not supported now");
     }
+    _is_query_read = read_params.reader_type == ReaderType::READER_QUERY;
+    _limit = read_params.limit;
     if (read_params.use_pk_index) {
         // defer init collector to IO scanner thread when calling do_get_next()
         _reader_params = &read_params;
@@ -256,7 +262,18 @@ Status TabletReader::do_get_next(Chunk* chunk) {
             RETURN_IF_ERROR(_init_collector(*_reader_params));
         }
     }
+    // The caller only sets |_limit| when the output order matches the query order, so the first
+    // |_limit| rows are the complete result and the remaining segments need not be merged at all.
+    if (_limit >= 0 && _num_rows_returned >= _limit) {
+        return Status::EndOfFile("reach limit of the key-ordered scan");
+    }
     RETURN_IF_ERROR(_collect_iter->get_next(chunk));
+    if (_limit >= 0) {
+        if (_num_rows_returned + chunk->num_rows() > _limit) {
+            chunk->set_num_rows(_limit - _num_rows_returned);
+        }
+        _num_rows_returned += chunk->num_rows();
+    }
     return Status::OK();
 }
 
@@ -371,19 +388,26 @@ Status TabletReader::_init_collector(const TabletReaderParams& params) {
         }
     } else if (keys_type == PRIMARY_KEYS || keys_type == DUP_KEYS || (keys_type == UNIQUE_KEYS && skip_aggr) ||
                (select_all_keys && seg_iters.size() == 1)) {
-        // The segments may be in order after compaction. At this time, we prefer to read the later segments first.
-        if (!_is_asc_hint) {
-            std::reverse(seg_iters.begin(), seg_iters.end());
+        // A fully compacted version has a single segment iterator (one rowset without overlapping
+        // segments, deletes already folded into the delete vector), hand it to the scan directly
+        // instead of going through a single-child UnionIterator.
+        if (seg_iters.size() == 1) {
+            _collect_iter = std::move(seg_iters[0]);
+        } else {
+            // The segments may be in order after compaction. At this time, we prefer to read the later segments first.
+            if (!_is_asc_hint) {
+                std::reverse(seg_iters.begin(), seg_iters.end());
+            }
+            //             UnionIterator
+            //                   |
+            //       +-----------+-----------+
+            //       |           |           |
+            //     Timer        ...        Timer
+            //       |           |           |
+            // SegmentIterator  ...    SegmentIterator
+            //
+            _collect_iter = new_union_iterator(std::move(seg_iters));
         }
-        //             UnionIterator
-        //                   |
-        //       +-----------+-----------+
-        //       |           |           |
-        //     Timer        ...        Timer
-        //       |           |           |
-        // SegmentIterator  ...    SegmentIterator
-        //
-        _collect_iter = new_union_iterator(std::move(seg_iters));
     } else if ((keys_type == AGG_KEYS || keys_type == UNIQUE_KEYS) && !skip_aggr) {
         //                 Timer
         //                   |
@@ -115,6 +115,14 @@ private:
     const TabletReaderParams* _reader_params = nullptr;
     bool _is_asc_hint = true;
 
+    // early termination for key-ordered scans with LIMIT, see TabletReaderParams::limit
+    int64_t _limit = -1;
+    int64_t _num_rows_returned = 0;
+
+    // whether this reader serves a query, used to feed read-amplification
+    // statistics back to the compaction scheduler on close
+    bool _is_query_read = false;
+
     bool _use_gtid = false;
 };
 
@@ -81,6 +81,10 @@ struct TabletReaderParams {
     ShortKeyRangesOptionPtr short_key_ranges_option = nullptr;
 
     bool sorted_by_keys_per_tablet = false;
+    // Stop reading after this many rows have been returned, -1 means unlimited.
+    // Only set this when the reader output order matches the query order (sorted_by_keys_per_tablet)
+    // and no filtering happens after the reader, otherwise rows would be cut off incorrectly.
+    int64_t limit = -1;
     OlapRuntimeScanRangePruner runtime_range_pruner;
 
     std::vector<ColumnAccessPathPtr>* column_access_paths = nullptr;
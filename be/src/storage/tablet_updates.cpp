@@ -47,11 +47,13 @@
 #include "storage/primary_key_dump.h"
 #include "storage/rows_mapper.h"
 #include "storage/rowset/default_value_column_iterator.h"
+#include "storage/rowset/delta_column_group_iterator.h"
 #include "storage/rowset/rowset_factory.h"
 #include "storage/rowset/rowset_meta_manager.h"
 #include "storage/rowset/rowset_options.h"
 #include "storage/rowset/rowset_writer.h"
 #include "storage/rowset/rowset_writer_context.h"
+#include "storage/rowset/segment_cache.h"
 #include "storage/rowset/segment_options.h"
 #include "storage/rowset_column_update_state.h"
 #include "storage/rowset_update_state.h"
@@ -1824,6 +1826,7 @@ Status TabletUpdates::_do_compaction(std::unique_ptr<CompactionInfo>* pinfo) {
     context.writer_type =
             (algorithm == VERTICAL_COMPACTION ? RowsetWriterType::kVertical : RowsetWriterType::kHorizontal);
     context.is_pk_compaction = true;
+    context.is_compaction = true;
     std::unique_ptr<RowsetWriter> rowset_writer;
     Status st = RowsetFactory::create_rowset_writer(context, &rowset_writer);
     if (!st.ok()) {
@@ -1978,8 +1981,11 @@ Status TabletUpdates::_commit_compaction(std::unique_ptr<CompactionInfo>* pinfo,
     rowset->rowset_meta()->get_full_meta_pb(&rowset_meta);
 
     // TODO(cbl): impl and use TabletMetaManager::compaction commit
+    // a lost compaction commit is simply redone after restart, so the meta write may skip the
+    // WAL fsync wait even when sync_tablet_meta is enabled.
     auto st = TabletMetaManager::rowset_commit(_tablet.data_dir(), _tablet.tablet_id(), _next_log_id, &edit,
-                                               rowset_meta, string());
+                                               rowset_meta, string(),
+                                               !config::enable_async_compaction_meta_write);
     if (!st.ok()) {
         _compaction_state.reset();
         LOG(WARNING) << "compaction commit failed: " << st << " " << _debug_string(false, false);
@@ -4936,44 +4942,58 @@ Status GetDeltaColumnContext::prepareGetDeltaColumnContext(std::shared_ptr<Segme
     return Status::OK();
 }
 
-static StatusOr<std::shared_ptr<Segment>> get_dcg_segment(GetDeltaColumnContext& ctx, uint32_t ucid, int32_t* col_index,
-                                                          const TabletSchemaCSPtr& read_tablet_schema) {
-    // iterate dcg from new ver to old ver
-    for (const auto& dcg : ctx.dcgs) {
-        std::pair<int32_t, int32_t> idx = dcg->get_column_idx(ucid);
-        if (idx.first >= 0) {
-            std::string column_file = dcg->column_files(parent_name(ctx.segment->file_name()))[idx.first];
-            if (ctx.dcg_segments.count(column_file) == 0) {
-                ASSIGN_OR_RETURN(auto dcg_segment, ctx.segment->new_dcg_segment(*dcg, idx.first, read_tablet_schema));
-                ctx.dcg_segments[column_file] = dcg_segment;
-            }
-            if (col_index != nullptr) {
-                *col_index = idx.second;
-            }
-            return ctx.dcg_segments[column_file];
-        }
-    }
-    // the column not exist in delta column group
-    return nullptr;
-}
-
 static StatusOr<std::unique_ptr<ColumnIterator>> new_dcg_column_iterator(GetDeltaColumnContext& ctx,
                                                                          const std::shared_ptr<FileSystem>& fs,
                                                                          ColumnIteratorOptions& iter_opts,
                                                                          uint32_t ucid,
-                                                                         const TabletSchemaCSPtr& read_tablet_schema) {
-    // build column iter from delta column group
-    int32_t col_index = 0;
-    ASSIGN_OR_RETURN(auto dcg_segment, get_dcg_segment(ctx, ucid, &col_index, read_tablet_schema));
-    if (dcg_segment != nullptr) {
-        if (ctx.dcg_read_files.count(dcg_segment->file_name()) == 0) {
-            ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(dcg_segment->file_info()));
-            ctx.dcg_read_files[dcg_segment->file_name()] = std::move(read_file);
-        }
-        iter_opts.read_file = ctx.dcg_read_files[dcg_segment->file_name()].get();
-        return dcg_segment->new_column_iterator(ucid, nullptr);
+                                                                         const TabletSchemaCSPtr& read_tablet_schema,
+                                                                         const TabletColumn& fallback_column,
+                                                                         io::SeekableInputStream* segment_read_file) {
+    // build column iter from delta column group, iterate dcg from new ver to old
+    // ver and collect sparse `.cols` overlays until a full-length source is found
+    std::vector<DeltaColumnGroupIterator::Source> overlays;
+    for (const auto& dcg : ctx.dcgs) {
+        std::pair<int32_t, int32_t> idx = dcg->get_column_idx(ucid);
+        if (idx.first < 0) {
+            continue;
+        }
+        std::string column_file = dcg->column_files(parent_name(ctx.segment->file_name()))[idx.first];
+        if (ctx.dcg_segments.count(column_file) == 0) {
+            ASSIGN_OR_RETURN(auto dcg_segment, ctx.segment->new_dcg_segment(*dcg, idx.first, read_tablet_schema));
+            ctx.dcg_segments[column_file] = dcg_segment;
+        }
+        auto dcg_segment = ctx.dcg_segments[column_file];
+        if (!dcg->sparse(idx.first)) {
+            if (ctx.dcg_read_files.count(dcg_segment->file_name()) == 0) {
+                ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(dcg_segment->file_info()));
+                ctx.dcg_read_files[dcg_segment->file_name()] = std::move(read_file);
+            }
+            iter_opts.read_file = ctx.dcg_read_files[dcg_segment->file_name()].get();
+            ASSIGN_OR_RETURN(auto base_iter, dcg_segment->new_column_iterator(ucid, nullptr));
+            if (overlays.empty()) {
+                return base_iter;
+            }
+            std::reverse(overlays.begin(), overlays.end());
+            return std::make_unique<DeltaColumnGroupIterator>(
+                    DeltaColumnGroupIterator::Source{std::move(base_iter), nullptr, {}}, std::move(overlays));
+        }
+        // sparse overlay, it owns its read file
+        DeltaColumnGroupIterator::Source overlay;
+        ASSIGN_OR_RETURN(overlay.iter, dcg_segment->new_column_iterator(ucid, nullptr));
+        ASSIGN_OR_RETURN(overlay.read_file, fs->new_random_access_file(dcg_segment->file_info()));
+        overlay.rowids = dcg->column_rowids(idx.first);
+        overlays.emplace_back(std::move(overlay));
+    }
+    if (overlays.empty()) {
+        // the column not exist in delta column group
+        return nullptr;
     }
-    return nullptr;
+    // only sparse overlays cover this column, the base is the segment itself
+    iter_opts.read_file = segment_read_file;
+    ASSIGN_OR_RETURN(auto base_iter, ctx.segment->new_column_iterator_or_default(fallback_column, nullptr));
+    std::reverse(overlays.begin(), overlays.end());
+    return std::make_unique<DeltaColumnGroupIterator>(
+            DeltaColumnGroupIterator::Source{std::move(base_iter), nullptr, {}}, std::move(overlays));
 }
 
 Status TabletUpdates::get_column_values(const std::vector<uint32_t>& column_ids, int64_t read_version,
@@ -5044,29 +5064,33 @@ Status TabletUpdates::get_column_values(const std::vector<uint32_t>& column_ids,
         }
         std::string seg_path =
                 Rowset::segment_file_path(rowset->rowset_path(), rowset->rowset_id(), rssid - iter->first);
-        auto segment = Segment::open(fs, FileInfo{seg_path}, rssid - iter->first, rowset->schema());
-        if (!segment.ok()) {
-            LOG(WARNING) << "Fail to open " << seg_path << ": " << segment.status();
-            return segment.status();
+        auto segment = SegmentCache::instance()->lookup(seg_path);
+        if (segment == nullptr) {
+            auto res = Segment::open(fs, FileInfo{seg_path}, rssid - iter->first, rowset->schema());
+            if (!res.ok()) {
+                LOG(WARNING) << "Fail to open " << seg_path << ": " << res.status();
+                return res.status();
+            }
+            segment = SegmentCache::instance()->cache_if_absent(seg_path, std::move(res).value());
         }
-        if ((*segment)->num_rows() == 0) {
+        if (segment->num_rows() == 0) {
             continue;
         }
         GetDeltaColumnContext ctx;
-        RETURN_IF_ERROR(ctx.prepareGetDeltaColumnContext((*segment), _tablet.data_dir()->get_meta(),
+        RETURN_IF_ERROR(ctx.prepareGetDeltaColumnContext(segment, _tablet.data_dir()->get_meta(),
                                                          TabletSegmentId(_tablet.tablet_id(), rssid), read_version));
         ColumnIteratorOptions iter_opts;
         OlapReaderStatistics stats;
         iter_opts.stats = &stats;
         iter_opts.use_page_cache = true;
-        ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file((*segment)->file_info()));
+        ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(segment->file_info()));
         iter_opts.read_file = read_file.get();
 
         if (full_row_column) {
             full_row_column->reset_column();
             full_row_column->reserve(rowids.size());
             const auto& column = _tablet.tablet_schema()->column(_tablet.tablet_schema()->num_columns() - 1);
-            ASSIGN_OR_RETURN(auto col_iter, (*segment)->new_column_iterator_or_default(column, nullptr));
+            ASSIGN_OR_RETURN(auto col_iter, segment->new_column_iterator_or_default(column, nullptr));
             RETURN_IF_ERROR(col_iter->init(iter_opts));
             RETURN_IF_ERROR(col_iter->fetch_values_by_rowid(rowids.data(), rowids.size(), full_row_column.get()));
             auto row_encoder = RowStoreEncoderFactory::instance()->get_or_create_encoder(SIMPLE);
@@ -5076,11 +5100,12 @@ Status TabletUpdates::get_column_values(const std::vector<uint32_t>& column_ids,
             for (auto i = 0; i < column_ids.size(); ++i) {
                 // try to build iterator from delta column file first
                 ASSIGN_OR_RETURN(auto col_iter,
-                                 new_dcg_column_iterator(ctx, fs, iter_opts, unique_column_ids[i], read_tablet_schema));
+                                 new_dcg_column_iterator(ctx, fs, iter_opts, unique_column_ids[i], read_tablet_schema,
+                                                         read_tablet_schema->column(column_ids[i]), read_file.get()));
                 if (col_iter == nullptr) {
                     // not found in delta column file, build iterator from main segment
                     const auto& column = read_tablet_schema->column(column_ids[i]);
-                    ASSIGN_OR_RETURN(col_iter, (*segment)->new_column_iterator_or_default(column, nullptr));
+                    ASSIGN_OR_RETURN(col_iter, segment->new_column_iterator_or_default(column, nullptr));
                     iter_opts.read_file = read_file.get();
                 }
                 RETURN_IF_ERROR(col_iter->init(iter_opts));
@@ -5116,7 +5141,9 @@ Status TabletUpdates::get_column_values(const std::vector<uint32_t>& column_ids,
         for (auto i = 0; i < column_ids.size(); ++i) {
             // try to build iterator from delta column file first
             ASSIGN_OR_RETURN(auto col_iter,
-                             new_dcg_column_iterator(ctx, fs, iter_opts, unique_column_ids[i], read_tablet_schema));
+                             new_dcg_column_iterator(ctx, fs, iter_opts, unique_column_ids[i], read_tablet_schema,
+                                                     auto_increment_state->schema->column(auto_increment_state->id),
+                                                     read_file.get()));
             if (col_iter == nullptr) {
                 // not found in delta column file, build iterator from main segment
                 // use partial segment column offset id to get the column
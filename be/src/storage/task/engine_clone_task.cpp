@@ -64,6 +64,7 @@
 #include "util/defer_op.h"
 #include "util/network_util.h"
 #include "util/string_parser.hpp"
+#include "util/threadpool.h"
 #include "util/thrift_rpc_helper.h"
 
 using std::set;
@@ -578,10 +579,13 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
     }
 
     // Get copy from remote
-    uint64_t total_file_size = 0;
+    std::atomic<uint64_t> total_file_size{0};
     MonotonicStopWatch watch;
     watch.start();
-    for (int i = 0; i < file_name_list.size(); ++i) {
+    auto download_one_file = [&](int i) {
+        if (StorageEngine::instance()->bg_worker_stopped()) {
+            return Status::InternalError("Process is going to quit. The download will stop.");
+        }
         std::string& file_name = file_name_list[i];
         auto remote_file_url = remote_url_prefix + file_name;
 
@@ -630,7 +634,40 @@ Status EngineCloneTask::_download_files(DataDir* data_dir, const std::string& re
             chmod(local_file_path.c_str(), S_IRUSR | S_IWUSR);
             return Status::OK();
         };
-        RETURN_IF_ERROR(HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb));
+        return HttpClient::execute_with_retry(DOWNLOAD_FILE_MAX_RETRY, 1, download_cb);
+    };
+
+    int file_count = file_name_list.size();
+    int parallelism = std::min<int>(std::max<int>(1, config::clone_download_parallelism), file_count - 1);
+    if (parallelism > 1) {
+        // Fetch the data files over multiple concurrent HTTP streams so a clone is not bounded
+        // by a single connection's throughput. The header file was swapped to the last slot
+        // above; it is still downloaded alone after all data files have landed, so a partially
+        // downloaded snapshot can never be loaded.
+        std::unique_ptr<ThreadPool> download_pool;
+        RETURN_IF_ERROR(ThreadPoolBuilder("clone_download")
+                                .set_min_threads(parallelism)
+                                .set_max_threads(parallelism)
+                                .build(&download_pool));
+        std::mutex download_status_mutex;
+        Status download_status;
+        for (int i = 0; i < file_count - 1; ++i) {
+            RETURN_IF_ERROR(download_pool->submit_func([&, i]() {
+                Status st = download_one_file(i);
+                if (!st.ok()) {
+                    std::lock_guard<std::mutex> l(download_status_mutex);
+                    download_status.update(st);
+                }
+            }));
+        }
+        download_pool->wait();
+        download_pool->shutdown();
+        RETURN_IF_ERROR(download_status);
+        RETURN_IF_ERROR(download_one_file(file_count - 1));
+    } else {
+        for (int i = 0; i < file_count; ++i) {
+            RETURN_IF_ERROR(download_one_file(i));
+        }
     } // Clone files from remote backend
 
     uint64_t total_time_ms = watch.elapsed_time() / 1000 / 1000;
@@ -125,6 +125,7 @@ TxnManager::TxnManager(int32_t txn_map_shard_size, int32_t txn_shard_size, uint3
     _txn_map_locks = std::unique_ptr<std::shared_mutex[]>(new std::shared_mutex[_txn_map_shard_size]);
     _txn_tablet_maps = std::unique_ptr<txn_tablet_map_t[]>(new txn_tablet_map_t[_txn_map_shard_size]);
     _txn_partition_maps = std::unique_ptr<txn_partition_map_t[]>(new txn_partition_map_t[_txn_map_shard_size]);
+    _txn_partition_map_locks = std::unique_ptr<std::shared_mutex[]>(new std::shared_mutex[_txn_map_shard_size]);
     // we will get "store_num = 0" if it acts as cn, just ignore flush pool
     if (store_num > 0) {
         auto st = ThreadPoolBuilder("meta-flush")
@@ -173,8 +174,8 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
                                SchemaHash schema_hash, const TabletUid& tablet_uid, const PUniqueId& load_id) {
     TxnKey key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    std::unique_lock txn_wrlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::unique_lock txn_wrlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it != txn_tablet_map.end()) {
         auto load_itr = it->second.find(tablet_info);
@@ -194,12 +195,15 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
 
     // check if there are too many transactions on running.
     // if yes, reject the request.
-    txn_partition_map_t& txn_partition_map = _get_txn_partition_map(transaction_id);
-    if (txn_partition_map.size() > config::max_runnings_transactions_per_txn_map) {
-        auto msg = fmt::format("Txn number exceeds the limit. txn_count: {}, limit: {}", txn_tablet_map.size(),
-                               config::max_runnings_transactions_per_txn_map);
-        LOG(ERROR) << msg;
-        return Status::ServiceUnavailable(msg);
+    {
+        txn_partition_map_t& txn_partition_map = _get_txn_partition_map(transaction_id);
+        std::shared_lock txn_partition_rdlock(_get_txn_partition_map_lock(transaction_id));
+        if (txn_partition_map.size() > config::max_runnings_transactions_per_txn_map) {
+            auto msg = fmt::format("Txn number exceeds the limit. txn_count: {}, limit: {}", txn_tablet_map.size(),
+                                   config::max_runnings_transactions_per_txn_map);
+            LOG(ERROR) << msg;
+            return Status::ServiceUnavailable(msg);
+        }
     }
 
     // not found load id
@@ -207,7 +211,7 @@ Status TxnManager::prepare_txn(TPartitionId partition_id, TTransactionId transac
     // case 2: loading txn from meta env
     TabletTxnInfo load_info(load_id, nullptr);
     txn_tablet_map[key][tablet_info] = load_info;
-    _insert_txn_partition_map_unlocked(transaction_id, partition_id);
+    _insert_txn_partition_map(transaction_id, partition_id);
 
     VLOG(3) << "add transaction to engine successfully."
             << "partition_id: " << key.first << ", txn_id: " << key.second << ", tablet: " << tablet_info.to_string();
@@ -232,8 +236,8 @@ Status TxnManager::commit_txn(KVStore* meta, TPartitionId partition_id, TTransac
 
     {
         // get tx
-        std::shared_lock rdlock(_get_txn_map_lock(transaction_id));
-        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+        std::shared_lock rdlock(_get_txn_map_lock(partition_id, transaction_id));
+        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
         auto it = txn_tablet_map.find(key);
         if (it != txn_tablet_map.end()) {
             auto load_itr = it->second.find(tablet_info);
@@ -280,8 +284,8 @@ Status TxnManager::commit_txn(KVStore* meta, TPartitionId partition_id, TTransac
     }
 
     {
-        std::unique_lock wrlock(_get_txn_map_lock(transaction_id));
-        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+        std::unique_lock wrlock(_get_txn_map_lock(partition_id, transaction_id));
+        txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
         auto& tablet_txn_infos = txn_tablet_map[key];
         auto itr = tablet_txn_infos.find(tablet_info);
         if (itr == tablet_txn_infos.end()) {
@@ -294,7 +298,7 @@ Status TxnManager::commit_txn(KVStore* meta, TPartitionId partition_id, TTransac
             itr->second.commit_time = UnixSeconds();
         }
         // [tablet_info] = load_info;
-        _insert_txn_partition_map_unlocked(transaction_id, partition_id);
+        _insert_txn_partition_map(transaction_id, partition_id);
         VLOG(1) << "Commit txn successfully. "
                 << " tablet: " << tablet_id << ", txn_id: " << key.second << ", rowsetid: " << rowset_ptr->rowset_id()
                 << " #segment:" << rowset_ptr->num_segments() << " #delfile:" << rowset_ptr->num_delete_files()
@@ -322,8 +326,8 @@ Status TxnManager::publish_txn(TPartitionId partition_id, const TabletSharedPtr&
             return st;
         }
     }
-    std::unique_lock wrlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::unique_lock wrlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet->tablet_id(), tablet->schema_hash(), tablet->tablet_uid());
     auto it = txn_tablet_map.find(key);
@@ -342,7 +346,7 @@ Status TxnManager::publish_txn(TPartitionId partition_id, const TabletSharedPtr&
         }
         if (it->second.empty()) {
             txn_tablet_map.erase(it);
-            _clear_txn_partition_map_unlocked(transaction_id, partition_id);
+            _clear_txn_partition_map(transaction_id, partition_id);
         }
     }
     return Status::OK();
@@ -434,8 +438,8 @@ Status TxnManager::rollback_txn(TPartitionId partition_id, TTransactionId transa
                                 SchemaHash schema_hash, const TabletUid& tablet_uid, bool with_log) {
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    std::unique_lock wrlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::unique_lock wrlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it != txn_tablet_map.end()) {
         auto load_itr = it->second.find(tablet_info);
@@ -457,7 +461,7 @@ Status TxnManager::rollback_txn(TPartitionId partition_id, TTransactionId transa
         }
         if (it->second.empty()) {
             txn_tablet_map.erase(it);
-            _clear_txn_partition_map_unlocked(transaction_id, partition_id);
+            _clear_txn_partition_map(transaction_id, partition_id);
         }
     }
     return Status::OK();
@@ -469,8 +473,8 @@ Status TxnManager::delete_txn(KVStore* meta, TPartitionId partition_id, TTransac
                               TTabletId tablet_id, SchemaHash schema_hash, const TabletUid& tablet_uid) {
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    std::unique_lock txn_wrlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::unique_lock txn_wrlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it == txn_tablet_map.end()) {
         return Status::NotFound(fmt::format("Not found txn. tablet_id: {}, txn_id: {}", tablet_id, transaction_id));
@@ -504,7 +508,7 @@ Status TxnManager::delete_txn(KVStore* meta, TPartitionId partition_id, TTransac
     it->second.erase(tablet_info);
     if (it->second.empty()) {
         txn_tablet_map.erase(it);
-        _clear_txn_partition_map_unlocked(transaction_id, partition_id);
+        _clear_txn_partition_map(transaction_id, partition_id);
     }
     return Status::OK();
 }
@@ -557,7 +561,7 @@ void TxnManager::force_rollback_tablet_related_txns(KVStore* meta, TTabletId tab
                 it->second.erase(tablet_info);
             }
             if (it->second.empty()) {
-                _clear_txn_partition_map_unlocked(it->first.second, it->first.first);
+                _clear_txn_partition_map(it->first.second, it->first.first);
                 it = txn_tablet_map.erase(it);
             } else {
                 ++it;
@@ -570,8 +574,8 @@ void TxnManager::get_txn_related_tablets(const TTransactionId transaction_id, TP
                                          std::map<TabletInfo, RowsetSharedPtr>* tablet_infos) {
     // get tablets in this transaction
     pair<int64_t, int64_t> key(partition_id, transaction_id);
-    std::shared_lock txn_rdlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::shared_lock txn_rdlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     auto it = txn_tablet_map.find(key);
     if (it == txn_tablet_map.end()) {
         VLOG(3) << "could not find tablet for"
@@ -604,8 +608,8 @@ bool TxnManager::has_txn(TPartitionId partition_id, TTransactionId transaction_i
                          SchemaHash schema_hash, const TabletUid& tablet_uid) {
     pair<int64_t, int64_t> key(partition_id, transaction_id);
     TabletInfo tablet_info(tablet_id, schema_hash, tablet_uid);
-    std::shared_lock txn_rdlock(_get_txn_map_lock(transaction_id));
-    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(transaction_id);
+    std::shared_lock txn_rdlock(_get_txn_map_lock(partition_id, transaction_id));
+    txn_tablet_map_t& txn_tablet_map = _get_txn_tablet_map(partition_id, transaction_id);
     auto it = txn_tablet_map.find(key);
     bool found = it != txn_tablet_map.end() && it->second.find(tablet_info) != it->second.end();
 
@@ -635,7 +639,7 @@ void TxnManager::build_expire_txn_map(std::map<TabletInfo, std::vector<int64_t>>
 }
 
 void TxnManager::get_partition_ids(const TTransactionId transaction_id, std::vector<TPartitionId>* partition_ids) {
-    std::shared_lock txn_rdlock(_get_txn_map_lock(transaction_id));
+    std::shared_lock txn_rdlock(_get_txn_partition_map_lock(transaction_id));
     txn_partition_map_t& txn_partition_map = _get_txn_partition_map(transaction_id);
     auto it = txn_partition_map.find(transaction_id);
     if (it != txn_partition_map.end()) {
@@ -645,16 +649,14 @@ void TxnManager::get_partition_ids(const TTransactionId transaction_id, std::vec
     }
 }
 
-void TxnManager::_insert_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id) {
+void TxnManager::_insert_txn_partition_map(int64_t transaction_id, int64_t partition_id) {
+    std::unique_lock txn_partition_wrlock(_get_txn_partition_map_lock(transaction_id));
     txn_partition_map_t& txn_partition_map = _get_txn_partition_map(transaction_id);
-    auto find = txn_partition_map.find(transaction_id);
-    if (find == txn_partition_map.end()) {
-        txn_partition_map[transaction_id] = std::unordered_set<int64_t>();
-    }
     txn_partition_map[transaction_id].insert(partition_id);
 }
 
-void TxnManager::_clear_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id) {
+void TxnManager::_clear_txn_partition_map(int64_t transaction_id, int64_t partition_id) {
+    std::unique_lock txn_partition_wrlock(_get_txn_partition_map_lock(transaction_id));
     txn_partition_map_t& txn_partition_map = _get_txn_partition_map(transaction_id);
     auto it = txn_partition_map.find(transaction_id);
     if (it != txn_partition_map.end()) {
@@ -179,32 +179,43 @@ private:
     typedef std::unordered_map<TxnKey, std::map<TabletInfo, TabletTxnInfo>, TxnKeyHash, TxnKeyEqual> txn_tablet_map_t;
     typedef std::unordered_map<int64_t, std::unordered_set<int64_t>> txn_partition_map_t;
 
-    std::shared_mutex& _get_txn_map_lock(TTransactionId transactionId);
+    // shard by the full (partition_id, transaction_id) key rather than the transaction id alone,
+    // so the tablets of one large load transaction spread over all shards instead of serializing
+    // on a single shard lock during ingest spikes.
+    std::shared_mutex& _get_txn_map_lock(TPartitionId partitionId, TTransactionId transactionId);
 
-    txn_tablet_map_t& _get_txn_tablet_map(TTransactionId transactionId);
+    txn_tablet_map_t& _get_txn_tablet_map(TPartitionId partitionId, TTransactionId transactionId);
+
+    std::shared_mutex& _get_txn_partition_map_lock(TTransactionId transactionId);
 
     txn_partition_map_t& _get_txn_partition_map(TTransactionId transactionId);
 
-    // insert or remove (transaction_id, partition_id) from _txn_partition_map
-    // get _txn_map_lock before calling
-    void _insert_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id);
-    void _clear_txn_partition_map_unlocked(int64_t transaction_id, int64_t partition_id);
+    // insert or remove (transaction_id, partition_id) from _txn_partition_map.
+    // they take the partition map shard lock internally, and may be called while holding a
+    // txn map shard lock (the reverse order never happens, so there is no deadlock).
+    void _insert_txn_partition_map(int64_t transaction_id, int64_t partition_id);
+    void _clear_txn_partition_map(int64_t transaction_id, int64_t partition_id);
 
 private:
     const int32_t _txn_map_shard_size;
 
     const int32_t _txn_shard_size;
 
-    // _txn_map_locks[i] protect _txn_tablet_maps[i], i=0,1,2...,and i < _txn_map_shard_size
+    // _txn_map_locks[i] protect _txn_tablet_maps[i], i=0,1,2...,and i < _txn_map_shard_size.
+    // sharded by TxnKeyHash of (partition_id, transaction_id)
     std::unique_ptr<txn_tablet_map_t[]> _txn_tablet_maps;
     // transaction_id -> corresponding partition ids
     // This is mainly for the clear txn task received from FE, which may only has transaction id,
     // so we need this map to find out which partitions are corresponding to a transaction id.
-    // The _txn_partition_maps[i] should be constructed/deconstructed/modified alongside with '_txn_tablet_maps[i]'
+    // It is sharded by the transaction id and protected by its own _txn_partition_map_locks,
+    // because its key does not carry a partition id.
     std::unique_ptr<txn_partition_map_t[]> _txn_partition_maps;
 
     std::unique_ptr<std::shared_mutex[]> _txn_map_locks;
 
+    // _txn_partition_map_locks[i] protect _txn_partition_maps[i]
+    std::unique_ptr<std::shared_mutex[]> _txn_partition_map_locks;
+
     // Dynamic thread pool used to concurrently flush WAL to disk
     std::unique_ptr<ThreadPool> _flush_thread_pool;
 
@@ -212,12 +223,17 @@ private:
     const TxnManager& operator=(const TxnManager&) = delete;
 }; // TxnManager
 
-inline std::shared_mutex& TxnManager::_get_txn_map_lock(TTransactionId transactionId) {
-    return _txn_map_locks[transactionId & (_txn_map_shard_size - 1)];
+inline std::shared_mutex& TxnManager::_get_txn_map_lock(TPartitionId partitionId, TTransactionId transactionId) {
+    return _txn_map_locks[TxnKeyHash()(TxnKey(partitionId, transactionId)) & (_txn_map_shard_size - 1)];
+}
+
+inline TxnManager::txn_tablet_map_t& TxnManager::_get_txn_tablet_map(TPartitionId partitionId,
+                                                                     TTransactionId transactionId) {
+    return _txn_tablet_maps[TxnKeyHash()(TxnKey(partitionId, transactionId)) & (_txn_map_shard_size - 1)];
 }
 
-inline TxnManager::txn_tablet_map_t& TxnManager::_get_txn_tablet_map(TTransactionId transactionId) {
-    return _txn_tablet_maps[transactionId & (_txn_map_shard_size - 1)];
+inline std::shared_mutex& TxnManager::_get_txn_partition_map_lock(TTransactionId transactionId) {
+    return _txn_partition_map_locks[transactionId & (_txn_map_shard_size - 1)];
 }
 
 inline TxnManager::txn_partition_map_t& TxnManager::_get_txn_partition_map(TTransactionId transactionId) {
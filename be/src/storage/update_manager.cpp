@@ -169,7 +169,7 @@ Status UpdateManager::get_delta_column_group(KVStore* meta, const TabletSegmentI
 
 Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, int64_t version, DelVectorPtr* pdelvec) {
     {
-        std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+        std::shared_lock lg(_del_vec_cache_lock);
         auto itr = _del_vec_cache.find(tsid);
         if (itr != _del_vec_cache.end()) {
             if (version >= itr->second->version()) {
@@ -186,7 +186,7 @@ Status UpdateManager::get_del_vec(KVStore* meta, const TabletSegmentId& tsid, in
     int64_t latest_version = 0;
     RETURN_IF_ERROR(get_del_vec_in_meta(meta, tsid, version, pdelvec->get(), &latest_version));
     if ((*pdelvec)->version() == latest_version) {
-        std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+        std::unique_lock lg(_del_vec_cache_lock);
         auto itr = _del_vec_cache.find(tsid);
         if (itr == _del_vec_cache.end()) {
             _del_vec_cache.emplace(tsid, *pdelvec);
@@ -214,7 +214,7 @@ void UpdateManager::clear_cache() {
     StarRocksMetrics::instance()->update_primary_index_num.set_value(0);
     StarRocksMetrics::instance()->update_primary_index_bytes_total.set_value(0);
     {
-        std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+        std::unique_lock lg(_del_vec_cache_lock);
         _del_vec_cache.clear();
         if (_del_vec_cache_mem_tracker) {
             _del_vec_cache_mem_tracker->release(_del_vec_cache_mem_tracker->consumption());
@@ -232,7 +232,7 @@ void UpdateManager::clear_cache() {
 }
 
 void UpdateManager::clear_cached_del_vec(const std::vector<TabletSegmentId>& tsids) {
-    std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+    std::unique_lock lg(_del_vec_cache_lock);
     for (const auto& tsid : tsids) {
         auto itr = _del_vec_cache.find(tsid);
         if (itr != _del_vec_cache.end()) {
@@ -365,7 +365,7 @@ void UpdateManager::expire_cache() {
     StarRocksMetrics::instance()->update_primary_index_num.set_value(_index_cache.object_size());
     StarRocksMetrics::instance()->update_primary_index_bytes_total.set_value(_index_cache.size());
     {
-        std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+        std::shared_lock lg(_del_vec_cache_lock);
         StarRocksMetrics::instance()->update_del_vector_num.set_value(_del_vec_cache.size());
         StarRocksMetrics::instance()->update_del_vector_bytes_total.set_value(std::accumulate(
                 _del_vec_cache.cbegin(), _del_vec_cache.cend(), 0,
@@ -454,18 +454,30 @@ string UpdateManager::topn_memory_stats(size_t topn) {
 }
 
 Status UpdateManager::get_latest_del_vec(KVStore* meta, const TabletSegmentId& tsid, DelVectorPtr* pdelvec) {
-    std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+    {
+        std::shared_lock lg(_del_vec_cache_lock);
+        auto itr = _del_vec_cache.find(tsid);
+        if (itr != _del_vec_cache.end()) {
+            *pdelvec = itr->second;
+            return Status::OK();
+        }
+    }
+    // load from meta without holding the cache lock.
+    (*pdelvec).reset(new DelVector());
+    int64_t latest_version = 0;
+    RETURN_IF_ERROR(get_del_vec_in_meta(meta, tsid, INT64_MAX, pdelvec->get(), &latest_version));
+    std::unique_lock lg(_del_vec_cache_lock);
     auto itr = _del_vec_cache.find(tsid);
-    if (itr != _del_vec_cache.end()) {
-        *pdelvec = itr->second;
-        return Status::OK();
-    } else {
-        // TODO(cbl): move get_del_vec_in_meta out of lock
-        (*pdelvec).reset(new DelVector());
-        int64_t latest_version = 0;
-        RETURN_IF_ERROR(get_del_vec_in_meta(meta, tsid, INT64_MAX, pdelvec->get(), &latest_version));
+    if (itr == _del_vec_cache.end()) {
         _del_vec_cache.emplace(tsid, *pdelvec);
         _del_vec_cache_mem_tracker->consume((*pdelvec)->memory_usage());
+    } else if ((*pdelvec)->version() > itr->second->version()) {
+        _del_vec_cache_mem_tracker->release(itr->second->memory_usage());
+        itr->second = *pdelvec;
+        _del_vec_cache_mem_tracker->consume(itr->second->memory_usage());
+    } else {
+        // a concurrent publish cached a newer version meanwhile, prefer it.
+        *pdelvec = itr->second;
     }
     return Status::OK();
 }
@@ -473,7 +485,7 @@ Status UpdateManager::get_latest_del_vec(KVStore* meta, const TabletSegmentId& t
 Status UpdateManager::set_cached_del_vec(const TabletSegmentId& tsid, const DelVectorPtr& delvec) {
     VLOG(1) << "set_cached_del_vec tablet:" << tsid.tablet_id << " rss:" << tsid.segment_id
             << " version:" << delvec->version() << " #del:" << delvec->cardinality();
-    std::lock_guard<std::mutex> lg(_del_vec_cache_lock);
+    std::unique_lock lg(_del_vec_cache_lock);
     auto itr = _del_vec_cache.find(tsid);
     if (itr != _del_vec_cache.end()) {
         if (delvec->version() <= itr->second->version()) {
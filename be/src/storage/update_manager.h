@@ -14,6 +14,7 @@
 
 #pragma once
 
+#include <shared_mutex>
 #include <string>
 #include <unordered_map>
 
@@ -167,7 +168,9 @@ private:
     std::atomic<int64_t> _last_clear_expired_cache_millis{0};
 
     // DelVector related states
-    std::mutex _del_vec_cache_lock;
+    // readers only need a shared lock to copy the decoded DelVectorPtr out of the cache, so
+    // concurrent queries over many segments do not serialize on the cache lookups.
+    std::shared_mutex _del_vec_cache_lock;
     std::unordered_map<TabletSegmentId, DelVectorPtr> _del_vec_cache;
     std::unique_ptr<MemTracker> _del_vec_cache_mem_tracker;
 
@@ -17,11 +17,13 @@
 #include <vector>
 
 #include "column/schema.h"
+#include "fs/fs.h"
 #include "runtime/current_thread.h"
 #include "storage/chunk_helper.h"
 #include "storage/compaction_utils.h"
 #include "storage/olap_common.h"
 #include "storage/row_source_mask.h"
+#include "storage/rowset/column_iterator.h"
 #include "storage/rowset/column_reader.h"
 #include "storage/rowset/rowset.h"
 #include "storage/rowset/rowset_writer.h"
@@ -57,10 +59,15 @@ Status VerticalCompactionTask::_vertical_compaction_data(Statistics* statistics)
     int64_t max_rows_per_segment = CompactionUtils::get_segment_max_rows(
             config::max_segment_file_size, _task_info.input_rows_num, _task_info.input_rowsets_size);
 
+    std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> seed_dict_words;
+    if (config::enable_vertical_compaction_dict_reuse) {
+        seed_dict_words = _collect_shared_dict_words();
+    }
+
     std::unique_ptr<RowsetWriter> output_rs_writer;
     RETURN_IF_ERROR(CompactionUtils::construct_output_rowset_writer(
             _tablet.get(), max_rows_per_segment, _task_info.algorithm, _task_info.output_version, _task_info.gtid,
-            &output_rs_writer, _tablet_schema));
+            &output_rs_writer, _tablet_schema, std::move(seed_dict_words)));
 
     std::vector<std::vector<uint32_t>> column_groups;
     CompactionUtils::split_column_into_groups(_tablet_schema->num_columns(), _tablet_schema->sort_key_idxes(),
@@ -162,6 +169,76 @@ Status VerticalCompactionTask::_compact_column_group(bool is_key, int column_gro
     return Status::OK();
 }
 
+std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>>
+VerticalCompactionTask::_collect_shared_dict_words() {
+    auto result = std::make_shared<std::unordered_map<uint32_t, std::vector<std::string>>>();
+    OlapReaderStatistics stats;
+    for (size_t column_index = 0; column_index < _tablet_schema->num_columns(); column_index++) {
+        const TabletColumn& column = _tablet_schema->column(column_index);
+        if (!is_string_type(column.type())) {
+            continue;
+        }
+        std::vector<std::string> words;
+        bool shared = true;
+        bool has_segment = false;
+        for (auto& rowset : _input_rowsets) {
+            for (auto& segment : rowset->segments()) {
+                if (segment->column_with_uid(column.unique_id()) == nullptr) {
+                    // the column was added after this segment was written
+                    shared = false;
+                    break;
+                }
+                auto segment_words = _fetch_dict_words(segment, column, &stats);
+                if (!segment_words.ok()) {
+                    // not fully dict encoded (or unreadable), don't seed this column
+                    shared = false;
+                    break;
+                }
+                if (!has_segment) {
+                    words = std::move(segment_words.value());
+                    has_segment = true;
+                } else if (words != segment_words.value()) {
+                    shared = false;
+                    break;
+                }
+            }
+            if (!shared) {
+                break;
+            }
+        }
+        if (shared && has_segment && !words.empty()) {
+            VLOG(1) << "compaction task_id:" << _task_info.task_id << ", tablet=" << _tablet->tablet_id()
+                    << ", carry dictionary of column " << column.name() << " forward, words=" << words.size();
+            (*result)[column.unique_id()] = std::move(words);
+        }
+    }
+    return result->empty() ? nullptr : result;
+}
+
+StatusOr<std::vector<std::string>> VerticalCompactionTask::_fetch_dict_words(const SegmentSharedPtr& segment,
+                                                                             const TabletColumn& column,
+                                                                             OlapReaderStatistics* stats) {
+    ASSIGN_OR_RETURN(auto fs, FileSystem::CreateSharedFromString(segment->file_name()));
+    ASSIGN_OR_RETURN(auto read_file, fs->new_random_access_file(segment->file_name()));
+    ASSIGN_OR_RETURN(auto iter, segment->new_column_iterator_or_default(column, nullptr));
+    ColumnIteratorOptions iter_opts;
+    iter_opts.check_dict_encoding = true;
+    iter_opts.read_file = read_file.get();
+    iter_opts.stats = stats;
+    RETURN_IF_ERROR(iter->init(iter_opts));
+    if (!iter->all_page_dict_encoded()) {
+        return Status::GlobalDictError("not all pages dict encoded");
+    }
+    std::vector<Slice> slices;
+    RETURN_IF_ERROR(iter->fetch_all_dict_words(&slices));
+    std::vector<std::string> words;
+    words.reserve(slices.size());
+    for (auto& slice : slices) {
+        words.emplace_back(slice.data, slice.size);
+    }
+    return words;
+}
+
 StatusOr<int32_t> VerticalCompactionTask::_calculate_chunk_size_for_column_group(
         const std::vector<uint32_t>& column_group) {
     int64_t total_num_rows = 0;
@@ -14,6 +14,9 @@
 
 #pragma once
 
+#include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common/status.h"
@@ -21,6 +24,7 @@
 #include "storage/compaction_task.h"
 #include "storage/olap_common.h"
 #include "storage/rowset/rowset.h"
+#include "storage/rowset/segment.h"
 
 namespace starrocks {
 
@@ -49,6 +53,15 @@ private:
                                    RowSourceMaskBuffer* mask_buffer, std::vector<RowSourceMask>* source_masks);
 
     StatusOr<int32_t> _calculate_chunk_size_for_column_group(const std::vector<uint32_t>& column_group);
+
+    // collect the dictionary words of string columns whose dictionaries are
+    // identical across all input segments, so the output writer can carry them
+    // forward instead of re-dictionarizing the columns per output segment.
+    // returns nullptr when no column qualifies.
+    std::shared_ptr<std::unordered_map<uint32_t, std::vector<std::string>>> _collect_shared_dict_words();
+
+    StatusOr<std::vector<std::string>> _fetch_dict_words(const SegmentSharedPtr& segment, const TabletColumn& column,
+                                                         OlapReaderStatistics* stats);
 };
 
 } // namespace starrocks
@@ -267,8 +267,14 @@ BitmapValue& BitmapValue::operator&=(const BitmapValue& rhs) {
             }
             break;
         case BITMAP:
-            _copy_on_write();
-            *_bitmap &= *rhs._bitmap;
+            if (_bitmap.use_count() > 1) {
+                // _copy_on_write would duplicate the whole shared bitmap only to shrink the copy
+                // right away. Build the (usually much smaller) intersection directly instead, so
+                // chained bitmap_and calls never materialize a copy of their larger operand.
+                _bitmap = std::make_shared<detail::Roaring64Map>(*_bitmap & *rhs._bitmap);
+            } else {
+                *_bitmap &= *rhs._bitmap;
+            }
             _from_bitmap_to_smaller_type();
             break;
         case SET: {
@@ -373,8 +379,13 @@ BitmapValue& BitmapValue::operator-=(const BitmapValue& rhs) {
             }
             break;
         case BITMAP:
-            _copy_on_write();
-            *_bitmap -= *rhs._bitmap;
+            if (_bitmap.use_count() > 1) {
+                // Same rationale as operator&=: avoid deep-copying a shared bitmap just to
+                // subtract from the copy.
+                _bitmap = std::make_shared<detail::Roaring64Map>(*_bitmap - *rhs._bitmap);
+            } else {
+                *_bitmap -= *rhs._bitmap;
+            }
             _from_bitmap_to_smaller_type();
             break;
         case SET: {
@@ -1173,6 +1184,47 @@ void BitmapValue::add_many(size_t n_args, const uint32_t* vals) {
     }
 }
 
+void BitmapValue::union_many(const std::vector<const BitmapValue*>& values) {
+    std::vector<const detail::Roaring64Map*> bitmaps;
+    bitmaps.reserve(values.size() + 1);
+    if (_type == BITMAP) {
+        bitmaps.emplace_back(_bitmap.get());
+    }
+    for (const auto* value : values) {
+        if (value->_type == BITMAP) {
+            bitmaps.emplace_back(value->_bitmap.get());
+        }
+    }
+    if (bitmaps.size() > 1) {
+        auto merged = std::make_shared<detail::Roaring64Map>(
+                detail::Roaring64Map::fastunion(bitmaps.size(), bitmaps.data()));
+        switch (_type) {
+        case EMPTY:
+        case BITMAP:
+            break;
+        case SINGLE:
+            merged->add(_sv);
+            break;
+        case SET:
+            for (auto x : *_set) {
+                merged->add(x);
+            }
+            _set.reset();
+            break;
+        }
+        _bitmap = std::move(merged);
+        _type = BITMAP;
+        _mem_usage = 0;
+    }
+    // SINGLE and SET inputs (or everything, when at most one bitmap showed up) take the
+    // pairwise path, which handles the type transitions.
+    for (const auto* value : values) {
+        if (value->_type != BITMAP || bitmaps.size() <= 1) {
+            *this |= *value;
+        }
+    }
+}
+
 uint64_t BitmapValueIter::next_batch(uint64_t* values, uint64_t count) {
     uint64_t remain_rows = _remain_rows();
     uint64_t read_count = std::min(count, remain_rows);
@@ -46,6 +46,7 @@
 #include <stdexcept>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "common/config.h"
 #include "common/logging.h"
@@ -126,6 +127,10 @@ public:
 
     void add_many(size_t n_args, const uint32_t* vals);
 
+    // Union many bitmaps into this one with a single multi-way merge, which builds every
+    // destination container once instead of growing this bitmap once per input.
+    void union_many(const std::vector<const BitmapValue*>& values);
+
     // Note: rhs BitmapValue is only readable after this method
     // Compute the union between the current bitmap and the provided bitmap.
     // Possible type transitions are:
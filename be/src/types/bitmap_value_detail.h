@@ -38,7 +38,9 @@
 // the detail class such as Roaring64Map.
 // So other files should not include this file except bitmap_value.cpp.
 #include <cstdint>
+#include <map>
 #include <optional>
+#include <vector>
 
 #include "roaring/array_util.h"
 #include "roaring/bitset_util.h"
@@ -765,14 +767,42 @@ public:
     /**
      * Computes the intersection between two bitmaps and returns new bitmap.
      * The current bitmap and the provided bitmap are unchanged.
+     * The result is assembled container by container with Roaring's binary and (which picks the
+     * SIMD/galloping kernel per container pair), so only the surviving containers are allocated
+     * instead of first deep-copying the left operand and shrinking the copy in place.
      */
-    Roaring64Map operator&(const Roaring64Map& o) const { return Roaring64Map(*this) &= o; }
+    Roaring64Map operator&(const Roaring64Map& o) const {
+        // intersection is symmetric, so walk the side with fewer containers and probe the other
+        const Roaring64Map& small = roarings.size() <= o.roarings.size() ? *this : o;
+        const Roaring64Map& large = roarings.size() <= o.roarings.size() ? o : *this;
+        Roaring64Map result;
+        for (const auto& map_entry : small.roarings) {
+            auto it = large.roarings.find(map_entry.first);
+            if (it == large.roarings.end()) continue;
+            Roaring intersection = map_entry.second & it->second;
+            if (!intersection.isEmpty()) {
+                result.roarings.emplace(map_entry.first, std::move(intersection));
+            }
+        }
+        return result;
+    }
 
     /**
      * Computes the difference between two bitmaps and returns new bitmap.
      * The current bitmap and the provided bitmap are unchanged.
+     * Assembled directly like operator& instead of copying the left operand first.
      */
-    Roaring64Map operator-(const Roaring64Map& o) const { return Roaring64Map(*this) -= o; }
+    Roaring64Map operator-(const Roaring64Map& o) const {
+        Roaring64Map result;
+        for (const auto& map_entry : roarings) {
+            auto it = o.roarings.find(map_entry.first);
+            Roaring difference = it == o.roarings.end() ? map_entry.second : map_entry.second - it->second;
+            if (!difference.isEmpty()) {
+                result.roarings.emplace(map_entry.first, std::move(difference));
+            }
+        }
+        return result;
+    }
 
     /**
      * Computes the union between two bitmaps and returns new bitmap.
@@ -880,10 +910,22 @@ public:
      * pointer).
      */
     static Roaring64Map fastunion(size_t n, const Roaring64Map** inputs) {
-        Roaring64Map ans;
-        // not particularly fast
+        // Group the 32-bit bitmaps sharing the same high bits, then let Roaring::fastunion
+        // (a container-level k-way merge) build each destination bitmap in one pass instead
+        // of reshaping it once per input.
+        std::map<uint32_t, std::vector<const Roaring*>> groups;
         for (size_t lcv = 0; lcv < n; ++lcv) {
-            ans |= *(inputs[lcv]);
+            for (const auto& map_entry : inputs[lcv]->roarings) {
+                groups[map_entry.first].emplace_back(&map_entry.second);
+            }
+        }
+        Roaring64Map ans;
+        for (auto& [key, group] : groups) {
+            if (group.size() == 1) {
+                ans.roarings.emplace(key, *group.front());
+            } else {
+                ans.roarings.emplace(key, Roaring::fastunion(group.size(), group.data()));
+            }
         }
         return ans;
     }
@@ -211,6 +211,63 @@ MFV_DEFAULT(void merge_registers_impl(uint8_t* dest, const uint8_t* other) {
     }
 })
 
+// Max-merge many register arrays in a single pass over the destination, so each destination
+// block is loaded and stored once no matter how many sketches are merged.
+MFV_AVX512(void merge_registers_many_impl(uint8_t* dest, const uint8_t** others, size_t n) {
+    constexpr int SIMD_SIZE = sizeof(__m512i);
+    constexpr int loop = HLL_REGISTERS_COUNT / SIMD_SIZE;
+    assert(HLL_REGISTERS_COUNT % SIMD_SIZE == 0);
+
+    for (int i = 0; i < loop; i++, dest += SIMD_SIZE) {
+        __m512i acc = _mm512_loadu_si512((const __m512i*)dest);
+        for (size_t j = 0; j < n; j++) {
+            __m512i xb = _mm512_loadu_si512((const __m512i*)(others[j] + i * SIMD_SIZE));
+            acc = _mm512_max_epu8(acc, xb);
+        }
+        _mm512_storeu_si512((__m512i*)dest, acc);
+    }
+})
+
+MFV_AVX2(void merge_registers_many_impl(uint8_t* dest, const uint8_t** others, size_t n) {
+    constexpr int SIMD_SIZE = sizeof(__m256i);
+    constexpr int loop = HLL_REGISTERS_COUNT / SIMD_SIZE;
+    assert(HLL_REGISTERS_COUNT % SIMD_SIZE == 0);
+
+    for (int i = 0; i < loop; i++, dest += SIMD_SIZE) {
+        __m256i acc = _mm256_loadu_si256((const __m256i*)dest);
+        for (size_t j = 0; j < n; j++) {
+            __m256i xb = _mm256_loadu_si256((const __m256i*)(others[j] + i * SIMD_SIZE));
+            acc = _mm256_max_epu8(acc, xb);
+        }
+        _mm256_storeu_si256((__m256i*)dest, acc);
+    }
+})
+
+MFV_SSE42(void merge_registers_many_impl(uint8_t* dest, const uint8_t** others, size_t n) {
+    constexpr int SIMD_SIZE = sizeof(__m128i);
+    constexpr int loop = HLL_REGISTERS_COUNT / SIMD_SIZE;
+    assert(HLL_REGISTERS_COUNT % SIMD_SIZE == 0);
+
+    for (int i = 0; i < loop; i++, dest += SIMD_SIZE) {
+        __m128i acc = _mm_loadu_si128((const __m128i*)dest);
+        for (size_t j = 0; j < n; j++) {
+            __m128i xb = _mm_loadu_si128((const __m128i*)(others[j] + i * SIMD_SIZE));
+            acc = _mm_max_epu8(acc, xb);
+        }
+        _mm_storeu_si128((__m128i*)dest, acc);
+    }
+})
+
+MFV_DEFAULT(void merge_registers_many_impl(uint8_t* dest, const uint8_t** others, size_t n) {
+    for (int i = 0; i < HLL_REGISTERS_COUNT; i++) {
+        uint8_t max_value = dest[i];
+        for (size_t j = 0; j < n; j++) {
+            max_value = std::max(max_value, others[j][i]);
+        }
+        dest[i] = max_value;
+    }
+})
+
 void HyperLogLog::merge(const HyperLogLog& other) {
     // fast path
     if (other._type == HLL_DATA_EMPTY) {
@@ -279,6 +336,68 @@ void HyperLogLog::merge(const HyperLogLog& other) {
     }
 }
 
+void HyperLogLog::merge_many(const std::vector<const HyperLogLog*>& others) {
+    std::vector<const uint8_t*> dense;
+    dense.reserve(others.size());
+    HllDataType first_dense_type = HLL_DATA_FULL;
+    for (const auto* other : others) {
+        switch (other->_type) {
+        case HLL_DATA_EMPTY:
+            break;
+        case HLL_DATA_EXPLICIT:
+            switch (_type) {
+            case HLL_DATA_EMPTY:
+                _type = HLL_DATA_EXPLICIT;
+                // fall through
+            case HLL_DATA_EXPLICIT:
+                // Promotion is deferred until all inputs are seen, so the register replay in
+                // _convert_explicit_to_register runs at most once per batch.
+                _hash_set.insert(other->_hash_set.begin(), other->_hash_set.end());
+                break;
+            case HLL_DATA_SPARSE:
+            case HLL_DATA_FULL:
+                for (auto hash_value : other->_hash_set) {
+                    _update_registers(hash_value);
+                }
+                break;
+            }
+            break;
+        case HLL_DATA_SPARSE:
+        case HLL_DATA_FULL:
+            if (dense.empty()) {
+                first_dense_type = other->_type;
+            }
+            dense.emplace_back(other->_registers.data);
+            break;
+        }
+    }
+
+    if (dense.empty()) {
+        if (_type == HLL_DATA_EXPLICIT && _hash_set.size() > HLL_EXPLICLIT_INT64_NUM) {
+            _convert_explicit_to_register();
+            _type = HLL_DATA_FULL;
+        }
+        return;
+    }
+
+    size_t first_unmerged = 0;
+    if (_type == HLL_DATA_EXPLICIT) {
+        _convert_explicit_to_register();
+        _type = HLL_DATA_FULL;
+    } else if (_type == HLL_DATA_EMPTY) {
+        DCHECK_EQ(_registers.data, nullptr);
+        MemChunkAllocator::instance()->allocate(HLL_REGISTERS_COUNT, &_registers);
+        DCHECK_NE(_registers.data, nullptr);
+        DCHECK_EQ(_registers.size, HLL_REGISTERS_COUNT);
+        memcpy(_registers.data, dense.front(), HLL_REGISTERS_COUNT);
+        first_unmerged = 1;
+        _type = first_dense_type;
+    }
+    if (dense.size() > first_unmerged) {
+        merge_registers_many_impl(_registers.data, dense.data() + first_unmerged, dense.size() - first_unmerged);
+    }
+}
+
 size_t HyperLogLog::max_serialized_size() const {
     switch (_type) {
     case HLL_DATA_EMPTY:
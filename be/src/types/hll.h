@@ -116,6 +116,11 @@ public:
 
     void merge(const HyperLogLog& other);
 
+    // Merge many HLL values into this one in a single pass: explicit inputs are unioned
+    // before the (at most one) promotion to dense registers, and all dense register arrays
+    // are max-merged block by block instead of sketch by sketch.
+    void merge_many(const std::vector<const HyperLogLog*>& others);
+
     // Return max size of serialized binary
     size_t max_serialized_size() const;
 
@@ -37,6 +37,7 @@
 #include <arrow/array.h>
 #include <arrow/array/builder_primitive.h>
 #include <arrow/buffer.h>
+#include <arrow/io/interfaces.h>
 #include <arrow/io/memory.h>
 #include <arrow/ipc/writer.h>
 #include <arrow/memory_pool.h>
@@ -177,8 +178,40 @@ Status convert_to_arrow_schema(const RowDescriptor& row_desc,
     return Status::OK();
 }
 
+namespace {
+
+// An output stream appending to a caller owned std::string, so the serialized batch
+// lands directly in the buffer handed to thrift instead of being copied out of an
+// intermediate arrow buffer afterwards.
+class StringOutputStream : public arrow::io::OutputStream {
+public:
+    explicit StringOutputStream(std::string* target) : _target(target) {}
+
+    arrow::Status Write(const void* data, int64_t nbytes) override {
+        _target->append(static_cast<const char*>(data), nbytes);
+        return arrow::Status::OK();
+    }
+
+    arrow::Status Flush() override { return arrow::Status::OK(); }
+
+    arrow::Status Close() override {
+        _closed = true;
+        return arrow::Status::OK();
+    }
+
+    bool closed() const override { return _closed; }
+
+    arrow::Result<int64_t> Tell() const override { return static_cast<int64_t>(_target->size()); }
+
+private:
+    std::string* _target;
+    bool _closed = false;
+};
+
+} // namespace
+
 Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::string* result) {
-    // create sink memory buffer outputstream with the computed capacity
+    // reserve the result with the computed capacity to avoid reallocation while writing
     int64_t capacity;
     arrow::Status a_st = arrow::ipc::GetRecordBatchSize(record_batch, &capacity);
     if (!a_st.ok()) {
@@ -186,22 +219,18 @@ Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::strin
         msg << "GetRecordBatchSize failure, reason: " << a_st.ToString();
         return Status::InternalError(msg.str());
     }
-    auto sink_res = arrow::io::BufferOutputStream::Create(capacity, arrow::default_memory_pool());
-    if (!sink_res.ok()) {
-        std::stringstream msg;
-        msg << "create BufferOutputStream failure, reason: " << sink_res.status().ToString();
-        return Status::InternalError(msg.str());
-    }
-    std::shared_ptr<arrow::io::BufferOutputStream> sink = sink_res.ValueOrDie();
+    result->clear();
+    result->reserve(capacity);
+    StringOutputStream sink(result);
     // create RecordBatch Writer
-    auto writer_res = arrow::ipc::MakeStreamWriter(sink.get(), record_batch.schema());
+    auto writer_res = arrow::ipc::MakeStreamWriter(&sink, record_batch.schema());
     if (!writer_res.ok()) {
         std::stringstream msg;
         msg << "open RecordBatchStreamWriter failure, reason: " << writer_res.status().ToString();
         return Status::InternalError(msg.str());
     }
     std::shared_ptr<arrow::ipc::RecordBatchWriter> record_batch_writer = writer_res.ValueOrDie();
-    // write RecordBatch to memory buffer outputstream
+    // write RecordBatch to the string sink
     a_st = record_batch_writer->WriteRecordBatch(record_batch);
     if (!a_st.ok()) {
         std::stringstream msg;
@@ -209,16 +238,8 @@ Status serialize_record_batch(const arrow::RecordBatch& record_batch, std::strin
         return Status::InternalError(msg.str());
     }
     [[maybe_unused]] auto wr_close_st = record_batch_writer->Close();
-    auto finish_res = sink->Finish();
-    if (!finish_res.ok()) {
-        std::stringstream msg;
-        msg << "allocate result buffer failure, reason: " << finish_res.status().ToString();
-        return Status::InternalError(msg.str());
-    }
-    std::shared_ptr<arrow::Buffer> buffer = finish_res.ValueOrDie();
-    *result = buffer->ToString();
     // close the sink
-    [[maybe_unused]] auto sk_close_st = sink->Close();
+    [[maybe_unused]] auto sk_close_st = sink.Close();
     return Status::OK();
 }
 
@@ -42,6 +42,7 @@
 #include <snappy/snappy-sinksource.h>
 #include <snappy/snappy.h>
 #include <zlib.h>
+#include <zstd/zdict.h>
 #include <zstd/zstd.h>
 #include <zstd/zstd_errors.h>
 
@@ -867,6 +868,135 @@ private:
     }
 };
 
+// A zstd codec bound to a digested per-column dictionary, created through
+// new_zstd_dict_compressor/new_zstd_dict_decompressor. The compression level is baked into
+// the digested dictionary, so pages are compressed in one shot instead of streaming.
+class ZstdDictBlockCompression final : public BlockCompressionCodec {
+public:
+    ZstdDictBlockCompression() : BlockCompressionCodec(CompressionTypePB::ZSTD) {}
+
+    ~ZstdDictBlockCompression() override {
+        ZSTD_freeCDict(_cdict);
+        ZSTD_freeDDict(_ddict);
+    }
+
+    Status init_compressor(const Slice& dict, int level) {
+        _cdict = ZSTD_createCDict(dict.data, dict.size, level);
+        if (_cdict == nullptr) {
+            return Status::InvalidArgument("Fail to digest ZSTD compression dictionary");
+        }
+        return Status::OK();
+    }
+
+    Status init_decompressor(const Slice& dict) {
+        _ddict = ZSTD_createDDict(dict.data, dict.size);
+        if (_ddict == nullptr) {
+            return Status::InvalidArgument("Fail to digest ZSTD decompression dictionary");
+        }
+        return Status::OK();
+    }
+
+    Status compress(const Slice& input, Slice* output, bool use_compression_buffer, size_t uncompressed_size,
+                    faststring* compressed_body1, raw::RawString* compressed_body2) const override {
+        return _compress(input, output, use_compression_buffer, uncompressed_size, compressed_body1, compressed_body2);
+    }
+
+    Status decompress(const Slice& input, Slice* output) const override {
+        DCHECK(_ddict != nullptr);
+        StatusOr<compression::ZSTD_DCtx_Pool::Ref> ref = compression::getZSTD_DCtx();
+        Status status = ref.status();
+        if (!status.ok()) {
+            return status;
+        }
+        compression::ZSTDDecompressContext* context = ref.value().get();
+        ZSTD_DCtx* ctx = context->ctx;
+
+        size_t ret = ZSTD_decompress_usingDDict(ctx, output->data, output->size, input.data, input.size, _ddict);
+        if (ZSTD_isError(ret)) {
+            context->decompression_fail = true;
+            return Status::InvalidArgument(
+                    strings::Substitute("ZSTD decompress failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
+        }
+        output->size = ret;
+        return Status::OK();
+    }
+
+    size_t max_compressed_len(size_t len) const override { return ZSTD_compressBound(len); }
+
+private:
+    Status _compress(const Slice& input, Slice* output, bool use_compression_buffer, size_t uncompressed_size,
+                     faststring* compressed_body1, raw::RawString* compressed_body2) const {
+        DCHECK(_cdict != nullptr);
+        StatusOr<compression::ZSTD_CCtx_Pool::Ref> ref = compression::getZSTD_CCtx();
+        Status status = ref.status();
+        if (!status.ok()) {
+            return status;
+        }
+        compression::ZSTDCompressionContext* context = ref.value().get();
+        ZSTD_CCtx* ctx = context->ctx;
+
+        [[maybe_unused]] faststring* compression_buffer = nullptr;
+        [[maybe_unused]] size_t max_len = 0;
+        if (use_compression_buffer) {
+            max_len = max_compressed_len(uncompressed_size);
+            if (max_len <= COMPRESSION_BUFFER_THRESHOLD) {
+                DCHECK_GE(uncompressed_size, 0);
+                compression_buffer = &context->compression_buffer;
+                compression_buffer->resize(max_len);
+                output->data = reinterpret_cast<char*>(compression_buffer->data());
+                output->size = max_len;
+            } else {
+                DCHECK_GE(uncompressed_size, 0);
+                if (compressed_body1) {
+                    compressed_body1->resize(max_len);
+                    output->data = reinterpret_cast<char*>(compressed_body1->data());
+                } else {
+                    DCHECK(compressed_body2);
+                    compressed_body2->resize(max_len);
+                    output->data = reinterpret_cast<char*>(compressed_body2->data());
+                }
+                output->size = max_len;
+            }
+        }
+
+        size_t ret = ZSTD_compress_usingCDict(ctx, output->data, output->size, input.data, input.size, _cdict);
+        if (ZSTD_isError(ret)) {
+            context->compression_fail = true;
+            return Status::InvalidArgument(
+                    strings::Substitute("ZSTD compress failed: $0", ZSTD_getErrorString(ZSTD_getErrorCode(ret))));
+        }
+        output->size = ret;
+
+        if (use_compression_buffer) {
+            if (max_len <= COMPRESSION_BUFFER_THRESHOLD) {
+                compression_buffer->resize(output->size);
+                if (compressed_body1) {
+                    compressed_body1->assign_copy(compression_buffer->data(), compression_buffer->size());
+                } else {
+                    DCHECK(compressed_body2);
+                    compressed_body2->clear();
+                    compressed_body2->resize(compression_buffer->size());
+                    strings::memcpy_inlined(compressed_body2->data(), compression_buffer->data(),
+                                            compression_buffer->size());
+                }
+                compression_buffer->resize(0);
+            } else {
+                if (compressed_body1) {
+                    compressed_body1->resize(output->size);
+                } else {
+                    DCHECK(compressed_body2);
+                    compressed_body2->resize(output->size);
+                }
+            }
+        }
+
+        return Status::OK();
+    }
+
+    ZSTD_CDict* _cdict = nullptr;
+    ZSTD_DDict* _ddict = nullptr;
+};
+
 class GzipBlockCompression : public ZlibBlockCompression {
 public:
     GzipBlockCompression() : ZlibBlockCompression(CompressionTypePB::GZIP) {}
@@ -1121,4 +1251,30 @@ bool use_compression_pool(CompressionTypePB type) {
     return false;
 }
 
+StatusOr<std::string> zstd_train_dictionary(const std::string& sample_buffer, const std::vector<size_t>& sample_sizes,
+                                            size_t max_dict_size) {
+    std::string dict;
+    dict.resize(max_dict_size);
+    size_t ret = ZDICT_trainFromBuffer(dict.data(), dict.size(), sample_buffer.data(), sample_sizes.data(),
+                                       static_cast<unsigned>(sample_sizes.size()));
+    if (ZDICT_isError(ret)) {
+        return Status::InvalidArgument(
+                strings::Substitute("Fail to train ZSTD dictionary: $0", ZDICT_getErrorName(ret)));
+    }
+    dict.resize(ret);
+    return dict;
+}
+
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_compressor(const Slice& dict, int level) {
+    auto codec = std::make_unique<ZstdDictBlockCompression>();
+    RETURN_IF_ERROR(codec->init_compressor(dict, level));
+    return codec;
+}
+
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_decompressor(const Slice& dict) {
+    auto codec = std::make_unique<ZstdDictBlockCompression>();
+    RETURN_IF_ERROR(codec->init_decompressor(dict));
+    return codec;
+}
+
 } // namespace starrocks
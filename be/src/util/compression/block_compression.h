@@ -35,9 +35,12 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
+#include <string>
 #include <vector>
 
 #include "common/status.h"
+#include "common/statusor.h"
 #include "gen_cpp/segment.pb.h"
 #include "util/raw_container.h"
 #include "util/slice.h"
@@ -110,4 +113,19 @@ Status get_block_compression_codec(CompressionTypePB type, const BlockCompressio
 
 bool use_compression_pool(CompressionTypePB type);
 
+// Train a zstd dictionary from the concatenated samples in `sample_buffer', whose
+// individual lengths are given by `sample_sizes'. The trained dictionary is at most
+// `max_dict_size' bytes. Training fails (e.g. when there are too few samples or the
+// samples carry no shared structure), in which case callers should fall back to
+// dictionary-less compression.
+StatusOr<std::string> zstd_train_dictionary(const std::string& sample_buffer, const std::vector<size_t>& sample_sizes,
+                                            size_t max_dict_size);
+
+// Create a zstd codec bound to a digested dictionary, for compression at the given level
+// or for decompression. Unlike the singleton codecs returned by get_block_compression_codec,
+// the returned codec carries per-column state and is owned by the caller. A decompressor
+// created this way also decodes frames that were written without the dictionary.
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_compressor(const Slice& dict, int level);
+StatusOr<std::unique_ptr<BlockCompressionCodec>> new_zstd_dict_decompressor(const Slice& dict);
+
 } // namespace starrocks
@@ -80,6 +80,26 @@ public:
     /// remain stable.
     static int get_current_core();
 
+    /// Returns the maximum number of NUMA nodes that will be online in the system,
+    /// including any that may be offline or disabled.
+    static int get_max_num_numa_nodes() { return max_num_numa_nodes_; }
+
+    /// Returns the NUMA node of the given core. 'core' must be in the range
+    /// [0, GetMaxNumCores()).
+    static int get_numa_node_of_core(int core) {
+        DCHECK_LE(0, core);
+        DCHECK_LT(core, max_num_cores_);
+        return core_to_numa_node_[core];
+    }
+
+    /// Returns the cores belonging to the NUMA node with the given index.
+    /// 'node' must be in the range [0, GetMaxNumNumaNodes()).
+    static const std::vector<int>& get_cores_of_numa_node(int node) {
+        DCHECK_LE(0, node);
+        DCHECK_LT(node, max_num_numa_nodes_);
+        return numa_node_to_cores_[node];
+    }
+
     static std::string debug_string();
 
 private:
@@ -26,6 +26,8 @@
 #include <arm_acle.h>
 #include <arm_neon.h>
 #endif
+#include <array>
+
 #include "util/coding.h"
 
 namespace starrocks::crc32c {
@@ -236,7 +238,92 @@ uint32_t ExtendImpl(uint32_t crc, const char* buf, size_t size) {
     return static_cast<uint32_t>(l ^ 0xffffffffu);
 }
 
+#if (defined(__SSE4_2__) && (defined(__LP64__) || defined(_WIN64))) || (defined(__ARM_NEON) && defined(__aarch64__))
+#define STARROCKS_CRC32C_HW64 1
+static inline uint64_t HW_CRC32_U64(uint64_t crc, uint64_t word) {
+#if defined(__SSE4_2__)
+    return _mm_crc32_u64(crc, word);
+#else
+    return __crc32cd(static_cast<uint32_t>(crc), word);
+#endif
+}
+#endif
+
+// Reflected CRC32C generator polynomial, used by the lane-combining arithmetic below.
+static constexpr uint32_t kCRC32CPoly = 0x82f63b78;
+
+// Product of two polynomials modulo the generator, operands and result in the reflected
+// bit order of the CRC register (x^0 is the top bit). Same construction as zlib's multmodp.
+static inline uint32_t multmodp(uint32_t a, uint32_t b) {
+    uint32_t m = 1u << 31;
+    uint32_t p = 0;
+    for (;;) {
+        if (a & m) {
+            p ^= b;
+            if ((a & (m - 1)) == 0) break;
+        }
+        m >>= 1;
+        b = (b & 1) ? (b >> 1) ^ kCRC32CPoly : (b >> 1);
+    }
+    return p;
+}
+
+// x^(8n) modulo the generator, i.e. the operator advancing a CRC register over n zero bytes.
+static uint32_t x8nmodp(size_t n) {
+    // x2n_table[k] = x^(2^k) mod P
+    static const auto x2n_table = []() {
+        std::array<uint32_t, 32> t{};
+        t[0] = 0x40000000u; // x^1
+        for (int k = 1; k < 32; k++) t[k] = multmodp(t[k - 1], t[k - 1]);
+        return t;
+    }();
+    uint32_t p = 1u << 31; // x^0
+    int k = 3;             // 8n == n << 3
+    while (n != 0) {
+        if (n & 1) p = multmodp(x2n_table[k & 31], p);
+        n >>= 1;
+        k++;
+    }
+    return p;
+}
+
+#ifdef STARROCKS_CRC32C_HW64
+// The hardware crc32 instruction has a multi-cycle latency but single-cycle throughput, so a
+// single dependency chain leaves the unit mostly idle. Split the buffer into three equal lanes
+// and run three independent chains, then fold the lane registers back together with the
+// polynomial arithmetic above; the combine is O(log n) per call, negligible for page-sized
+// buffers, which is why short inputs stay on the single-chain path.
+static constexpr size_t kInterleaveMinSize = 3 * 1024;
+
+static uint32_t Extend3Way(uint32_t crc, const char* buf, size_t size) {
+    const auto* p = reinterpret_cast<const uint8_t*>(buf);
+    const size_t n = size / 24 * 8; // bytes per lane, multiple of 8
+    const uint8_t* a = p;
+    const uint8_t* b = p + n;
+    const uint8_t* c = p + 2 * n;
+    uint64_t crc0 = crc ^ 0xffffffffu;
+    uint64_t crc1 = 0;
+    uint64_t crc2 = 0;
+    for (size_t i = 0; i < n; i += 8) {
+        crc0 = HW_CRC32_U64(crc0, decode_fixed64_le(a + i));
+        crc1 = HW_CRC32_U64(crc1, decode_fixed64_le(b + i));
+        crc2 = HW_CRC32_U64(crc2, decode_fixed64_le(c + i));
+    }
+    // lane 0 is followed by 2n bytes and lane 1 by n bytes, advance their registers over
+    // that distance and xor in the zero-initialized lane registers.
+    uint32_t combined = multmodp(x8nmodp(2 * n), static_cast<uint32_t>(crc0)) ^
+                        multmodp(x8nmodp(n), static_cast<uint32_t>(crc1)) ^ static_cast<uint32_t>(crc2);
+    // up to 23 trailing bytes are left over.
+    return ExtendImpl<Fast_CRC32>(combined ^ 0xffffffffu, buf + 3 * n, size - 3 * n);
+}
+#endif
+
 uint32_t Extend(uint32_t crc, const char* buf, size_t size) {
+#ifdef STARROCKS_CRC32C_HW64
+    if (size >= kInterleaveMinSize) {
+        return Extend3Way(crc, buf, size);
+    }
+#endif
     return ExtendImpl<Fast_CRC32>(crc, buf, size);
 }
 
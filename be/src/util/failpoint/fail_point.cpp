@@ -1,7 +1,9 @@
 
 #include "util/failpoint/fail_point.h"
 
+#include <chrono>
 #include <filesystem>
+#include <thread>
 
 #include "fmt/format.h"
 #include "simdjson.h"
@@ -60,6 +62,43 @@ void FailPoint::setMode(const PFailPointTriggerMode& p_trigger_mode) {
     }
 }
 
+int64_t FailPoint::delay_ms() const {
+    std::shared_lock l(_mu);
+    return _trigger_mode.delay_ms();
+}
+
+int64_t FailPoint::bytes_per_second() const {
+    std::shared_lock l(_mu);
+    return _trigger_mode.bytes_per_second();
+}
+
+void inject_latency(const char* name) {
+    auto fp = FailPointRegistry::GetInstance()->get(name);
+    if (fp == nullptr) {
+        return;
+    }
+    int64_t delay_ms = fp->delay_ms();
+    if (delay_ms > 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(delay_ms));
+    }
+}
+
+void inject_bandwidth_throttle(const char* name, int64_t bytes) {
+    auto fp = FailPointRegistry::GetInstance()->get(name);
+    if (fp == nullptr) {
+        return;
+    }
+    int64_t bytes_per_second = fp->bytes_per_second();
+    if (bytes_per_second <= 0 || bytes <= 0) {
+        return;
+    }
+    // sleep as long as transferring |bytes| at the configured bandwidth would take
+    int64_t delay_us = bytes * 1000 * 1000 / bytes_per_second;
+    if (delay_us > 0) {
+        std::this_thread::sleep_for(std::chrono::microseconds(delay_us));
+    }
+}
+
 PFailPointInfo FailPoint::to_pb() const {
     std::shared_lock l(_mu);
     PFailPointInfo result;
@@ -22,6 +22,10 @@ public:
 
     void setMode(const PFailPointTriggerMode& p_trigger_mode);
 
+    // performance injection parameters, see FAIL_POINT_TRIGGER_SLEEP/FAIL_POINT_TRIGGER_THROTTLE
+    int64_t delay_ms() const;
+    int64_t bytes_per_second() const;
+
     std::string name() const { return _name; }
 
     PFailPointInfo to_pb() const;
@@ -78,6 +82,12 @@ public:
     explicit FailPointRegisterer(FailPoint* fp);
 };
 
+// Sleep for the delay_ms configured on the failpoint, used to inject latency into a code path.
+void inject_latency(const char* name);
+// Sleep long enough to cap the code path at the bytes_per_second configured on the failpoint,
+// assuming it just transferred |bytes| bytes.
+void inject_bandwidth_throttle(const char* name, int64_t bytes);
+
 #ifdef FIU_ENABLE
 // Use this macro to define failpoint
 // NOTE: it can only be used in cpp files, the name of failpoint must be globally unique
@@ -89,6 +99,9 @@ public:
     starrocks::failpoint::FailPointRegisterer fpr##NAME(&sfp##NAME);
 #define FAIL_POINT_SCOPE(NAME) starrocks::failpoint::ScopedFailPointGuard sfpg##NAME(#NAME);
 #define FAIL_POINT_TRIGGER_EXECUTE(NAME, stmt) fiu_do_on(#NAME, stmt)
+#define FAIL_POINT_TRIGGER_SLEEP(NAME) fiu_do_on(#NAME, starrocks::failpoint::inject_latency(#NAME))
+#define FAIL_POINT_TRIGGER_THROTTLE(NAME, nbytes) \
+    fiu_do_on(#NAME, starrocks::failpoint::inject_bandwidth_throttle(#NAME, nbytes))
 #define FAIL_POINT_TRIGGER_RETURN(NAME, retVal) fiu_return_on(#NAME, retVal)
 #define FAIL_POINT_TRIGGER_RETURN_ERROR(NAME) \
     fiu_return_on(#NAME, Status::InternalError(fmt::format("inject error {} at {}:{}", #NAME, __FILE__, __LINE__)))
@@ -97,6 +110,8 @@ public:
 #define DEFINE_SCOPED_FAIL_POINT(NAME)
 #define FAIL_POINT_SCOPE(NAME)
 #define FAIL_POINT_TRIGGER_EXECUTE(NAME, stmt)
+#define FAIL_POINT_TRIGGER_SLEEP(NAME)
+#define FAIL_POINT_TRIGGER_THROTTLE(NAME, nbytes)
 #define FAIL_POINT_TRIGGER_RETURN(NAME, retVal)
 #define FAIL_POINT_TRIGGER_RETURN_ERROR(NAME)
 #endif
@@ -34,6 +34,8 @@
 
 #include "util/metrics.h"
 
+#include <algorithm>
+#include <cmath>
 #include <mutex>
 
 namespace starrocks {
@@ -95,6 +97,78 @@ const char* unit_name(MetricUnit unit) {
     }
 }
 
+void HistogramMetric::observe(int64_t value) {
+    _buckets[bucket_index(value)].fetch_add(1, std::memory_order_relaxed);
+    __sync_fetch_and_add(_sum.access(), value);
+}
+
+size_t HistogramMetric::bucket_index(int64_t value) {
+    if (value < kSubBucketCount) {
+        return value < 0 ? 0 : value;
+    }
+    int msb = 63 - __builtin_clzll(static_cast<uint64_t>(value));
+    int exp = msb - (kSubBucketBits - 1);
+    auto sub = static_cast<size_t>(static_cast<uint64_t>(value) >> exp) - kSubBucketCount / 2;
+    return kSubBucketCount + (exp - 1) * (kSubBucketCount / 2) + sub;
+}
+
+int64_t HistogramMetric::bucket_upper_bound(size_t index) {
+    if (index < kSubBucketCount) {
+        return index;
+    }
+    size_t exp = (index - kSubBucketCount) / (kSubBucketCount / 2) + 1;
+    size_t sub = (index - kSubBucketCount) % (kSubBucketCount / 2) + kSubBucketCount / 2;
+    return ((static_cast<int64_t>(sub) + 1) << exp) - 1;
+}
+
+int64_t HistogramMetric::count() const {
+    int64_t total = 0;
+    for (const auto& bucket : _buckets) {
+        total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+int64_t HistogramMetric::sum() const {
+    int64_t total = 0;
+    for (int i = 0; i < _sum.size(); ++i) {
+        total += *_sum.access_at_core(i);
+    }
+    return total;
+}
+
+int64_t HistogramMetric::quantile(double q) const {
+    int64_t total = count();
+    if (total == 0) {
+        return 0;
+    }
+    auto target = std::max<int64_t>(static_cast<int64_t>(std::ceil(q * total)), 1);
+    int64_t accumulated = 0;
+    for (size_t i = 0; i < _buckets.size(); ++i) {
+        accumulated += _buckets[i].load(std::memory_order_relaxed);
+        if (accumulated >= target) {
+            return bucket_upper_bound(i);
+        }
+    }
+    return bucket_upper_bound(_buckets.size() - 1);
+}
+
+std::string HistogramMetric::to_string() const {
+    std::stringstream ss;
+    ss << "count: " << count() << ", sum: " << sum() << ", p50: " << quantile(0.5) << ", p90: " << quantile(0.9)
+       << ", p99: " << quantile(0.99) << ", p999: " << quantile(0.999);
+    return ss.str();
+}
+
+void HistogramMetric::write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) {
+    metric_obj.AddMember("count", rj::Value(count()), allocator);
+    metric_obj.AddMember("sum", rj::Value(sum()), allocator);
+    metric_obj.AddMember("percentile_50", rj::Value(quantile(0.5)), allocator);
+    metric_obj.AddMember("percentile_90", rj::Value(quantile(0.9)), allocator);
+    metric_obj.AddMember("percentile_99", rj::Value(quantile(0.99)), allocator);
+    metric_obj.AddMember("percentile_999", rj::Value(quantile(0.999)), allocator);
+}
+
 void Metric::hide() {
     if (_registry == nullptr) {
         return;
@@ -38,6 +38,7 @@
 #include <rapidjson/document.h>
 #include <rapidjson/rapidjson.h>
 
+#include <array>
 #include <atomic>
 #include <functional>
 #include <iomanip>
@@ -221,6 +222,42 @@ public:
     virtual ~LockGauge() = default;
 };
 
+// HDR-style log-linear histogram for latency metrics. A value falls into one of the power-of-two
+// ranges, each split into kSubBucketCount linear sub buckets (~3% relative error), and observe()
+// costs one relaxed atomic add on the bucket plus a core-local add on the sum, so it is cheap
+// enough for hot loops. Readers aggregate the buckets on demand.
+class HistogramMetric : public Metric {
+public:
+    explicit HistogramMetric(MetricUnit unit) : Metric(MetricType::HISTOGRAM, unit) {}
+    ~HistogramMetric() override = default;
+
+    // Negative values are counted in the first bucket.
+    void observe(int64_t value);
+
+    int64_t count() const;
+    int64_t sum() const;
+    // |q| in [0, 1], returns the upper bound of the bucket holding the q-quantile.
+    int64_t quantile(double q) const;
+
+    std::string to_string() const override;
+    void write_value(rj::Value& metric_obj, rj::Document::AllocatorType& allocator) override;
+
+    // Each power-of-two range is split into 2^kSubBucketBits linear sub buckets.
+    constexpr static int kSubBucketBits = 5;
+    constexpr static int kSubBucketCount = 1 << kSubBucketBits;
+
+private:
+    static size_t bucket_index(int64_t value);
+    static int64_t bucket_upper_bound(size_t index);
+
+    // Values below kSubBucketCount get exact buckets, every following power-of-two range
+    // contributes kSubBucketCount / 2 buckets, up to the largest positive int64.
+    constexpr static size_t kNumBuckets = kSubBucketCount + (62 - kSubBucketBits + 1) * kSubBucketCount / 2;
+
+    std::array<std::atomic<int64_t>, kNumBuckets> _buckets{};
+    CoreLocalValue<int64_t> _sum;
+};
+
 // one key-value pair used to
 struct MetricLabel {
     std::string name;
@@ -429,3 +466,6 @@ using DoubleGauge = LockGauge<double>;
 
 #define METRIC_DEFINE_DOUBLE_GAUGE(metric_name, unit) \
     starrocks::DoubleGauge metric_name { unit }
+
+#define METRIC_DEFINE_HISTOGRAM(metric_name, unit) \
+    starrocks::HistogramMetric metric_name { unit }
@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "util/perf_event_group.h"
+
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace starrocks {
+
+#ifdef __linux__
+
+static int perf_event_open(struct perf_event_attr* attr, pid_t pid, int cpu, int group_fd, unsigned long flags) {
+    return static_cast<int>(syscall(SYS_perf_event_open, attr, pid, cpu, group_fd, flags));
+}
+
+PerfEventGroup::PerfEventGroup() {
+    static constexpr uint64_t kEventConfigs[kNumEvents] = {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                                                           PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+    for (int i = 0; i < kNumEvents; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = kEventConfigs[i];
+        attr.disabled = (i == 0) ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_ID;
+
+        int fd = perf_event_open(&attr, 0, -1, _group_fd, 0);
+        if (fd < 0) {
+            // no PMU access on this host: close what we opened and stay invalid
+            for (int j = 0; j < i; ++j) {
+                close(_fds[j]);
+                _fds[j] = -1;
+            }
+            _group_fd = -1;
+            return;
+        }
+        _fds[i] = fd;
+        if (i == 0) {
+            _group_fd = fd;
+        }
+        if (ioctl(fd, PERF_EVENT_IOC_ID, &_ids[i]) < 0) {
+            _ids[i] = 0;
+        }
+    }
+
+    ioctl(_group_fd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(_group_fd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+PerfEventGroup::~PerfEventGroup() {
+    for (int fd : _fds) {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+}
+
+PerfEventGroup::Values PerfEventGroup::read() const {
+    Values values;
+    if (!valid()) {
+        return values;
+    }
+
+    struct ReadFormat {
+        uint64_t nr;
+        struct {
+            uint64_t value;
+            uint64_t id;
+        } values[kNumEvents];
+    } buf;
+
+    ssize_t n = ::read(_group_fd, &buf, sizeof(buf));
+    if (n < static_cast<ssize_t>(sizeof(uint64_t))) {
+        return values;
+    }
+
+    for (uint64_t i = 0; i < buf.nr && i < kNumEvents; ++i) {
+        auto value = static_cast<int64_t>(buf.values[i].value);
+        if (buf.values[i].id == _ids[0]) {
+            values.cycles = value;
+        } else if (buf.values[i].id == _ids[1]) {
+            values.instructions = value;
+        } else if (buf.values[i].id == _ids[2]) {
+            values.cache_misses = value;
+        } else if (buf.values[i].id == _ids[3]) {
+            values.branch_misses = value;
+        }
+    }
+    return values;
+}
+
+#else
+
+PerfEventGroup::PerfEventGroup() = default;
+
+PerfEventGroup::~PerfEventGroup() = default;
+
+PerfEventGroup::Values PerfEventGroup::read() const {
+    return {};
+}
+
+#endif
+
+PerfEventGroup& PerfEventGroup::current() {
+    static thread_local PerfEventGroup group;
+    return group;
+}
+
+} // namespace starrocks
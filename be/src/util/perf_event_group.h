@@ -0,0 +1,65 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+
+namespace starrocks {
+
+// A per-thread perf_event counter group over cycles, instructions, LLC misses and branch
+// misses of the calling thread. The group is opened lazily on first use and stays open for
+// the lifetime of the thread, so reading a snapshot costs one read() syscall.
+//
+// Opening can fail (non-Linux build, perf_event_paranoid, seccomp, missing PMU in VMs); in
+// that case valid() returns false and read() returns zeroed values. Callers are expected to
+// check valid() once and skip collection.
+class PerfEventGroup {
+public:
+    struct Values {
+        int64_t cycles = 0;
+        int64_t instructions = 0;
+        int64_t cache_misses = 0;
+        int64_t branch_misses = 0;
+
+        Values operator-(const Values& rhs) const {
+            return {cycles - rhs.cycles, instructions - rhs.instructions, cache_misses - rhs.cache_misses,
+                    branch_misses - rhs.branch_misses};
+        }
+    };
+
+    // The calling thread's event group.
+    static PerfEventGroup& current();
+
+    ~PerfEventGroup();
+
+    PerfEventGroup(const PerfEventGroup&) = delete;
+    void operator=(const PerfEventGroup&) = delete;
+
+    bool valid() const { return _group_fd >= 0; }
+
+    // Snapshot of the four counters since the group was opened.
+    Values read() const;
+
+private:
+    PerfEventGroup();
+
+    static constexpr int kNumEvents = 4;
+
+    int _group_fd = -1;
+    int _fds[kNumEvents] = {-1, -1, -1, -1};
+    uint64_t _ids[kNumEvents] = {0, 0, 0, 0};
+};
+
+} // namespace starrocks
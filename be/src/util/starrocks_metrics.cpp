@@ -49,6 +49,7 @@ StarRocksMetrics::StarRocksMetrics() : _metrics(_s_registry_name) {
     // You can put StarRocksMetrics's metrics initial code here
     REGISTER_STARROCKS_METRIC(fragment_requests_total);
     REGISTER_STARROCKS_METRIC(fragment_request_duration_us);
+    REGISTER_STARROCKS_METRIC(fragment_request_latency_us);
     REGISTER_STARROCKS_METRIC(http_requests_total);
     REGISTER_STARROCKS_METRIC(http_request_send_bytes);
     REGISTER_STARROCKS_METRIC(query_scan_bytes);
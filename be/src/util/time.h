@@ -82,6 +82,14 @@ inline double GetMonoTimeSecondsAsDouble() {
     return GetMonoTimeMicros() / static_cast<double>(MICROS_PER_SEC);
 }
 
+// Returns the CPU time consumed by the calling thread, measured in nanoseconds. Unlike the
+// monotonic clock, it does not advance while the thread is descheduled or blocked in a syscall.
+inline int64_t GetCurrentThreadCpuTimeNanos() {
+    timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec * NANOS_PER_SEC + ts.tv_nsec;
+}
+
 // Returns the time since the Epoch measured in nanoseconds.
 inline int64_t GetCurrentTimeNanos() {
     timespec ts;
@@ -0,0 +1,56 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "block_cache/cache_admission_policy.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+namespace starrocks {
+
+TEST(CacheAdmissionPolicyTest, admit_on_repeated_access) {
+    CacheAdmissionPolicy policy(4096);
+
+    // a block seen only once is not admitted
+    policy.record_access("block/0");
+    ASSERT_FALSE(policy.should_admit("block/0"));
+
+    // a second access within the window makes it cacheable
+    policy.record_access("block/0");
+    ASSERT_TRUE(policy.should_admit("block/0"));
+
+    // an unseen block is never admitted
+    ASSERT_FALSE(policy.should_admit("block/1"));
+}
+
+TEST(CacheAdmissionPolicyTest, aging_forgets_stale_keys) {
+    const size_t sketch_bytes = 4096;
+    CacheAdmissionPolicy policy(sketch_bytes);
+
+    policy.record_access("hot/0");
+    policy.record_access("hot/0");
+    ASSERT_TRUE(policy.should_admit("hot/0"));
+
+    // push two full sample periods of unrelated accesses through the sketch,
+    // halving the counters twice, so the stale key has to prove itself again.
+    // cycle over a few keys only to keep collisions with "hot/0" unlikely.
+    const size_t accesses = sketch_bytes / 4 * 2;
+    for (size_t i = 0; i < accesses; i++) {
+        policy.record_access("scan/" + std::to_string(i % 16));
+    }
+    ASSERT_FALSE(policy.should_admit("hot/0"));
+}
+
+} // namespace starrocks
@@ -215,6 +215,28 @@ PARALLEL_TEST(NullableColumnTest, test_clone_shared) {
     ASSERT_EQ(3, c2->get(3).get_int32());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(NullableColumnTest, test_clone_stats) {
+    auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    for (int32_t i = 0; i < 100; i++) {
+        c0->append_datum(i);
+    }
+
+    // a clone of a nested column is accounted once, with the memory usage of the whole tree
+    int64_t bytes = ColumnCloneStats::current_thread_bytes();
+    auto c1 = c0->clone_shared();
+    ASSERT_EQ(c0->memory_usage(), ColumnCloneStats::current_thread_bytes() - bytes);
+
+    bytes = ColumnCloneStats::current_thread_bytes();
+    auto c2 = c0->clone();
+    ASSERT_EQ(c0->memory_usage(), ColumnCloneStats::current_thread_bytes() - bytes);
+
+    // clone_empty copies no data and is not accounted
+    bytes = ColumnCloneStats::current_thread_bytes();
+    auto c3 = c0->clone_empty();
+    ASSERT_EQ(bytes, ColumnCloneStats::current_thread_bytes());
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(NullableColumnTest, test_clone_empty) {
     auto c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
@@ -62,6 +62,36 @@ TEST_F(AnalytorTest, reset_state_for_next_partition) {
     ASSERT_EQ(analytor._current_row_position, 20);
 }
 
+// NOLINTNEXTLINE
+TEST_F(AnalytorTest, fold_frame_blocks) {
+    TPlanNode plan_node;
+    RowDescriptor row_desc;
+    Analytor analytor(plan_node, row_desc, nullptr, false);
+
+    analytor._use_frame_block_process = true;
+    analytor._input_rows += 300;
+    analytor._partition.is_real = true;
+    analytor._partition.end = 300;
+
+    // 300 buffered rows hold two complete blocks, the tail stays unfolded.
+    analytor._fold_frame_blocks();
+    ASSERT_EQ(analytor._frame_block_base_position, 0);
+    ASSERT_EQ(analytor._frame_block_next_position, 2 * Analytor::FRAME_BLOCK_SIZE);
+
+    // Once the buffer prefix is removed beyond the folded point, blocks restart from the
+    // first still-buffered row.
+    analytor._removed_from_buffer_rows = 2 * Analytor::FRAME_BLOCK_SIZE + 10;
+    analytor._partition.remove_first_n(analytor._removed_from_buffer_rows);
+    analytor._fold_frame_blocks();
+    ASSERT_EQ(analytor._frame_block_base_position, 2 * Analytor::FRAME_BLOCK_SIZE + 10);
+    ASSERT_EQ(analytor._frame_block_next_position, 2 * Analytor::FRAME_BLOCK_SIZE + 10);
+
+    // A new partition restarts the blocks from its first row.
+    analytor._reset_state_for_next_partition();
+    ASSERT_EQ(analytor._frame_block_base_position, 300);
+    ASSERT_EQ(analytor._frame_block_next_position, 300);
+}
+
 // NOLINTNEXTLINE
 TEST_F(AnalytorTest, find_partition_end) {
     TPlanNode plan_node;
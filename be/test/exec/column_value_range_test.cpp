@@ -173,4 +173,77 @@ TEST(NormalizeRangeTest, ExtendScanKeyTest) {
     }
 }
 
+TEST(NormalizeRangeTest, ExtendScanKeyWithRunsTest) {
+    const constexpr LogicalType Type = TYPE_BIGINT;
+    using CppType = RunTimeCppType<Type>;
+    {
+        // 30 consecutive values over a cap of 8 compress into one closed range
+        ColumnValueRange<CppType> range("test", Type, std::numeric_limits<CppType>::lowest(),
+                                        std::numeric_limits<CppType>::max());
+        std::set<CppType> values;
+        for (CppType i = 1; i <= 30; ++i) {
+            values.insert(i);
+        }
+        ASSERT_OK(range.add_fixed_values(SQLFilterOp::FILTER_IN, values));
+
+        OlapScanKeys scan_keys;
+        ASSERT_OK(scan_keys.extend_scan_key(range, 8));
+        ASSERT_EQ(1, scan_keys.size());
+        ASSERT_TRUE(scan_keys.has_range_value());
+        ASSERT_TRUE(scan_keys.begin_include());
+        ASSERT_TRUE(scan_keys.end_include());
+    }
+    {
+        // two runs separated by a gap produce two closed ranges
+        ColumnValueRange<CppType> range("test", Type, std::numeric_limits<CppType>::lowest(),
+                                        std::numeric_limits<CppType>::max());
+        std::set<CppType> values;
+        for (CppType i = 1; i <= 10; ++i) {
+            values.insert(i);
+            values.insert(i + 100);
+        }
+        ASSERT_OK(range.add_fixed_values(SQLFilterOp::FILTER_IN, values));
+
+        OlapScanKeys scan_keys;
+        ASSERT_OK(scan_keys.extend_scan_key(range, 8));
+        ASSERT_EQ(2, scan_keys.size());
+        ASSERT_TRUE(scan_keys.has_range_value());
+    }
+    {
+        // scattered values stay above the cap and degrade to one [min, max] range as before
+        ColumnValueRange<CppType> range("test", Type, std::numeric_limits<CppType>::lowest(),
+                                        std::numeric_limits<CppType>::max());
+        std::set<CppType> values;
+        for (CppType i = 0; i < 10; ++i) {
+            values.insert(i * 10);
+        }
+        ASSERT_OK(range.add_fixed_values(SQLFilterOp::FILTER_IN, values));
+
+        OlapScanKeys scan_keys;
+        ASSERT_OK(scan_keys.extend_scan_key(range, 4));
+        ASSERT_EQ(1, scan_keys.size());
+        ASSERT_TRUE(scan_keys.has_range_value());
+    }
+    {
+        // runs of a second key column multiply with the existing point keys
+        ColumnValueRange<CppType> first("c0", Type, std::numeric_limits<CppType>::lowest(),
+                                        std::numeric_limits<CppType>::max());
+        ASSERT_OK(first.add_fixed_values(SQLFilterOp::FILTER_IN, {1, 2}));
+        ColumnValueRange<CppType> second("c1", Type, std::numeric_limits<CppType>::lowest(),
+                                         std::numeric_limits<CppType>::max());
+        std::set<CppType> values;
+        for (CppType i = 5; i < 15; ++i) {
+            values.insert(i);
+        }
+        ASSERT_OK(second.add_fixed_values(SQLFilterOp::FILTER_IN, values));
+
+        OlapScanKeys scan_keys;
+        ASSERT_OK(scan_keys.extend_scan_key(first, 10));
+        ASSERT_EQ(2, scan_keys.size());
+        ASSERT_OK(scan_keys.extend_scan_key(second, 10));
+        ASSERT_EQ(2, scan_keys.size());
+        ASSERT_TRUE(scan_keys.has_range_value());
+    }
+}
+
 } // namespace starrocks
@@ -228,6 +228,31 @@ TEST_F(HdfsScannerTest, TestHdfsRunningTime) {
     ASSERT_TRUE(scanner->cpu_time_spent() > 0);
 }
 
+TEST_F(HdfsScannerTest, TestLazyMaterializationSlotClassification) {
+    HdfsScannerParams params;
+    // no conjuncts at all: every slot is active.
+    EXPECT_FALSE(params.is_lazy_materialization_slot(0));
+
+    // c0 > 1 and (c1 + c2 > 3)
+    std::vector<ExprContext*> ctxs;
+    params.conjunct_ctxs_by_slot[0] = ctxs;
+    params.conjunct_ctxs.emplace_back(nullptr);
+    params.slots_in_conjunct = {0, 1, 2};
+    params.slots_of_mutli_slot_conjunct = {1, 2};
+
+    // slot with pushed-down per-slot conjuncts must be active.
+    EXPECT_FALSE(params.is_lazy_materialization_slot(0));
+    // slots referenced only by multi-slot conjuncts are lazy, because those
+    // conjuncts are evaluated after lazy columns have been loaded.
+    EXPECT_TRUE(params.is_lazy_materialization_slot(1));
+    EXPECT_TRUE(params.is_lazy_materialization_slot(2));
+    // slot in some conjunct not pushed down to the scanner stays active.
+    params.slots_in_conjunct.insert(3);
+    EXPECT_FALSE(params.is_lazy_materialization_slot(3));
+    // slot untouched by any conjunct is lazy.
+    EXPECT_TRUE(params.is_lazy_materialization_slot(4));
+}
+
 TEST_F(HdfsScannerTest, TestParquetGetNext) {
     auto scanner = std::make_shared<HdfsParquetScanner>();
 
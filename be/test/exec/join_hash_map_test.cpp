@@ -16,6 +16,8 @@
 
 #include <gtest/gtest.h>
 
+#include <set>
+
 #include "runtime/descriptor_helper.h"
 #include "runtime/exec_env.h"
 #include "runtime/mem_tracker.h"
@@ -1126,6 +1128,43 @@ TEST_F(JoinHashMapTest, JoinBuildProbeFuncNullable) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST_F(JoinHashMapTest, JoinBuildFuncDedupForLeftSemiJoin) {
+    JoinHashTableItems table_items;
+    HashTableProbeState probe_state;
+
+    auto type = TypeDescriptor::from_logical_type(LogicalType::TYPE_INT);
+    auto build_column = ColumnHelper::create_column(type, false);
+    build_column->append_default();
+    // every key appears twice in the build side
+    build_column->append(*JoinHashMapTest::create_int32_column(10, 0), 0, 10);
+    build_column->append(*JoinHashMapTest::create_int32_column(10, 0), 0, 10);
+    table_items.key_columns.emplace_back(build_column);
+    table_items.row_count = 20;
+    table_items.join_type = TJoinOp::LEFT_SEMI_JOIN;
+
+    JoinBuildFunc<LogicalType::TYPE_INT>::prepare(nullptr, &table_items);
+    JoinBuildFunc<LogicalType::TYPE_INT>::construct_hash_table(_runtime_state.get(), &table_items, &probe_state);
+
+    // the table only answers existence questions for a left semi join, so the second
+    // occurrence of each key must have been dropped at insertion time
+    auto data = ColumnHelper::as_raw_column<Int32Column>(table_items.key_columns[0])->get_data();
+    size_t chained_rows = 0;
+    for (size_t bucket = 0; bucket < table_items.bucket_size; bucket++) {
+        std::set<int32_t> keys_in_chain;
+        size_t chain_length = 0;
+        size_t index = table_items.first[bucket];
+        while (index != 0) {
+            keys_in_chain.insert(data[index]);
+            chain_length++;
+            index = table_items.next[index];
+        }
+        ASSERT_EQ(keys_in_chain.size(), chain_length);
+        chained_rows += chain_length;
+    }
+    ASSERT_EQ(chained_rows, 10);
+}
+
 // NOLINTNEXTLINE
 TEST_F(JoinHashMapTest, DirectMappingJoinBuildProbeFunc) {
     TDescriptorTableBuilder row_desc_builder;
@@ -0,0 +1,111 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/pipeline/exec_state_reporter.h"
+
+#include <gtest/gtest.h>
+
+namespace starrocks::pipeline {
+
+namespace {
+
+TCounter make_counter(const std::string& name, int64_t value) {
+    TCounter counter;
+    counter.__set_name(name);
+    counter.__set_type(TUnit::UNIT);
+    counter.__set_value(value);
+    return counter;
+}
+
+TRuntimeProfileNode make_node(const std::string& name, int32_t num_children) {
+    TRuntimeProfileNode node;
+    node.name = name;
+    node.num_children = num_children;
+    node.indent = true;
+    return node;
+}
+
+} // namespace
+
+TEST(ExecStateReporterTest, test_prune_unchanged_profile_items) {
+    TRuntimeProfileTree last_report;
+    last_report.nodes.push_back(make_node("Fragment", 1));
+    last_report.nodes.push_back(make_node("OlapScan", 0));
+    last_report.nodes[0].counters.push_back(make_counter("RowsReturned", 100));
+    last_report.nodes[1].counters.push_back(make_counter("BytesRead", 1024));
+    last_report.nodes[1].counters.push_back(make_counter("IOTaskExecTime", 5));
+    last_report.nodes[1].info_strings["Table"] = "t0";
+    last_report.nodes[1].info_strings["Rollup"] = "t0";
+    last_report.nodes[1].info_strings_display_order = {"Table", "Rollup"};
+
+    TRuntimeProfileTree profile = last_report;
+    // only BytesRead and Rollup changed since the last report
+    profile.nodes[1].counters[0].value = 2048;
+    profile.nodes[1].info_strings["Rollup"] = "mv0";
+
+    ExecStateReporter::prune_unchanged_profile_items(last_report, &profile);
+
+    ASSERT_TRUE(profile.nodes[0].counters.empty());
+    ASSERT_EQ(1, profile.nodes[1].counters.size());
+    ASSERT_EQ("BytesRead", profile.nodes[1].counters[0].name);
+    ASSERT_EQ(2048, profile.nodes[1].counters[0].value);
+    ASSERT_EQ(1, profile.nodes[1].info_strings.size());
+    ASSERT_EQ("mv0", profile.nodes[1].info_strings["Rollup"]);
+    ASSERT_EQ(std::vector<std::string>{"Rollup"}, profile.nodes[1].info_strings_display_order);
+}
+
+TEST(ExecStateReporterTest, test_prune_keeps_new_items) {
+    TRuntimeProfileTree last_report;
+    last_report.nodes.push_back(make_node("Fragment", 0));
+    last_report.nodes[0].counters.push_back(make_counter("RowsReturned", 100));
+
+    TRuntimeProfileTree profile = last_report;
+    profile.nodes[0].counters.push_back(make_counter("PeakMemoryUsage", 4096));
+    profile.nodes[0].info_strings["MissingVersion"] = "1";
+    profile.nodes[0].info_strings_display_order = {"MissingVersion"};
+
+    ExecStateReporter::prune_unchanged_profile_items(last_report, &profile);
+
+    ASSERT_EQ(1, profile.nodes[0].counters.size());
+    ASSERT_EQ("PeakMemoryUsage", profile.nodes[0].counters[0].name);
+    ASSERT_EQ(1, profile.nodes[0].info_strings.size());
+    ASSERT_EQ(1, profile.nodes[0].info_strings_display_order.size());
+}
+
+TEST(ExecStateReporterTest, test_prune_skips_changed_structure) {
+    TRuntimeProfileTree last_report;
+    last_report.nodes.push_back(make_node("Fragment", 0));
+    last_report.nodes[0].counters.push_back(make_counter("RowsReturned", 100));
+
+    // a node appeared since the last report, positions no longer line up
+    TRuntimeProfileTree profile;
+    profile.nodes.push_back(make_node("Fragment", 1));
+    profile.nodes.push_back(make_node("OlapScan", 0));
+    profile.nodes[0].counters.push_back(make_counter("RowsReturned", 100));
+
+    ExecStateReporter::prune_unchanged_profile_items(last_report, &profile);
+
+    ASSERT_EQ(1, profile.nodes[0].counters.size());
+
+    // same node count but a renamed node, still left untouched
+    TRuntimeProfileTree renamed;
+    renamed.nodes.push_back(make_node("OtherFragment", 0));
+    renamed.nodes[0].counters.push_back(make_counter("RowsReturned", 100));
+
+    ExecStateReporter::prune_unchanged_profile_items(last_report, &renamed);
+
+    ASSERT_EQ(1, renamed.nodes[0].counters.size());
+}
+
+} // namespace starrocks::pipeline
@@ -20,8 +20,10 @@
 #include <thread>
 #include <utility>
 
+#include "block_cache/block_cache.h"
 #include "column/fixed_length_column.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/pipeline/group_execution/execution_group_builder.h"
 #include "exec/pipeline/group_execution/execution_group_fwd.h"
 #include "exec/pipeline/pipeline.h"
@@ -35,6 +37,7 @@
 #include "exec/query_cache/ticket_checker.h"
 #include "exec/query_cache/transform_operator.h"
 #include "gutil/strings/substitute.h"
+#include "util/defer_op.h"
 
 namespace starrocks {
 
@@ -557,6 +560,52 @@ void test_framework_force_populate_and_passthrough(query_cache::CacheManagerPtr
                                      post_passthrough_actions, std::move(validate_func));
 }
 
+#ifdef WITH_STARCACHE
+TEST_F(QueryCacheTest, testPersistentTier) {
+    auto* block_cache = BlockCache::instance();
+    if (!block_cache->is_initialized()) {
+        CacheOptions options;
+        options.mem_space_size = 20 * 1024 * 1024;
+        options.block_size = 1024 * 1024;
+        options.max_concurrent_inserts = 100000;
+        options.max_flying_memory_mb = 100;
+        options.engine = "starcache";
+        ASSERT_TRUE(block_cache->init(options).ok());
+    }
+    config::enable_query_cache_persistent_tier = true;
+    DeferOp defer([]() { config::enable_query_cache_persistent_tier = false; });
+
+    auto cache_mgr = std::make_shared<query_cache::CacheManager>(10240);
+    auto chunk = std::make_shared<Chunk>();
+    auto col = Int64Column::create();
+    for (int64_t i = 0; i < 100; ++i) {
+        col->append(i);
+    }
+    chunk->append_column(col, 7);
+    query_cache::CacheValue value(1000, 42, {chunk});
+    cache_mgr->populate("persistent_key", value);
+
+    // rehydrating from the datacache must reproduce the entry bit for bit.
+    auto rehydrated = cache_mgr->_probe_persistent_entry("persistent_key");
+    ASSERT_TRUE(rehydrated.ok()) << rehydrated.status();
+    ASSERT_EQ(rehydrated->version, 42);
+    ASSERT_EQ(rehydrated->populate_time, 1000);
+    ASSERT_EQ(rehydrated->result.size(), 1);
+    auto& rehydrated_chunk = rehydrated->result[0];
+    ASSERT_EQ(rehydrated_chunk->num_rows(), 100);
+    ASSERT_TRUE(rehydrated_chunk->is_slot_exist(7));
+    auto& rehydrated_col = rehydrated_chunk->get_column_by_index(0);
+    for (int64_t i = 0; i < 100; ++i) {
+        ASSERT_EQ(rehydrated_col->get(i).get_int64(), i);
+    }
+
+    // a fresh cache manager has no prototype chunk, so rehydration reports a miss instead of
+    // handing out a wrongly typed chunk.
+    auto fresh_cache_mgr = std::make_shared<query_cache::CacheManager>(10240);
+    ASSERT_FALSE(fresh_cache_mgr->_probe_persistent_entry("persistent_key").ok());
+}
+#endif
+
 TEST_F(QueryCacheTest, testMultilane) {
     Actions actions = {
             Action::cache_miss_and_emit_first_chunk(1, 0, 10, 1, false, false),
@@ -23,6 +23,7 @@
 #include "column/chunk.h"
 #include "column/column_helper.h"
 #include "column/vectorized_fwd.h"
+#include "common/config.h"
 #include "exec/sorting/merge.h"
 #include "exec/sorting/merge_path.h"
 #include "exec/sorting/sort_helper.h"
@@ -219,6 +220,73 @@ INSTANTIATE_TEST_SUITE_P(
 
                         ));
 
+TEST(SortingTest, sortable_slice_compare) {
+    // SortableSlice must keep the exact ordering of Slice::compare, both on inline
+    // short strings and on strings spilling to the overflow pointer.
+    std::vector<std::string> values = {"",
+                                       "a",
+                                       std::string("a\0", 2),
+                                       "ab",
+                                       "abc",
+                                       "abcd",
+                                       "abce",
+                                       "abcdefgh",
+                                       "abcdefghijkl",
+                                       "abcdefghijkm",
+                                       "abcdefghijklm",
+                                       "abcdefghijklmnopqrstuvwxy",
+                                       "abcdefghijklmnopqrstuvwxyz",
+                                       "\xff\xff",
+                                       "zzzzzzzzzzzzzzzz"};
+    for (const auto& lhs : values) {
+        for (const auto& rhs : values) {
+            Slice slice_lhs(lhs), slice_rhs(rhs);
+            int expected = SorterComparator<Slice>::compare(slice_lhs, slice_rhs);
+            int actual = SorterComparator<SortableSlice>::compare(SortableSlice(slice_lhs), SortableSlice(slice_rhs));
+            ASSERT_EQ(expected, actual) << "lhs=" << lhs << " rhs=" << rhs;
+        }
+    }
+}
+
+TEST(SortingTest, normalized_key_prefix_radix_sort) {
+    // The radix path must produce the same tuple ordering as the comparison based kernels,
+    // including null placement and descending columns.
+    std::mt19937 rng(0x5a5a);
+    constexpr size_t num_rows = 4096;
+    NullableColumn::Ptr c0 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    Int16Column::Ptr c1 = Int16Column::create();
+    for (size_t i = 0; i < num_rows; i++) {
+        if (rng() % 10 == 0) {
+            c0->append_nulls(1);
+        } else {
+            c0->append_datum(Datum((int32_t)(rng() % 100) - 50)); // many ties on the first column
+        }
+        c1->append((int16_t)(rng() % 1000));
+    }
+    Columns columns{c0, c1};
+    // c0: asc nulls first, c1: desc nulls last
+    SortDescs sort_desc(std::vector<bool>{true, false}, std::vector<bool>{true, false});
+    std::atomic<bool> cancel{false};
+
+    config::enable_sort_key_prefix_radix_sort = true;
+    Permutation perm_radix;
+    ASSERT_OK(sort_and_tie_columns(cancel, columns, sort_desc, &perm_radix));
+
+    config::enable_sort_key_prefix_radix_sort = false;
+    Permutation perm_compare;
+    ASSERT_OK(sort_and_tie_columns(cancel, columns, sort_desc, &perm_compare));
+    config::enable_sort_key_prefix_radix_sort = true;
+
+    ASSERT_EQ(perm_compare.size(), perm_radix.size());
+    for (size_t i = 0; i < perm_compare.size(); i++) {
+        for (size_t c = 0; c < columns.size(); c++) {
+            ASSERT_EQ(0, columns[c]->compare_at(perm_radix[i].index_in_chunk, perm_compare[i].index_in_chunk,
+                                                *columns[c], sort_desc.get_column_desc((int)c).nan_direction()))
+                    << "row " << i << " column " << c;
+        }
+    }
+}
+
 TEST(SortingTest, materialize_by_permutation_binary) {
     BinaryColumn::Ptr input1 = BinaryColumn::create();
     BinaryColumn::Ptr input2 = BinaryColumn::create();
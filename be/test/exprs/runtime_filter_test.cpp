@@ -162,6 +162,105 @@ TEST_F(RuntimeFilterTest, TestJoinRuntimeFilter) {
     EXPECT_EQ(chunk.num_rows(), 12);
 }
 
+TEST_F(RuntimeFilterTest, TestExactValueRuntimeFilter) {
+    RuntimeBloomFilter<TYPE_INT> bf;
+    bf.init(100);
+    for (int i = 0; i <= 200; i += 17) {
+        bf.insert(i);
+    }
+    // small build NDV keeps the exact value set, so probing has no false positives at all.
+    EXPECT_TRUE(bf._use_exact_values);
+    for (int i = 0; i <= 200; i += 1) {
+        EXPECT_EQ(bf._test_data(i), i % 17 == 0);
+    }
+
+    // merging two build-side partials unions their exact sets.
+    RuntimeBloomFilter<TYPE_INT> bf2;
+    bf2.init(100);
+    bf2.insert(1);
+    bf.merge(&bf2);
+    EXPECT_TRUE(bf._use_exact_values);
+    EXPECT_TRUE(bf._test_data(1));
+    EXPECT_FALSE(bf._test_data(2));
+
+    // overflowing the exact set falls back to the bloom filter and keeps every inserted value.
+    const int num_values = 2 * RuntimeBloomFilter<TYPE_INT>::kMaxExactValueNum;
+    RuntimeBloomFilter<TYPE_INT> big;
+    big.init(num_values);
+    for (int i = 0; i < num_values; i++) {
+        big.insert(i);
+    }
+    EXPECT_FALSE(big._use_exact_values);
+    for (int i = 0; i < num_values; i++) {
+        EXPECT_TRUE(big._test_data(i));
+    }
+
+    // the exact set is not part of the wire format, so a deserialized filter probes the bloom filter.
+    JoinRuntimeFilter* rf = &bf;
+    size_t max_size = RuntimeFilterHelper::max_runtime_filter_serialized_size(rf);
+    std::vector<uint8_t> buffer(max_size, 0);
+    size_t actual_size = RuntimeFilterHelper::serialize_runtime_filter(RF_VERSION_V2, rf, buffer.data());
+    buffer.resize(actual_size);
+    JoinRuntimeFilter* deserialized = nullptr;
+    ObjectPool pool;
+    RuntimeFilterHelper::deserialize_runtime_filter(&pool, &deserialized, buffer.data(), actual_size);
+    EXPECT_FALSE(down_cast<RuntimeBloomFilter<TYPE_INT>*>(deserialized)->_use_exact_values);
+    EXPECT_TRUE(deserialized->check_equal(*rf));
+}
+
+TEST_F(RuntimeFilterTest, TestProbeDescriptorVersionedUpdate) {
+    RuntimeFilterProbeDescriptor desc;
+    ASSERT_TRUE(desc.init(1, nullptr).ok());
+
+    RuntimeBloomFilter<TYPE_INT> bf0;
+    bf0.init(100);
+    bf0.insert(10);
+    RuntimeBloomFilter<TYPE_INT> bf1;
+    bf1.init(100);
+    bf1.insert(10);
+
+    // the first filter always installs
+    desc.update_runtime_filter(&bf0);
+    EXPECT_EQ(&bf0, desc.runtime_filter(-1));
+
+    // a filter of the same version does not replace the installed one
+    desc.update_runtime_filter(&bf1);
+    EXPECT_EQ(&bf0, desc.runtime_filter(-1));
+
+    // a newer version replaces it
+    bf1.update_min_max<false>(5);
+    EXPECT_GT(bf1.rf_version(), bf0.rf_version());
+    desc.update_runtime_filter(&bf1);
+    EXPECT_EQ(&bf1, desc.runtime_filter(-1));
+
+    // an older version never downgrades the installed one
+    desc.update_runtime_filter(&bf0);
+    EXPECT_EQ(&bf1, desc.runtime_filter(-1));
+}
+
+TEST_F(RuntimeFilterTest, TestProbeDescriptorSharedVersionedUpdate) {
+    RuntimeFilterProbeDescriptor desc;
+    ASSERT_TRUE(desc.init(2, nullptr).ok());
+
+    auto bf0 = std::make_shared<RuntimeBloomFilter<TYPE_INT>>();
+    bf0->init(100);
+    bf0->insert(10);
+    auto bf1 = std::make_shared<RuntimeBloomFilter<TYPE_INT>>();
+    bf1->init(100);
+    bf1->insert(10);
+    bf1->update_min_max<false>(5);
+
+    desc.update_shared_runtime_filter(bf0);
+    EXPECT_EQ(bf0.get(), desc.runtime_filter(-1));
+
+    // the replaced filter stays alive for probers still holding its raw pointer
+    std::weak_ptr<const JoinRuntimeFilter> old_ref = bf0;
+    desc.update_shared_runtime_filter(bf1);
+    EXPECT_EQ(bf1.get(), desc.runtime_filter(-1));
+    bf0.reset();
+    EXPECT_FALSE(old_ref.expired());
+}
+
 TEST_F(RuntimeFilterTest, TestJoinRuntimeFilterSlice) {
     RuntimeBloomFilter<TYPE_VARCHAR> bf;
     // JoinRuntimeFilter* rf = &bf;
@@ -492,6 +492,45 @@ TEST_F(CSVFileWriterTest, TestWriteWithExecutors) {
     ASSERT_EQ(content, expect);
 }
 
+TEST_F(CSVFileWriterTest, TestWriteMultipleChunksWithExecutors) {
+    auto type_int = TypeDescriptor::from_logical_type(TYPE_INT);
+    std::vector<TypeDescriptor> type_descs{type_int};
+
+    auto column_names = _make_type_names(type_descs);
+    auto maybe_output_file = _fs.new_writable_file(_file_path);
+    EXPECT_OK(maybe_output_file.status());
+    auto output_file = std::move(maybe_output_file.value());
+    auto output_stream = std::make_unique<csv::OutputStreamFile>(std::move(output_file), 1024);
+    auto column_evaluators = ColumnSlotIdEvaluator::from_types(type_descs);
+    auto writer_options = std::make_shared<formats::CSVWriterOptions>();
+    auto executors = PriorityThreadPool("test", 1, 1);
+    auto writer = std::make_unique<formats::CSVFileWriter>(
+            _file_path, std::move(output_stream), column_names, type_descs, std::move(column_evaluators),
+            TCompressionType::NO_COMPRESSION, writer_options, []() {}, &executors, nullptr);
+    ASSERT_OK(writer->init());
+
+    // write chunks one by one, appends keep the chunk order
+    for (int i = 0; i < 3; i++) {
+        auto chunk = std::make_shared<Chunk>();
+        auto col = ColumnHelper::create_column(type_int, true);
+        std::vector<int32_t> int32_nums{i * 2, i * 2 + 1};
+        auto count = col->append_numbers(int32_nums.data(), size(int32_nums) * sizeof(int32_t));
+        ASSERT_EQ(2, count);
+        chunk->append_column(col, chunk->num_columns());
+        ASSERT_OK(writer->write(chunk).get());
+    }
+
+    auto result = writer->commit().get();
+    ASSERT_OK(result.io_status);
+    ASSERT_EQ(result.file_statistics.record_count, 6);
+
+    // verify correctness
+    std::string content;
+    ASSERT_OK(_fs.read_file(_file_path, &content));
+    std::string expect = "0\n1\n2\n3\n4\n5\n";
+    ASSERT_EQ(content, expect);
+}
+
 TEST_F(CSVFileWriterTest, TestFactory) {
     auto type_bool = TypeDescriptor::from_logical_type(TYPE_BOOLEAN);
     std::vector<TypeDescriptor> type_descs{type_bool};
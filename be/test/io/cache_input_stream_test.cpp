@@ -17,8 +17,10 @@
 #include <gtest/gtest.h>
 
 #include "block_cache/block_cache.h"
+#include "common/config.h"
 #include "fs/fs_util.h"
 #include "testutil/assert.h"
+#include "util/defer_op.h"
 
 namespace starrocks::io {
 
@@ -236,6 +238,11 @@ TEST_F(CacheInputStreamTest, test_read_from_io_buffer) {
     CacheOptions options = cache_options();
     ASSERT_OK(BlockCache::instance()->init(options));
 
+    // force even small reads through the block buffer
+    int64_t old_min_read_size = config::datacache_block_buffer_min_read_size;
+    config::datacache_block_buffer_min_read_size = 0;
+    DeferOp defer([&]() { config::datacache_block_buffer_min_read_size = old_min_read_size; });
+
     const int64_t block_count = 1;
 
     int64_t data_size = block_size * block_count;
@@ -269,6 +276,48 @@ TEST_F(CacheInputStreamTest, test_read_from_io_buffer) {
     ASSERT_EQ(stats.read_block_buffer_count, 1);
 }
 
+TEST_F(CacheInputStreamTest, test_small_read_skip_block_buffer) {
+    CacheOptions options = cache_options();
+    ASSERT_OK(BlockCache::instance()->init(options));
+
+    const int64_t block_count = 1;
+
+    int64_t data_size = block_size * block_count;
+    char data[data_size + 1];
+    gen_test_data(data, data_size, block_size);
+
+    const std::string file_name = "test_file7";
+    std::shared_ptr<io::SeekableInputStream> stream(new MockSeekableInputStream(data, data_size));
+    std::shared_ptr<io::SharedBufferedInputStream> sb_stream(
+            new io::SharedBufferedInputStream(stream, file_name, data_size));
+    io::CacheInputStream cache_stream(sb_stream, file_name, data_size, 1000);
+    cache_stream.set_enable_populate_cache(true);
+    cache_stream.set_enable_block_buffer(true);
+    auto& stats = cache_stream.stats();
+
+    // read from backend, cache the data
+    char buffer[block_size];
+    read_stream_data(&cache_stream, 0, block_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, block_size, 'a'));
+    ASSERT_EQ(stats.read_cache_count, 0);
+    ASSERT_EQ(stats.write_cache_count, 1);
+
+    // a read below the threshold only fetches the requested range from the cache,
+    // without materializing the whole block into the block buffer
+    const int64_t small_size = 1024;
+    ASSERT_LT(small_size, config::datacache_block_buffer_min_read_size);
+    read_stream_data(&cache_stream, 0, small_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, small_size, 'a'));
+    ASSERT_EQ(stats.read_cache_count, 1);
+    ASSERT_EQ(stats.read_cache_bytes, small_size);
+
+    // the block buffer stays empty, so a second small read hits the cache again
+    read_stream_data(&cache_stream, small_size, small_size, buffer);
+    ASSERT_TRUE(check_data_content(buffer, small_size, 'a'));
+    ASSERT_EQ(stats.read_block_buffer_count, 0);
+    ASSERT_EQ(stats.read_cache_count, 2);
+}
+
 TEST_F(CacheInputStreamTest, test_read_zero_copy) {
     CacheOptions options = cache_options();
     ASSERT_OK(BlockCache::instance()->init(options));
@@ -117,6 +117,31 @@ PARALLEL_TEST(FdInputStreamTest, test_read_at) {
     ASSERT_EQ(0, in.get_errno());
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(FdInputStreamTest, test_readv_at) {
+    int fd = open_temp_file();
+    pwrite_or_die(fd, "0123456789", 10, 0);
+
+    FdInputStream in(fd);
+    in.set_close_on_delete(true);
+
+    char buff1[3];
+    char buff2[4];
+    Slice iov[2] = {Slice(buff1, sizeof(buff1)), Slice(buff2, sizeof(buff2))};
+
+    ASSERT_EQ(7, *in.readv_at(1, iov, 2));
+    ASSERT_EQ("123", std::string_view(buff1, 3));
+    ASSERT_EQ("4567", std::string_view(buff2, 4));
+
+    // crossing the end of the file gives a short read
+    ASSERT_EQ(5, *in.readv_at(5, iov, 2));
+    ASSERT_EQ("567", std::string_view(buff1, 3));
+    ASSERT_EQ("89", std::string_view(buff2, 2));
+
+    ASSERT_EQ(0, *in.readv_at(12, iov, 2));
+    ASSERT_EQ(0, in.get_errno());
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(FdInputStreamTest, test_seek) {
     int fd = open_temp_file();
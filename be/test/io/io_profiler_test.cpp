@@ -16,7 +16,10 @@
 
 #include <gtest/gtest.h>
 
+#include "gen_cpp/Types_types.h"
+#include "runtime/current_thread.h"
 #include "testutil/assert.h"
+#include "util/uid_util.h"
 
 namespace starrocks {
 
@@ -131,4 +134,23 @@ TEST(IOProfilerTest, test_profile_and_get_topn_stats) {
     ASSERT_TRUE(IOProfiler::is_empty());
 }
 
+TEST(IOProfilerTest, test_query_stats) {
+    TUniqueId query_id;
+    query_id.__set_hi(0x10);
+    query_id.__set_lo(0x20);
+    CurrentThread::current().set_query_id(query_id);
+    auto scope = IOProfiler::scope(IOProfiler::TAG_QUERY, 3);
+    ASSERT_OK(IOProfiler::start(IOProfiler::IOMode::IOMODE_ALL));
+    IOProfiler::add_read(100, 1000);
+    IOProfiler::add_write(200, 2000);
+    IOProfiler::stop();
+    auto ret = IOProfiler::get_topn_query_stats(10);
+    ASSERT_OK(ret.status());
+    // header + the single query
+    ASSERT_EQ(2, ret.value().size());
+    ASSERT_NE(std::string::npos, ret.value()[1].find(UniqueId(query_id).to_string()));
+    IOProfiler::reset();
+    CurrentThread::current().set_query_id({});
+}
+
 } // namespace starrocks
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "runtime/auto_increment_id_allocator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+#include "testutil/assert.h"
+
+namespace starrocks {
+
+TEST(AutoIncrementIdAllocatorTest, test_allocate) {
+    std::atomic<int64_t> next_lease{1};
+    AutoIncrementIdAllocator allocator([&](int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+        size_t lease_rows = std::max<size_t>(rows, 1000);
+        *start = next_lease.fetch_add(lease_rows);
+        *allocated = lease_rows;
+        return Status::OK();
+    });
+
+    std::vector<int64_t> ids(10);
+    ASSERT_OK(allocator.allocate(1, ids.size(), ids));
+    ASSERT_EQ(1, ids.front());
+    ASSERT_EQ(10, ids.back());
+
+    // the second batch continues in the leased range without a new lease
+    ASSERT_OK(allocator.allocate(1, ids.size(), ids));
+    ASSERT_EQ(11, ids.front());
+    ASSERT_EQ(20, ids.back());
+
+    // another table gets its own range
+    ASSERT_OK(allocator.allocate(2, ids.size(), ids));
+    ASSERT_GT(ids.front(), 20);
+
+    // zero rows is a no-op
+    std::vector<int64_t> empty;
+    ASSERT_OK(allocator.allocate(1, 0, empty));
+
+    allocator.stop();
+}
+
+TEST(AutoIncrementIdAllocatorTest, test_concurrent_allocate_unique) {
+    std::atomic<int64_t> next_lease{1};
+    AutoIncrementIdAllocator allocator([&](int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+        // under-deliver on purpose, small leases force frequent range switches
+        size_t lease_rows = 64;
+        *start = next_lease.fetch_add(lease_rows);
+        *allocated = lease_rows;
+        return Status::OK();
+    });
+
+    constexpr int kThreads = 4;
+    constexpr int kBatches = 200;
+    constexpr size_t kBatchRows = 7;
+    std::vector<std::vector<int64_t>> results(kThreads);
+    std::vector<std::thread> threads;
+    threads.reserve(kThreads);
+    for (int i = 0; i < kThreads; i++) {
+        threads.emplace_back([&, i] {
+            std::vector<int64_t> ids(kBatchRows);
+            for (int j = 0; j < kBatches; j++) {
+                ASSERT_OK(allocator.allocate(1, ids.size(), ids));
+                results[i].insert(results[i].end(), ids.begin(), ids.end());
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    std::vector<int64_t> all;
+    for (const auto& r : results) {
+        all.insert(all.end(), r.begin(), r.end());
+    }
+    ASSERT_EQ(kThreads * kBatches * kBatchRows, all.size());
+    std::sort(all.begin(), all.end());
+    ASSERT_TRUE(std::adjacent_find(all.begin(), all.end()) == all.end());
+
+    allocator.stop();
+}
+
+TEST(AutoIncrementIdAllocatorTest, test_lease_failure) {
+    AutoIncrementIdAllocator allocator([](int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+        return Status::InternalError("injected lease failure");
+    });
+
+    std::vector<int64_t> ids(10);
+    ASSERT_ERROR(allocator.allocate(1, ids.size(), ids));
+
+    allocator.stop();
+}
+
+TEST(AutoIncrementIdAllocatorTest, test_remove_table) {
+    std::atomic<int64_t> next_lease{1};
+    std::atomic<int64_t> lease_count{0};
+    AutoIncrementIdAllocator allocator([&](int64_t table_id, size_t rows, int64_t* start, size_t* allocated) {
+        size_t lease_rows = std::max<size_t>(rows, 1000);
+        *start = next_lease.fetch_add(lease_rows);
+        *allocated = lease_rows;
+        lease_count++;
+        return Status::OK();
+    });
+
+    std::vector<int64_t> ids(10);
+    ASSERT_OK(allocator.allocate(1, ids.size(), ids));
+    int64_t leases_before = lease_count;
+
+    // dropping the table discards its leased ranges, a new allocation leases again
+    allocator.remove_table(1);
+    ASSERT_OK(allocator.allocate(1, ids.size(), ids));
+    ASSERT_GT(lease_count, leases_before);
+
+    allocator.stop();
+}
+
+} // namespace starrocks
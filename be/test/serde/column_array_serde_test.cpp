@@ -202,7 +202,7 @@ PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column) {
         }
     }
 
-    for (auto level = -1; level < 8; ++level) {
+    for (auto level = -1; level < 16; ++level) {
         buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
         ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
         ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level);
@@ -215,6 +215,30 @@ PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column) {
     }
 }
 
+// NOLINTNEXTLINE
+PARALLEL_TEST(ColumnArraySerdeTest, nullable_int32_column_without_null) {
+    std::vector<int32_t> numbers{1, 2, 3, 4, 5, 6, 7};
+    auto c1 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    auto c2 = NullableColumn::create(Int32Column::create(), NullColumn::create());
+    c1->append_numbers(numbers.data(), numbers.size() * sizeof(int32_t));
+
+    // with the null encode bit set, a column without nulls ships a flag instead of
+    // the all-zeros null bytemap.
+    const int level = 8;
+    std::vector<uint8_t> buffer;
+    buffer.resize(ColumnArraySerde::max_serialized_size(*c1, level));
+    uint8_t* serialize_end = ColumnArraySerde::serialize(*c1, buffer.data(), false, level);
+    ASSERT_EQ(sizeof(uint8_t) + ColumnArraySerde::max_serialized_size(*c1->data_column()),
+              serialize_end - buffer.data());
+    ASSERT_EQ(serialize_end, ColumnArraySerde::deserialize(buffer.data(), c2.get(), false, level));
+    ASSERT_FALSE(c2->has_null());
+    ASSERT_EQ(c1->size(), c2->size());
+    for (size_t i = 0; i < c1->size(); i++) {
+        ASSERT_FALSE(c2->is_null(i));
+        ASSERT_EQ(c1->get(i).get_int32(), c2->get(i).get_int32());
+    }
+}
+
 // NOLINTNEXTLINE
 PARALLEL_TEST(ColumnArraySerdeTest, binary_column) {
     std::vector<Slice> strings{{"bbb"}, {"bbc"}, {"ccc"}};
@@ -1584,6 +1584,41 @@ TEST_F(LakeServiceTest, test_get_tablet_stats) {
     ASSERT_EQ(0, response.tablet_stats_size());
 }
 
+TEST_F(LakeServiceTest, test_prefetch_tablet_meta) {
+    {
+        brpc::Controller cntl;
+        PrefetchTabletMetaRequest request;
+        PrefetchTabletMetaResponse response;
+        _lake_service.prefetch_tablet_meta(&cntl, &request, &response, nullptr);
+        ASSERT_TRUE(cntl.Failed());
+        ASSERT_EQ("missing tablet_infos", cntl.ErrorText());
+    }
+    {
+        brpc::Controller cntl;
+        PrefetchTabletMetaRequest request;
+        PrefetchTabletMetaResponse response;
+        auto* info = request.add_tablet_infos();
+        info->set_tablet_id(_tablet_id);
+        info->set_version(1);
+        _lake_service.prefetch_tablet_meta(&cntl, &request, &response, nullptr);
+        ASSERT_FALSE(cntl.Failed()) << cntl.ErrorText();
+        ASSERT_EQ(0, response.failed_tablets_size());
+    }
+    {
+        // prefetching a version that does not exist reports the tablet as failed
+        brpc::Controller cntl;
+        PrefetchTabletMetaRequest request;
+        PrefetchTabletMetaResponse response;
+        auto* info = request.add_tablet_infos();
+        info->set_tablet_id(_tablet_id);
+        info->set_version(100);
+        _lake_service.prefetch_tablet_meta(&cntl, &request, &response, nullptr);
+        ASSERT_FALSE(cntl.Failed()) << cntl.ErrorText();
+        ASSERT_EQ(1, response.failed_tablets_size());
+        ASSERT_EQ(_tablet_id, response.failed_tablets(0));
+    }
+}
+
 TEST_F(LakeServiceTest, test_drop_table_no_thread_pool) {
     ASSERT_OK(FileSystem::Default()->path_exists(kRootLocation));
 
@@ -134,4 +134,22 @@ TEST_F(SIMDTest, count_nonzero_int32) {
     EXPECT_EQ(30u, SIMD::count_nonzero(numbers));
 }
 
+TEST_F(SIMDTest, find_any_of) {
+    std::string data = "abcdefgh";
+    EXPECT_EQ(0u, SIMD::find_any_of(data.data(), data.size(), 'a', ',', '\n', '"'));
+    EXPECT_EQ(3u, SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', 'd'));
+    EXPECT_EQ(data.size(), SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+    EXPECT_EQ(0u, SIMD::find_any_of(data.data(), 0, 'a', 'a', 'a', 'a'));
+
+    // size greater than 16 will use SIMD instructions.
+    data.assign(100, 'x');
+    EXPECT_EQ(100u, SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+    data[63] = ',';
+    EXPECT_EQ(63u, SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+    data[20] = '\n';
+    EXPECT_EQ(20u, SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+    data[5] = '\\';
+    EXPECT_EQ(5u, SIMD::find_any_of(data.data(), data.size(), ',', '\n', '"', '\\'));
+}
+
 } // namespace starrocks
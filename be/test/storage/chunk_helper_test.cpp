@@ -141,6 +141,42 @@ TEST_F(ChunkHelperTest, ReorderChunk) {
     ASSERT_EQ(chunk->columns()[8]->get_name(), "binary");
 }
 
+TEST_F(ChunkHelperTest, Recycler) {
+    auto* tuple_desc = _create_tuple_desc();
+    const auto& slots = tuple_desc->slots();
+
+    ChunkRecycler recycler;
+
+    // nothing cached yet: a fresh chunk is allocated
+    auto chunk = recycler.acquire(slots, 1024);
+    ASSERT_EQ(9, chunk->num_columns());
+    ASSERT_EQ(0, recycler.cached_count());
+
+    // a recycled chunk is handed back for the same layout, emptied but with capacity retained
+    Chunk* raw = chunk.get();
+    chunk->get_column_by_slot_id(0)->append_default();
+    recycler.recycle(std::move(chunk));
+    ASSERT_EQ(1, recycler.cached_count());
+    auto reused = recycler.acquire(slots, 1024);
+    ASSERT_EQ(raw, reused.get());
+    ASSERT_EQ(0, reused->num_rows());
+    ASSERT_EQ(0, recycler.cached_count());
+
+    // a different layout does not match the cached chunk
+    recycler.recycle(std::move(reused));
+    auto reversed_slots = slots;
+    std::reverse(reversed_slots.begin(), reversed_slots.end());
+    auto other = recycler.acquire(reversed_slots, 1024);
+    ASSERT_NE(raw, other.get());
+    ASSERT_EQ(1, recycler.cached_count());
+
+    // the cache never keeps more than kMaxCachedPerLayout chunks per layout
+    for (size_t i = 0; i < ChunkRecycler::kMaxCachedPerLayout + 2; i++) {
+        recycler.recycle(ChunkHelper::new_chunk(slots, 16));
+    }
+    ASSERT_EQ(ChunkRecycler::kMaxCachedPerLayout, recycler.cached_count());
+}
+
 TEST_F(ChunkHelperTest, Accumulator) {
     constexpr size_t kDesiredSize = 4096;
     auto* tuple_desc = _create_simple_desc();
@@ -272,6 +308,24 @@ TEST_F(ChunkPipelineAccumulatorTest, test_push) {
     ASSERT_FALSE(accumulator.has_output());
 }
 
+TEST_F(ChunkPipelineAccumulatorTest, test_segments_not_mutated) {
+    ChunkPipelineAccumulator accumulator;
+    accumulator.set_max_size(4096);
+
+    auto chunk1 = _generate_chunk(2000, 1);
+    auto chunk2 = _generate_chunk(2000, 1);
+    accumulator.push(chunk1);
+    accumulator.push(chunk2);
+    ASSERT_TRUE(accumulator.has_output());
+    auto result_chunk = std::move(accumulator.pull());
+    ASSERT_EQ(result_chunk->num_rows(), 4000);
+    // the pushed chunks are only buffered and then concatenated into a fresh chunk,
+    // they must never be grown in place.
+    ASSERT_EQ(chunk1->num_rows(), 2000);
+    ASSERT_EQ(chunk2->num_rows(), 2000);
+    ASSERT_NE(result_chunk.get(), chunk1.get());
+}
+
 TEST_F(ChunkPipelineAccumulatorTest, test_owner_info) {
     constexpr size_t kDesiredSize = 4096;
 
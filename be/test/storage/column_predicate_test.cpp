@@ -1640,6 +1640,52 @@ TEST(ColumnPredicateTest, test_in) {
     }
 }
 
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_dictionary_code_in) {
+    std::unique_ptr<ColumnPredicate> p(new_dictionary_code_in_predicate(get_type_info(TYPE_INT), 0, {3, 4}, 6));
+    auto c = ChunkHelper::column_from_field_type(TYPE_INT, true);
+    c->append_datum(Datum(1));
+    c->append_datum(Datum(2));
+    c->append_datum(Datum(3));
+    (void)c->append_nulls(1);
+    c->append_datum(Datum(4));
+
+    ASSERT_EQ(PredicateType::kInList, p->type());
+    ASSERT_FALSE(p->can_vectorized());
+
+    // ---------------------------------------------
+    // evaluate()
+    // ---------------------------------------------
+    std::vector<uint8_t> buff(5);
+    p->evaluate(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("0,0,1,0,1", to_string(buff));
+
+    p->evaluate(c.get(), buff.data(), 1, 3);
+    ASSERT_EQ("0,0,1,0,1", to_string(buff));
+
+    // ---------------------------------------------
+    // evaluate_and()
+    // ---------------------------------------------
+    buff.assign(5, 1);
+    p->evaluate_and(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("0,0,1,0,1", to_string(buff));
+
+    buff.assign(5, 0);
+    p->evaluate_and(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("0,0,0,0,0", to_string(buff));
+
+    // ---------------------------------------------
+    // evaluate_or()
+    // ---------------------------------------------
+    buff.assign(5, 0);
+    p->evaluate_or(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("0,0,1,0,1", to_string(buff));
+
+    buff.assign(5, 1);
+    p->evaluate_or(c.get(), buff.data(), 0, 5);
+    ASSERT_EQ("1,1,1,1,1", to_string(buff));
+}
+
 // NOLINTNEXTLINE
 TEST(ColumnPredicateTest, test_no_in) {
     {
@@ -2220,4 +2266,43 @@ TEST(ColumnPredicateTest, test_convert_cmp_binary_predicate) {
         EXPECT_EQ(new_p->type(), p->type());
     }
 }
+
+// NOLINTNEXTLINE
+TEST(ColumnPredicateTest, test_dict_conjuct) {
+    // code mapping: 0 -> false, 1 -> true, 2 -> true
+    std::vector<uint8_t> code_mapping(3);
+    code_mapping[1] = 1;
+    code_mapping[2] = 1;
+    {
+        std::unique_ptr<ColumnPredicate> p(
+                new_column_dict_conjuct_predicate(get_type_info(TYPE_INT), 0, code_mapping));
+        auto c = ChunkHelper::column_from_field_type(TYPE_INT, false);
+        c->append_datum(Datum(0));
+        c->append_datum(Datum(2));
+        c->append_datum(Datum(1));
+        c->append_datum(Datum(0));
+
+        std::vector<uint8_t> buff(4);
+        p->evaluate(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("0,1,1,0", to_string(buff));
+    }
+    {
+        // with skip_null, null rows never index the mapping and evaluate to false
+        std::unique_ptr<ColumnPredicate> p(
+                new_column_dict_conjuct_predicate(get_type_info(TYPE_INT), 0, code_mapping, /*skip_null=*/true));
+        auto c = ChunkHelper::column_from_field_type(TYPE_INT, true);
+        c->append_datum(Datum(1));
+        (void)c->append_nulls(1);
+        c->append_datum(Datum(0));
+        c->append_datum(Datum(2));
+
+        std::vector<uint8_t> buff(4);
+        p->evaluate(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("1,0,0,1", to_string(buff));
+
+        buff.assign(4, 1);
+        p->evaluate_and(c.get(), buff.data(), 0, 4);
+        ASSERT_EQ("1,0,0,1", to_string(buff));
+    }
+}
 } // namespace starrocks
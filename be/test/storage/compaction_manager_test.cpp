@@ -251,6 +251,25 @@ TEST_F(CompactionManagerTest, test_next_compaction_task_id) {
     ASSERT_LT(0, start_task_id);
 }
 
+TEST_F(CompactionManagerTest, test_read_feedback_factor) {
+    const int64_t now_s = 1000000;
+    const int64_t recent_s = now_s - 60;
+    const int64_t stale_s = now_s - config::compaction_cold_tablet_threshold_seconds - 1;
+
+    // score above the bypass bound is never adjusted
+    ASSERT_EQ(1.0, CompactionManager::read_feedback_factor(config::compaction_read_feedback_bypass_score, 80,
+                                                           recent_s, now_s));
+    // never-read and stale tablets are damped
+    ASSERT_EQ(config::compaction_cold_tablet_score_factor, CompactionManager::read_feedback_factor(10, 0, 0, now_s));
+    ASSERT_EQ(config::compaction_cold_tablet_score_factor,
+              CompactionManager::read_feedback_factor(10, 5, stale_s, now_s));
+    // recently read tablets are boosted by their per-query segment count
+    ASSERT_DOUBLE_EQ(1.5, CompactionManager::read_feedback_factor(10, 5, recent_s, now_s));
+    // the boost is capped
+    ASSERT_DOUBLE_EQ(config::compaction_read_feedback_max_boost,
+                     CompactionManager::read_feedback_factor(10, 80, recent_s, now_s));
+}
+
 TEST_F(CompactionManagerTest, test_compaction_parallel) {
     std::vector<TabletSharedPtr> tablets;
     std::vector<std::shared_ptr<MockCompactionTask>> tasks;
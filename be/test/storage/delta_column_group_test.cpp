@@ -38,6 +38,39 @@ TEST(TestDeltaColumnGroup, testLoad) {
     }
 };
 
+TEST(TestDeltaColumnGroup, testSparseLoad) {
+    DeltaColumnGroup dcg;
+    dcg.init(100, {{1, 10}, {20}}, {"abc0.cols", "abc1.cols"}, {{3, 7, 1024}, {}});
+    ASSERT_TRUE(dcg.sparse(0));
+    ASSERT_FALSE(dcg.sparse(1));
+    std::string pb_str = dcg.save();
+    DeltaColumnGroup new_dcg;
+    ASSERT_TRUE(new_dcg.load(100, pb_str.data(), pb_str.length()).ok());
+    ASSERT_TRUE(dcg.column_files("111") == new_dcg.column_files("111"));
+    ASSERT_TRUE(new_dcg.sparse(0));
+    ASSERT_FALSE(new_dcg.sparse(1));
+    ASSERT_TRUE(dcg.column_rowids(0) == new_dcg.column_rowids(0));
+};
+
+TEST(TestDeltaColumnGroup, testSparseGC) {
+    // a sparse dcg doesn't cover its columns, so the full-length dcgs
+    // below it must survive garbage collection
+    std::vector<std::pair<TabletSegmentId, int64_t>> garbage_dcgs;
+    DeltaColumnGroupList dcgs;
+    for (uint32_t i = 1; i <= 10; i++) {
+        DeltaColumnGroup dcg;
+        dcg.init((int64_t)i, {{1, 2, 3}}, {"abc.cols"}, {{1, 2}});
+        dcgs.push_back(std::make_shared<DeltaColumnGroup>(dcg));
+    }
+    const std::string path = "/asd/";
+    std::vector<std::string> clear_files;
+    DeltaColumnGroupListHelper::garbage_collection(dcgs, TabletSegmentId(100, 100), 10, path, &garbage_dcgs,
+                                                   &clear_files);
+    ASSERT_TRUE(dcgs.size() == 10);
+    ASSERT_TRUE(garbage_dcgs.size() == 0);
+    ASSERT_TRUE(clear_files.size() == 0);
+};
+
 TEST(TestDeltaColumnGroup, testGet) {
     DeltaColumnGroup dcg;
     dcg.init(100, {{10, 1, 100}}, {"abc.cols"});
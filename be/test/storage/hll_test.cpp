@@ -193,6 +193,43 @@ TEST_F(TestHll, Normal) {
     }
 }
 
+TEST_F(TestHll, MergeMany) {
+    HyperLogLog full_1;
+    HyperLogLog full_2;
+    for (uint64_t i = 0; i < 1000; i++) {
+        full_1.update(hash(i));
+        full_2.update(hash(i + 500));
+    }
+    HyperLogLog explicit_1(hash(100000));
+    HyperLogLog explicit_2(hash(100001));
+    HyperLogLog empty_hll;
+
+    // register max-merge is deterministic, so one batched merge must estimate the same
+    // cardinality as the chain of pairwise merges
+    std::vector<const HyperLogLog*> inputs = {&full_1, &explicit_1, &empty_hll, &full_2, &explicit_2};
+    HyperLogLog pairwise;
+    for (const auto* input : inputs) {
+        pairwise.merge(*input);
+    }
+    HyperLogLog batched;
+    batched.merge_many(inputs);
+    ASSERT_GT(batched.estimate_cardinality(), 0);
+    ASSERT_EQ(pairwise.estimate_cardinality(), batched.estimate_cardinality());
+
+    // starting from an existing dense state
+    HyperLogLog merged_pairwise(full_1);
+    merged_pairwise.merge(explicit_1);
+    merged_pairwise.merge(full_2);
+    HyperLogLog merged_batched(full_1);
+    merged_batched.merge_many({&explicit_1, &full_2});
+    ASSERT_EQ(merged_pairwise.estimate_cardinality(), merged_batched.estimate_cardinality());
+
+    // a batch of small explicit inputs stays explicit
+    HyperLogLog explicit_merge;
+    explicit_merge.merge_many({&explicit_1, &explicit_2});
+    ASSERT_EQ(2, explicit_merge.estimate_cardinality());
+}
+
 TEST_F(TestHll, InvalidPtr) {
     {
         HyperLogLog hll(Slice((char*)nullptr, 0));
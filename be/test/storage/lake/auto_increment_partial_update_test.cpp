@@ -22,6 +22,7 @@
 #include "column/schema.h"
 #include "column/vectorized_fwd.h"
 #include "common/logging.h"
+#include "runtime/auto_increment_id_allocator.h"
 #include "storage/chunk_helper.h"
 #include "storage/lake/delta_writer.h"
 #include "storage/lake/meta_file.h"
@@ -214,10 +215,10 @@ TEST_F(LakeAutoIncrementPartialUpdateTest, test_write) {
     EXPECT_EQ(new_tablet_metadata->rowsets_size(), 3);
 
     SyncPoint::GetInstance()->EnableProcessing();
-    SyncPoint::GetInstance()->SetCallBack("StorageEngine::get_next_increment_id_interval.1", [](void* arg) {
-        auto& meta = *(std::shared_ptr<AutoIncrementMeta>*)(arg);
-        meta->min = 1;
-        meta->max = kChunkSize * 2;
+    SyncPoint::GetInstance()->SetCallBack("AutoIncrementIdAllocator::allocate.1", [](void* arg) {
+        auto* range = (AutoIncrementIdAllocator::TableIdRange*)(arg);
+        range->next = 1;
+        range->limit = kChunkSize * 2;
     });
 
     // partial update with normal column and auto increment column
@@ -284,10 +285,10 @@ TEST_F(LakeAutoIncrementPartialUpdateTest, test_resolve_conflict) {
     EXPECT_EQ(new_tablet_metadata->rowsets_size(), 3);
 
     SyncPoint::GetInstance()->EnableProcessing();
-    SyncPoint::GetInstance()->SetCallBack("StorageEngine::get_next_increment_id_interval.1", [](void* arg) {
-        auto& meta = *(std::shared_ptr<AutoIncrementMeta>*)(arg);
-        meta->min = 1;
-        meta->max = kChunkSize * 2;
+    SyncPoint::GetInstance()->SetCallBack("AutoIncrementIdAllocator::allocate.1", [](void* arg) {
+        auto* range = (AutoIncrementIdAllocator::TableIdRange*)(arg);
+        range->next = 1;
+        range->limit = kChunkSize * 2;
     });
 
     // concurrent partial update
@@ -128,6 +128,47 @@ TEST_F(MergeIteratorTest, heap_merge_no_overlapping) {
     ASSERT_TRUE(iter->get_next(chunk.get()).is_end_of_file());
 }
 
+// NOLINTNEXTLINE
+TEST_F(MergeIteratorTest, loser_tree_merge_many_inputs) {
+    bool saved = config::enable_loser_tree_merge;
+    for (bool use_loser_tree : {true, false}) {
+        config::enable_loser_tree_merge = use_loser_tree;
+
+        // many overlapping duplicate-heavy inputs to exercise the tournament tree.
+        std::vector<ChunkIteratorPtr> subs;
+        std::vector<int32_t> expected;
+        for (int32_t child = 0; child < 9; child++) {
+            std::vector<int32_t> v;
+            for (int32_t i = 0; i < 100; i++) {
+                v.push_back((i * 7 + child) % 50);
+            }
+            std::sort(v.begin(), v.end());
+            expected.insert(expected.end(), v.begin(), v.end());
+            subs.emplace_back(std::make_shared<VectorChunkIterator>(_schema, COL_INT(v)));
+        }
+        std::sort(expected.begin(), expected.end());
+
+        auto iter = new_heap_merge_iterator(subs);
+        ASSERT_TRUE(iter->init_encoded_schema(EMPTY_GLOBAL_DICTMAPS).ok());
+
+        std::vector<int32_t> real;
+        ChunkPtr chunk = ChunkHelper::new_chunk(iter->schema(), config::vector_chunk_size);
+        while (iter->get_next(chunk.get()).ok()) {
+            ColumnPtr& c = chunk->get_column_by_index(0);
+            for (size_t i = 0; i < c->size(); i++) {
+                real.push_back(c->get(i).get_int32());
+            }
+            chunk->reset();
+        }
+        ASSERT_EQ(expected.size(), real.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            EXPECT_EQ(expected[i], real[i]);
+        }
+        ASSERT_TRUE(iter->get_next(chunk.get()).is_end_of_file());
+    }
+    config::enable_loser_tree_merge = saved;
+}
+
 // NOLINTNEXTLINE
 TEST_F(MergeIteratorTest, merge_one) {
     auto sub1 = std::make_shared<VectorChunkIterator>(_schema, COL_INT({1, 1, 2, 3, 4, 5}));
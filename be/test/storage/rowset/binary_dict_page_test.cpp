@@ -279,6 +279,50 @@ TEST_F(BinaryDictPageTest, TestBySmallDataSize) {
     test_by_small_data_size(slices);
 }
 
+// NOLINTNEXTLINE
+TEST_F(BinaryDictPageTest, TestSeedDictWords) {
+    std::vector<std::string> seed_words = {"red", "green", "blue"};
+    PageBuilderOptions options;
+    options.data_page_size = 256 * 1024;
+    options.dict_page_size = 256 * 1024;
+    options.seed_dict_words = &seed_words;
+    BinaryDictPageBuilder page_builder(options);
+
+    std::vector<Slice> slices;
+    slices.emplace_back("blue");
+    slices.emplace_back("red");
+    slices.emplace_back("blue");
+    size_t count = page_builder.add(reinterpret_cast<const uint8_t*>(slices.data()), slices.size());
+    ASSERT_EQ(slices.size(), count);
+    auto s = page_builder.finish()->build();
+
+    // the dictionary page carries all the seed words, even "green" which never occurs
+    OwnedSlice dict_slice = page_builder.get_dictionary_page()->build();
+    auto dict_page_decoder = std::make_unique<BinaryPlainPageDecoder<TYPE_VARCHAR>>(dict_slice.slice());
+    ASSERT_TRUE(dict_page_decoder->init().ok());
+    ASSERT_EQ(seed_words.size(), dict_page_decoder->count());
+
+    Slice encoded_data = s.slice();
+    PageFooterPB footer;
+    footer.set_type(DATA_PAGE);
+    footer.mutable_data_page_footer()->set_nullmap_size(0);
+    std::unique_ptr<char[]> page = nullptr;
+    ASSERT_TRUE(StoragePageDecoder::decode_page(&footer, 0, starrocks::DICT_ENCODING, &page, &encoded_data).ok());
+
+    BinaryDictPageDecoder<TYPE_VARCHAR> page_decoder(encoded_data);
+    page_decoder.set_dict_decoder(dict_page_decoder.get());
+    ASSERT_TRUE(page_decoder.init().ok());
+    ASSERT_EQ(slices.size(), page_decoder.count());
+
+    auto column = ChunkHelper::column_from_field_type(TYPE_VARCHAR, false);
+    size_t size = slices.size();
+    ASSERT_TRUE(page_decoder.next_batch(&size, column.get()).ok());
+    ASSERT_EQ(slices.size(), size);
+    ASSERT_EQ("blue", column->get(0).get_slice().to_string());
+    ASSERT_EQ("red", column->get(1).get_slice().to_string());
+    ASSERT_EQ("blue", column->get(2).get_slice().to_string());
+}
+
 // NOLINTNEXTLINE
 TEST_F(BinaryDictPageTest, TestEncodingRatio) {
     std::vector<Slice> slices;
@@ -0,0 +1,114 @@
+// Copyright 2021-present StarRocks, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "storage/rowset/bloom_filter.h"
+#include "util/slice.h"
+
+namespace starrocks {
+
+class CuckooFilterTest : public testing::Test {
+public:
+    ~CuckooFilterTest() override = default;
+
+private:
+    uint64_t _expected_num = 1024;
+    double _fpp = 0.05;
+};
+
+TEST_F(CuckooFilterTest, Normal) {
+    // test write
+    std::unique_ptr<BloomFilter> bf;
+    auto st = BloomFilter::create(CUCKOO_FILTER, &bf);
+    ASSERT_TRUE(st.ok());
+    ASSERT_NE(nullptr, bf);
+    st = bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(bf->size() > 0);
+    int num = 1000;
+    uint32_t values[1000];
+    for (int i = 0; i < num; ++i) {
+        values[i] = random();
+    }
+    for (int i = 0; i < num; ++i) {
+        bf->add_bytes((char*)&values[i], sizeof(uint32_t));
+    }
+    // add nullptr
+    bf->add_bytes(nullptr, 1);
+    for (int i = 0; i < num; ++i) {
+        ASSERT_TRUE(bf->test_bytes((char*)&values[i], sizeof(uint32_t)));
+    }
+    // test nullptr
+    ASSERT_TRUE(bf->test_bytes(nullptr, 1));
+
+    // test read: reconstruct from the serialized bytes
+    std::unique_ptr<BloomFilter> bf2;
+    st = BloomFilter::create(CUCKOO_FILTER, &bf2);
+    ASSERT_TRUE(st.ok());
+    ASSERT_NE(nullptr, bf2);
+    st = bf2->init(bf->data(), bf->size(), HASH_MURMUR3_X64_64);
+    ASSERT_TRUE(st.ok());
+    ASSERT_TRUE(bf2->size() > 0);
+    for (int i = 0; i < num; ++i) {
+        ASSERT_TRUE(bf2->test_bytes((char*)&values[i], sizeof(uint32_t)));
+    }
+    // test nullptr
+    ASSERT_TRUE(bf2->test_bytes(nullptr, 1));
+}
+
+TEST_F(CuckooFilterTest, FalsePositiveRate) {
+    std::unique_ptr<BloomFilter> bf;
+    auto st = BloomFilter::create(CUCKOO_FILTER, &bf);
+    ASSERT_TRUE(st.ok());
+    st = bf->init(_expected_num, _fpp, HASH_MURMUR3_X64_64);
+    ASSERT_TRUE(st.ok());
+
+    for (uint64_t i = 0; i < _expected_num; ++i) {
+        bf->add_bytes((char*)&i, sizeof(uint64_t));
+    }
+    for (uint64_t i = 0; i < _expected_num; ++i) {
+        ASSERT_TRUE(bf->test_bytes((char*)&i, sizeof(uint64_t)));
+    }
+    int false_positives = 0;
+    int probes = 100000;
+    for (uint64_t i = _expected_num; i < _expected_num + probes; ++i) {
+        false_positives += bf->test_bytes((char*)&i, sizeof(uint64_t));
+    }
+    // the 8-bit fingerprint bounds the false positive rate around 3%;
+    // leave slack so the test is not sensitive to the hash function.
+    ASSERT_LT(false_positives, probes * 0.05);
+}
+
+// Inserting far more keys than the filter was sized for must keep queries
+// correct: the filter saturates instead of dropping keys.
+TEST_F(CuckooFilterTest, Overflow) {
+    std::unique_ptr<BloomFilter> bf;
+    auto st = BloomFilter::create(CUCKOO_FILTER, &bf);
+    ASSERT_TRUE(st.ok());
+    st = bf->init(64, _fpp, HASH_MURMUR3_X64_64);
+    ASSERT_TRUE(st.ok());
+
+    int num = 100000;
+    for (uint64_t i = 0; i < num; ++i) {
+        bf->add_bytes((char*)&i, sizeof(uint64_t));
+    }
+    for (uint64_t i = 0; i < num; ++i) {
+        ASSERT_TRUE(bf->test_bytes((char*)&i, sizeof(uint64_t)));
+    }
+}
+
+} // namespace starrocks
@@ -106,4 +106,33 @@ TEST_F(ShortKeyIndexTest, buider) {
     }
 }
 
+TEST_F(ShortKeyIndexTest, batch_lower_bound) {
+    ShortKeyIndexBuilder builder(0, 1024);
+    for (int i = 1000; i < 10000; i += 2) {
+        builder.add_item(std::to_string(i));
+    }
+    std::vector<Slice> slices;
+    PageFooterPB footer;
+    ASSERT_TRUE(builder.finalize(9000 * 1024, &slices, &footer).ok());
+
+    std::string buf;
+    for (auto& slice : slices) {
+        buf.append(slice.data, slice.size);
+    }
+
+    ShortKeyIndexDecoder decoder;
+    ASSERT_TRUE(decoder.parse(buf, footer.short_key_page_footer()).ok());
+
+    // unsorted probes with exact hits, misses, a shared prefix, and keys off both ends
+    std::vector<std::string> probe_storage = {"8700", "1499", "0999", "1500", "9999", "87", "5000", "5001"};
+    std::vector<Slice> probes(probe_storage.begin(), probe_storage.end());
+
+    std::vector<uint32_t> ordinals;
+    decoder.batch_lower_bound(probes, &ordinals);
+    ASSERT_EQ(probes.size(), ordinals.size());
+    for (size_t i = 0; i < probes.size(); i++) {
+        ASSERT_EQ(decoder.lower_bound(probes[i]).ordinal(), ordinals[i]) << "probe=" << probe_storage[i];
+    }
+}
+
 } // namespace starrocks
@@ -302,6 +302,42 @@ TEST_F(BitmapValueTest, bitmap_union) {
     check_bitmap(BitmapDataType::BITMAP, bitmap_14, 0, 132);
 }
 
+TEST_F(BitmapValueTest, bitmap_union_many) {
+    const uint64_t high = uint64_t(1) << 32;
+    auto bitmap_1 = gen_bitmap(0, 100);
+    auto bitmap_2 = gen_bitmap(50, 150);
+    auto bitmap_3 = gen_bitmap(high, high + 50);
+    BitmapValue single(uint64_t(200));
+    BitmapValue empty;
+
+    BitmapValue result;
+    result.union_many({&bitmap_1, &bitmap_2, &single, &empty, &bitmap_3, &_medium_bitmap});
+    ASSERT_EQ(result.type(), BitmapDataType::BITMAP);
+    ASSERT_EQ(result.cardinality(), 150 + 1 + 50);
+    for (uint64_t i = 0; i < 150; i++) {
+        ASSERT_TRUE(result.contains(i));
+    }
+    ASSERT_TRUE(result.contains(200));
+    for (uint64_t i = high; i < high + 50; i++) {
+        ASSERT_TRUE(result.contains(i));
+    }
+
+    // inputs stay intact
+    check_bitmap(BitmapDataType::BITMAP, bitmap_1, 0, 100);
+    check_bitmap(BitmapDataType::BITMAP, bitmap_2, 50, 150);
+    check_bitmap(BitmapDataType::SET, _medium_bitmap, 0, 14);
+
+    // with fewer than two full bitmaps everything takes the pairwise path
+    BitmapValue result_2;
+    result_2.union_many({&_medium_bitmap, &single});
+    ASSERT_EQ(result_2.type(), BitmapDataType::SET);
+    ASSERT_EQ(result_2.cardinality(), 15);
+    for (uint64_t i = 0; i < 14; i++) {
+        ASSERT_TRUE(result_2.contains(i));
+    }
+    ASSERT_TRUE(result_2.contains(200));
+}
+
 TEST_F(BitmapValueTest, bitmap_intersect) {
     auto bitmap_1 = gen_bitmap(0, 100);
     bitmap_1 &= _empty_bitmap;
@@ -385,6 +421,28 @@ TEST_F(BitmapValueTest, bitmap_intersect) {
     check_bitmap(BitmapDataType::SET, bitmap_23, 10, 14);
 }
 
+// Intersecting or subtracting a shared bitmap assembles the result directly instead of
+// deep-copying the left operand; make sure operands stay intact across 32-bit key boundaries.
+TEST_F(BitmapValueTest, shared_bitmap_intersect_and_sub) {
+    const uint64_t high = uint64_t(1) << 32;
+    auto lhs = gen_bitmap(0, 100);
+    for (uint64_t i = high; i < high + 100; i++) {
+        lhs.add(i);
+    }
+    auto rhs = gen_bitmap(50, 150);
+
+    BitmapValue intersection(lhs);
+    intersection &= rhs;
+    check_bitmap(BitmapDataType::BITMAP, intersection, 50, 100);
+
+    BitmapValue difference(lhs);
+    difference -= rhs;
+    check_bitmap(BitmapDataType::BITMAP, difference, 0, 50, high, high + 100);
+
+    check_bitmap(BitmapDataType::BITMAP, lhs, 0, 100, high, high + 100);
+    check_bitmap(BitmapDataType::BITMAP, rhs, 50, 150);
+}
+
 TEST_F(BitmapValueTest, test_remove) {
     BitmapValue bitmap_1;
     bitmap_1.remove(1);
@@ -24,6 +24,8 @@
 
 #define ARROW_UTIL_LOGGING_H
 #include <arrow/buffer.h>
+#include <arrow/io/memory.h>
+#include <arrow/ipc/reader.h>
 #include <arrow/json/api.h>
 #include <arrow/result.h>
 
@@ -43,6 +45,7 @@ DIAGNOSTIC_POP
 #include "column/column_helper.h"
 #include "runtime/large_int_value.h"
 #include "storage/tablet_schema_helper.h"
+#include "util/arrow/row_batch.h"
 
 namespace starrocks {
 struct StarRocksColumnToArrowTest : public testing::Test {};
@@ -836,4 +839,27 @@ TEST_F(StarRocksColumnToArrowTest, testNestedArrayStructMap) {
     ASSERT_TRUE(expect_array->Equals(array));
 }
 
+TEST_F(StarRocksColumnToArrowTest, testSerializeRecordBatch) {
+    arrow::Int64Builder builder;
+    ASSERT_OK(builder.AppendValues({1, 2, 3, 4, 5}));
+    std::shared_ptr<arrow::Array> array;
+    ASSERT_OK(builder.Finish(&array));
+    auto schema = arrow::schema({arrow::field("col", arrow::int64(), false)});
+    auto record_batch = arrow::RecordBatch::Make(schema, array->length(), {array});
+
+    std::string serialized;
+    ASSERT_TRUE(serialize_record_batch(*record_batch, &serialized).ok());
+    ASSERT_FALSE(serialized.empty());
+
+    // the serialized stream should round-trip through the arrow ipc reader.
+    auto buffer = arrow::Buffer::FromString(serialized);
+    auto buffer_reader = std::make_shared<arrow::io::BufferReader>(buffer);
+    auto reader_res = arrow::ipc::RecordBatchStreamReader::Open(buffer_reader);
+    ASSERT_TRUE(reader_res.ok());
+    std::shared_ptr<arrow::RecordBatch> read_batch;
+    ASSERT_OK(reader_res.ValueOrDie()->ReadNext(&read_batch));
+    ASSERT_TRUE(read_batch);
+    ASSERT_TRUE(read_batch->Equals(*record_batch));
+}
+
 } // namespace starrocks
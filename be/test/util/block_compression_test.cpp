@@ -224,6 +224,57 @@ TEST_F(BlockCompressionTest, multi) {
     test_multi_slices(starrocks::CompressionTypePB::GZIP);
 }
 
+TEST_F(BlockCompressionTest, zstd_dictionary) {
+    // many short structured values sharing a common shape, the case a trained dictionary helps
+    std::vector<std::string> samples;
+    std::string sample_buffer;
+    std::vector<size_t> sample_sizes;
+    for (int i = 0; i < 200; i++) {
+        std::string s = "2024-01-01 12:00:00 INFO request id=" + std::to_string(i * 7919) +
+                        " path=/api/v1/query status=200 latency_ms=" + std::to_string(i % 97);
+        sample_buffer.append(s);
+        sample_sizes.push_back(s.size());
+        samples.emplace_back(std::move(s));
+    }
+
+    auto dict = zstd_train_dictionary(sample_buffer, sample_sizes, 16 * 1024);
+    ASSERT_TRUE(dict.ok()) << dict.status();
+    ASSERT_GT(dict->size(), 0);
+
+    auto compressor = new_zstd_dict_compressor(*dict, 3);
+    ASSERT_TRUE(compressor.ok()) << compressor.status();
+    auto decompressor = new_zstd_dict_decompressor(*dict);
+    ASSERT_TRUE(decompressor.ok()) << decompressor.status();
+
+    for (auto& orig : samples) {
+        std::string compressed;
+        compressed.resize((*compressor)->max_compressed_len(orig.size()));
+        Slice compressed_slice(compressed);
+        ASSERT_TRUE((*compressor)->compress(orig, &compressed_slice).ok());
+
+        std::string uncompressed;
+        uncompressed.resize(orig.size());
+        Slice uncompressed_slice(uncompressed);
+        ASSERT_TRUE((*decompressor)->decompress(compressed_slice, &uncompressed_slice).ok());
+        ASSERT_EQ(orig.size(), uncompressed_slice.size);
+        ASSERT_EQ(orig, uncompressed_slice.to_string());
+    }
+
+    // the dict decompressor must also decode frames written without the dictionary
+    const BlockCompressionCodec* plain = nullptr;
+    ASSERT_TRUE(get_block_compression_codec(starrocks::CompressionTypePB::ZSTD, &plain).ok());
+    std::string orig = random_string(1024);
+    std::string compressed;
+    compressed.resize(plain->max_compressed_len(orig.size()));
+    Slice compressed_slice(compressed);
+    ASSERT_TRUE(plain->compress(orig, &compressed_slice).ok());
+    std::string uncompressed;
+    uncompressed.resize(orig.size());
+    Slice uncompressed_slice(uncompressed);
+    ASSERT_TRUE((*decompressor)->decompress(compressed_slice, &uncompressed_slice).ok());
+    ASSERT_EQ(orig, uncompressed_slice.to_string());
+}
+
 TEST_F(BlockCompressionTest, test_issue_10721) {
     std::string str = random_string(1024);
     const BlockCompressionCodec* codec = nullptr;
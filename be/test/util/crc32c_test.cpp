@@ -22,6 +22,7 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <vector>
 
 #include "util/slice.h"
@@ -70,4 +71,36 @@ TEST(CRC, Extend) {
     ASSERT_EQ(Value("hello world", 11), Value(slices));
 }
 
+TEST(CRC, LargeBuffers) {
+    // Buffers past the interleave threshold take the multi-lane path; check it against the
+    // single-chain result around the threshold and for sizes with every possible tail length.
+    std::vector<char> data(1 << 20);
+    uint32_t seed = 0x12345678;
+    for (auto& c : data) {
+        seed = seed * 1103515245 + 12345;
+        c = static_cast<char>(seed >> 16);
+    }
+
+    auto reference = [&](size_t n) {
+        uint32_t crc = 0;
+        // feed small pieces so the reference never leaves the single-chain path.
+        for (size_t i = 0; i < n; i += 512) {
+            crc = Extend(crc, data.data() + i, std::min<size_t>(512, n - i));
+        }
+        return crc;
+    };
+
+    for (size_t size : {3071, 3072, 3073, 4096, 65536, (1 << 20)}) {
+        ASSERT_EQ(reference(size), Value(data.data(), size)) << "size=" << size;
+    }
+    for (size_t tail = 0; tail < 24; tail++) {
+        size_t size = 65536 + tail;
+        ASSERT_EQ(reference(size), Value(data.data(), size)) << "size=" << size;
+    }
+    // extending across an arbitrary split must match the one-shot value.
+    size_t split = 70001;
+    uint32_t crc = Extend(Value(data.data(), split), data.data() + split, data.size() - split);
+    ASSERT_EQ(reference(data.size()), crc);
+}
+
 } // namespace starrocks::crc32c
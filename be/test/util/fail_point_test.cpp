@@ -19,6 +19,8 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+
 namespace starrocks {
 
 TEST(FailPointTest, enable_disable_mode) {
@@ -81,6 +83,53 @@ TEST(FailPointTest, scoped_fail_point) {
     ASSERT_FALSE(sfp.shouldFail());
 }
 
+TEST(FailPointTest, performance_injection_params) {
+    failpoint::FailPoint fp("test");
+
+    PFailPointTriggerMode trigger_mode;
+    trigger_mode.set_mode(FailPointTriggerModeType::ENABLE);
+    trigger_mode.set_delay_ms(50);
+    trigger_mode.set_bytes_per_second(1024);
+    fp.setMode(trigger_mode);
+    ASSERT_EQ(50, fp.delay_ms());
+    ASSERT_EQ(1024, fp.bytes_per_second());
+
+    PFailPointTriggerMode disable_mode;
+    disable_mode.set_mode(FailPointTriggerModeType::DISABLE);
+    fp.setMode(disable_mode);
+    ASSERT_EQ(0, fp.delay_ms());
+    ASSERT_EQ(0, fp.bytes_per_second());
+}
+
+TEST(FailPointTest, latency_injection) {
+    DEFINE_FAIL_POINT(fp_latency_test);
+
+    PFailPointTriggerMode trigger_mode;
+    trigger_mode.set_mode(FailPointTriggerModeType::ENABLE);
+    trigger_mode.set_delay_ms(20);
+    fpfp_latency_test.setMode(trigger_mode);
+
+    auto start = std::chrono::steady_clock::now();
+    FAIL_POINT_TRIGGER_SLEEP(fp_latency_test);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_GE(elapsed.count(), 20);
+}
+
+TEST(FailPointTest, bandwidth_throttle_injection) {
+    DEFINE_FAIL_POINT(fp_throttle_test);
+
+    PFailPointTriggerMode trigger_mode;
+    trigger_mode.set_mode(FailPointTriggerModeType::ENABLE);
+    // 1000 bytes/s, so transferring 100 bytes should take at least 100ms
+    trigger_mode.set_bytes_per_second(1000);
+    fpfp_throttle_test.setMode(trigger_mode);
+
+    auto start = std::chrono::steady_clock::now();
+    FAIL_POINT_TRIGGER_THROTTLE(fp_throttle_test, 100);
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    ASSERT_GE(elapsed.count(), 100);
+}
+
 TEST(FailPointTest, fp_demo) {
     DEFINE_FAIL_POINT(fp_test);
 
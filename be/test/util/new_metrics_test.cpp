@@ -18,7 +18,9 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <limits>
 #include <thread>
+#include <vector>
 
 #include "common/config.h"
 #include "util/logging.h"
@@ -151,6 +153,60 @@ TEST_F(MetricsTest, CounterPerf) {
     }
 }
 
+TEST_F(MetricsTest, Histogram) {
+    {
+        HistogramMetric histogram(MetricUnit::MICROSECONDS);
+        ASSERT_EQ(0, histogram.count());
+        ASSERT_EQ(0, histogram.sum());
+        ASSERT_EQ(0, histogram.quantile(0.5));
+
+        // values below kSubBucketCount are recorded exactly
+        for (int64_t v = 1; v <= 10; v++) {
+            histogram.observe(v);
+        }
+        ASSERT_EQ(10, histogram.count());
+        ASSERT_EQ(55, histogram.sum());
+        ASSERT_EQ(1, histogram.quantile(0.0));
+        ASSERT_EQ(5, histogram.quantile(0.5));
+        ASSERT_EQ(9, histogram.quantile(0.9));
+        ASSERT_EQ(10, histogram.quantile(1.0));
+
+        ASSERT_STREQ("count: 10, sum: 55, p50: 5, p90: 9, p99: 10, p999: 10", histogram.to_string().c_str());
+    }
+    {
+        // large values keep the log-linear relative error bound
+        HistogramMetric histogram(MetricUnit::MICROSECONDS);
+        const int64_t value = 123456789;
+        histogram.observe(value);
+        int64_t p100 = histogram.quantile(1.0);
+        ASSERT_GE(p100, value);
+        ASSERT_LE(p100 - value, value * 2 / HistogramMetric::kSubBucketCount);
+
+        histogram.observe(std::numeric_limits<int64_t>::max());
+        histogram.observe(-1);
+        ASSERT_EQ(3, histogram.count());
+        ASSERT_EQ(0, histogram.quantile(0.0));
+    }
+    {
+        // concurrent observes lose no sample
+        HistogramMetric histogram(MetricUnit::MICROSECONDS);
+        std::vector<std::thread> threads;
+        threads.reserve(4);
+        for (int i = 0; i < 4; i++) {
+            threads.emplace_back([&histogram] {
+                for (int j = 0; j < 10000; j++) {
+                    histogram.observe(j);
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        ASSERT_EQ(40000, histogram.count());
+        ASSERT_EQ(4LL * 10000 * 9999 / 2, histogram.sum());
+    }
+}
+
 TEST_F(MetricsTest, Gauge) {
     // IntGauge
     {
@@ -50,6 +50,11 @@ public class JDBCScanner {
     private ResultSetMetaData resultSetMetaData;
     private List<String> resultColumnClassNames;
     private List<Object[]> resultChunk;
+    // for columns whose values fit a java primitive, rows are accumulated in a primitive array
+    // plus a null-indicator array instead of a boxed Object[], so the C++ side can copy the
+    // whole batch with a single critical-array access per column.
+    private byte[][] primitiveNulls;
+    private Object[] primitiveData;
     private int resultNumRows = 0;
     ClassLoader classLoader;
 
@@ -95,10 +100,17 @@ public class JDBCScanner {
         resultSetMetaData = resultSet.getMetaData();
         resultColumnClassNames = new ArrayList<>(resultSetMetaData.getColumnCount());
         resultChunk = new ArrayList<>(resultSetMetaData.getColumnCount());
+        primitiveNulls = new byte[resultSetMetaData.getColumnCount()][];
+        primitiveData = new Object[resultSetMetaData.getColumnCount()];
         for (int i = 1; i <= resultSetMetaData.getColumnCount(); i++) {
             resultColumnClassNames.add(resultSetMetaData.getColumnClassName(i));
             Class<?> clazz = classLoader.loadClass(resultSetMetaData.getColumnClassName(i));
-            if (isGeneralJDBCClassType(clazz)) {
+            Class<?> primitiveType = PRIMITIVE_ARRAY_TYPE_MAPPING.get(clazz);
+            if (primitiveType != null) {
+                primitiveNulls[i - 1] = new byte[scanContext.getStatementFetchSize()];
+                primitiveData[i - 1] = Array.newInstance(primitiveType, scanContext.getStatementFetchSize());
+                resultChunk.add(null);
+            } else if (isGeneralJDBCClassType(clazz)) {
                 resultChunk.add((Object[]) Array.newInstance(clazz, scanContext.getStatementFetchSize()));
             } else if (null != mapEngineSpecificClassType(clazz)) {
                 Class targetClass = mapEngineSpecificClassType(clazz);
@@ -109,6 +121,18 @@ public class JDBCScanner {
         }
     }
 
+    // boxed classes whose values are shipped through primitive arrays; must stay consistent
+    // with the class names the C++ JDBCScanner treats as primitive interchange columns
+    private static final Map<Class<?>, Class<?>> PRIMITIVE_ARRAY_TYPE_MAPPING = new HashMap<Class<?>, Class<?>>() {{
+            put(Boolean.class, boolean.class);
+            put(Byte.class, byte.class);
+            put(Short.class, short.class);
+            put(Integer.class, int.class);
+            put(Long.class, long.class);
+            put(Float.class, float.class);
+            put(Double.class, double.class);
+        }};
+
     private static final Set<Class<?>> GENERAL_JDBC_CLASS_SET = new HashSet<>(
             Arrays.asList(Boolean.class, Byte.class, Short.class, Integer.class, Long.class, Float.class, Double.class,
                     BigInteger.class, BigDecimal.class, java.sql.Date.class, Timestamp.class, LocalDate.class,
@@ -146,6 +170,10 @@ public class JDBCScanner {
         resultNumRows = 0;
         do {
             for (int i = 0; i < columnCount; i++) {
+                if (primitiveData[i] != null) {
+                    fillPrimitiveValue(i, resultNumRows);
+                    continue;
+                }
                 Object[] dataColumn = resultChunk.get(i);
                 Object resultObject = resultSet.getObject(i + 1);
                 // in some cases, the real java class type of result is not consistent with the type from
@@ -185,6 +213,59 @@ public class JDBCScanner {
         return resultChunk;
     }
 
+    // fill one value through the type-specific ResultSet getter, which avoids boxing and the
+    // per-value unboxing on the native side
+    private void fillPrimitiveValue(int columnIndex, int rowIndex) throws Exception {
+        Object dataColumn = primitiveData[columnIndex];
+        byte[] nulls = primitiveNulls[columnIndex];
+        if (dataColumn instanceof int[]) {
+            int value = resultSet.getInt(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((int[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else if (dataColumn instanceof long[]) {
+            long value = resultSet.getLong(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((long[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else if (dataColumn instanceof double[]) {
+            double value = resultSet.getDouble(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((double[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else if (dataColumn instanceof float[]) {
+            float value = resultSet.getFloat(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((float[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else if (dataColumn instanceof short[]) {
+            short value = resultSet.getShort(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((short[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else if (dataColumn instanceof byte[]) {
+            byte value = resultSet.getByte(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((byte[]) dataColumn)[rowIndex] = isNull ? 0 : value;
+        } else {
+            boolean value = resultSet.getBoolean(columnIndex + 1);
+            boolean isNull = resultSet.wasNull();
+            nulls[rowIndex] = (byte) (isNull ? 1 : 0);
+            ((boolean[]) dataColumn)[rowIndex] = !isNull && value;
+        }
+    }
+
+    // used for cpp interface
+    public byte[] getColumnNulls(int index) {
+        return primitiveNulls[index];
+    }
+
+    // used for cpp interface
+    public Object getColumnData(int index) {
+        return primitiveData[index];
+    }
+
     public int getResultNumRows() {
         return resultNumRows;
     }